@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Templates/Less.h"
+
+/**
+ * Binary searches over sorted ranges, such as TArray and TInlineArray: anything with GetData() and GetSize().
+ * The range must be sorted with the same predicate as the search. All searches are O(log n).
+ */
+namespace Algo
+{
+	/**
+	 * Finds the first element that doesn't come before a value.
+	 *
+	 * @param InRange: Sorted range.
+	 * @param InValue: Value to compare elements with.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 * @returns: Index of the element, or the size of the range if every element comes before InValue.
+	 */
+	template<typename RangeType, typename ValueType, typename PredicateType>
+	int32 LowerBound(const RangeType& InRange, const ValueType& InValue, const PredicateType& InPredicate)
+	{
+		const auto* Data = InRange.GetData();
+		int32 FirstIndex = 0;
+		int32 Num = InRange.GetSize();
+		while (Num > 0)
+		{
+			const int32 HalfNum = Num / 2;
+			if (InPredicate(Data[FirstIndex + HalfNum], InValue))
+			{
+				FirstIndex += HalfNum + 1;
+				Num -= HalfNum + 1;
+			}
+			else
+			{
+				Num = HalfNum;
+			}
+		}
+		return FirstIndex;
+	}
+
+	template<typename RangeType, typename ValueType>
+	int32 LowerBound(const RangeType& InRange, const ValueType& InValue)
+	{
+		return LowerBound(InRange, InValue, TLess<>());
+	}
+
+	/**
+	 * Finds the first element that comes after a value.
+	 *
+	 * @param InRange: Sorted range.
+	 * @param InValue: Value to compare elements with.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 * @returns: Index of the element, or the size of the range if no element comes after InValue.
+	 */
+	template<typename RangeType, typename ValueType, typename PredicateType>
+	int32 UpperBound(const RangeType& InRange, const ValueType& InValue, const PredicateType& InPredicate)
+	{
+		const auto* Data = InRange.GetData();
+		int32 FirstIndex = 0;
+		int32 Num = InRange.GetSize();
+		while (Num > 0)
+		{
+			const int32 HalfNum = Num / 2;
+			if (!InPredicate(InValue, Data[FirstIndex + HalfNum]))
+			{
+				FirstIndex += HalfNum + 1;
+				Num -= HalfNum + 1;
+			}
+			else
+			{
+				Num = HalfNum;
+			}
+		}
+		return FirstIndex;
+	}
+
+	template<typename RangeType, typename ValueType>
+	int32 UpperBound(const RangeType& InRange, const ValueType& InValue)
+	{
+		return UpperBound(InRange, InValue, TLess<>());
+	}
+
+	/**
+	 * Finds an element equal to a value, where equal means that neither comes before the other.
+	 *
+	 * @param InRange: Sorted range.
+	 * @param InValue: Value to find.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 * @returns: Index of the first equal element, or InvalidIndex if there is none.
+	 */
+	template<typename RangeType, typename ValueType, typename PredicateType>
+	int32 BinarySearch(const RangeType& InRange, const ValueType& InValue, const PredicateType& InPredicate)
+	{
+		const int32 Index = LowerBound(InRange, InValue, InPredicate);
+		return (Index < InRange.GetSize() && !InPredicate(InValue, InRange.GetData()[Index])) ? Index : InvalidIndex;
+	}
+
+	template<typename RangeType, typename ValueType>
+	int32 BinarySearch(const RangeType& InRange, const ValueType& InValue)
+	{
+		return BinarySearch(InRange, InValue, TLess<>());
+	}
+}
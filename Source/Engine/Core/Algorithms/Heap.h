@@ -0,0 +1,206 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Containers/Array.h"
+#include "Templates/Less.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+/**
+ * Binary heaps stored in arrays, following Unreal's convention: the top of the heap, at index 0, is the element
+ * that comes first in the predicate's order, so with the default TLess it is the smallest element.
+ * Heaps are priority queues: pushing and popping are O(log n), and the top is always at index 0.
+ */
+namespace Algo
+{
+	namespace Private
+	{
+		// Moves an element down until none of its children come before it.
+		template<typename ElementType, typename PredicateType>
+		void HeapSiftDown(ElementType* InData, int32 InIndex, int32 InNum, const PredicateType& InPredicate)
+		{
+			while (true)
+			{
+				const int32 LeftChildIndex = InIndex * 2 + 1;
+				if (LeftChildIndex >= InNum)
+				{
+					return;
+				}
+
+				// Pick the child that comes first.
+				const int32 RightChildIndex = LeftChildIndex + 1;
+				const int32 ChildIndex = (RightChildIndex < InNum && InPredicate(InData[RightChildIndex], InData[LeftChildIndex])) ? RightChildIndex : LeftChildIndex;
+				if (!InPredicate(InData[ChildIndex], InData[InIndex]))
+				{
+					return;
+				}
+				Swap(InData[InIndex], InData[ChildIndex]);
+				InIndex = ChildIndex;
+			}
+		}
+
+		// Moves an element up until its parent comes before it.
+		template<typename ElementType, typename PredicateType>
+		void HeapSiftUp(ElementType* InData, int32 InIndex, const PredicateType& InPredicate)
+		{
+			while (InIndex > 0)
+			{
+				const int32 ParentIndex = (InIndex - 1) / 2;
+				if (!InPredicate(InData[InIndex], InData[ParentIndex]))
+				{
+					return;
+				}
+				Swap(InData[InIndex], InData[ParentIndex]);
+				InIndex = ParentIndex;
+			}
+		}
+
+		template<typename ElementType, typename PredicateType>
+		void Heapify(ElementType* InData, int32 InNum, const PredicateType& InPredicate)
+		{
+			// Leaves are heaps already, so start from the last parent.
+			for (int32 Index = InNum / 2 - 1; Index >= 0; --Index)
+			{
+				HeapSiftDown(InData, Index, InNum, InPredicate);
+			}
+		}
+
+		template<typename ElementType, typename PredicateType>
+		void HeapSort(ElementType* InData, int32 InNum, const PredicateType& InPredicate)
+		{
+			// Build the heap in reverse order, so that the last element comes out first and goes to the back.
+			auto ReversePredicate = [&InPredicate](const ElementType& InA, const ElementType& InB)
+			{
+				return InPredicate(InB, InA);
+			};
+			Heapify(InData, InNum, ReversePredicate);
+			for (int32 Num = InNum - 1; Num > 0; --Num)
+			{
+				Swap(InData[0], InData[Num]);
+				HeapSiftDown(InData, 0, Num, ReversePredicate);
+			}
+		}
+	}
+
+	/**
+	 * Reorders a range into a heap, in O(n).
+	 *
+	 * @param InOutRange: Range with GetData() and GetSize(), such as a TArray.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename RangeType, typename PredicateType>
+	void Heapify(RangeType& InOutRange, const PredicateType& InPredicate)
+	{
+		Private::Heapify(InOutRange.GetData(), InOutRange.GetSize(), InPredicate);
+	}
+
+	template<typename RangeType>
+	void Heapify(RangeType& InOutRange)
+	{
+		Heapify(InOutRange, TLess<>());
+	}
+
+	/**
+	 * Adds an element to a heap.
+	 *
+	 * @param InOutHeap: Array that is a heap for InPredicate.
+	 * @param InElement: Element to add.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename ElementType, typename PredicateType>
+	void HeapPush(TArray<ElementType>& InOutHeap, const ElementType& InElement, const PredicateType& InPredicate)
+	{
+		InOutHeap.Add(InElement);
+		Private::HeapSiftUp(InOutHeap.GetData(), InOutHeap.GetSize() - 1, InPredicate);
+	}
+
+	template<typename ElementType, typename PredicateType>
+	void HeapPush(TArray<ElementType>& InOutHeap, ElementType&& InElement, const PredicateType& InPredicate)
+	{
+		InOutHeap.Add(MoveTemp(InElement));
+		Private::HeapSiftUp(InOutHeap.GetData(), InOutHeap.GetSize() - 1, InPredicate);
+	}
+
+	template<typename ElementType>
+	void HeapPush(TArray<ElementType>& InOutHeap, const ElementType& InElement)
+	{
+		HeapPush(InOutHeap, InElement, TLess<>());
+	}
+
+	template<typename ElementType>
+	void HeapPush(TArray<ElementType>& InOutHeap, ElementType&& InElement)
+	{
+		HeapPush(InOutHeap, MoveTemp(InElement), TLess<>());
+	}
+
+	/**
+	 * Removes the top element of a heap. The heap must not be empty.
+	 *
+	 * @param InOutHeap: Array that is a heap for InPredicate.
+	 * @param OutElement: Receives the removed element.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename ElementType, typename PredicateType>
+	void HeapPop(TArray<ElementType>& InOutHeap, ElementType& OutElement, const PredicateType& InPredicate)
+	{
+		ensure(!InOutHeap.IsEmpty());
+		const int32 LastIndex = InOutHeap.GetSize() - 1;
+		OutElement = MoveTemp(InOutHeap[0]);
+		if (LastIndex > 0)
+		{
+			InOutHeap[0] = MoveTemp(InOutHeap[LastIndex]);
+		}
+		InOutHeap.RemoveAt(LastIndex);
+		Private::HeapSiftDown(InOutHeap.GetData(), 0, InOutHeap.GetSize(), InPredicate);
+	}
+
+	template<typename ElementType>
+	void HeapPop(TArray<ElementType>& InOutHeap, ElementType& OutElement)
+	{
+		HeapPop(InOutHeap, OutElement, TLess<>());
+	}
+
+	/**
+	 * Checks whether a range is a heap.
+	 *
+	 * @param InRange: Range with GetData() and GetSize(), such as a TArray.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 * @returns: true if no element comes before its parent, false otherwise.
+	 */
+	template<typename RangeType, typename PredicateType>
+	bool IsHeap(const RangeType& InRange, const PredicateType& InPredicate)
+	{
+		const auto* Data = InRange.GetData();
+		for (int32 Index = 1; Index < InRange.GetSize(); ++Index)
+		{
+			if (InPredicate(Data[Index], Data[(Index - 1) / 2]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename RangeType>
+	bool IsHeap(const RangeType& InRange)
+	{
+		return IsHeap(InRange, TLess<>());
+	}
+
+	/**
+	 * Sorts a range with heap sort: O(n log n) in every case, without extra memory, but slower than Sort on average.
+	 *
+	 * @param InOutRange: Range with GetData() and GetSize(), such as a TArray.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename RangeType, typename PredicateType>
+	void HeapSort(RangeType& InOutRange, const PredicateType& InPredicate)
+	{
+		Private::HeapSort(InOutRange.GetData(), InOutRange.GetSize(), InPredicate);
+	}
+
+	template<typename RangeType>
+	void HeapSort(RangeType& InOutRange)
+	{
+		HeapSort(InOutRange, TLess<>());
+	}
+}
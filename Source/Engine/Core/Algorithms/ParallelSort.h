@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Algorithms/Sort.h"
+#include "Containers/Array.h"
+#include "Math/MathUtilities.h"
+
+// System includes for threads.
+#include <thread>
+
+namespace Algo
+{
+	namespace Private
+	{
+		// Chunks smaller than this are sorted faster on one thread than it takes to start another.
+		static constexpr int32 ParallelSortMinChunkSize = 16 * 1024;
+
+		// Runs InTask(TaskIndex) for every task, the first on the calling thread and the others on threads of their own.
+		template<typename TaskType>
+		void RunTasksConcurrently(int32 InNumTasks, const TaskType& InTask)
+		{
+			TArray<std::thread> Threads(InNumTasks);
+			for (int32 TaskIndex = 1; TaskIndex < InNumTasks; ++TaskIndex)
+			{
+				Threads.Emplace([&InTask, TaskIndex]()
+				{
+					InTask(TaskIndex);
+				});
+			}
+			InTask(0);
+			for (std::thread& Thread : Threads)
+			{
+				Thread.join();
+			}
+		}
+	}
+
+	/**
+	 * Sorts a range on several threads. The range is split into one chunk per thread, the chunks are sorted
+	 * with Sort concurrently, then adjacent chunks are merged pairwise, with the merges of each round
+	 * running concurrently too. Not stable.
+	 *
+	 * Ranges too small to be worth starting threads for are sorted with Sort on the calling thread.
+	 *
+	 * @param InOutRange: Range to sort.
+	 * @param InPredicate: Returns true if its first argument comes before its second one. Called from several threads at once.
+	 * @param InMaxNumThreads: Maximum number of threads, including the calling thread, or 0 to use one per hardware thread.
+	 */
+	template<typename RangeType, typename PredicateType>
+	void ParallelSort(RangeType& InOutRange, const PredicateType& InPredicate, int32 InMaxNumThreads = 0)
+	{
+		using ElementType = typename TRemoveReference<decltype(*InOutRange.GetData())>::Type;
+
+		ElementType* Data = InOutRange.GetData();
+		const int32 Num = InOutRange.GetSize();
+		const int32 MaxNumThreads = InMaxNumThreads > 0 ? InMaxNumThreads : static_cast<int32>(std::thread::hardware_concurrency());
+		const int32 NumChunks = FMath::Min(MaxNumThreads, Num / Private::ParallelSortMinChunkSize);
+		if (NumChunks <= 1)
+		{
+			Private::Sort(Data, Num, InPredicate);
+			return;
+		}
+
+		// Chunk boundaries, with one past the end so that chunk ChunkIndex is [ChunkStarts[ChunkIndex], ChunkStarts[ChunkIndex + 1]).
+		TArray<int32> ChunkStarts(NumChunks + 1);
+		for (int32 ChunkIndex = 0; ChunkIndex <= NumChunks; ++ChunkIndex)
+		{
+			ChunkStarts.Add(static_cast<int32>(static_cast<int64>(Num) * ChunkIndex / NumChunks));
+		}
+
+		Private::RunTasksConcurrently(NumChunks, [&](int32 InChunkIndex)
+		{
+			Private::Sort(Data + ChunkStarts[InChunkIndex], ChunkStarts[InChunkIndex + 1] - ChunkStarts[InChunkIndex], InPredicate);
+		});
+
+		// Each round merges pairs of sorted runs of NumRunChunks chunks into runs twice as long.
+		for (int32 NumRunChunks = 1; NumRunChunks < NumChunks; NumRunChunks *= 2)
+		{
+			const int32 NumMerges = (NumChunks - NumRunChunks + 2 * NumRunChunks - 1) / (2 * NumRunChunks);
+			Private::RunTasksConcurrently(NumMerges, [&](int32 InMergeIndex)
+			{
+				const int32 FirstChunkIndex = InMergeIndex * 2 * NumRunChunks;
+				const int32 MiddleChunkIndex = FirstChunkIndex + NumRunChunks;
+				const int32 EndChunkIndex = FMath::Min(MiddleChunkIndex + NumRunChunks, NumChunks);
+				const int32 Start = ChunkStarts[FirstChunkIndex];
+
+				TArray<ElementType> Buffer;
+				Private::Merge(Data + Start, ChunkStarts[MiddleChunkIndex] - Start, ChunkStarts[EndChunkIndex] - Start, InPredicate, Buffer);
+			});
+		}
+	}
+
+	template<typename RangeType>
+	void ParallelSort(RangeType& InOutRange)
+	{
+		ParallelSort(InOutRange, TLess<>());
+	}
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Algorithms/Sort.h"
+#include "Containers/Array.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
+
+// System includes for memcpy and memset.
+#include <cstring>
+
+namespace Algo
+{
+	namespace Private
+	{
+		// Maps keys to unsigned integers whose order is the same as the keys'.
+		inline uint32 ToRadixKey(uint32 InKey)
+		{
+			return InKey;
+		}
+
+		inline uint32 ToRadixKey(int32 InKey)
+		{
+			// Flip the sign bit, so that negative keys come first.
+			return static_cast<uint32>(InKey) ^ 0x80000000u;
+		}
+
+		inline uint32 ToRadixKey(float InKey)
+		{
+			uint32 Bits;
+			memcpy(&Bits, &InKey, sizeof(Bits));
+			// Negative floats grow more negative as their bits grow, so flip all their bits. Flip only the sign of the others.
+			return Bits ^ ((Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+		}
+
+		inline uint64 ToRadixKey(uint64 InKey)
+		{
+			return InKey;
+		}
+
+		inline uint64 ToRadixKey(int64 InKey)
+		{
+			return static_cast<uint64>(InKey) ^ (1ull << 63);
+		}
+	}
+
+	/**
+	 * Sorts a range by integer or float keys with a least significant digit radix sort: one counting sort
+	 * per byte of the key, from the lowest byte to the highest. O(n) for a given key size and stable, which
+	 * makes it faster than comparison sorts on large ranges, such as render keys or depths.
+	 *
+	 * Elements are moved with memcpy between the range and a temporary buffer, so they must be trivially
+	 * relocatable. Bytes that are the same for every key are skipped.
+	 *
+	 * @param InOutRange: Range to sort, such as a TArray.
+	 * @param InKeyProjection: Returns the key of an element, as an int32, uint32, float, int64 or uint64.
+	 *                         Floats must not be NaN.
+	 */
+	template<typename RangeType, typename KeyProjectionType>
+	void RadixSort(RangeType& InOutRange, const KeyProjectionType& InKeyProjection)
+	{
+		using ElementType = typename TRemoveReference<decltype(*InOutRange.GetData())>::Type;
+		using RadixKeyType = decltype(Private::ToRadixKey(InKeyProjection(DeclVal<const ElementType&>())));
+		static_assert(TIsTriviallyRelocatable<ElementType>::Value, "RadixSort moves elements with memcpy.");
+
+		static constexpr int32 NumDigitValues = 256;
+		static constexpr int32 NumPasses = sizeof(RadixKeyType);
+
+		ElementType* Data = InOutRange.GetData();
+		const int32 Num = InOutRange.GetSize();
+		auto GetRadixKey = [&InKeyProjection](const ElementType& InElement)
+		{
+			return Private::ToRadixKey(InKeyProjection(InElement));
+		};
+
+		if (Num <= Private::InsertionSortThreshold)
+		{
+			Private::InsertionSort(Data, Num, [&GetRadixKey](const ElementType& InA, const ElementType& InB)
+			{
+				return GetRadixKey(InA) < GetRadixKey(InB);
+			});
+			return;
+		}
+
+		// Count the digits of every pass up front, in a single read of the keys.
+		int32 DigitCounts[NumPasses][NumDigitValues];
+		memset(DigitCounts, 0, sizeof(DigitCounts));
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			RadixKeyType Key = GetRadixKey(Data[Index]);
+			for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+			{
+				++DigitCounts[Pass][Key & 0xFF];
+				Key >>= 8;
+			}
+		}
+
+		IAllocator& Allocator = FDefaultArrayAllocator::GetDefaultAllocator();
+		ElementType* Buffer = static_cast<ElementType*>(Allocator.Allocate(sizeof(ElementType) * Num));
+		ensure(Buffer);
+
+		ElementType* Source = Data;
+		ElementType* Destination = Buffer;
+		const RadixKeyType FirstKey = GetRadixKey(Data[0]);
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * 8;
+			int32* Counts = DigitCounts[Pass];
+			// A pass where every key has the same digit wouldn't move anything.
+			if (Counts[(FirstKey >> Shift) & 0xFF] == Num)
+			{
+				continue;
+			}
+
+			// Turn the counts into the index of the first element with each digit.
+			int32 Offset = 0;
+			for (int32 Digit = 0; Digit < NumDigitValues; ++Digit)
+			{
+				const int32 Count = Counts[Digit];
+				Counts[Digit] = Offset;
+				Offset += Count;
+			}
+
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				const int32 Digit = static_cast<int32>((GetRadixKey(Source[Index]) >> Shift) & 0xFF);
+				memcpy(&Destination[Counts[Digit]++], &Source[Index], sizeof(ElementType));
+			}
+			Swap(Source, Destination);
+		}
+
+		if (Source != Data)
+		{
+			memcpy(Data, Source, sizeof(ElementType) * Num);
+		}
+		Allocator.Deallocate(Buffer);
+	}
+
+	// Sorts a range of int32, uint32, float, int64 or uint64 with RadixSort.
+	template<typename RangeType>
+	void RadixSort(RangeType& InOutRange)
+	{
+		using ElementType = typename TRemoveReference<decltype(*InOutRange.GetData())>::Type;
+		RadixSort(InOutRange, [](const ElementType& InElement)
+		{
+			return InElement;
+		});
+	}
+}
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Algorithms/Heap.h"
+#include "Containers/Array.h"
+#include "Math/MathUtilities.h"
+#include "Templates/Less.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+/**
+ * Sorting algorithms over ranges, such as TArray and TInlineArray: anything with GetData() and GetSize().
+ *
+ * Predicates take two elements and return true if the first one comes before the second one.
+ * They default to TLess, which sorts in increasing order with operator<.
+ */
+namespace Algo
+{
+	namespace Private
+	{
+		// Below this size, insertion sort beats the recursion of the other sorts.
+		static constexpr int32 InsertionSortThreshold = 16;
+
+		// Stable, and O(n) on ranges that are almost sorted.
+		template<typename ElementType, typename PredicateType>
+		void InsertionSort(ElementType* InData, int32 InNum, const PredicateType& InPredicate)
+		{
+			for (int32 Index = 1; Index < InNum; ++Index)
+			{
+				if (!InPredicate(InData[Index], InData[Index - 1]))
+				{
+					continue;
+				}
+
+				ElementType Element = MoveTemp(InData[Index]);
+				int32 HoleIndex = Index;
+				do
+				{
+					InData[HoleIndex] = MoveTemp(InData[HoleIndex - 1]);
+					--HoleIndex;
+				}
+				while (HoleIndex > 0 && InPredicate(Element, InData[HoleIndex - 1]));
+				InData[HoleIndex] = MoveTemp(Element);
+			}
+		}
+
+		// Quick sort that switches to heap sort after InDepthLimit levels of bad pivots, and to insertion sort on small ranges.
+		template<typename ElementType, typename PredicateType>
+		void IntroSort(ElementType* InData, int32 InNum, const PredicateType& InPredicate, int32 InDepthLimit)
+		{
+			while (InNum > InsertionSortThreshold)
+			{
+				if (InDepthLimit-- == 0)
+				{
+					HeapSort(InData, InNum, InPredicate);
+					return;
+				}
+
+				// Order the first, middle and last elements, and use the median as the pivot. The first and last
+				// elements then stop the partition loops without bounds checks.
+				const int32 MiddleIndex = InNum / 2;
+				const int32 LastIndex = InNum - 1;
+				if (InPredicate(InData[MiddleIndex], InData[0]))
+				{
+					Swap(InData[MiddleIndex], InData[0]);
+				}
+				if (InPredicate(InData[LastIndex], InData[MiddleIndex]))
+				{
+					Swap(InData[LastIndex], InData[MiddleIndex]);
+					if (InPredicate(InData[MiddleIndex], InData[0]))
+					{
+						Swap(InData[MiddleIndex], InData[0]);
+					}
+				}
+				Swap(InData[MiddleIndex], InData[1]);
+
+				// Partition around the pivot at index 1. Both loops stop on elements equal to the pivot,
+				// which keeps ranges of equal elements balanced.
+				int32 LeftIndex = 1;
+				int32 RightIndex = LastIndex;
+				while (true)
+				{
+					do
+					{
+						++LeftIndex;
+					}
+					while (InPredicate(InData[LeftIndex], InData[1]));
+					do
+					{
+						--RightIndex;
+					}
+					while (InPredicate(InData[1], InData[RightIndex]));
+
+					if (LeftIndex >= RightIndex)
+					{
+						break;
+					}
+					Swap(InData[LeftIndex], InData[RightIndex]);
+				}
+				Swap(InData[1], InData[RightIndex]);
+
+				// Recurse into the smaller side and loop on the larger one, so that the stack depth stays O(log n).
+				const int32 NumLeft = RightIndex;
+				const int32 NumRight = InNum - RightIndex - 1;
+				if (NumLeft < NumRight)
+				{
+					IntroSort(InData, NumLeft, InPredicate, InDepthLimit);
+					InData += RightIndex + 1;
+					InNum = NumRight;
+				}
+				else
+				{
+					IntroSort(InData + RightIndex + 1, NumRight, InPredicate, InDepthLimit);
+					InNum = NumLeft;
+				}
+			}
+			InsertionSort(InData, InNum, InPredicate);
+		}
+
+		template<typename ElementType, typename PredicateType>
+		void Sort(ElementType* InData, int32 InNum, const PredicateType& InPredicate)
+		{
+			if (InNum > 1)
+			{
+				IntroSort(InData, InNum, InPredicate, 2 * FMath::FloorLog2(static_cast<uint64>(InNum)));
+			}
+		}
+
+		/**
+		 * Merges two adjacent sorted ranges, [0, InNumLeft) and [InNumLeft, InNum). Stable.
+		 * The left range is moved to InOutBuffer, then merged back with the right range from the front.
+		 */
+		template<typename ElementType, typename PredicateType>
+		void Merge(ElementType* InData, int32 InNumLeft, int32 InNum, const PredicateType& InPredicate, TArray<ElementType>& InOutBuffer)
+		{
+			// Nothing to do if the ranges are already in order.
+			if (InNumLeft == 0 || InNumLeft == InNum || !InPredicate(InData[InNumLeft], InData[InNumLeft - 1]))
+			{
+				return;
+			}
+
+			InOutBuffer.Empty();
+			InOutBuffer.Reserve(InNumLeft);
+			for (int32 Index = 0; Index < InNumLeft; ++Index)
+			{
+				InOutBuffer.Add(MoveTemp(InData[Index]));
+			}
+
+			int32 LeftIndex = 0;
+			int32 RightIndex = InNumLeft;
+			int32 OutIndex = 0;
+			// Output never catches up with the right range, since the left range was moved out.
+			while (LeftIndex < InNumLeft && RightIndex < InNum)
+			{
+				// Take from the left range on ties, to keep equal elements in order.
+				if (InPredicate(InData[RightIndex], InOutBuffer[LeftIndex]))
+				{
+					InData[OutIndex++] = MoveTemp(InData[RightIndex++]);
+				}
+				else
+				{
+					InData[OutIndex++] = MoveTemp(InOutBuffer[LeftIndex++]);
+				}
+			}
+			while (LeftIndex < InNumLeft)
+			{
+				InData[OutIndex++] = MoveTemp(InOutBuffer[LeftIndex++]);
+			}
+		}
+
+		template<typename ElementType, typename PredicateType>
+		void MergeSort(ElementType* InData, int32 InNum, const PredicateType& InPredicate, TArray<ElementType>& InOutBuffer)
+		{
+			if (InNum <= InsertionSortThreshold)
+			{
+				InsertionSort(InData, InNum, InPredicate);
+				return;
+			}
+
+			const int32 NumLeft = InNum / 2;
+			MergeSort(InData, NumLeft, InPredicate, InOutBuffer);
+			MergeSort(InData + NumLeft, InNum - NumLeft, InPredicate, InOutBuffer);
+			Merge(InData, NumLeft, InNum, InPredicate, InOutBuffer);
+		}
+	}
+
+	/**
+	 * Sorts a range with introsort: quick sort with a median of three pivot, falling back to heap sort
+	 * if the pivots are bad and to insertion sort on small ranges. O(n log n), in place, and not stable.
+	 *
+	 * @param InOutRange: Range to sort.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename RangeType, typename PredicateType>
+	void Sort(RangeType& InOutRange, const PredicateType& InPredicate)
+	{
+		Private::Sort(InOutRange.GetData(), InOutRange.GetSize(), InPredicate);
+	}
+
+	template<typename RangeType>
+	void Sort(RangeType& InOutRange)
+	{
+		Sort(InOutRange, TLess<>());
+	}
+
+	/**
+	 * Sorts a range with merge sort, keeping equal elements in their original order. O(n log n),
+	 * and moves up to half of the range to a temporary array.
+	 *
+	 * @param InOutRange: Range to sort.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 */
+	template<typename RangeType, typename PredicateType>
+	void StableSort(RangeType& InOutRange, const PredicateType& InPredicate)
+	{
+		using ElementType = typename TRemoveReference<decltype(*InOutRange.GetData())>::Type;
+		TArray<ElementType> Buffer;
+		Private::MergeSort(InOutRange.GetData(), InOutRange.GetSize(), InPredicate, Buffer);
+	}
+
+	template<typename RangeType>
+	void StableSort(RangeType& InOutRange)
+	{
+		StableSort(InOutRange, TLess<>());
+	}
+
+	/**
+	 * Checks whether a range is sorted.
+	 *
+	 * @param InRange: Range to check.
+	 * @param InPredicate: Returns true if its first argument comes before its second one.
+	 * @returns: true if no element comes before the previous one, false otherwise.
+	 */
+	template<typename RangeType, typename PredicateType>
+	bool IsSorted(const RangeType& InRange, const PredicateType& InPredicate)
+	{
+		const auto* Data = InRange.GetData();
+		for (int32 Index = 1; Index < InRange.GetSize(); ++Index)
+		{
+			if (InPredicate(Data[Index], Data[Index - 1]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename RangeType>
+	bool IsSorted(const RangeType& InRange)
+	{
+		return IsSorted(InRange, TLess<>());
+	}
+
+	/**
+	 * Moves the elements that match a predicate before the ones that don't. O(n), and not stable.
+	 *
+	 * @param InOutRange: Range to partition.
+	 * @param InPredicate: Takes an element and returns true if it belongs to the first partition.
+	 * @returns: Number of elements that match the predicate, which is also the index of the second partition.
+	 */
+	template<typename RangeType, typename PredicateType>
+	int32 Partition(RangeType& InOutRange, const PredicateType& InPredicate)
+	{
+		auto* Data = InOutRange.GetData();
+		int32 LeftIndex = 0;
+		int32 RightIndex = InOutRange.GetSize();
+		while (true)
+		{
+			while (LeftIndex < RightIndex && InPredicate(Data[LeftIndex]))
+			{
+				++LeftIndex;
+			}
+			while (LeftIndex < RightIndex && !InPredicate(Data[RightIndex - 1]))
+			{
+				--RightIndex;
+			}
+			if (LeftIndex == RightIndex)
+			{
+				return LeftIndex;
+			}
+			Swap(Data[LeftIndex++], Data[--RightIndex]);
+		}
+	}
+}
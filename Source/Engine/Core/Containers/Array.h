@@ -3,8 +3,11 @@
 #include "CoreGlobals.h"
 #include "AssertionMacros.h"
 #include "Memory/NewDeleteAllocator.h"
+#include "Templates/TemplateFunctionLibrary.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
 
-// System include for placement new.
+// System includes for placement new and memcpy.
+#include <cstring>
 #include <new>
 
 using FDefaultArrayAllocator = FNewDeleteAllocator;
@@ -67,16 +70,18 @@ public:
 	 * @returns: Index of the array that the element was added at.
 	 */
 	int32 Add(const ElementType& InElement);
+	int32 Add(ElementType&& InElement);
 	
 	/**
 	 * Constructs an element at the back of the array using the input arguments.
-	 * Can cause array reallocation.
+	 * Can cause array reallocation. The arguments are forwarded to the element's constructor,
+	 * and may refer to elements of the array.
 	 *
 	 * @param InArgs: Arguments used to constructor the new element.
 	 * @returns: Index of the array that the element was constructed in.
 	 */
-	template<typename... Args>
-	int32 Emplace(Args... InArgs);
+	template<typename... ArgTypes>
+	int32 Emplace(ArgTypes&&... InArgs);
 
 	/**
 	 * Copies all elements of the source array to the back of the target array.
@@ -265,6 +270,17 @@ public:
 	 */
 	TArray<ElementType> operator+(const TArray<ElementType>& InArray) const;
 
+protected:
+	/**
+	 * Constructor for arrays that provide their own storage for the first elements, such as TInlineArray.
+	 * Memory is only allocated once the array grows past that storage.
+	 *
+	 * @param InInlineData: Storage for InInlineCapacity elements, which must outlive the array.
+	 * @param InInlineCapacity: Number of elements that fit in the storage.
+	 * @param InAllocator: Allocator use to allocate array memory.
+	 */
+	TArray(ElementType* InInlineData, int32 InInlineCapacity, IAllocator& InAllocator);
+
 private:
 	ElementType* Data;
 	// Number of elements stored in the Data array.
@@ -272,6 +288,8 @@ private:
 	// Total size of the Data array.
 	int32 Capacity;
 	IAllocator* Allocator;
+	// Storage provided by the derived array, or nullptr. Data points here until the array outgrows it.
+	ElementType* InlineData = nullptr;
 
 	// Growth factor used to determine the amount of space to reserve during a reallocation.
 	static constexpr int32 GrowthFactor = 2;
@@ -280,6 +298,10 @@ private:
 	int32 GetNextCapacity();
 	// Grows the array to the requested capacity.
 	void Resize(int32 InCapacity);
+	// Moves the elements to newly allocated memory of the requested capacity and releases the current memory.
+	void RelocateElements(ElementType* InNewData, int32 InNewCapacity);
+	// Returns the Data array to the allocator, unless it is the inline storage.
+	void ReleaseData();
 	// Makes this array a copy of the requested array.
 	void CopyArray(const TArray<ElementType>& InArray);
 };
@@ -300,7 +322,17 @@ inline TArray<ElementType>::TArray(int32 InCapacity, IAllocator& InAllocator /*
 	, Allocator(&InAllocator)
 {
 	Data = (ElementType*)Allocator->Allocate(Capacity * sizeof(ElementType));
-	ensure(Data);
+	ensure(Data || Capacity == 0);
+}
+
+template<typename ElementType>
+inline TArray<ElementType>::TArray(ElementType* InInlineData, int32 InInlineCapacity, IAllocator& InAllocator)
+	: Data(InInlineData)
+	, Size(0)
+	, Capacity(InInlineCapacity)
+	, Allocator(&InAllocator)
+	, InlineData(InInlineData)
+{
 }
 
 template<typename ElementType>
@@ -314,10 +346,7 @@ template<typename ElementType>
 inline TArray<ElementType>::~TArray()
 {
 	Empty();
-	if (Data)
-	{
-		Allocator->Deallocate(Data);
-	}
+	ReleaseData();
 }
 
 template<typename ElementType>
@@ -350,27 +379,31 @@ inline const ElementType& TArray<ElementType>::operator[](int32 InIndex) const
 template<typename ElementType>
 inline int32 TArray<ElementType>::Add(const ElementType& InElement)
 {
-	if (Size >= Capacity)
-	{
-		int32 NextCapacity = GetNextCapacity();
-		Resize(NextCapacity);
-	}
+	return Emplace(InElement);
+}
 
-	new (Data + Size) ElementType(InElement);
-	return Size++;
+template<typename ElementType>
+inline int32 TArray<ElementType>::Add(ElementType&& InElement)
+{
+	return Emplace(MoveTempIfPossible(InElement));
 }
 
 template<typename ElementType>
-template<typename... Args>
-inline int32 TArray<ElementType>::Emplace(Args... InArgs)
+template<typename... ArgTypes>
+inline int32 TArray<ElementType>::Emplace(ArgTypes&&... InArgs)
 {
-	if (Size >= Capacity)
+	if (Size < Capacity)
 	{
-		int32 NextCapacity = GetNextCapacity();
-		Resize(NextCapacity);
+		new (Data + Size) ElementType(Forward<ArgTypes>(InArgs)...);
+		return Size++;
 	}
 
-	new (Data + Size) ElementType(InArgs...);
+	// The arguments may refer to elements of this array, so construct the new element before moving the others.
+	int32 NextCapacity = GetNextCapacity();
+	ElementType* ResizedData = (ElementType*)Allocator->Allocate(NextCapacity * sizeof(ElementType));
+	ensure(ResizedData);
+	new (ResizedData + Size) ElementType(Forward<ArgTypes>(InArgs)...);
+	RelocateElements(ResizedData, NextCapacity);
 	return Size++;
 }
 
@@ -590,31 +623,48 @@ void TArray<ElementType>::Resize(int32 InCapacity)
 	ensure(InCapacity > Capacity);
 
 	ElementType* ResizedData = (ElementType*)Allocator->Allocate(InCapacity * sizeof(ElementType));
+	ensure(ResizedData);
+	RelocateElements(ResizedData, InCapacity);
+}
 
-	if (Capacity > 0)
+template<typename ElementType>
+void TArray<ElementType>::RelocateElements(ElementType* InNewData, int32 InNewCapacity)
+{
+	if constexpr (TIsTriviallyRelocatable<ElementType>::Value)
 	{
-		for (int32 Index = 0; Index < Size; ++Index)
+		if (Size > 0)
 		{
-			new (ResizedData + Index) ElementType(Data[Index]);
+			memcpy(static_cast<void*>(InNewData), static_cast<const void*>(Data), Size * sizeof(ElementType));
 		}
-
+	}
+	else
+	{
 		for (int32 Index = 0; Index < Size; ++Index)
 		{
+			new (InNewData + Index) ElementType(MoveTempIfPossible(Data[Index]));
 			Data[Index].~ElementType();
 		}
+	}
 
+	ReleaseData();
+	Data = InNewData;
+	Capacity = InNewCapacity;
+}
+
+template<typename ElementType>
+inline void TArray<ElementType>::ReleaseData()
+{
+	if (Data && Data != InlineData)
+	{
 		Allocator->Deallocate(Data);
 	}
-
-	Data = ResizedData;
-	Capacity = InCapacity;
 }
 
 template<typename ElementType>
 inline void TArray<ElementType>::CopyArray(const TArray<ElementType>& InArray)
 {
 	Data = (ElementType*)Allocator->Allocate(InArray.GetCapacity() * sizeof(ElementType));
-	ensure(Data);
+	ensure(Data || InArray.GetCapacity() == 0);
 
 	for (int32 Index = 0; Index < InArray.GetSize(); ++Index)
 	{
@@ -624,3 +674,10 @@ inline void TArray<ElementType>::CopyArray(const TArray<ElementType>& InArray)
 	Size = InArray.GetSize();
 	Capacity = InArray.GetCapacity();
 }
+
+// Arrays don't point into themselves, so they can be relocated along with their elements. TInlineArray can't.
+template<typename ElementType>
+struct TIsTriviallyRelocatable<TArray<ElementType>>
+{
+	static constexpr bool Value = true;
+};
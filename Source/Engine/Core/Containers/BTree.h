@@ -0,0 +1,969 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Containers/Array.h"
+#include "Math/MathUtilities.h"
+#include "Memory/PoolAllocator.h"
+#include "Templates/TemplateFunctionLibrary.h"
+#include "Templates/TypeTraits/CallTraits.h"
+#include "Templates/TypeTraits/IsTriviallyDestructable.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
+
+// System includes for placement new and memmove.
+#include <cstring>
+#include <new>
+
+using FDefaultBTreeAllocator = FPoolAllocator;
+
+/**
+ * Orders the elements of sorted containers. Sorted keys only need operator<, where hashed keys need
+ * GetTypeHash and operator==.
+ */
+template<typename InKeyType, typename ElementType>
+struct TDefaultSortedKeyOperations
+{
+	using KeyType = InKeyType;
+	using KeyParamType = typename TCallTraits<KeyType>::ConstParamType;
+
+	static KeyParamType GetKeyFromElement(const ElementType& InElement)
+	{
+		return InElement;
+	}
+
+	static bool IsKeyLess(KeyParamType InKey, KeyParamType InOtherKey)
+	{
+		return InKey < InOtherKey;
+	}
+};
+
+/**
+ * Range of elements of a sorted container, between two iterators. Used as: for (auto& Element : Range).
+ */
+template<typename IteratorType>
+struct TSortedRange
+{
+	IteratorType First;
+	IteratorType Last;
+
+	IteratorType begin() const
+	{
+		return First;
+	}
+
+	IteratorType end() const
+	{
+		return Last;
+	}
+};
+
+/**
+ * B+ tree storing unique elements in key order. Implements TSortedSet and TSortedMap.
+ *
+ * Elements live in leaves, which are linked in key order so that iteration and range queries walk
+ * leaves like arrays. Inner nodes only hold separator keys and children. Nodes are sized to a few cache
+ * lines, so a node is searched with a binary search over contiguous keys, and the tree stays shallow:
+ * a tree of int32 has about 20 children per inner node and 60 elements per leaf.
+ *
+ * Adding and removing elements is O(log n), and moves elements within a leaf, so pointers and
+ * iterators to elements are only valid until the tree is modified.
+ */
+template<typename ElementType, typename KeyOperations>
+class TBTree
+{
+public:
+	using KeyType = typename KeyOperations::KeyType;
+	using KeyParamType = typename KeyOperations::KeyParamType;
+
+	// Size of a node in bytes: 4 cache lines.
+	static constexpr int32 NodeSize = 256;
+	// Node headers: an element count and a pointer, rounded up.
+	static constexpr int32 NodeHeaderSize = 16;
+	static constexpr int32 LeafCapacity = FMath::Max(4, static_cast<int32>((NodeSize - NodeHeaderSize) / sizeof(ElementType)));
+	// Number of keys of an inner node, which has one more child than keys.
+	static constexpr int32 InnerCapacity = FMath::Max(4, static_cast<int32>((NodeSize - NodeHeaderSize) / (sizeof(KeyType) + sizeof(void*))));
+
+	static_assert(alignof(ElementType) <= alignof(uint64) && alignof(KeyType) <= alignof(uint64), "B-tree nodes are only aligned to 8 bytes.");
+
+private:
+	struct FLeafNode
+	{
+		int32 NumElements;
+		// Next leaf in key order, or nullptr for the last leaf.
+		FLeafNode* Next;
+		alignas(ElementType) uint8 ElementStorage[LeafCapacity * sizeof(ElementType)];
+
+		ElementType* GetElements()
+		{
+			return reinterpret_cast<ElementType*>(ElementStorage);
+		}
+	};
+
+	struct FInnerNode
+	{
+		int32 NumKeys;
+		// Children[Index] holds the keys before Keys[Index], and the keys from Keys[Index - 1] on.
+		void* Children[InnerCapacity + 1];
+		alignas(KeyType) uint8 KeyStorage[InnerCapacity * sizeof(KeyType)];
+
+		KeyType* GetKeys()
+		{
+			return reinterpret_cast<KeyType*>(KeyStorage);
+		}
+	};
+
+	// Nodes other than the root never have fewer elements or keys than these, so the tree stays balanced.
+	static constexpr int32 MinLeafElements = LeafCapacity / 2;
+	static constexpr int32 MinInnerKeys = (InnerCapacity - 1) / 2;
+
+public:
+	// Iterator over elements in key order. IteratedElementType is ElementType or const ElementType.
+	template<typename IteratedElementType>
+	class TIterator
+	{
+	public:
+		TIterator() = default;
+
+		TIterator(FLeafNode* InLeaf, int32 InIndex)
+			: Leaf(InLeaf)
+			, Index(InIndex)
+		{
+			// Iterators past the end of a leaf point at the start of the next one instead.
+			if (Leaf && Index == Leaf->NumElements)
+			{
+				Leaf = Leaf->Next;
+				Index = 0;
+			}
+		}
+
+		// Iterators convert to const iterators.
+		operator TIterator<const IteratedElementType>() const
+		{
+			return TIterator<const IteratedElementType>(Leaf, Index);
+		}
+
+		IteratedElementType& operator*() const
+		{
+			return Leaf->GetElements()[Index];
+		}
+
+		IteratedElementType* operator->() const
+		{
+			return &Leaf->GetElements()[Index];
+		}
+
+		TIterator& operator++()
+		{
+			if (++Index == Leaf->NumElements)
+			{
+				Leaf = Leaf->Next;
+				Index = 0;
+			}
+			return *this;
+		}
+
+		bool operator==(const TIterator& InOther) const
+		{
+			return Leaf == InOther.Leaf && Index == InOther.Index;
+		}
+
+		bool operator!=(const TIterator& InOther) const
+		{
+			return !(*this == InOther);
+		}
+
+	private:
+		FLeafNode* Leaf = nullptr;
+		int32 Index = 0;
+	};
+
+	using FIterator = TIterator<ElementType>;
+	using FConstIterator = TIterator<const ElementType>;
+
+	/**
+	 * Default constructor. Does not allocate any memory.
+	 *
+	 * @param InAllocator: Allocator for the nodes. Must outlive the tree.
+	 */
+	explicit TBTree(IAllocator& InAllocator = FDefaultBTreeAllocator::GetDefaultAllocator())
+		: Allocator(&InAllocator)
+	{
+	}
+
+	// Copy constructor. The copy uses the same allocator as InOther, and is built with full leaves.
+	TBTree(const TBTree& InOther)
+		: TBTree(InOther, *InOther.Allocator)
+	{
+	}
+
+	// Copies InOther into nodes from InAllocator.
+	TBTree(const TBTree& InOther, IAllocator& InAllocator)
+		: Allocator(&InAllocator)
+	{
+		CopyElements(InOther);
+	}
+
+	// Takes InOther's nodes and allocator, leaving it empty.
+	TBTree(TBTree&& InOther)
+	{
+		TakeNodes(InOther);
+	}
+
+	~TBTree()
+	{
+		Empty();
+	}
+
+	// Copy assignment operator. Keeps this tree's allocator.
+	TBTree& operator=(const TBTree& InOther)
+	{
+		if (this != &InOther)
+		{
+			CopyElements(InOther);
+		}
+		return *this;
+	}
+
+	// Move assignment operator. Takes InOther's nodes if both trees use the same allocator, copies them otherwise.
+	TBTree& operator=(TBTree&& InOther)
+	{
+		if (this == &InOther)
+		{
+			return *this;
+		}
+
+		if (Allocator == InOther.Allocator)
+		{
+			Empty();
+			TakeNodes(InOther);
+		}
+		else
+		{
+			CopyElements(InOther);
+			InOther.Empty();
+		}
+		return *this;
+	}
+
+	/**
+	 * Constructs an element in key order, unless an element with the same key is already in the tree.
+	 *
+	 * @param InKey: Key of the element.
+	 * @param InArgs: Arguments forwarded to ElementType's constructor.
+	 * @returns: true if the element was added, false if its key was already in the tree.
+	 */
+	template<typename... ArgTypes>
+	bool Emplace(KeyParamType InKey, ArgTypes&&... InArgs);
+
+	/**
+	 * Removes the element with the given key.
+	 *
+	 * @param InKey: Key of the element.
+	 * @returns: true if the element was removed, false if no element has that key.
+	 */
+	bool Remove(KeyParamType InKey);
+
+	/**
+	 * Finds the element with the given key.
+	 *
+	 * @param InKey: Key of the element.
+	 * @returns: A pointer to the element, or nullptr if no element has that key.
+	 */
+	const ElementType* Find(KeyParamType InKey) const
+	{
+		FConstIterator It = LowerBound(InKey);
+		return (It != end() && !KeyOperations::IsKeyLess(InKey, KeyOperations::GetKeyFromElement(*It))) ? &*It : nullptr;
+	}
+
+	ElementType* Find(KeyParamType InKey)
+	{
+		return const_cast<ElementType*>(
+			static_cast<const TBTree&>(*this).Find(InKey)
+			);
+	}
+
+	// Returns an iterator to the first element whose key isn't before InKey, or end() if there is none.
+	FConstIterator LowerBound(KeyParamType InKey) const
+	{
+		FLeafNode* Leaf = FindLeaf(InKey);
+		return Leaf ? FConstIterator(Leaf, LowerBoundInLeaf(Leaf, InKey)) : FConstIterator();
+	}
+
+	FIterator LowerBound(KeyParamType InKey)
+	{
+		FLeafNode* Leaf = FindLeaf(InKey);
+		return Leaf ? FIterator(Leaf, LowerBoundInLeaf(Leaf, InKey)) : FIterator();
+	}
+
+	// Returns an iterator to the first element whose key is after InKey, or end() if there is none.
+	FConstIterator UpperBound(KeyParamType InKey) const
+	{
+		FLeafNode* Leaf = FindLeaf(InKey);
+		return Leaf ? FConstIterator(Leaf, UpperBoundInLeaf(Leaf, InKey)) : FConstIterator();
+	}
+
+	FIterator UpperBound(KeyParamType InKey)
+	{
+		FLeafNode* Leaf = FindLeaf(InKey);
+		return Leaf ? FIterator(Leaf, UpperBoundInLeaf(Leaf, InKey)) : FIterator();
+	}
+
+	/**
+	 * Replaces the elements of the tree with sorted elements, in O(n). Leaves are filled and inner nodes
+	 * built level by level, instead of adding elements one by one.
+	 *
+	 * @param InNum: Number of elements.
+	 * @param InConstructElement: Called as InConstructElement(ElementType* Destination) InNum times, to construct
+	 *                            each element at its destination in increasing key order, without duplicate keys.
+	 */
+	template<typename ConstructElementType>
+	void BuildFromSorted(int32 InNum, const ConstructElementType& InConstructElement);
+
+	// Destroys every element and frees every node.
+	void Empty()
+	{
+		if (Root)
+		{
+			FreeSubtree(Root, Height);
+		}
+		Root = nullptr;
+		Height = 0;
+		Size = 0;
+	}
+
+	// Getters.
+	int32 GetSize() const
+	{
+		return Size;
+	}
+	bool IsEmpty() const
+	{
+		return Size == 0;
+	}
+	// Number of inner node levels above the leaves.
+	int32 GetHeight() const
+	{
+		return Height;
+	}
+	IAllocator* GetAllocator() const
+	{
+		return Allocator;
+	}
+
+	// Iterators in key order.
+	FIterator begin()
+	{
+		return FIterator(GetFirstLeaf(), 0);
+	}
+	FConstIterator begin() const
+	{
+		return FConstIterator(GetFirstLeaf(), 0);
+	}
+	FIterator end()
+	{
+		return FIterator();
+	}
+	FConstIterator end() const
+	{
+		return FConstIterator();
+	}
+
+private:
+	// Inner node on the path from the root to a leaf, and the index of the child that was taken.
+	struct FPathEntry
+	{
+		FInnerNode* Node;
+		int32 ChildIndex;
+	};
+
+	// Deeper than any tree that fits in memory, since inner nodes have at least 2 children.
+	static constexpr int32 MaxHeight = 32;
+
+	static KeyParamType GetKey(const ElementType& InElement)
+	{
+		return KeyOperations::GetKeyFromElement(InElement);
+	}
+
+	// Moves InNum objects to a location that may overlap, destroying the originals.
+	template<typename ObjectType>
+	static void Relocate(ObjectType* InDestination, ObjectType* InSource, int32 InNum);
+
+	// Index of the first key of an inner node after InKey, which is the index of the child that may hold InKey.
+	static int32 UpperBoundInInner(FInnerNode* InNode, KeyParamType InKey);
+	static int32 LowerBoundInLeaf(FLeafNode* InLeaf, KeyParamType InKey);
+	static int32 UpperBoundInLeaf(FLeafNode* InLeaf, KeyParamType InKey);
+
+	// Returns the leaf that holds InKey if it is in the tree, or nullptr if the tree is empty.
+	FLeafNode* FindLeaf(KeyParamType InKey) const
+	{
+		void* Node = Root;
+		for (int32 Level = Height; Level > 0; --Level)
+		{
+			FInnerNode* Inner = static_cast<FInnerNode*>(Node);
+			Node = Inner->Children[UpperBoundInInner(Inner, InKey)];
+		}
+		return static_cast<FLeafNode*>(Node);
+	}
+
+	FLeafNode* GetFirstLeaf() const
+	{
+		void* Node = Root;
+		for (int32 Level = Height; Level > 0; --Level)
+		{
+			Node = static_cast<FInnerNode*>(Node)->Children[0];
+		}
+		return static_cast<FLeafNode*>(Node);
+	}
+
+	// Returns the first key of a subtree, which separates it from the subtree before it.
+	static KeyParamType GetFirstKey(void* InNode, int32 InLevel)
+	{
+		for (; InLevel > 0; --InLevel)
+		{
+			InNode = static_cast<FInnerNode*>(InNode)->Children[0];
+		}
+		return GetKey(static_cast<FLeafNode*>(InNode)->GetElements()[0]);
+	}
+
+	static bool IsNodeFull(void* InNode, int32 InLevel)
+	{
+		return InLevel == 0 ? static_cast<FLeafNode*>(InNode)->NumElements == LeafCapacity : static_cast<FInnerNode*>(InNode)->NumKeys == InnerCapacity;
+	}
+
+	FLeafNode* AllocateLeaf()
+	{
+		FLeafNode* Leaf = static_cast<FLeafNode*>(Allocator->Allocate(sizeof(FLeafNode)));
+		ensure(Leaf);
+		Leaf->NumElements = 0;
+		Leaf->Next = nullptr;
+		return Leaf;
+	}
+
+	FInnerNode* AllocateInner()
+	{
+		FInnerNode* Inner = static_cast<FInnerNode*>(Allocator->Allocate(sizeof(FInnerNode)));
+		ensure(Inner);
+		Inner->NumKeys = 0;
+		return Inner;
+	}
+
+	// Splits a full child in two, adding the second half as the next child of a parent that isn't full.
+	void SplitChild(FInnerNode* InParent, int32 InChildIndex, int32 InChildLevel);
+
+	// Inserts a key and the child after it into an inner node that isn't full.
+	static void InsertIntoInner(FInnerNode* InNode, int32 InKeyIndex, KeyType&& InKey, void* InChild);
+
+	// Removes a key and the child after it from an inner node.
+	static void RemoveFromInner(FInnerNode* InNode, int32 InKeyIndex);
+
+	/**
+	 * Refills a leaf or inner node that has fewer elements or keys than the minimum, by borrowing from
+	 * a sibling, or by merging with a sibling if neither has any to spare.
+	 *
+	 * @returns: true if the node was merged, which removes a key from the parent.
+	 */
+	bool RebalanceLeaf(FInnerNode* InParent, int32 InChildIndex);
+	bool RebalanceInner(FInnerNode* InParent, int32 InChildIndex);
+
+	void FreeSubtree(void* InNode, int32 InLevel);
+
+	void CopyElements(const TBTree& InOther)
+	{
+		FConstIterator It = InOther.begin();
+		BuildFromSorted(InOther.Size, [&It](ElementType* InDestination)
+		{
+			new (InDestination) ElementType(*It);
+			++It;
+		});
+	}
+
+	void TakeNodes(TBTree& InOther)
+	{
+		Root = InOther.Root;
+		Height = InOther.Height;
+		Size = InOther.Size;
+		Allocator = InOther.Allocator;
+		InOther.Root = nullptr;
+		InOther.Height = 0;
+		InOther.Size = 0;
+	}
+
+	// Leaf or inner node at the top of the tree, or nullptr if the tree is empty.
+	void* Root = nullptr;
+	int32 Height = 0;
+	int32 Size = 0;
+	IAllocator* Allocator = nullptr;
+};
+
+template<typename ElementType, typename KeyOperations>
+template<typename... ArgTypes>
+bool TBTree<ElementType, KeyOperations>::Emplace(KeyParamType InKey, ArgTypes&&... InArgs)
+{
+	if (!Root)
+	{
+		Root = AllocateLeaf();
+	}
+
+	// Split full nodes on the way down, so that a split never has to go back up.
+	if (IsNodeFull(Root, Height))
+	{
+		FInnerNode* NewRoot = AllocateInner();
+		NewRoot->Children[0] = Root;
+		SplitChild(NewRoot, 0, Height);
+		Root = NewRoot;
+		++Height;
+	}
+
+	void* Node = Root;
+	for (int32 Level = Height; Level > 0; --Level)
+	{
+		FInnerNode* Inner = static_cast<FInnerNode*>(Node);
+		int32 ChildIndex = UpperBoundInInner(Inner, InKey);
+		if (IsNodeFull(Inner->Children[ChildIndex], Level - 1))
+		{
+			SplitChild(Inner, ChildIndex, Level - 1);
+			// The new separator decides which half the key goes into.
+			if (!KeyOperations::IsKeyLess(InKey, Inner->GetKeys()[ChildIndex]))
+			{
+				++ChildIndex;
+			}
+		}
+		Node = Inner->Children[ChildIndex];
+	}
+
+	FLeafNode* Leaf = static_cast<FLeafNode*>(Node);
+	ElementType* Elements = Leaf->GetElements();
+	const int32 Index = LowerBoundInLeaf(Leaf, InKey);
+	if (Index < Leaf->NumElements && !KeyOperations::IsKeyLess(InKey, GetKey(Elements[Index])))
+	{
+		return false;
+	}
+
+	Relocate(Elements + Index + 1, Elements + Index, Leaf->NumElements - Index);
+	new (Elements + Index) ElementType(Forward<ArgTypes>(InArgs)...);
+	++Leaf->NumElements;
+	++Size;
+	return true;
+}
+
+template<typename ElementType, typename KeyOperations>
+bool TBTree<ElementType, KeyOperations>::Remove(KeyParamType InKey)
+{
+	if (!Root)
+	{
+		return false;
+	}
+
+	// Path[Level] is the inner node at that level, from Path[1] above the leaf to Path[Height] at the root.
+	FPathEntry Path[MaxHeight + 1];
+	void* Node = Root;
+	for (int32 Level = Height; Level > 0; --Level)
+	{
+		FInnerNode* Inner = static_cast<FInnerNode*>(Node);
+		const int32 ChildIndex = UpperBoundInInner(Inner, InKey);
+		Path[Level] = { Inner, ChildIndex };
+		Node = Inner->Children[ChildIndex];
+	}
+
+	FLeafNode* Leaf = static_cast<FLeafNode*>(Node);
+	ElementType* Elements = Leaf->GetElements();
+	const int32 Index = LowerBoundInLeaf(Leaf, InKey);
+	if (Index == Leaf->NumElements || KeyOperations::IsKeyLess(InKey, GetKey(Elements[Index])))
+	{
+		return false;
+	}
+
+	Elements[Index].~ElementType();
+	Relocate(Elements + Index, Elements + Index + 1, Leaf->NumElements - Index - 1);
+	--Leaf->NumElements;
+	--Size;
+
+	if (Height == 0)
+	{
+		if (Leaf->NumElements == 0)
+		{
+			Allocator->Deallocate(Leaf);
+			Root = nullptr;
+		}
+		return true;
+	}
+
+	// Merges remove a key from the parent, which may leave it short of keys in turn.
+	if (Leaf->NumElements >= MinLeafElements || !RebalanceLeaf(Path[1].Node, Path[1].ChildIndex))
+	{
+		return true;
+	}
+	for (int32 Level = 1; Level < Height; ++Level)
+	{
+		if (Path[Level].Node->NumKeys >= MinInnerKeys || !RebalanceInner(Path[Level + 1].Node, Path[Level + 1].ChildIndex))
+		{
+			return true;
+		}
+	}
+
+	// The root may have fewer keys than the minimum, but once it has a single child, that child becomes the root.
+	FInnerNode* RootNode = static_cast<FInnerNode*>(Root);
+	if (RootNode->NumKeys == 0)
+	{
+		Root = RootNode->Children[0];
+		Allocator->Deallocate(RootNode);
+		--Height;
+	}
+	return true;
+}
+
+template<typename ElementType, typename KeyOperations>
+template<typename ConstructElementType>
+void TBTree<ElementType, KeyOperations>::BuildFromSorted(int32 InNum, const ConstructElementType& InConstructElement)
+{
+	Empty();
+	if (InNum == 0)
+	{
+		return;
+	}
+
+	// Fill leaves evenly rather than filling all but the last, so that every leaf has at least the minimum.
+	const int32 NumLeaves = (InNum + LeafCapacity - 1) / LeafCapacity;
+	TArray<void*> Nodes(NumLeaves);
+	FLeafNode* PreviousLeaf = nullptr;
+	const ElementType* PreviousElement = nullptr;
+	for (int32 LeafIndex = 0; LeafIndex < NumLeaves; ++LeafIndex)
+	{
+		FLeafNode* Leaf = AllocateLeaf();
+		const int32 NumElements = InNum / NumLeaves + (LeafIndex < InNum % NumLeaves ? 1 : 0);
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			ElementType* Element = Leaf->GetElements() + Index;
+			InConstructElement(Element);
+			ensure(!PreviousElement || KeyOperations::IsKeyLess(GetKey(*PreviousElement), GetKey(*Element)));
+			PreviousElement = Element;
+		}
+		Leaf->NumElements = NumElements;
+
+		if (PreviousLeaf)
+		{
+			PreviousLeaf->Next = Leaf;
+		}
+		PreviousLeaf = Leaf;
+		Nodes.Add(Leaf);
+	}
+	Size = InNum;
+
+	// Build each level of inner nodes from the one below, spreading the children evenly as well.
+	while (Nodes.GetSize() > 1)
+	{
+		const int32 NumChildren = Nodes.GetSize();
+		const int32 NumParents = (NumChildren + InnerCapacity) / (InnerCapacity + 1);
+		TArray<void*> Parents(NumParents);
+		int32 ChildIndex = 0;
+		for (int32 ParentIndex = 0; ParentIndex < NumParents; ++ParentIndex)
+		{
+			FInnerNode* Parent = AllocateInner();
+			const int32 NumParentChildren = NumChildren / NumParents + (ParentIndex < NumChildren % NumParents ? 1 : 0);
+			Parent->Children[0] = Nodes[ChildIndex++];
+			for (int32 Index = 1; Index < NumParentChildren; ++Index)
+			{
+				void* Child = Nodes[ChildIndex++];
+				new (Parent->GetKeys() + Index - 1) KeyType(GetFirstKey(Child, Height));
+				Parent->Children[Index] = Child;
+			}
+			Parent->NumKeys = NumParentChildren - 1;
+			Parents.Add(Parent);
+		}
+		Nodes = Parents;
+		++Height;
+	}
+	Root = Nodes[0];
+}
+
+template<typename ElementType, typename KeyOperations>
+template<typename ObjectType>
+/*static*/ void TBTree<ElementType, KeyOperations>::Relocate(ObjectType* InDestination, ObjectType* InSource, int32 InNum)
+{
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	if (TIsTriviallyRelocatable<ObjectType>::Value)
+	{
+		memmove(static_cast<void*>(InDestination), static_cast<const void*>(InSource), sizeof(ObjectType) * InNum);
+		return;
+	}
+
+	// Go in the direction that doesn't overwrite objects before they are moved.
+	if (InDestination < InSource)
+	{
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			new (InDestination + Index) ObjectType(MoveTemp(InSource[Index]));
+			InSource[Index].~ObjectType();
+		}
+	}
+	else
+	{
+		for (int32 Index = InNum - 1; Index >= 0; --Index)
+		{
+			new (InDestination + Index) ObjectType(MoveTemp(InSource[Index]));
+			InSource[Index].~ObjectType();
+		}
+	}
+}
+
+template<typename ElementType, typename KeyOperations>
+/*static*/ int32 TBTree<ElementType, KeyOperations>::UpperBoundInInner(FInnerNode* InNode, KeyParamType InKey)
+{
+	const KeyType* Keys = InNode->GetKeys();
+	int32 FirstIndex = 0;
+	int32 Num = InNode->NumKeys;
+	while (Num > 0)
+	{
+		const int32 HalfNum = Num / 2;
+		if (!KeyOperations::IsKeyLess(InKey, Keys[FirstIndex + HalfNum]))
+		{
+			FirstIndex += HalfNum + 1;
+			Num -= HalfNum + 1;
+		}
+		else
+		{
+			Num = HalfNum;
+		}
+	}
+	return FirstIndex;
+}
+
+template<typename ElementType, typename KeyOperations>
+/*static*/ int32 TBTree<ElementType, KeyOperations>::LowerBoundInLeaf(FLeafNode* InLeaf, KeyParamType InKey)
+{
+	const ElementType* Elements = InLeaf->GetElements();
+	int32 FirstIndex = 0;
+	int32 Num = InLeaf->NumElements;
+	while (Num > 0)
+	{
+		const int32 HalfNum = Num / 2;
+		if (KeyOperations::IsKeyLess(GetKey(Elements[FirstIndex + HalfNum]), InKey))
+		{
+			FirstIndex += HalfNum + 1;
+			Num -= HalfNum + 1;
+		}
+		else
+		{
+			Num = HalfNum;
+		}
+	}
+	return FirstIndex;
+}
+
+template<typename ElementType, typename KeyOperations>
+/*static*/ int32 TBTree<ElementType, KeyOperations>::UpperBoundInLeaf(FLeafNode* InLeaf, KeyParamType InKey)
+{
+	const ElementType* Elements = InLeaf->GetElements();
+	int32 FirstIndex = 0;
+	int32 Num = InLeaf->NumElements;
+	while (Num > 0)
+	{
+		const int32 HalfNum = Num / 2;
+		if (!KeyOperations::IsKeyLess(InKey, GetKey(Elements[FirstIndex + HalfNum])))
+		{
+			FirstIndex += HalfNum + 1;
+			Num -= HalfNum + 1;
+		}
+		else
+		{
+			Num = HalfNum;
+		}
+	}
+	return FirstIndex;
+}
+
+template<typename ElementType, typename KeyOperations>
+void TBTree<ElementType, KeyOperations>::SplitChild(FInnerNode* InParent, int32 InChildIndex, int32 InChildLevel)
+{
+	if (InChildLevel == 0)
+	{
+		// Leaves keep every element, and the first key of the second half is copied up as the separator.
+		FLeafNode* Left = static_cast<FLeafNode*>(InParent->Children[InChildIndex]);
+		FLeafNode* Right = AllocateLeaf();
+		const int32 NumLeft = Left->NumElements / 2;
+		Right->NumElements = Left->NumElements - NumLeft;
+		Relocate(Right->GetElements(), Left->GetElements() + NumLeft, Right->NumElements);
+		Left->NumElements = NumLeft;
+		Right->Next = Left->Next;
+		Left->Next = Right;
+		InsertIntoInner(InParent, InChildIndex, KeyType(GetKey(Right->GetElements()[0])), Right);
+	}
+	else
+	{
+		// Inner nodes move their middle key up to the parent.
+		FInnerNode* Left = static_cast<FInnerNode*>(InParent->Children[InChildIndex]);
+		FInnerNode* Right = AllocateInner();
+		const int32 MiddleIndex = Left->NumKeys / 2;
+		Right->NumKeys = Left->NumKeys - MiddleIndex - 1;
+		Relocate(Right->GetKeys(), Left->GetKeys() + MiddleIndex + 1, Right->NumKeys);
+		memcpy(Right->Children, Left->Children + MiddleIndex + 1, sizeof(void*) * (Right->NumKeys + 1));
+
+		KeyType MiddleKey = MoveTemp(Left->GetKeys()[MiddleIndex]);
+		Left->GetKeys()[MiddleIndex].~KeyType();
+		Left->NumKeys = MiddleIndex;
+		InsertIntoInner(InParent, InChildIndex, MoveTemp(MiddleKey), Right);
+	}
+}
+
+template<typename ElementType, typename KeyOperations>
+/*static*/ void TBTree<ElementType, KeyOperations>::InsertIntoInner(FInnerNode* InNode, int32 InKeyIndex, KeyType&& InKey, void* InChild)
+{
+	ensure(InNode->NumKeys < InnerCapacity);
+	KeyType* Keys = InNode->GetKeys();
+	Relocate(Keys + InKeyIndex + 1, Keys + InKeyIndex, InNode->NumKeys - InKeyIndex);
+	new (Keys + InKeyIndex) KeyType(MoveTemp(InKey));
+	memmove(InNode->Children + InKeyIndex + 2, InNode->Children + InKeyIndex + 1, sizeof(void*) * (InNode->NumKeys - InKeyIndex));
+	InNode->Children[InKeyIndex + 1] = InChild;
+	++InNode->NumKeys;
+}
+
+template<typename ElementType, typename KeyOperations>
+/*static*/ void TBTree<ElementType, KeyOperations>::RemoveFromInner(FInnerNode* InNode, int32 InKeyIndex)
+{
+	KeyType* Keys = InNode->GetKeys();
+	Keys[InKeyIndex].~KeyType();
+	Relocate(Keys + InKeyIndex, Keys + InKeyIndex + 1, InNode->NumKeys - InKeyIndex - 1);
+	memmove(InNode->Children + InKeyIndex + 1, InNode->Children + InKeyIndex + 2, sizeof(void*) * (InNode->NumKeys - InKeyIndex - 1));
+	--InNode->NumKeys;
+}
+
+template<typename ElementType, typename KeyOperations>
+bool TBTree<ElementType, KeyOperations>::RebalanceLeaf(FInnerNode* InParent, int32 InChildIndex)
+{
+	FLeafNode* Leaf = static_cast<FLeafNode*>(InParent->Children[InChildIndex]);
+	KeyType* ParentKeys = InParent->GetKeys();
+
+	// Borrow the last element of the previous leaf.
+	if (InChildIndex > 0)
+	{
+		FLeafNode* Left = static_cast<FLeafNode*>(InParent->Children[InChildIndex - 1]);
+		if (Left->NumElements > MinLeafElements)
+		{
+			Relocate(Leaf->GetElements() + 1, Leaf->GetElements(), Leaf->NumElements);
+			Relocate(Leaf->GetElements(), Left->GetElements() + Left->NumElements - 1, 1);
+			--Left->NumElements;
+			++Leaf->NumElements;
+			ParentKeys[InChildIndex - 1] = GetKey(Leaf->GetElements()[0]);
+			return false;
+		}
+	}
+
+	// Borrow the first element of the next leaf.
+	if (InChildIndex < InParent->NumKeys)
+	{
+		FLeafNode* Right = static_cast<FLeafNode*>(InParent->Children[InChildIndex + 1]);
+		if (Right->NumElements > MinLeafElements)
+		{
+			Relocate(Leaf->GetElements() + Leaf->NumElements, Right->GetElements(), 1);
+			Relocate(Right->GetElements(), Right->GetElements() + 1, Right->NumElements - 1);
+			--Right->NumElements;
+			++Leaf->NumElements;
+			ParentKeys[InChildIndex] = GetKey(Right->GetElements()[0]);
+			return false;
+		}
+	}
+
+	// Neither sibling has elements to spare, so together they fit in one leaf.
+	const int32 LeftIndex = InChildIndex > 0 ? InChildIndex - 1 : InChildIndex;
+	FLeafNode* Left = static_cast<FLeafNode*>(InParent->Children[LeftIndex]);
+	FLeafNode* Right = static_cast<FLeafNode*>(InParent->Children[LeftIndex + 1]);
+	Relocate(Left->GetElements() + Left->NumElements, Right->GetElements(), Right->NumElements);
+	Left->NumElements += Right->NumElements;
+	Left->Next = Right->Next;
+	Allocator->Deallocate(Right);
+	RemoveFromInner(InParent, LeftIndex);
+	return true;
+}
+
+template<typename ElementType, typename KeyOperations>
+bool TBTree<ElementType, KeyOperations>::RebalanceInner(FInnerNode* InParent, int32 InChildIndex)
+{
+	FInnerNode* Node = static_cast<FInnerNode*>(InParent->Children[InChildIndex]);
+	KeyType* ParentKeys = InParent->GetKeys();
+
+	// Rotate the last child of the previous node through the parent's separator.
+	if (InChildIndex > 0)
+	{
+		FInnerNode* Left = static_cast<FInnerNode*>(InParent->Children[InChildIndex - 1]);
+		if (Left->NumKeys > MinInnerKeys)
+		{
+			KeyType* LeftKeys = Left->GetKeys();
+			Relocate(Node->GetKeys() + 1, Node->GetKeys(), Node->NumKeys);
+			memmove(Node->Children + 1, Node->Children, sizeof(void*) * (Node->NumKeys + 1));
+			new (Node->GetKeys()) KeyType(MoveTemp(ParentKeys[InChildIndex - 1]));
+			Node->Children[0] = Left->Children[Left->NumKeys];
+			ParentKeys[InChildIndex - 1] = MoveTemp(LeftKeys[Left->NumKeys - 1]);
+			LeftKeys[Left->NumKeys - 1].~KeyType();
+			--Left->NumKeys;
+			++Node->NumKeys;
+			return false;
+		}
+	}
+
+	// Rotate the first child of the next node through the parent's separator.
+	if (InChildIndex < InParent->NumKeys)
+	{
+		FInnerNode* Right = static_cast<FInnerNode*>(InParent->Children[InChildIndex + 1]);
+		if (Right->NumKeys > MinInnerKeys)
+		{
+			KeyType* RightKeys = Right->GetKeys();
+			new (Node->GetKeys() + Node->NumKeys) KeyType(MoveTemp(ParentKeys[InChildIndex]));
+			Node->Children[Node->NumKeys + 1] = Right->Children[0];
+			ParentKeys[InChildIndex] = MoveTemp(RightKeys[0]);
+			RightKeys[0].~KeyType();
+			Relocate(RightKeys, RightKeys + 1, Right->NumKeys - 1);
+			memmove(Right->Children, Right->Children + 1, sizeof(void*) * Right->NumKeys);
+			--Right->NumKeys;
+			++Node->NumKeys;
+			return false;
+		}
+	}
+
+	// Merge with a sibling, pulling down the parent's separator between them.
+	const int32 LeftIndex = InChildIndex > 0 ? InChildIndex - 1 : InChildIndex;
+	FInnerNode* Left = static_cast<FInnerNode*>(InParent->Children[LeftIndex]);
+	FInnerNode* Right = static_cast<FInnerNode*>(InParent->Children[LeftIndex + 1]);
+	new (Left->GetKeys() + Left->NumKeys) KeyType(MoveTemp(ParentKeys[LeftIndex]));
+	Relocate(Left->GetKeys() + Left->NumKeys + 1, Right->GetKeys(), Right->NumKeys);
+	memcpy(Left->Children + Left->NumKeys + 1, Right->Children, sizeof(void*) * (Right->NumKeys + 1));
+	Left->NumKeys += Right->NumKeys + 1;
+	Allocator->Deallocate(Right);
+	RemoveFromInner(InParent, LeftIndex);
+	return true;
+}
+
+template<typename ElementType, typename KeyOperations>
+void TBTree<ElementType, KeyOperations>::FreeSubtree(void* InNode, int32 InLevel)
+{
+	if (InLevel == 0)
+	{
+		FLeafNode* Leaf = static_cast<FLeafNode*>(InNode);
+		if (!TIsTriviallyDestructable<ElementType>::Value)
+		{
+			for (int32 Index = 0; Index < Leaf->NumElements; ++Index)
+			{
+				Leaf->GetElements()[Index].~ElementType();
+			}
+		}
+		Allocator->Deallocate(Leaf);
+		return;
+	}
+
+	FInnerNode* Inner = static_cast<FInnerNode*>(InNode);
+	for (int32 Index = 0; Index <= Inner->NumKeys; ++Index)
+	{
+		FreeSubtree(Inner->Children[Index], InLevel - 1);
+	}
+	if (!TIsTriviallyDestructable<KeyType>::Value)
+	{
+		for (int32 Index = 0; Index < Inner->NumKeys; ++Index)
+		{
+			Inner->GetKeys()[Index].~KeyType();
+		}
+	}
+	Allocator->Deallocate(Inner);
+}
@@ -0,0 +1,264 @@
+#include "BitArray.h"
+#include "Math/Simd/VectorRegister8.h"
+
+// System includes for memcpy, memcmp and memset.
+#include <cstring>
+
+namespace
+{
+	// Number of words that fit in an FVectorRegister8.
+	constexpr int32 NumWordsPerRegister = sizeof(FVectorRegister8) / sizeof(uint64);
+
+	/**
+	 * Combines InWords into InOutWords with the same operation on SIMD registers and on words.
+	 * The words are reinterpreted as floats, which the bitwise vector operations leave untouched.
+	 */
+	template<typename VectorOperationType, typename WordOperationType>
+	void CombineWords(uint64* InOutWords, const uint64* InWords, int32 InNumWords, VectorOperationType InVectorOperation, WordOperationType InWordOperation)
+	{
+		int32 WordIndex = 0;
+		for (; WordIndex + NumWordsPerRegister <= InNumWords; WordIndex += NumWordsPerRegister)
+		{
+			float* OutFloats = reinterpret_cast<float*>(InOutWords + WordIndex);
+			const FVectorRegister8 A = Vector8Load(OutFloats);
+			const FVectorRegister8 B = Vector8Load(reinterpret_cast<const float*>(InWords + WordIndex));
+			Vector8Store(InVectorOperation(A, B), OutFloats);
+		}
+		for (; WordIndex < InNumWords; ++WordIndex)
+		{
+			InOutWords[WordIndex] = InWordOperation(InOutWords[WordIndex], InWords[WordIndex]);
+		}
+	}
+}
+
+/*static*/ void FBitArrayWords::SetRange(uint64* InOutWords, int32 InStartIndex, int32 InNumBits, bool bValue)
+{
+	if (InNumBits == 0)
+	{
+		return;
+	}
+
+	const int32 FirstWordIndex = InStartIndex / NumBitsPerWord;
+	const int32 LastWordIndex = (InStartIndex + InNumBits - 1) / NumBitsPerWord;
+	const uint64 FirstWordMask = ~0ull << (InStartIndex % NumBitsPerWord);
+	const uint64 LastWordMask = GetLastWordMask(InStartIndex + InNumBits);
+
+	auto SetMaskedBits = [InOutWords, bValue](int32 InWordIndex, uint64 InMask)
+	{
+		InOutWords[InWordIndex] = bValue ? (InOutWords[InWordIndex] | InMask) : (InOutWords[InWordIndex] & ~InMask);
+	};
+
+	if (FirstWordIndex == LastWordIndex)
+	{
+		SetMaskedBits(FirstWordIndex, FirstWordMask & LastWordMask);
+		return;
+	}
+
+	SetMaskedBits(FirstWordIndex, FirstWordMask);
+	const int32 NumWholeWords = LastWordIndex - FirstWordIndex - 1;
+	memset(InOutWords + FirstWordIndex + 1, bValue ? 0xFF : 0, sizeof(uint64) * NumWholeWords);
+	SetMaskedBits(LastWordIndex, LastWordMask);
+}
+
+/*static*/ int32 FBitArrayWords::CountSetBits(const uint64* InWords, int32 InNumWords)
+{
+	int32 NumSetBits = 0;
+	for (int32 WordIndex = 0; WordIndex < InNumWords; ++WordIndex)
+	{
+		NumSetBits += FMath::CountSetBits(InWords[WordIndex]);
+	}
+	return NumSetBits;
+}
+
+/*static*/ int32 FBitArrayWords::FindFirstSetBit(const uint64* InWords, int32 InNumBits, int32 InStartIndex)
+{
+	if (InStartIndex < 0 || InStartIndex >= InNumBits)
+	{
+		return InvalidIndex;
+	}
+
+	const int32 NumWords = GetNumWords(InNumBits);
+	int32 WordIndex = InStartIndex / NumBitsPerWord;
+	// Ignore the bits before the start index.
+	uint64 Word = InWords[WordIndex] & (~0ull << (InStartIndex % NumBitsPerWord));
+	while (Word == 0)
+	{
+		if (++WordIndex == NumWords)
+		{
+			return InvalidIndex;
+		}
+		Word = InWords[WordIndex];
+	}
+	return WordIndex * NumBitsPerWord + FMath::CountTrailingZeros(Word);
+}
+
+/*static*/ int32 FBitArrayWords::FindFirstClearBit(const uint64* InWords, int32 InNumBits, int32 InStartIndex)
+{
+	if (InStartIndex < 0 || InStartIndex >= InNumBits)
+	{
+		return InvalidIndex;
+	}
+
+	const int32 NumWords = GetNumWords(InNumBits);
+	int32 WordIndex = InStartIndex / NumBitsPerWord;
+	uint64 Word = ~InWords[WordIndex] & (~0ull << (InStartIndex % NumBitsPerWord));
+	while (Word == 0)
+	{
+		if (++WordIndex == NumWords)
+		{
+			return InvalidIndex;
+		}
+		Word = ~InWords[WordIndex];
+	}
+	// The unused bits of the last word are clear, so they may be found here.
+	const int32 BitIndex = WordIndex * NumBitsPerWord + FMath::CountTrailingZeros(Word);
+	return BitIndex < InNumBits ? BitIndex : InvalidIndex;
+}
+
+/*static*/ void FBitArrayWords::And(uint64* InOutWords, const uint64* InWords, int32 InNumWords)
+{
+	CombineWords(InOutWords, InWords, InNumWords,
+		[](FVectorRegister8 InA, FVectorRegister8 InB) { return VectorBitwiseAnd(InA, InB); },
+		[](uint64 InA, uint64 InB) { return InA & InB; });
+}
+
+/*static*/ void FBitArrayWords::Or(uint64* InOutWords, const uint64* InWords, int32 InNumWords)
+{
+	CombineWords(InOutWords, InWords, InNumWords,
+		[](FVectorRegister8 InA, FVectorRegister8 InB) { return VectorBitwiseOr(InA, InB); },
+		[](uint64 InA, uint64 InB) { return InA | InB; });
+}
+
+/*static*/ void FBitArrayWords::AndNot(uint64* InOutWords, const uint64* InWords, int32 InNumWords)
+{
+	CombineWords(InOutWords, InWords, InNumWords,
+		[](FVectorRegister8 InA, FVectorRegister8 InB) { return VectorBitwiseAndNot(InA, InB); },
+		[](uint64 InA, uint64 InB) { return InA & ~InB; });
+}
+
+FBitArray::FBitArray(int32 InNumBits, bool bValue, IAllocator& InAllocator /* = FDefaultBitArrayAllocator::GetDefaultAllocator() */)
+	: Allocator(&InAllocator)
+{
+	SetNum(InNumBits, bValue);
+}
+
+FBitArray::FBitArray(const FBitArray& InOther, IAllocator& InAllocator)
+	: Allocator(&InAllocator)
+{
+	*this = InOther;
+}
+
+FBitArray::FBitArray(FBitArray&& InOther)
+	: Words(InOther.Words)
+	, NumBits(InOther.NumBits)
+	, MaxWords(InOther.MaxWords)
+	, Allocator(InOther.Allocator)
+{
+	InOther.Words = nullptr;
+	InOther.NumBits = 0;
+	InOther.MaxWords = 0;
+}
+
+FBitArray::~FBitArray()
+{
+	ReleaseWords();
+}
+
+FBitArray& FBitArray::operator=(const FBitArray& InOther)
+{
+	if (this == &InOther)
+	{
+		return *this;
+	}
+
+	Empty();
+	Reserve(InOther.NumBits);
+	if (InOther.NumBits > 0)
+	{
+		memcpy(Words, InOther.Words, sizeof(uint64) * InOther.GetNumWords());
+	}
+	NumBits = InOther.NumBits;
+	return *this;
+}
+
+FBitArray& FBitArray::operator=(FBitArray&& InOther)
+{
+	if (this == &InOther)
+	{
+		return *this;
+	}
+
+	if (Allocator == InOther.Allocator)
+	{
+		ReleaseWords();
+		Words = InOther.Words;
+		NumBits = InOther.NumBits;
+		MaxWords = InOther.MaxWords;
+		InOther.Words = nullptr;
+		InOther.NumBits = 0;
+		InOther.MaxWords = 0;
+	}
+	else
+	{
+		*this = static_cast<const FBitArray&>(InOther);
+		InOther.ReleaseWords();
+	}
+	return *this;
+}
+
+void FBitArray::SetNum(int32 InNumBits, bool bValue /* = false */)
+{
+	ensure(InNumBits >= 0);
+	if (InNumBits < NumBits)
+	{
+		// Keep the bits past the end clear.
+		FBitArrayWords::SetRange(Words, InNumBits, NumBits - InNumBits, false);
+		NumBits = InNumBits;
+		return;
+	}
+
+	Reserve(InNumBits);
+	const int32 OldNumBits = NumBits;
+	NumBits = InNumBits;
+	if (bValue)
+	{
+		SetRange(OldNumBits, NumBits - OldNumBits, true);
+	}
+}
+
+void FBitArray::Reserve(int32 InNumBits)
+{
+	const int32 NewMaxWords = FBitArrayWords::GetNumWords(InNumBits);
+	if (NewMaxWords <= MaxWords)
+	{
+		return;
+	}
+
+	uint64* NewWords = static_cast<uint64*>(Allocator->Allocate(sizeof(uint64) * NewMaxWords));
+	ensure(NewWords);
+	if (MaxWords > 0)
+	{
+		memcpy(NewWords, Words, sizeof(uint64) * MaxWords);
+		Allocator->Deallocate(Words);
+	}
+	// New words hold bits past the end, which are always clear.
+	memset(NewWords + MaxWords, 0, sizeof(uint64) * (NewMaxWords - MaxWords));
+	Words = NewWords;
+	MaxWords = NewMaxWords;
+}
+
+bool FBitArray::operator==(const FBitArray& InOther) const
+{
+	return NumBits == InOther.NumBits && (NumBits == 0 || memcmp(Words, InOther.Words, sizeof(uint64) * GetNumWords()) == 0);
+}
+
+void FBitArray::ReleaseWords()
+{
+	if (MaxWords > 0)
+	{
+		Allocator->Deallocate(Words);
+	}
+	Words = nullptr;
+	NumBits = 0;
+	MaxWords = 0;
+}
@@ -0,0 +1,460 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
+#include "Memory/PoolAllocator.h"
+
+using FDefaultBitArrayAllocator = FPoolAllocator;
+
+/**
+ * Operations on arrays of 64-bit words, shared by FBitArray and TStaticBitArray.
+ *
+ * Bit N is bit N % 64 of word N / 64. Bits past the last bit of a bit array are always clear,
+ * so that whole words can be counted, searched and combined without masking the last one.
+ */
+struct FBitArrayWords
+{
+	static constexpr int32 NumBitsPerWord = 64;
+
+	// Returns the number of words needed to store InNumBits.
+	static constexpr int32 GetNumWords(int32 InNumBits)
+	{
+		return (InNumBits + NumBitsPerWord - 1) / NumBitsPerWord;
+	}
+
+	// Returns the mask of the bits of the last word that are used by InNumBits bits.
+	static constexpr uint64 GetLastWordMask(int32 InNumBits)
+	{
+		return (InNumBits % NumBitsPerWord) == 0 ? ~0ull : (1ull << (InNumBits % NumBitsPerWord)) - 1;
+	}
+
+	// Sets or clears InNumBits bits starting at InStartIndex, a word at a time.
+	static void SetRange(uint64* InOutWords, int32 InStartIndex, int32 InNumBits, bool bValue);
+
+	// Returns the number of set bits.
+	static int32 CountSetBits(const uint64* InWords, int32 InNumWords);
+
+	/**
+	 * Finds the first set or clear bit at or after InStartIndex.
+	 *
+	 * @param InNumBits: Number of bits in the words. Clear bits past it are not returned.
+	 * @returns: Index of the bit, or InvalidIndex if there is none.
+	 */
+	static int32 FindFirstSetBit(const uint64* InWords, int32 InNumBits, int32 InStartIndex);
+	static int32 FindFirstClearBit(const uint64* InWords, int32 InNumBits, int32 InStartIndex);
+
+	// Combines InWords into InOutWords, using SIMD registers when available.
+	static void And(uint64* InOutWords, const uint64* InWords, int32 InNumWords);
+	static void Or(uint64* InOutWords, const uint64* InWords, int32 InNumWords);
+	// InOutWords & ~InWords.
+	static void AndNot(uint64* InOutWords, const uint64* InWords, int32 InNumWords);
+};
+
+/**
+ * Iterator over the indices of the set bits of a bit array, in increasing order.
+ * Skips clear words entirely and finds set bits with a bit scan, so iterating over sparse bit arrays
+ * costs a word load per 64 bits plus a bit scan per set bit.
+ */
+class FSetBitIterator
+{
+public:
+	FSetBitIterator(const uint64* InWords, int32 InNumWords, int32 InWordIndex)
+		: Words(InWords)
+		, NumWords(InNumWords)
+		, WordIndex(InWordIndex)
+		, Word(InWordIndex < InNumWords ? InWords[InWordIndex] : 0)
+	{
+		if (WordIndex < NumWords)
+		{
+			SkipClearWords();
+		}
+	}
+
+	int32 operator*() const
+	{
+		return WordIndex * FBitArrayWords::NumBitsPerWord + FMath::CountTrailingZeros(Word);
+	}
+
+	FSetBitIterator& operator++()
+	{
+		// Clear the lowest set bit.
+		Word &= Word - 1;
+		SkipClearWords();
+		return *this;
+	}
+
+	bool operator!=(const FSetBitIterator& InOther) const
+	{
+		return WordIndex != InOther.WordIndex || Word != InOther.Word;
+	}
+
+private:
+	void SkipClearWords()
+	{
+		while (Word == 0)
+		{
+			if (++WordIndex >= NumWords)
+			{
+				WordIndex = NumWords;
+				return;
+			}
+			Word = Words[WordIndex];
+		}
+	}
+
+	const uint64* Words;
+	int32 NumWords;
+	int32 WordIndex;
+	// Bits of the current word that haven't been visited yet.
+	uint64 Word;
+};
+
+// Range of set bits, used as: for (int32 BitIndex : BitArray.GetSetBits()).
+struct FSetBitRange
+{
+	const uint64* Words;
+	int32 NumWords;
+
+	FSetBitIterator begin() const
+	{
+		return FSetBitIterator(Words, NumWords, 0);
+	}
+
+	FSetBitIterator end() const
+	{
+		return FSetBitIterator(Words, NumWords, NumWords);
+	}
+};
+
+/**
+ * Dynamically resizable array of bits, packed in 64-bit words.
+ *
+ * Uses an eighth of the memory of a TArray<bool>, and works on whole words where it can:
+ * ranges are set a word at a time, bits are counted with popcount, set bits are found with a bit scan,
+ * and bit arrays are combined with SIMD registers.
+ */
+class FBitArray
+{
+public:
+	/**
+	 * Default constructor. Does not allocate any memory.
+	 *
+	 * @param InAllocator: Allocator for the words. Must outlive the bit array.
+	 */
+	explicit FBitArray(IAllocator& InAllocator = FDefaultBitArrayAllocator::GetDefaultAllocator())
+		: Allocator(&InAllocator)
+	{
+	}
+
+	/**
+	 * Constructor that creates InNumBits bits with the same value.
+	 *
+	 * @param InNumBits: Number of bits.
+	 * @param bValue: Value of the bits.
+	 * @param InAllocator: Allocator for the words. Must outlive the bit array.
+	 */
+	FBitArray(int32 InNumBits, bool bValue, IAllocator& InAllocator = FDefaultBitArrayAllocator::GetDefaultAllocator());
+
+	// Copy constructor. The copy uses the same allocator as InOther.
+	FBitArray(const FBitArray& InOther)
+		: FBitArray(InOther, *InOther.Allocator)
+	{
+	}
+
+	// Copies InOther into memory from InAllocator.
+	FBitArray(const FBitArray& InOther, IAllocator& InAllocator);
+
+	// Takes InOther's memory and allocator, leaving it empty.
+	FBitArray(FBitArray&& InOther);
+
+	~FBitArray();
+
+	// Copy assignment operator. Keeps this bit array's allocator.
+	FBitArray& operator=(const FBitArray& InOther);
+
+	// Move assignment operator. Takes InOther's memory if both bit arrays use the same allocator, copies it otherwise.
+	FBitArray& operator=(FBitArray&& InOther);
+
+	/**
+	 * Adds a bit at the end of the bit array.
+	 *
+	 * @param bValue: Value of the bit.
+	 * @returns: Index of the bit.
+	 */
+	int32 Add(bool bValue)
+	{
+		if (NumBits == MaxWords * FBitArrayWords::NumBitsPerWord)
+		{
+			Reserve(NumBits == 0 ? FBitArrayWords::NumBitsPerWord : NumBits * 2);
+		}
+		const int32 Index = NumBits++;
+		if (bValue)
+		{
+			SetBit(Index);
+		}
+		return Index;
+	}
+
+	/**
+	 * Resizes the bit array. Bits that are added get bValue, bits that are kept keep their value.
+	 *
+	 * @param InNumBits: New number of bits.
+	 * @param bValue: Value of the added bits.
+	 */
+	void SetNum(int32 InNumBits, bool bValue = false);
+
+	// Removes all bits. Memory is kept for reuse.
+	void Empty()
+	{
+		SetNum(0);
+	}
+
+	/**
+	 * Allocates enough memory for at least InNumBits bits.
+	 *
+	 * @param InNumBits: Requested number of bits.
+	 */
+	void Reserve(int32 InNumBits);
+
+	// Bit accessors. The index must be in range.
+	bool operator[](int32 InIndex) const
+	{
+		return IsBitSet(InIndex);
+	}
+	bool IsBitSet(int32 InIndex) const
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		return (Words[InIndex / FBitArrayWords::NumBitsPerWord] >> (InIndex % FBitArrayWords::NumBitsPerWord)) & 1;
+	}
+	void SetBit(int32 InIndex)
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		Words[InIndex / FBitArrayWords::NumBitsPerWord] |= 1ull << (InIndex % FBitArrayWords::NumBitsPerWord);
+	}
+	void ClearBit(int32 InIndex)
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		Words[InIndex / FBitArrayWords::NumBitsPerWord] &= ~(1ull << (InIndex % FBitArrayWords::NumBitsPerWord));
+	}
+	void SetBitValue(int32 InIndex, bool bValue)
+	{
+		bValue ? SetBit(InIndex) : ClearBit(InIndex);
+	}
+
+	/**
+	 * Sets or clears a range of bits, a word at a time.
+	 *
+	 * @param InStartIndex: Index of the first bit.
+	 * @param InNumBits: Number of bits. The range must be within the bit array.
+	 * @param bValue: Value of the bits.
+	 */
+	void SetRange(int32 InStartIndex, int32 InNumBits, bool bValue)
+	{
+		ensure(0 <= InStartIndex && 0 <= InNumBits && InStartIndex + InNumBits <= NumBits);
+		FBitArrayWords::SetRange(Words, InStartIndex, InNumBits, bValue);
+	}
+
+	void SetAll(bool bValue)
+	{
+		SetRange(0, NumBits, bValue);
+	}
+
+	int32 CountSetBits() const
+	{
+		return FBitArrayWords::CountSetBits(Words, GetNumWords());
+	}
+
+	/**
+	 * Finds the first set or clear bit at or after InStartIndex.
+	 *
+	 * @returns: Index of the bit, or InvalidIndex if there is none.
+	 */
+	int32 FindFirstSetBit(int32 InStartIndex = 0) const
+	{
+		return FBitArrayWords::FindFirstSetBit(Words, NumBits, InStartIndex);
+	}
+	int32 FindFirstClearBit(int32 InStartIndex = 0) const
+	{
+		return FBitArrayWords::FindFirstClearBit(Words, NumBits, InStartIndex);
+	}
+
+	// Returns a range over the indices of the set bits.
+	FSetBitRange GetSetBits() const
+	{
+		return { Words, GetNumWords() };
+	}
+
+	/**
+	 * Combines another bit array into this one, bit by bit. Both must have the same number of bits.
+	 *
+	 * @param InOther: Bit array to combine with.
+	 */
+	void BitwiseAnd(const FBitArray& InOther)
+	{
+		ensure(NumBits == InOther.NumBits);
+		FBitArrayWords::And(Words, InOther.Words, GetNumWords());
+	}
+	void BitwiseOr(const FBitArray& InOther)
+	{
+		ensure(NumBits == InOther.NumBits);
+		FBitArrayWords::Or(Words, InOther.Words, GetNumWords());
+	}
+	// Clears the bits that are set in InOther.
+	void BitwiseAndNot(const FBitArray& InOther)
+	{
+		ensure(NumBits == InOther.NumBits);
+		FBitArrayWords::AndNot(Words, InOther.Words, GetNumWords());
+	}
+
+	bool operator==(const FBitArray& InOther) const;
+	bool operator!=(const FBitArray& InOther) const
+	{
+		return !(*this == InOther);
+	}
+
+	// Getters.
+	int32 GetSize() const
+	{
+		return NumBits;
+	}
+	bool IsEmpty() const
+	{
+		return NumBits == 0;
+	}
+	int32 GetNumWords() const
+	{
+		return FBitArrayWords::GetNumWords(NumBits);
+	}
+	const uint64* GetWords() const
+	{
+		return Words;
+	}
+
+private:
+	void ReleaseWords();
+
+	uint64* Words = nullptr;
+	int32 NumBits = 0;
+	// Number of allocated words.
+	int32 MaxWords = 0;
+	IAllocator* Allocator = nullptr;
+};
+
+/**
+ * Array of NumBits bits stored inline, for sets of flags whose size is known at compile time.
+ * Has the same operations as FBitArray, without allocating.
+ */
+template<int32 NumBits>
+class TStaticBitArray
+{
+	static_assert(NumBits > 0, "TStaticBitArray must have at least one bit.");
+
+public:
+	static constexpr int32 NumWords = FBitArrayWords::GetNumWords(NumBits);
+
+	// Default constructor. All bits are clear.
+	TStaticBitArray() = default;
+
+	// Bit accessors. The index must be in range.
+	bool operator[](int32 InIndex) const
+	{
+		return IsBitSet(InIndex);
+	}
+	bool IsBitSet(int32 InIndex) const
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		return (Words[InIndex / FBitArrayWords::NumBitsPerWord] >> (InIndex % FBitArrayWords::NumBitsPerWord)) & 1;
+	}
+	void SetBit(int32 InIndex)
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		Words[InIndex / FBitArrayWords::NumBitsPerWord] |= 1ull << (InIndex % FBitArrayWords::NumBitsPerWord);
+	}
+	void ClearBit(int32 InIndex)
+	{
+		ensure(0 <= InIndex && InIndex < NumBits);
+		Words[InIndex / FBitArrayWords::NumBitsPerWord] &= ~(1ull << (InIndex % FBitArrayWords::NumBitsPerWord));
+	}
+	void SetBitValue(int32 InIndex, bool bValue)
+	{
+		bValue ? SetBit(InIndex) : ClearBit(InIndex);
+	}
+
+	// Sets or clears a range of bits, a word at a time. The range must be within the bit array.
+	void SetRange(int32 InStartIndex, int32 InNumBits, bool bValue)
+	{
+		ensure(0 <= InStartIndex && 0 <= InNumBits && InStartIndex + InNumBits <= NumBits);
+		FBitArrayWords::SetRange(Words, InStartIndex, InNumBits, bValue);
+	}
+
+	void SetAll(bool bValue)
+	{
+		SetRange(0, NumBits, bValue);
+	}
+
+	int32 CountSetBits() const
+	{
+		return FBitArrayWords::CountSetBits(Words, NumWords);
+	}
+
+	// Returns the index of the first set or clear bit at or after InStartIndex, or InvalidIndex if there is none.
+	int32 FindFirstSetBit(int32 InStartIndex = 0) const
+	{
+		return FBitArrayWords::FindFirstSetBit(Words, NumBits, InStartIndex);
+	}
+	int32 FindFirstClearBit(int32 InStartIndex = 0) const
+	{
+		return FBitArrayWords::FindFirstClearBit(Words, NumBits, InStartIndex);
+	}
+
+	// Returns a range over the indices of the set bits.
+	FSetBitRange GetSetBits() const
+	{
+		return { Words, NumWords };
+	}
+
+	// Combines another bit array into this one, bit by bit.
+	void BitwiseAnd(const TStaticBitArray& InOther)
+	{
+		FBitArrayWords::And(Words, InOther.Words, NumWords);
+	}
+	void BitwiseOr(const TStaticBitArray& InOther)
+	{
+		FBitArrayWords::Or(Words, InOther.Words, NumWords);
+	}
+	// Clears the bits that are set in InOther.
+	void BitwiseAndNot(const TStaticBitArray& InOther)
+	{
+		FBitArrayWords::AndNot(Words, InOther.Words, NumWords);
+	}
+
+	bool operator==(const TStaticBitArray& InOther) const
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if (Words[WordIndex] != InOther.Words[WordIndex])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	bool operator!=(const TStaticBitArray& InOther) const
+	{
+		return !(*this == InOther);
+	}
+
+	// Getters.
+	static constexpr int32 GetSize()
+	{
+		return NumBits;
+	}
+	const uint64* GetWords() const
+	{
+		return Words;
+	}
+
+private:
+	uint64 Words[NumWords] = {};
+};
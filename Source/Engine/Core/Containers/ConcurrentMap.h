@@ -0,0 +1,549 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Containers/Map.h"
+#include "Memory/EpochManager.h"
+#include "Memory/PoolAllocator.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+// System includes for atomics, the shard locks and placement new.
+#include <atomic>
+#include <mutex>
+#include <new>
+
+using FDefaultConcurrentMapAllocator = FPoolAllocator;
+
+namespace NConcurrentMapPrivate
+{
+	// Whether a value can be replaced in place with a single lock-free store.
+	template<typename ValueType, bool bIsTriviallyCopyable = __is_trivially_copyable(ValueType)>
+	struct TIsAtomicValue
+	{
+		static constexpr bool Value = std::atomic<ValueType>::is_always_lock_free;
+	};
+
+	template<typename ValueType>
+	struct TIsAtomicValue<ValueType, false>
+	{
+		static constexpr bool Value = false;
+	};
+
+	// Value of a pair that writers replace in place, e.g. a handle or a pointer.
+	template<typename ValueType, bool bIsAtomic = TIsAtomicValue<ValueType>::Value>
+	struct TValue
+	{
+		template<typename ValueArgType>
+		explicit TValue(ValueArgType&& InValue)
+			: Value(Forward<ValueArgType>(InValue))
+		{
+		}
+
+		// Acquire and release, so that readers see what a value points to as it was when the value was stored.
+		ValueType Load() const
+		{
+			return Value.load(std::memory_order_acquire);
+		}
+		void Store(const ValueType& InValue)
+		{
+			Value.store(InValue, std::memory_order_release);
+		}
+
+		std::atomic<ValueType> Value;
+	};
+
+	// Value of a pair that is never modified once published. Writers replace the whole pair instead.
+	template<typename ValueType>
+	struct TValue<ValueType, false>
+	{
+		template<typename ValueArgType>
+		explicit TValue(ValueArgType&& InValue)
+			: Value(Forward<ValueArgType>(InValue))
+		{
+		}
+
+		const ValueType& Load() const
+		{
+			return Value;
+		}
+
+		const ValueType Value;
+	};
+}
+
+/**
+ * Hash map for data that many threads read all the time and a few threads write now and then, such as
+ * registries that loaders fill while the render path looks them up.
+ *
+ * Readers never lock and never write shared memory besides their own epoch: Find probes the table inside an
+ * epoch read scope and copies the value out. Writers lock one of NumShards shards, chosen by the key's hash,
+ * so writers to different shards don't wait on each other.
+ *
+ * Each shard is an open-addressing table of pointers to pairs. Values that fit a lock-free atomic, such as
+ * handles and pointers, are replaced in place. Other values are never modified once published; writers link
+ * in a new pair instead and retire the old one through FEpochManager, which frees it once no reader can be
+ * looking at it. Removing a pair leaves a marker in its slot for lookups to probe past. When a table fills
+ * up with pairs and markers, the pointers are copied into a new table and the old one is retired; the pairs
+ * themselves are neither copied nor moved.
+ *
+ * Readers see every write that completed before they began, and each lookup sees either the old or the new
+ * value of a concurrent write. Writes are slower than TMap's and values are copied out, so values should be
+ * small, e.g. handles or pointers to objects with a lifetime of their own.
+ */
+template<typename KeyType, typename ValueType, typename KeyOperations = TDefaultMapKeyOperationsPolicy<KeyType, ValueType>>
+class TConcurrentMap
+{
+	using KeyConstParamType = typename TCallTraits<KeyType>::ConstParamType;
+
+public:
+	static_assert(alignof(KeyType) <= alignof(uint64) && alignof(ValueType) <= alignof(uint64), "Pairs are only aligned to 8 bytes.");
+
+	// Number of independently locked shards. A power of two.
+	static constexpr int32 NumShards = 16;
+	// Number of slots each shard starts with. A power of two.
+	static constexpr int32 MinNumSlots = 16;
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InAllocator: Allocator for the pairs and slot tables. Must be usable from several threads at once,
+	 * and outlive the map.
+	 */
+	explicit TConcurrentMap(IAllocator& InAllocator = FDefaultConcurrentMapAllocator::GetDefaultAllocator());
+
+	// Destructor. No thread may use the map anymore. Waits for readers of any epoch-protected data to leave their scopes.
+	~TConcurrentMap();
+
+	// Non-copyable.
+	TConcurrentMap(const TConcurrentMap&) = delete;
+	TConcurrentMap& operator=(const TConcurrentMap&) = delete;
+
+	/**
+	 * Adds a pair if the key isn't in the map yet.
+	 *
+	 * @returns: false if the key was already in the map, in which case its value is left unchanged.
+	 */
+	bool Add(KeyConstParamType InKey, const ValueType& InValue)
+	{
+		return Emplace(false, InKey, InValue);
+	}
+
+	bool Add(KeyConstParamType InKey, ValueType&& InValue)
+	{
+		return Emplace(false, InKey, MoveTemp(InValue));
+	}
+
+	/**
+	 * Adds a pair, or replaces the value of a key that is already in the map.
+	 *
+	 * @returns: true if the pair was added, false if a value was replaced.
+	 */
+	bool AddOrReplace(KeyConstParamType InKey, const ValueType& InValue)
+	{
+		return Emplace(true, InKey, InValue);
+	}
+
+	bool AddOrReplace(KeyConstParamType InKey, ValueType&& InValue)
+	{
+		return Emplace(true, InKey, MoveTemp(InValue));
+	}
+
+	/**
+	 * Removes a pair. Readers that found it before may still be copying its value.
+	 *
+	 * @returns: true if the key was in the map.
+	 */
+	bool Remove(KeyConstParamType InKey);
+
+	/**
+	 * Finds the value of a key without locking.
+	 *
+	 * @param OutValue: Assigned a copy of the value if the key was found.
+	 * @returns: true if the key was found.
+	 */
+	bool Find(KeyConstParamType InKey, ValueType& OutValue) const;
+
+	bool IsKeyContained(KeyConstParamType InKey) const;
+
+	// Removes all pairs and shrinks every shard back to MinNumSlots.
+	void Empty();
+
+	// Approximate number of pairs, exact only when no thread is writing.
+	int32 GetSize() const;
+	bool IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+
+private:
+	using FValue = NConcurrentMapPrivate::TValue<ValueType>;
+	static constexpr bool bReplacesValuesInPlace = NConcurrentMapPrivate::TIsAtomicValue<ValueType>::Value;
+
+	struct FNode
+	{
+		template<typename ValueArgType>
+		FNode(uint64 InHash, KeyConstParamType InKey, ValueArgType&& InValue)
+			: Hash(InHash)
+			, Key(InKey)
+			, Value(Forward<ValueArgType>(InValue))
+		{
+		}
+
+		uint64 Hash;
+		const KeyType Key;
+		FValue Value;
+	};
+
+	// A shard's slots follow the table header in the same allocation.
+	struct FTable
+	{
+		uint64 Mask;
+
+		std::atomic<FNode*>* GetSlots()
+		{
+			return reinterpret_cast<std::atomic<FNode*>*>(this + 1);
+		}
+		int32 GetNumSlots() const
+		{
+			return static_cast<int32>(Mask + 1);
+		}
+	};
+
+	// On a cache line of its own, so that a writer locking one shard doesn't evict its neighbours' tables from readers.
+	struct alignas(PlatformCacheLineSize) FShard
+	{
+		std::mutex Mutex;
+		std::atomic<FTable*> Table{ nullptr };
+		std::atomic<int32> Size{ 0 };
+		// Number of slots holding the removed pair marker. Only accessed with the lock held.
+		int32 NumRemovedSlots = 0;
+	};
+
+	// Left in the slot of a removed pair. Nodes are aligned to 8 bytes, so no node has this address.
+	static FNode* GetRemovedSlotMarker()
+	{
+		return reinterpret_cast<FNode*>(static_cast<uint64>(1));
+	}
+
+	template<typename ValueArgType>
+	bool Emplace(bool bReplaceExisting, KeyConstParamType InKey, ValueArgType&& InValue);
+
+	// Finds the node of a key, or nullptr. Must be called in a read scope, or with the shard lock held.
+	static FNode* FindNode(FTable& InTable, uint64 InHash, KeyConstParamType InKey);
+
+	/**
+	 * Finds the slot of a key, or the slot to add it in if it isn't in the table: the first slot of a removed
+	 * pair along the way, or the empty slot that ends the probe sequence. The shard lock must be held.
+	 *
+	 * @param bOutFound: Set to whether the slot holds the key.
+	 */
+	static std::atomic<FNode*>& FindSlot(FTable& InTable, uint64 InHash, KeyConstParamType InKey, bool& bOutFound);
+
+	// Copies the shard's pairs into a table at most a quarter full, dropping the removed pair markers. The shard lock must be held.
+	void Rebuild(FShard& InShard);
+
+	template<typename ValueArgType>
+	FNode* CreateNode(uint64 InHash, KeyConstParamType InKey, ValueArgType&& InValue);
+	FTable* CreateTable(int32 InNumSlots);
+
+	// Deleters for FEpochManager::Retire, with the allocator as the context.
+	static void DestroyNode(void* InNode, void* InAllocator);
+	// Frees a table whose nodes have been copied into another.
+	static void DestroyTable(void* InTable, void* InAllocator);
+	// Destroys a table along with its nodes.
+	static void DestroyTableAndNodes(void* InTable, void* InAllocator);
+
+	static uint64 GetHash(KeyConstParamType InKey)
+	{
+		return MixHash(KeyOperations::GetHashFromKey(InKey));
+	}
+
+	// Shards are picked from the high bits and slots from the low bits, so that a shard's keys spread over its slots.
+	static int32 GetShardIndex(uint64 InHash)
+	{
+		return static_cast<int32>(InHash >> 60);
+	}
+
+	static_assert(NumShards == 16, "GetShardIndex takes the top 4 bits of the hash.");
+
+	FShard Shards[NumShards];
+	IAllocator* Allocator = nullptr;
+	// Cached, so that lookups don't go through FEpochManager::Get.
+	FEpochManager* EpochManager = nullptr;
+};
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+TConcurrentMap<KeyType, ValueType, KeyOperations>::TConcurrentMap(IAllocator& InAllocator)
+	: Allocator(&InAllocator)
+	, EpochManager(&FEpochManager::Get())
+{
+	for (FShard& Shard : Shards)
+	{
+		Shard.Table.store(CreateTable(MinNumSlots), std::memory_order_release);
+	}
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+TConcurrentMap<KeyType, ValueType, KeyOperations>::~TConcurrentMap()
+{
+	// Free what this map retired while its allocator is still alive.
+	EpochManager->Synchronize();
+	for (FShard& Shard : Shards)
+	{
+		DestroyTableAndNodes(Shard.Table.load(std::memory_order_relaxed), Allocator);
+	}
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+bool TConcurrentMap<KeyType, ValueType, KeyOperations>::Remove(KeyConstParamType InKey)
+{
+	const uint64 Hash = GetHash(InKey);
+	FShard& Shard = Shards[GetShardIndex(Hash)];
+	std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+	bool bFound;
+	std::atomic<FNode*>& Slot = FindSlot(*Shard.Table.load(std::memory_order_relaxed), Hash, InKey, bFound);
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// Readers that loaded the node before can still read it.
+	FNode* Node = Slot.load(std::memory_order_relaxed);
+	Slot.store(GetRemovedSlotMarker(), std::memory_order_relaxed);
+	++Shard.NumRemovedSlots;
+	Shard.Size.store(Shard.Size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+	EpochManager->Retire(Node, &DestroyNode, Allocator);
+	return true;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+bool TConcurrentMap<KeyType, ValueType, KeyOperations>::Find(KeyConstParamType InKey, ValueType& OutValue) const
+{
+	const uint64 Hash = GetHash(InKey);
+	const FShard& Shard = Shards[GetShardIndex(Hash)];
+
+	FEpochReadScope ReadScope(*EpochManager);
+	// Acquire, so that the nodes a writer added before publishing the table are visible.
+	if (const FNode* Node = FindNode(*Shard.Table.load(std::memory_order_acquire), Hash, InKey))
+	{
+		OutValue = Node->Value.Load();
+		return true;
+	}
+	return false;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+bool TConcurrentMap<KeyType, ValueType, KeyOperations>::IsKeyContained(KeyConstParamType InKey) const
+{
+	const uint64 Hash = GetHash(InKey);
+	const FShard& Shard = Shards[GetShardIndex(Hash)];
+
+	FEpochReadScope ReadScope(*EpochManager);
+	return FindNode(*Shard.Table.load(std::memory_order_acquire), Hash, InKey) != nullptr;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+void TConcurrentMap<KeyType, ValueType, KeyOperations>::Empty()
+{
+	for (FShard& Shard : Shards)
+	{
+		std::lock_guard<std::mutex> Lock(Shard.Mutex);
+		FTable* OldTable = Shard.Table.load(std::memory_order_relaxed);
+		Shard.Table.store(CreateTable(MinNumSlots), std::memory_order_release);
+		Shard.Size.store(0, std::memory_order_relaxed);
+		Shard.NumRemovedSlots = 0;
+		EpochManager->Retire(OldTable, &DestroyTableAndNodes, Allocator);
+	}
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+int32 TConcurrentMap<KeyType, ValueType, KeyOperations>::GetSize() const
+{
+	int32 Size = 0;
+	for (const FShard& Shard : Shards)
+	{
+		Size += Shard.Size.load(std::memory_order_relaxed);
+	}
+	return Size;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+template<typename ValueArgType>
+bool TConcurrentMap<KeyType, ValueType, KeyOperations>::Emplace(bool bReplaceExisting, KeyConstParamType InKey, ValueArgType&& InValue)
+{
+	const uint64 Hash = GetHash(InKey);
+	FShard& Shard = Shards[GetShardIndex(Hash)];
+	std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+	FTable& Table = *Shard.Table.load(std::memory_order_relaxed);
+	bool bFound;
+	std::atomic<FNode*>& Slot = FindSlot(Table, Hash, InKey, bFound);
+	if (bFound)
+	{
+		if (bReplaceExisting)
+		{
+			FNode* OldNode = Slot.load(std::memory_order_relaxed);
+			if constexpr (bReplacesValuesInPlace)
+			{
+				OldNode->Value.Store(InValue);
+			}
+			else
+			{
+				// Readers see either the old node or the new one, which takes the old one's slot.
+				Slot.store(CreateNode(Hash, InKey, Forward<ValueArgType>(InValue)), std::memory_order_release);
+				EpochManager->Retire(OldNode, &DestroyNode, Allocator);
+			}
+		}
+		return false;
+	}
+
+	if (Slot.load(std::memory_order_relaxed) == GetRemovedSlotMarker())
+	{
+		--Shard.NumRemovedSlots;
+	}
+	// Release, so that readers that find the node see it constructed.
+	Slot.store(CreateNode(Hash, InKey, Forward<ValueArgType>(InValue)), std::memory_order_release);
+
+	const int32 Size = Shard.Size.load(std::memory_order_relaxed) + 1;
+	Shard.Size.store(Size, std::memory_order_relaxed);
+	// Keeps at least half of the slots empty, since every slot a lookup probes past costs a load from another node.
+	if ((Size + Shard.NumRemovedSlots) * 2 > Table.GetNumSlots())
+	{
+		Rebuild(Shard);
+	}
+	return true;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+/*static*/ typename TConcurrentMap<KeyType, ValueType, KeyOperations>::FNode* TConcurrentMap<KeyType, ValueType, KeyOperations>::FindNode(FTable& InTable, uint64 InHash, KeyConstParamType InKey)
+{
+	std::atomic<FNode*>* Slots = InTable.GetSlots();
+	for (uint64 SlotIndex = InHash & InTable.Mask; ; SlotIndex = (SlotIndex + 1) & InTable.Mask)
+	{
+		// Acquire, so that a node added while the table was published is seen constructed.
+		FNode* Node = Slots[SlotIndex].load(std::memory_order_acquire);
+		if (!Node)
+		{
+			return nullptr;
+		}
+		if (Node != GetRemovedSlotMarker() && Node->Hash == InHash && KeyOperations::DoKeysMatch(Node->Key, InKey))
+		{
+			return Node;
+		}
+	}
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+/*static*/ std::atomic<typename TConcurrentMap<KeyType, ValueType, KeyOperations>::FNode*>& TConcurrentMap<KeyType, ValueType, KeyOperations>::FindSlot(FTable& InTable, uint64 InHash, KeyConstParamType InKey, bool& bOutFound)
+{
+	std::atomic<FNode*>* Slots = InTable.GetSlots();
+	std::atomic<FNode*>* RemovedSlot = nullptr;
+	for (uint64 SlotIndex = InHash & InTable.Mask; ; SlotIndex = (SlotIndex + 1) & InTable.Mask)
+	{
+		FNode* Node = Slots[SlotIndex].load(std::memory_order_relaxed);
+		if (!Node)
+		{
+			bOutFound = false;
+			return RemovedSlot ? *RemovedSlot : Slots[SlotIndex];
+		}
+		if (Node == GetRemovedSlotMarker())
+		{
+			if (!RemovedSlot)
+			{
+				RemovedSlot = &Slots[SlotIndex];
+			}
+		}
+		else if (Node->Hash == InHash && KeyOperations::DoKeysMatch(Node->Key, InKey))
+		{
+			bOutFound = true;
+			return Slots[SlotIndex];
+		}
+	}
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+void TConcurrentMap<KeyType, ValueType, KeyOperations>::Rebuild(FShard& InShard)
+{
+	int32 NumSlots = MinNumSlots;
+	while (NumSlots < InShard.Size.load(std::memory_order_relaxed) * 4)
+	{
+		NumSlots *= 2;
+	}
+
+	// Readers may still be probing the old table, so it is left as it is until it is retired.
+	FTable* OldTable = InShard.Table.load(std::memory_order_relaxed);
+	FTable* NewTable = CreateTable(NumSlots);
+	std::atomic<FNode*>* OldSlots = OldTable->GetSlots();
+	std::atomic<FNode*>* NewSlots = NewTable->GetSlots();
+	for (int32 OldSlotIndex = 0; OldSlotIndex < OldTable->GetNumSlots(); ++OldSlotIndex)
+	{
+		FNode* Node = OldSlots[OldSlotIndex].load(std::memory_order_relaxed);
+		if (!Node || Node == GetRemovedSlotMarker())
+		{
+			continue;
+		}
+
+		uint64 SlotIndex = Node->Hash & NewTable->Mask;
+		while (NewSlots[SlotIndex].load(std::memory_order_relaxed))
+		{
+			SlotIndex = (SlotIndex + 1) & NewTable->Mask;
+		}
+		NewSlots[SlotIndex].store(Node, std::memory_order_relaxed);
+	}
+
+	InShard.NumRemovedSlots = 0;
+	InShard.Table.store(NewTable, std::memory_order_release);
+	EpochManager->Retire(OldTable, &DestroyTable, Allocator);
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+template<typename ValueArgType>
+typename TConcurrentMap<KeyType, ValueType, KeyOperations>::FNode* TConcurrentMap<KeyType, ValueType, KeyOperations>::CreateNode(uint64 InHash, KeyConstParamType InKey, ValueArgType&& InValue)
+{
+	void* Memory = Allocator->Allocate(static_cast<int32>(sizeof(FNode)));
+	ensure(Memory);
+	return new (Memory) FNode(InHash, InKey, Forward<ValueArgType>(InValue));
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+typename TConcurrentMap<KeyType, ValueType, KeyOperations>::FTable* TConcurrentMap<KeyType, ValueType, KeyOperations>::CreateTable(int32 InNumSlots)
+{
+	void* Memory = Allocator->Allocate(static_cast<int32>(sizeof(FTable) + sizeof(std::atomic<FNode*>) * InNumSlots));
+	ensure(Memory);
+	FTable* Table = new (Memory) FTable{ static_cast<uint64>(InNumSlots - 1) };
+	for (int32 SlotIndex = 0; SlotIndex < InNumSlots; ++SlotIndex)
+	{
+		new (&Table->GetSlots()[SlotIndex]) std::atomic<FNode*>(nullptr);
+	}
+	return Table;
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+/*static*/ void TConcurrentMap<KeyType, ValueType, KeyOperations>::DestroyNode(void* InNode, void* InAllocator)
+{
+	static_cast<FNode*>(InNode)->~FNode();
+	static_cast<IAllocator*>(InAllocator)->Deallocate(InNode);
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+/*static*/ void TConcurrentMap<KeyType, ValueType, KeyOperations>::DestroyTable(void* InTable, void* InAllocator)
+{
+	static_cast<IAllocator*>(InAllocator)->Deallocate(InTable);
+}
+
+template<typename KeyType, typename ValueType, typename KeyOperations>
+/*static*/ void TConcurrentMap<KeyType, ValueType, KeyOperations>::DestroyTableAndNodes(void* InTable, void* InAllocator)
+{
+	FTable* Table = static_cast<FTable*>(InTable);
+	std::atomic<FNode*>* Slots = Table->GetSlots();
+	for (int32 SlotIndex = 0; SlotIndex < Table->GetNumSlots(); ++SlotIndex)
+	{
+		FNode* Node = Slots[SlotIndex].load(std::memory_order_relaxed);
+		if (Node && Node != GetRemovedSlotMarker())
+		{
+			DestroyNode(Node, InAllocator);
+		}
+	}
+	DestroyTable(Table, InAllocator);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Containers/Array.h"
+
+/**
+ * Array that stores its first InlineCapacity elements within itself, and only allocates memory once it grows
+ * past them. Suited to arrays that are usually short, such as the components of a face or the properties of
+ * a material. It can be passed wherever a TArray is expected.
+ */
+template<typename ElementType, int32 InlineCapacity>
+class TInlineArray : public TArray<ElementType>
+{
+public:
+	static_assert(InlineCapacity > 0, "Inline arrays must have room for at least one element.");
+
+	/**
+	 * Default constructor. Does not allocate any memory.
+	 *
+	 * @param InAllocator: Allocator used once the array outgrows its inline storage.
+	 */
+	explicit TInlineArray(IAllocator& InAllocator = FDefaultArrayAllocator::GetDefaultAllocator())
+		: TArray<ElementType>(reinterpret_cast<ElementType*>(InlineStorage), InlineCapacity, InAllocator)
+	{
+	}
+
+	// Copy constructors. Use InArray's allocator, but this array's inline storage.
+	TInlineArray(const TInlineArray& InArray)
+		: TInlineArray(const_cast<IAllocator&>(*InArray.GetAllocator()))
+	{
+		this->Append(InArray);
+	}
+
+	TInlineArray(const TArray<ElementType>& InArray)
+		: TInlineArray(const_cast<IAllocator&>(*InArray.GetAllocator()))
+	{
+		this->Append(InArray);
+	}
+
+	// Copy assignment operator. Does not copy InArray's allocator.
+	TInlineArray& operator=(const TInlineArray& InArray)
+	{
+		TArray<ElementType>::operator=(InArray);
+		return *this;
+	}
+
+private:
+	alignas(ElementType) int8 InlineStorage[InlineCapacity * sizeof(ElementType)];
+};
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
+#include "Memory/PoolAllocator.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+// System includes for atomics and placement new.
+#include <atomic>
+#include <new>
+
+using FDefaultMPMCQueueAllocator = FPoolAllocator;
+
+/**
+ * Bounded queue for any number of producer and consumer threads, such as workers posting results to the
+ * main thread. This is Dmitry Vyukov's bounded MPMC queue: a ring buffer where each slot has a sequence
+ * number that tells whether it is ready to be written or read for a given position.
+ *
+ * Producers claim a position with a compare-and-swap on the enqueue index, then construct the element and
+ * publish it by updating the slot's sequence. Consumers do the same on the dequeue index. Producers and
+ * consumers only contend with each other through the slots, and the two indices are on separate cache lines.
+ *
+ * Lock-free but not wait-free: a thread that stops between claiming a slot and publishing it holds up the
+ * threads that reach that slot after it. With a single producer and a single consumer, TSPSCQueue is faster.
+ */
+template<typename ElementType>
+class TMPMCQueue
+{
+public:
+	static_assert(alignof(ElementType) <= alignof(uint64), "Queue elements are only aligned to 8 bytes.");
+
+	/**
+	 * Constructor. Allocates the ring buffer.
+	 *
+	 * @param InCapacity: Maximum number of elements in the queue, rounded up to a power of two of at least 2.
+	 * @param InAllocator: Allocator for the ring buffer. Must outlive the queue and be usable from the thread that destroys it.
+	 */
+	explicit TMPMCQueue(int32 InCapacity, IAllocator& InAllocator = FDefaultMPMCQueueAllocator::GetDefaultAllocator());
+
+	// Destroys the elements left in the queue. No thread may use the queue anymore.
+	~TMPMCQueue();
+
+	// Non-copyable.
+	TMPMCQueue(const TMPMCQueue&) = delete;
+	TMPMCQueue& operator=(const TMPMCQueue&) = delete;
+
+	/**
+	 * Constructs an element at the back of the queue.
+	 *
+	 * @returns: false if the queue is full, in which case InArgs are left untouched.
+	 */
+	template<typename... ArgTypes>
+	bool Emplace(ArgTypes&&... InArgs);
+
+	bool Enqueue(const ElementType& InElement)
+	{
+		return Emplace(InElement);
+	}
+
+	bool Enqueue(ElementType&& InElement)
+	{
+		return Emplace(MoveTemp(InElement));
+	}
+
+	/**
+	 * Moves the element at the front of the queue out.
+	 *
+	 * @param OutElement: Assigned the element.
+	 * @returns: false if the queue is empty.
+	 */
+	bool Dequeue(ElementType& OutElement);
+
+	// Approximate number of elements, exact only when no thread is using the queue.
+	int32 GetSize() const
+	{
+		const uint32 DequeuePosition = DequeueSide.Position.load(std::memory_order_acquire);
+		const int32 Size = static_cast<int32>(EnqueueSide.Position.load(std::memory_order_acquire) - DequeuePosition);
+		return FMath::Max(Size, 0);
+	}
+	bool IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+	int32 GetCapacity() const
+	{
+		return static_cast<int32>(Mask + 1);
+	}
+
+private:
+	struct FSlot
+	{
+		// Equal to the position for a slot ready to be written at that position, and to the position + 1
+		// for a slot holding the element written at that position.
+		std::atomic<uint32> Sequence;
+		alignas(ElementType) uint8 ElementStorage[sizeof(ElementType)];
+
+		ElementType* GetElement()
+		{
+			return reinterpret_cast<ElementType*>(ElementStorage);
+		}
+	};
+
+	// Positions grow forever and wrap around; a position's slot is Position & Mask.
+	struct alignas(PlatformCacheLineSize) FQueueSide
+	{
+		std::atomic<uint32> Position{ 0 };
+	};
+
+	FQueueSide EnqueueSide;
+	FQueueSide DequeueSide;
+	// Read-only after construction, on a line of their own so that neither side's writes evict them.
+	alignas(PlatformCacheLineSize) FSlot* Slots = nullptr;
+	uint32 Mask = 0;
+	IAllocator* Allocator = nullptr;
+};
+
+template<typename ElementType>
+TMPMCQueue<ElementType>::TMPMCQueue(int32 InCapacity, IAllocator& InAllocator)
+	: Allocator(&InAllocator)
+{
+	ensure(InCapacity > 0);
+	// A single slot would be ready to read and to write at the next position at once.
+	const int32 Capacity = FMath::RoundUpToNearestPowerOfTwo(FMath::Max(InCapacity, 2));
+	Mask = static_cast<uint32>(Capacity - 1);
+	Slots = static_cast<FSlot*>(Allocator->Allocate(static_cast<int32>(sizeof(FSlot)) * Capacity));
+	ensure(Slots);
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		new (&Slots[Index].Sequence) std::atomic<uint32>(static_cast<uint32>(Index));
+	}
+}
+
+template<typename ElementType>
+TMPMCQueue<ElementType>::~TMPMCQueue()
+{
+	const uint32 EnqueuePosition = EnqueueSide.Position.load(std::memory_order_acquire);
+	for (uint32 Position = DequeueSide.Position.load(std::memory_order_relaxed); Position != EnqueuePosition; ++Position)
+	{
+		Slots[Position & Mask].GetElement()->~ElementType();
+	}
+	Allocator->Deallocate(Slots);
+}
+
+template<typename ElementType>
+template<typename... ArgTypes>
+bool TMPMCQueue<ElementType>::Emplace(ArgTypes&&... InArgs)
+{
+	FSlot* Slot;
+	uint32 Position = EnqueueSide.Position.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Slot = &Slots[Position & Mask];
+		// Acquire, so that the consumer that last read the slot is done with it.
+		const uint32 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+		const int32 Difference = static_cast<int32>(Sequence - Position);
+		if (Difference == 0)
+		{
+			// The slot is free for this position; claim the position unless another producer got it first.
+			if (EnqueueSide.Position.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Difference < 0)
+		{
+			// The slot still holds the element from a lap ago, so the queue is full.
+			return false;
+		}
+		else
+		{
+			// Another producer claimed this position already.
+			Position = EnqueueSide.Position.load(std::memory_order_relaxed);
+		}
+	}
+
+	new (Slot->GetElement()) ElementType(Forward<ArgTypes>(InArgs)...);
+	Slot->Sequence.store(Position + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ElementType>
+bool TMPMCQueue<ElementType>::Dequeue(ElementType& OutElement)
+{
+	FSlot* Slot;
+	uint32 Position = DequeueSide.Position.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Slot = &Slots[Position & Mask];
+		// Acquire, so that the element written by the producer is visible.
+		const uint32 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+		const int32 Difference = static_cast<int32>(Sequence - (Position + 1));
+		if (Difference == 0)
+		{
+			if (DequeueSide.Position.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Difference < 0)
+		{
+			// No element has been published at this position yet, so the queue is empty.
+			return false;
+		}
+		else
+		{
+			Position = DequeueSide.Position.load(std::memory_order_relaxed);
+		}
+	}
+
+	ElementType* Element = Slot->GetElement();
+	OutElement = MoveTemp(*Element);
+	Element->~ElementType();
+	// The slot is ready for the producer of the next lap.
+	Slot->Sequence.store(Position + Mask + 1, std::memory_order_release);
+	return true;
+}
@@ -110,6 +110,8 @@ struct TDefaultMapHashableKeyOperations : TDefaultMapKeyOperationsPolicy<KeyType
 
 /**
  * A hash map implementation that does not allow for duplicate keys.
+ * Pairs are stored in a TSet, so the map's memory comes from the allocator it was constructed with,
+ * and copies and moves follow the same allocator rules as TSet.
  */
 template<typename KeyType, typename ValueType, typename KeyOperations = TDefaultMapKeyOperationsPolicy<KeyType, ValueType>>
 class TMap
@@ -122,6 +124,29 @@ public:
 	TMap() = default;
 	~TMap() = default;
 
+	TMap(const TMap& InMap) = default;
+	TMap& operator=(const TMap& InMap) = default;
+	TMap(TMap&& InMap) = default;
+	TMap& operator=(TMap&& InMap) = default;
+
+	// Constructor that stores the map's pairs in memory from the given allocator, which must outlive the map.
+	explicit TMap(IAllocator& InAllocator)
+		: Set(InAllocator)
+	{
+	}
+
+	// Constructor that allocates enough memory for at least InCapacity pairs, so that adding them doesn't rehash.
+	explicit TMap(int32 InCapacity, IAllocator& InAllocator = FDefaultSetAllocator::GetDefaultAllocator())
+		: Set(InCapacity, InAllocator)
+	{
+	}
+
+	// Copy constructor that stores the copy in memory from another allocator.
+	TMap(const TMap& InMap, IAllocator& InAllocator)
+		: Set(InMap.Set, InAllocator)
+	{
+	}
+
 	void Add(const KeyType& InKey, const ValueType& InValue)
 	{
 		Set.Add(TPair<KeyType, ValueType>(InKey, InValue));
@@ -144,19 +169,12 @@ public:
 
 	void Remove(KeyConstParamType InKey, bool bShouldDeleteKey = true)
 	{
-		Set.Remove(InKey);
+		Set.Remove(InKey, bShouldDeleteKey);
 	}
 
 	const ValueType* Find(KeyConstParamType InKey) const
 	{
-		return const_cast<ValueType*>(
-			static_cast<const TMap&>(*this).Find(InKey)
-		);
-	}
-
-	ValueType* Find(KeyConstParamType InKey)
-	{
-		if (TPair<KeyType, ValueType>* Pair = Set.Find(InKey))
+		if (const TPair<KeyType, ValueType>* Pair = Set.Find(InKey))
 		{
 			return &Pair->Value;
 		}
@@ -164,6 +182,13 @@ public:
 		return nullptr;
 	}
 
+	ValueType* Find(KeyConstParamType InKey)
+	{
+		return const_cast<ValueType*>(
+			static_cast<const TMap&>(*this).Find(InKey)
+		);
+	}
+
 	template<typename ComparableKeyType>
 	const KeyType* FindByHash(uint64 InHash, const ComparableKeyType& InKey) const
 	{
@@ -184,7 +209,7 @@ public:
 	template<typename ComparableKeyType>
 	int32 FindIndexByHash(uint64 InHash, const ComparableKeyType& InKey) const
 	{
-		Set.FindIndexByHash(InHash, InKey);
+		return Set.FindIndexByHash(InHash, InKey);
 	}
 
 	void Empty()
@@ -192,6 +217,24 @@ public:
 		Set.Empty();
 	}
 
+	// Grows the map so that it can hold InNumPairs without rehashing again while they are added.
+	void Reserve(int32 InNumPairs)
+	{
+		Set.Reserve(InNumPairs);
+	}
+
+	// Moves the pairs into the smallest capacity that holds them, e.g. after mass removals.
+	void Shrink()
+	{
+		Set.Shrink();
+	}
+
+	// Drops the tombstones of removed pairs in place, without allocating.
+	void Compact()
+	{
+		Set.Compact();
+	}
+
 	bool IsEmpty() const
 	{
 		return Set.IsEmpty();
@@ -222,6 +265,10 @@ public:
 	{
 		return Set.GetRehashLoadFactor();
 	}
+	int32 GetNumDeleted() const
+	{
+		return Set.GetNumDeleted();
+	}
 	IAllocator* GetAllocator()
 	{
 		return Set.GetAllocator();
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
+#include "Memory/PoolAllocator.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+// System includes for atomics and placement new.
+#include <atomic>
+#include <new>
+
+using FDefaultSPSCQueueAllocator = FPoolAllocator;
+
+/**
+ * Bounded queue for one producer thread and one consumer thread, such as a loader handing results to the
+ * main thread. Elements are stored in a ring buffer allocated once, and both Enqueue and Dequeue are wait-free:
+ * each side only writes its own index and reads the other's, without compare-and-swap loops.
+ *
+ * The producer and consumer indices are on separate cache lines, and each side keeps a cached copy of the
+ * other's index, so they only read the other side's cache line when the queue looks full or empty.
+ *
+ * Only one thread may call Enqueue and only one thread may call Dequeue at a time; use TMPMCQueue for
+ * several producers or consumers.
+ */
+template<typename ElementType>
+class TSPSCQueue
+{
+public:
+	static_assert(alignof(ElementType) <= alignof(uint64), "Queue elements are only aligned to 8 bytes.");
+
+	/**
+	 * Constructor. Allocates the ring buffer.
+	 *
+	 * @param InCapacity: Maximum number of elements in the queue, rounded up to a power of two.
+	 * @param InAllocator: Allocator for the ring buffer. Must outlive the queue and be usable from the thread that destroys it.
+	 */
+	explicit TSPSCQueue(int32 InCapacity, IAllocator& InAllocator = FDefaultSPSCQueueAllocator::GetDefaultAllocator());
+
+	// Destroys the elements left in the queue. Neither thread may use the queue anymore.
+	~TSPSCQueue();
+
+	// Non-copyable.
+	TSPSCQueue(const TSPSCQueue&) = delete;
+	TSPSCQueue& operator=(const TSPSCQueue&) = delete;
+
+	/**
+	 * Constructs an element at the back of the queue. Producer thread only.
+	 *
+	 * @returns: false if the queue is full, in which case InArgs are left untouched.
+	 */
+	template<typename... ArgTypes>
+	bool Emplace(ArgTypes&&... InArgs);
+
+	bool Enqueue(const ElementType& InElement)
+	{
+		return Emplace(InElement);
+	}
+
+	bool Enqueue(ElementType&& InElement)
+	{
+		return Emplace(MoveTemp(InElement));
+	}
+
+	/**
+	 * Moves the element at the front of the queue out. Consumer thread only.
+	 *
+	 * @param OutElement: Assigned the element.
+	 * @returns: false if the queue is empty.
+	 */
+	bool Dequeue(ElementType& OutElement);
+
+	// Approximate number of elements, exact only when neither thread is using the queue.
+	int32 GetSize() const
+	{
+		return static_cast<int32>(ProducerSide.Tail.load(std::memory_order_acquire) - ConsumerSide.Head.load(std::memory_order_acquire));
+	}
+	bool IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+	int32 GetCapacity() const
+	{
+		return static_cast<int32>(Mask + 1);
+	}
+
+private:
+	// Written by the producer. Indices grow forever and wrap around; an element's slot is its index & Mask.
+	struct alignas(PlatformCacheLineSize) FProducerSide
+	{
+		std::atomic<uint32> Tail{ 0 };
+		// Consumer's head when the producer last read it. The queue has at least Capacity - (Tail - CachedHead) free slots.
+		uint32 CachedHead = 0;
+	};
+
+	// Written by the consumer.
+	struct alignas(PlatformCacheLineSize) FConsumerSide
+	{
+		std::atomic<uint32> Head{ 0 };
+		// Producer's tail when the consumer last read it. The queue has at least CachedTail - Head elements.
+		uint32 CachedTail = 0;
+	};
+
+	FProducerSide ProducerSide;
+	FConsumerSide ConsumerSide;
+	// Read-only after construction, on a line of their own so that neither side's writes evict them.
+	alignas(PlatformCacheLineSize) ElementType* Elements = nullptr;
+	uint32 Mask = 0;
+	IAllocator* Allocator = nullptr;
+};
+
+template<typename ElementType>
+TSPSCQueue<ElementType>::TSPSCQueue(int32 InCapacity, IAllocator& InAllocator)
+	: Allocator(&InAllocator)
+{
+	ensure(InCapacity > 0);
+	const int32 Capacity = FMath::RoundUpToNearestPowerOfTwo(InCapacity);
+	Mask = static_cast<uint32>(Capacity - 1);
+	Elements = static_cast<ElementType*>(Allocator->Allocate(static_cast<int32>(sizeof(ElementType)) * Capacity));
+	ensure(Elements);
+}
+
+template<typename ElementType>
+TSPSCQueue<ElementType>::~TSPSCQueue()
+{
+	const uint32 Tail = ProducerSide.Tail.load(std::memory_order_acquire);
+	for (uint32 Index = ConsumerSide.Head.load(std::memory_order_relaxed); Index != Tail; ++Index)
+	{
+		Elements[Index & Mask].~ElementType();
+	}
+	Allocator->Deallocate(Elements);
+}
+
+template<typename ElementType>
+template<typename... ArgTypes>
+bool TSPSCQueue<ElementType>::Emplace(ArgTypes&&... InArgs)
+{
+	const uint32 Tail = ProducerSide.Tail.load(std::memory_order_relaxed);
+	if (Tail - ProducerSide.CachedHead > Mask)
+	{
+		// Acquire, so that the consumer is done moving the element out of the slot before it is reused.
+		ProducerSide.CachedHead = ConsumerSide.Head.load(std::memory_order_acquire);
+		if (Tail - ProducerSide.CachedHead > Mask)
+		{
+			return false;
+		}
+	}
+
+	new (Elements + (Tail & Mask)) ElementType(Forward<ArgTypes>(InArgs)...);
+	// Release, so that the consumer sees the constructed element once it sees the new tail.
+	ProducerSide.Tail.store(Tail + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ElementType>
+bool TSPSCQueue<ElementType>::Dequeue(ElementType& OutElement)
+{
+	const uint32 Head = ConsumerSide.Head.load(std::memory_order_relaxed);
+	if (Head == ConsumerSide.CachedTail)
+	{
+		ConsumerSide.CachedTail = ProducerSide.Tail.load(std::memory_order_acquire);
+		if (Head == ConsumerSide.CachedTail)
+		{
+			return false;
+		}
+	}
+
+	ElementType& Element = Elements[Head & Mask];
+	OutElement = MoveTemp(Element);
+	Element.~ElementType();
+	ConsumerSide.Head.store(Head + 1, std::memory_order_release);
+	return true;
+}
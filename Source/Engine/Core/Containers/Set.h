@@ -5,15 +5,17 @@
 #include "Memory/Alignment.h"
 #include "Containers/KeyOperationsPolicyBase.h"
 #include "Templates/TypeTraits/CallTraits.h"
-#include "Templates/TypeTraits/IsDefaultConstructable.h"
 #include "Templates/TypeTraits/IsTriviallyDestructable.h"
 #include "Templates/TemplateFunctionLibrary.h"
-#include "Memory/MemoryManager.h"
+#include "Memory/PoolAllocator.h"
 #include "Math/MathUtilities.h"
 
-// System include for placement new.
+// System includes for placement new and memcpy.
+#include <cstring>
 #include <new>
 
+using FDefaultSetAllocator = FPoolAllocator;
+
 template<typename ElementType>
 struct TDefaultSetKeyOperationsPolicy : public TKeyOperationsPolicyBase<ElementType, ElementType>
 {
@@ -62,6 +64,21 @@ namespace EMetadataState
 	}
 }
 
+/**
+ * Spreads the bits of a hash over all 64 bits, with the finalizer of MurmurHash3. The set splits hashes into
+ * metadata and slot index bits, so hashes that only differ in a few bits, such as the identity hashes of
+ * consecutive integers, would otherwise share their slot index and probe through each other.
+ */
+static uint64 MixHash(uint64 InHash)
+{
+	InHash ^= InHash >> 33;
+	InHash *= 0xff51afd7ed558ccdull;
+	InHash ^= InHash >> 33;
+	InHash *= 0xc4ceb9fe1a85ec53ull;
+	InHash ^= InHash >> 33;
+	return InHash;
+}
+
 // This isolates the 7 bits that make up the metadata.
 static MetadataType GetMetadataFromHash(uint64 InHash)
 {
@@ -79,9 +96,17 @@ static int64 GetIndexFromHash(uint64 InHash)
  * Flat hash set based on the Google Abseil implementation 
  * and the following CppCon Talk: https://youtu.be/ncHmEUmJZf4
  * 
- * ElementType must support a default constructor if it is a user-defined type.
+ * Elements are constructed in their slots when added and destroyed when removed.
  * Growth policy is just powers of 2 for now. No SSE or intrinsics are used yet.
  * Optimization of groups isn't being done yet either.
+ *
+ * Removed elements leave Deleted tombstones, so that probes for other elements continue past them. Adds reuse
+ * tombstones, and when tombstones fill the set while few elements are left, such as after churn from level
+ * switches, they are purged in place instead of growing the set. Shrink returns memory after mass removals.
+ *
+ * The set's memory comes from an allocator chosen at construction, the default pool allocator unless
+ * specified. Temporary sets, such as the lookup tables built while loading an asset, can use an arena
+ * and be freed all at once by rewinding it. Copies and moves keep each set's memory with its allocator.
  */
 template<typename ElementType, typename KeyOperations = TDefaultSetKeyOperationsPolicy<ElementType>>
 class TSet
@@ -98,18 +123,26 @@ class TSet
 
 public:
 	/**
-	 * Default constructor. Allocates memory and default constructs 
-	 * elements if ElementType is a user-defined type.
+	 * Default constructor. Allocates memory for the minimum capacity from the default allocator.
 	 */
 	TSet();
 
+	/**
+	 * Constructor that stores the set's elements in memory from the given allocator,
+	 * e.g. an arena for sets that only live while an asset loads.
+	 *
+	 * @param InAllocator: Allocator for the set's memory. Must outlive the set.
+	 */
+	explicit TSet(IAllocator& InAllocator);
+
 	/**
 	 * Constructor that creates a set of requested capacity.
 	 * Allocates enough memory for at least InCapacity elements.
 	 * 
 	 * @param InCapacity: Requested number of elements.
+	 * @param InAllocator: Allocator for the set's memory. Must outlive the set.
 	 */
-	TSet(int32 InCapacity);
+	TSet(int32 InCapacity, IAllocator& InAllocator = FDefaultSetAllocator::GetDefaultAllocator());
 
 	// Destructor.
 	~TSet();
@@ -119,29 +152,41 @@ public:
 	 *
 	 * @param InOther: Source set to copy from.
 	 */
-	TSet(const TSet<ElementType>& InOther);
+	TSet(const TSet& InOther);
 
 	/**
-	 * Copy assignment operator. Copies InOther's elements into
-	 * memory allocated by InOther's allocator.
+	 * Copy constructor that stores the copy in memory from another allocator,
+	 * e.g. to keep a set that was built in an arena.
 	 *
 	 * @param InOther: Source set to copy from.
+	 * @param InAllocator: Allocator for the copy's memory. Must outlive the copy.
 	 */
-	TSet<ElementType>& operator=(const TSet<ElementType>& InOther);
+	TSet(const TSet& InOther, IAllocator& InAllocator);
 
 	/**
-	 * Move constructor.
+	 * Copy assignment operator. Does not copy InOther's allocator;
+	 * the elements are copied into memory from this set's allocator.
+	 *
+	 * @param InOther: Source set to copy from.
+	 */
+	TSet& operator=(const TSet& InOther);
+
+	/**
+	 * Move constructor. Takes InOther's memory along with its allocator.
+	 * InOther is left empty, without memory, and can be reused.
 	 *
 	 * @param InOther: Source set to move from.
 	 */
-	TSet(TSet<ElementType>&& InOther);
+	TSet(TSet&& InOther);
 
 	/**
-	 * Move assignment operator.
+	 * Move assignment operator. Takes InOther's memory if both sets use the same allocator.
+	 * Otherwise the elements are moved into memory from this set's allocator, since that memory
+	 * may not live as long as this set. Either way, InOther is left empty.
 	 *
 	 * @param InOther: Source set to move from.
 	 */
-	TSet<ElementType>& operator=(TSet<ElementType>&& InOther);
+	TSet& operator=(TSet&& InOther);
 
 	/**
 	 * Adds a copy of InElement to the set.
@@ -212,14 +257,39 @@ public:
 	 */
 	void Empty();
 
+	/**
+	 * Grows the set so that it can hold InNumElements without rehashing again while they are added.
+	 * Does nothing if the set is already large enough.
+	 *
+	 * @param InNumElements: Number of elements the set should hold.
+	 */
+	void Reserve(int32 InNumElements);
+
+	/**
+	 * Moves the elements into the smallest capacity that holds them, which also drops all tombstones.
+	 * Meant for after mass removals, such as unloading a level.
+	 */
+	void Shrink();
+
+	/**
+	 * Drops all tombstones in place, without allocating, so that lookups no longer probe past them.
+	 * Adds already do this when tombstones dominate, so this is only needed before a lookup-heavy phase.
+	 */
+	void Compact();
+
 	bool IsKeyContained(KeyParamType InElement) const
 	{
 		return Find(InElement) != nullptr;
 	}
-	bool IsHashContained(uint64 InHash) const
-	{
-		return FindByHash(InElement) != nullptr;
-	}
+
+	/**
+	 * Checks whether an element with the given hash is in the set, without a key to compare against.
+	 * The hashes of the candidate elements are recomputed, so this is slower than IsKeyContained.
+	 *
+	 * @param InHash: Hash returned by KeyOperations::GetHashFromKey for the element's key.
+	 */
+	bool IsHashContained(uint64 InHash) const;
+
 	bool IsEmpty() const
 	{
 		return Size == 0;
@@ -236,12 +306,17 @@ public:
 	}
 	float GetLoadFactor() const
 	{
-		return static_cast<float>(Size) / static_cast<float>(Capacity);
+		return Capacity > 0 ? static_cast<float>(Size) / static_cast<float>(Capacity) : 0.0f;
 	}
 	float GetRehashLoadFactor() const
 	{
 		return MaxLoadFactor;
 	}
+	// Number of slots holding tombstones of removed elements.
+	int32 GetNumDeleted() const
+	{
+		return NumDeleted;
+	}
 	IAllocator* GetAllocator()
 	{
 		return Allocator;
@@ -256,222 +331,182 @@ public:
 private:
 	// A hash set should never be full. This is primarily used for assertions.
 	bool IsFull() const;
-	void Rehash();
+	// Makes room for one more element, by purging tombstones if they dominate or by doubling the capacity.
+	void GrowForAdd();
+	// Moves the elements into new slots of the given capacity.
+	void Rehash(int32 InNewCapacity);
+	// Returns the capacity that holds InNumElements below the maximum load factor.
+	static int32 GetCapacityForNumElements(int32 InNumElements);
+	// Returns the first slot that isn't full on the probe sequence of a mixed hash.
+	int32 FindFirstNonFullSlot(uint64 InMixedHash) const;
+
+	template<typename ArgType>
+	void AddElement(ArgType&& InElement);
+
+	// Allocates empty Metadata and Data arrays for InCapacity elements from the set's allocator.
+	void AllocateSlots(int32 InCapacity);
+	// Destroys the elements and returns the Metadata and Data arrays to the allocator.
+	void ReleaseSlots();
+	// Copies or moves the elements of a set with the same capacity into this set's empty slots.
+	void CopySlots(const TSet& InOther);
+	void MoveSlots(TSet& InOther);
+	// Moves InOther's memory and allocator into this set, which must have no memory, leaving InOther without memory.
+	void TakeSlots(TSet& InOther);
 
 	IAllocator* Allocator = nullptr;
-	// The metadata for the data with all of the hash codes.
+	// The metadata for the data with all of the hash codes. Elements only exist in slots whose metadata is full.
 	// We use raw pointers instead of TArrays to cut down on the memory footprint.
 	MetadataType* Metadata = nullptr;
 	ElementType* Data = nullptr;
 	int32 Size = 0;
 	int32 Capacity = 0;
+	// Slots whose metadata is Deleted. Probes go past them, so they count towards the load like elements.
+	int32 NumDeleted = 0;
 };
 
 template <typename ElementType, typename KeyOperations>
 TSet<ElementType, KeyOperations>::TSet()
+	: TSet(FDefaultSetAllocator::GetDefaultAllocator())
 {
-	Capacity = TSet::MinimumSetSize;
-	SetAllocator(FMemoryManager::Get().GetArenaAllocator());
-	Metadata = (MetadataType*)Allocator->Allocate(Capacity * sizeof(MetadataType));
-	Data = (ElementType*)Allocator->Allocate(Capacity * sizeof(ElementType));
-
-	for (int32 Index = 0; Index < Capacity; ++Index)
-	{
-		Metadata[Index] = EMetadataState::Empty;
-	}
-
-	// Default construct every element in the Data array if ElementType is a user-defined type.
-	if (TIsDefaultConstructable<ElementType>::Value)
-	{
-		for (int32 Index = 0; Index < Capacity; ++Index)
-		{
-			new (Data + Index) ElementType();
-		}
-	}
 }
 
+template <typename ElementType, typename KeyOperations>
+TSet<ElementType, KeyOperations>::TSet(IAllocator& InAllocator)
+	: TSet(TSet::MinimumSetSize, InAllocator)
+{
+}
 
 template <typename ElementType, typename KeyOperations>
-TSet<ElementType, KeyOperations>::TSet(int32 InCapacity)
+TSet<ElementType, KeyOperations>::TSet(int32 InCapacity, IAllocator& InAllocator /* = FDefaultSetAllocator::GetDefaultAllocator() */)
+	: Allocator(&InAllocator)
 {
-	if (InCapacity < TSet::MinimumSetSize)
-	{
-		Capacity = TSet::MinimumSetSize;
-	}
-	else
-	{
-		Capacity = FMath::RoundUpToNearestPowerOfTwo(InCapacity);
-	}
-	SetAllocator(FMemoryManager::Get().GetArenaAllocator());
-	Metadata = (MetadataType*)Allocator->Allocate(Capacity * sizeof(MetadataType));
-	Data = (ElementType*)Allocator->Allocate(Capacity * sizeof(ElementType));
+	AllocateSlots(InCapacity < TSet::MinimumSetSize ? TSet::MinimumSetSize : FMath::RoundUpToNearestPowerOfTwo(InCapacity));
 }
 
 template <typename ElementType, typename KeyOperations>
-TSet<ElementType, KeyOperations>::TSet(const TSet<ElementType>& InOther)
+TSet<ElementType, KeyOperations>::TSet(const TSet& InOther)
+	: TSet(InOther, *InOther.Allocator)
 {
-	Capacity = InOther.Capacity;
-	ensure(FMath::IsPowerOfTwo(Capacity));
-	Size = InOther.Size;
-	ensure(Size < Capacity);
-	Allocator = InOther.Allocator;
-	// Allocate the data arrays with the new allocator.
-	Metadata = Allocator->Allocate(Capacity * sizeof(MetadataType));
-	Data = Allocator->Allocate(Capacity * sizeof(ElementType));
-	// Loop through the other set and copy everything over.
-	// We have 2 separate loops to keep the cache hot.
-	for (int32 Index = 0; Index < Capacity; ++Index)
-	{
-		Metadata[Index] = InOther.Metadata[Index];
-	}
-	for (int32 Index = 0; Index < Capacity; ++Index)
-	{
-		Data[Index] = InOther.Data[Index];
-	}
 }
 
 template <typename ElementType, typename KeyOperations>
-TSet<ElementType, KeyOperations>::TSet(TSet<ElementType>&& InOther)
+TSet<ElementType, KeyOperations>::TSet(const TSet& InOther, IAllocator& InAllocator)
+	: Allocator(&InAllocator)
 {
-	Allocator = InOther.Allocator;
-	Metadata = InOther.Metadata;
-	Data = InOther.Data;
-	Size = InOther.Size;
-	Capacity = InOther.Capacity;
+	AllocateSlots(InOther.Capacity);
+	CopySlots(InOther);
+}
 
-	InOther.Allocator = nullptr;
-	InOther.Metadata = nullptr;
-	InOther.Data = nullptr;
-	InOther.Size = 0;
-	InOther.Capacity = nullptr;
+template <typename ElementType, typename KeyOperations>
+TSet<ElementType, KeyOperations>::TSet(TSet&& InOther)
+{
+	TakeSlots(InOther);
 }
 
 template <typename ElementType, typename KeyOperations>
 TSet<ElementType, KeyOperations>::~TSet()
 {
-	// Capacity MUST always be a power of 2 due to growth factor.
-	ensure(FMath::IsPowerOfTwo(Capacity));
 	// We must ALWAYS have an allocator.
-	ensure(Allocator);;
-	Empty();
-	// Clean up the allocated data.
-	Allocator->Deallocate(Metadata);
-	Allocator->Deallocate(Data);
+	ensure(Allocator);
+	ReleaseSlots();
 }
 
 template <typename ElementType, typename KeyOperations>
-TSet<ElementType>& TSet<ElementType, KeyOperations>::operator=(const TSet<ElementType>& InOther)
+TSet<ElementType, KeyOperations>& TSet<ElementType, KeyOperations>::operator=(const TSet& InOther)
 {
-	ensure(FMath::IsPowerOfTwo(InOther.Capacity));
-	ensure(InOther.Size < InOther.Capacity);
-	Empty();
-	// Deallocate current data.
-	Allocator->Deallocate(Metadata);
-	Allocator->Deallocate(Data);
-	Capacity = 0;
-	Capacity = InOther.Capacity;
-	Size = InOther.Size;
-	Allocator = InOther.Allocator;
-	// Allocate the data arrays with the new allocator.
-	Metadata = Allocator->Allocate(Capacity * sizeof(MetadataType));
-	Data = Allocator->Allocate(Capacity * sizeof(ElementType));
-	// Loop through the other set and copy everything over.
-	// We have 2 separate loops to keep the cache hot.
-	for (int32 Index = 0; Index < Capacity; ++Index)
+	if (this == &InOther)
 	{
-		Metadata[Index] = InOther.Metadata[Index];
+		return *this;
 	}
-	for (int32 Index = 0; Index < Capacity; ++Index)
+
+	// Reuse the current memory if it has the right capacity.
+	Empty();
+	if (Capacity != InOther.Capacity)
 	{
-		Data[Index] = InOther.Data[Index];
+		ReleaseSlots();
+		AllocateSlots(InOther.Capacity);
 	}
+	CopySlots(InOther);
 	return *this;
 }
 
 template <typename ElementType, typename KeyOperations>
-TSet<ElementType>& TSet<ElementType, KeyOperations>::operator=(TSet<ElementType>&& InOther)
+TSet<ElementType, KeyOperations>& TSet<ElementType, KeyOperations>::operator=(TSet&& InOther)
 {
-	Allocator = InOther.Allocator;
-	Metadata = InOther.Metadata;
-	Data = InOther.Data;
-	Size = InOther.Size;
-	Capacity = InOther.Capacity;
+	if (this == &InOther)
+	{
+		return *this;
+	}
 
-	InOther.Allocator = nullptr;
-	InOther.Metadata = nullptr;
-	InOther.Data = nullptr;
-	InOther.Size = 0;
-	InOther.Capacity = nullptr;
+	if (Allocator == InOther.Allocator)
+	{
+		ReleaseSlots();
+		TakeSlots(InOther);
+		return *this;
+	}
+
+	Empty();
+	if (Capacity != InOther.Capacity)
+	{
+		ReleaseSlots();
+		AllocateSlots(InOther.Capacity);
+	}
+	MoveSlots(InOther);
 	return *this;
 }
 
 template <typename ElementType, typename KeyOperations>
 void TSet<ElementType, KeyOperations>::Add(const ElementType& InElement)
 {
-	ensure(Capacity >= TSet::MinimumSetSize);
-	ensure(FMath::IsPowerOfTwo(Capacity));
-	// Rehashing is also expensive so we'll also need to have a look at size.
-	if (GetLoadFactor() >= MaxLoadFactor)
-	{
-		Rehash();
-	}
-	KeyOperations::KeyParamType Key = KeyOperations::GetKeyFromElement(InElement);
-	int64 Hash = KeyOperations::GetHashFromKey(Key);
-	// Think of this as GetIndexFromHash(Hash) % static_cast<int64>(Capacity);
-	// We're just using bit manipualtion as an optimization.
-	int64 Index = GetIndexFromHash(Hash) & (static_cast<uint64>(Capacity) - 1);
-	while (true)
-	{
-		// Check for duplicate keys if we allow them.
-		if (!KeyOperations::bAllowDuplicateKeys && EMetadataState::IsFull(Metadata[Index]) && KeyOperations::DoKeysMatch(Data[Index], InElement))
-		{
-			// Early return if duplicate is found.
-			return;
-		}
-		if (EMetadataState::IsEmpty(Metadata[Index]))
-		{
-			// Empty slot, we can just pop the key in.
-			Metadata[Index] = GetMetadataFromHash(Hash);
-			Data[Index] = InElement;
-			++Size;
-			return;
-		}
-		// If we reach here, that means there's a collision in the Index hash. So we need to probe to find an empty spot.
-		++Index;
-		// Think of this as Index %= Capacity.
-		// Just an optimization as capacity is always a power of 2.
-		Index &= (Capacity - 1);
-	}
+	AddElement(InElement);
 }
 
 template <typename ElementType, typename KeyOperations>
 void TSet<ElementType, KeyOperations>::Add(ElementType&& InElement)
 {
-	ensure(FMath::IsPowerOfTwo(Capacity));
+	AddElement(MoveTempIfPossible(InElement));
+}
+
+template <typename ElementType, typename KeyOperations>
+template<typename ArgType>
+void TSet<ElementType, KeyOperations>::AddElement(ArgType&& InElement)
+{
 	// Rehashing is also expensive so we'll also need to have a look at size.
-	if (GetLoadFactor() >= MaxLoadFactor)
+	// Tombstones count towards the load, since probes have to go past them too.
+	// Sets that were moved from have no memory until they are added to again.
+	if (Capacity == 0 || static_cast<float>(Size + NumDeleted) >= MaxLoadFactor * static_cast<float>(Capacity))
 	{
-		Rehash();
+		GrowForAdd();
 	}
-	KeyOperations::KeyParamType Key = KeyOperations::GetKeyFromElement(InElement);
-	int64 Hash = KeyOperations::GetHashFromKey(Key);
+	ensure(Capacity >= TSet::MinimumSetSize);
+	ensure(FMath::IsPowerOfTwo(Capacity));
+	typename KeyOperations::KeyParamType Key = KeyOperations::GetKeyFromElement(InElement);
+	uint64 Hash = MixHash(KeyOperations::GetHashFromKey(Key));
+	// Think of this as GetIndexFromHash(Hash) % static_cast<int64>(Capacity);
+	// We're just using bit manipualtion as an optimization.
 	int64 Index = GetIndexFromHash(Hash) & (static_cast<uint64>(Capacity) - 1);
+	// First tombstone on the probe sequence, which the element takes once we know it isn't a duplicate.
+	int64 DeletedIndex = InvalidIndex;
 	while (true)
 	{
 		// Check for duplicate keys if we allow them.
 		if (!KeyOperations::bAllowDuplicateKeys && EMetadataState::IsFull(Metadata[Index])
-			&& KeyOperations::DoKeysMatch(KeyOperations::GetKeyFromElement(Data[Index]), KeyOperations::GetKeyFromElement(InElement)))
+			&& KeyOperations::DoKeysMatch(KeyOperations::GetKeyFromElement(Data[Index]), Key))
 		{
 			// Early return if duplicate is found.
 			return;
 		}
+		if (EMetadataState::IsDeleted(Metadata[Index]) && DeletedIndex == InvalidIndex)
+		{
+			DeletedIndex = Index;
+			if (KeyOperations::bAllowDuplicateKeys)
+			{
+				break;
+			}
+		}
 		if (EMetadataState::IsEmpty(Metadata[Index]))
 		{
-			// Empty slot, we can just pop the key in.
-			Metadata[Index] = GetMetadataFromHash(Hash);
-			Data[Index] = MoveTempIfPossible(InElement);
-			++Size;
-			return;
+			break;
 		}
 		// If we reach here, that means there's a collision in the Index hash. So we need to probe to find an empty spot.
 		++Index;
@@ -479,16 +514,35 @@ void TSet<ElementType, KeyOperations>::Add(ElementType&& InElement)
 		// Just an optimization as capacity is always a power of 2.
 		Index &= (Capacity - 1);
 	}
+
+	if (DeletedIndex != InvalidIndex)
+	{
+		Index = DeletedIndex;
+		--NumDeleted;
+	}
+	Metadata[Index] = GetMetadataFromHash(Hash);
+	new (Data + Index) ElementType(Forward<ArgType>(InElement));
+	++Size;
 }
 
 template <typename ElementType, typename KeyOperations>
-void TSet<ElementType, KeyOperations>::Remove(KeyParamType InElement, bool bShouldDeleteKey = true)
+void TSet<ElementType, KeyOperations>::Remove(KeyParamType InElement, bool bShouldDeleteKey /* = true */)
 {
 	int32 FoundIndex = FindIndexByKey(InElement);
 	if (FoundIndex != InvalidIndex)
 	{
-		Metadata[FoundIndex] = EMetadataState::Deleted;
-		if (bShouldDeleteKey && TIsTriviallyDestructable<ElementType>::Value)
+		// Probes stop at the next empty slot, so if it directly follows, no probe needs to go past this slot
+		// and it can be empty rather than a tombstone.
+		if (EMetadataState::IsEmpty(Metadata[(FoundIndex + 1) & (Capacity - 1)]))
+		{
+			Metadata[FoundIndex] = EMetadataState::Empty;
+		}
+		else
+		{
+			Metadata[FoundIndex] = EMetadataState::Deleted;
+			++NumDeleted;
+		}
+		if (bShouldDeleteKey && !TIsTriviallyDestructable<ElementType>::Value)
 		{
 			Data[FoundIndex].~ElementType();
 		}
@@ -539,14 +593,18 @@ template <typename ElementType, typename KeyOperations>
 template<typename ComparableKeyType>
 ElementType* TSet<ElementType, KeyOperations>::FindByHash(uint64 InHash, const ComparableKeyType& InElement)
 {
-	const_cast<ElementType*>(
-		static_cast<const TSet&>(*this).FindByHash(InElement)
+	return const_cast<ElementType*>(
+		static_cast<const TSet&>(*this).FindByHash(InHash, InElement)
 		);
 }
 
 template <typename ElementType, typename KeyOperations>
 int32 TSet<ElementType, KeyOperations>::FindIndexByKey(KeyParamType InElement) const
 {
+	if (Capacity == 0)
+	{
+		return InvalidIndex;
+	}
 	ensure(FMath::IsPowerOfTwo(Capacity));
 	uint64 Hash = KeyOperations::GetHashFromKey(InElement);
 	return FindIndexByHash(Hash, InElement);
@@ -555,7 +613,12 @@ int32 TSet<ElementType, KeyOperations>::FindIndexByKey(KeyParamType InElement) c
 template <typename ElementType, typename KeyOperations>
 int32 TSet<ElementType, KeyOperations>::FindIndexByHash(uint64 InHash, KeyParamType InElement) const
 {
+	if (Capacity == 0)
+	{
+		return InvalidIndex;
+	}
 	ensure(FMath::IsPowerOfTwo(Capacity));
+	InHash = MixHash(InHash);
 	uint64 Index = GetIndexFromHash(InHash) & (static_cast<uint64>(Capacity) - 1);
 	while (true)
 	{
@@ -581,7 +644,12 @@ template <typename ElementType, typename KeyOperations>
 template<typename ComparableKeyType>
 int32 TSet<ElementType, KeyOperations>::FindIndexByHash(uint64 InHash, const ComparableKeyType& InElement) const
 {
+	if (Capacity == 0)
+	{
+		return InvalidIndex;
+	}
 	ensure(FMath::IsPowerOfTwo(Capacity));
+	InHash = MixHash(InHash);
 	uint64 Index = GetIndexFromHash(InHash) & (static_cast<uint64>(Capacity) - 1);
 	while (true)
 	{
@@ -603,92 +671,302 @@ int32 TSet<ElementType, KeyOperations>::FindIndexByHash(uint64 InHash, const Com
 	}
 }
 
+template <typename ElementType, typename KeyOperations>
+bool TSet<ElementType, KeyOperations>::IsHashContained(uint64 InHash) const
+{
+	if (Capacity == 0)
+	{
+		return false;
+	}
+	ensure(FMath::IsPowerOfTwo(Capacity));
+	const uint64 MixedHash = MixHash(InHash);
+	uint64 Index = GetIndexFromHash(MixedHash) & (static_cast<uint64>(Capacity) - 1);
+	while (!EMetadataState::IsEmpty(Metadata[Index]))
+	{
+		// Only the metadata bits are stored, so the full hash of each candidate has to be recomputed.
+		if (GetMetadataFromHash(MixedHash) == Metadata[Index]
+			&& KeyOperations::GetHashFromKey(KeyOperations::GetKeyFromElement(Data[Index])) == InHash)
+		{
+			return true;
+		}
+		++Index;
+		Index &= (Capacity - 1);
+	}
+	return false;
+}
+
 template <typename ElementType, typename KeyOperations>
 void TSet<ElementType, KeyOperations>::Empty()
 {
 	for (int32 Index = 0; Index < Capacity; ++Index)
 	{
-		if (EMetadataState::IsFull(Metadata[Index]) || EMetadataState::IsDeleted(Metadata[Index]))
+		// Destroy the element.
+		if (EMetadataState::IsFull(Metadata[Index]) && !TIsTriviallyDestructable<ElementType>::Value)
 		{
-			// Destroy the element.
-			if (TIsTriviallyDestructable<ElementType>::Value)
-			{
-				Data[Index].~ElementType();
-			}
-			Metadata[Index] = EMetadataState::Empty;
+			Data[Index].~ElementType();
 		}
+		Metadata[Index] = EMetadataState::Empty;
 	}
 	Size = 0;
+	NumDeleted = 0;
 }
 
 template <typename ElementType, typename KeyOperations>
-void TSet<ElementType, KeyOperations>::Rehash()
+void TSet<ElementType, KeyOperations>::Reserve(int32 InNumElements)
 {
-	MetadataType* OldMetadata = Metadata;
-	ElementType* OldData = Data;
-	// Capacity should ALWAYS be a power of 2.
-	// If this assertion triggers, something is very wrong with the algorithm.
-	ensure(FMath::IsPowerOfTwo(Capacity));
-	int32 OldCapacity = Capacity;
-	Capacity = FMath::RoundUpToNearestPowerOfTwo(++Capacity);
+	const int32 NewCapacity = GetCapacityForNumElements(InNumElements);
+	if (NewCapacity > Capacity)
+	{
+		Rehash(NewCapacity);
+	}
+}
 
-	// Allocate new arrays.
-	Metadata = static_cast<MetadataType*>(Allocator->Allocate(sizeof(MetadataType) * Capacity));
-	Data = static_cast<ElementType*>(Allocator->Allocate(sizeof(ElementType) * Capacity));
-	// Initialize Metadata array.
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::Shrink()
+{
+	// Sets that were moved from have no memory to shrink.
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	const int32 NewCapacity = GetCapacityForNumElements(Size);
+	if (NewCapacity < Capacity)
+	{
+		Rehash(NewCapacity);
+	}
+	else
+	{
+		Compact();
+	}
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::Compact()
+{
+	if (NumDeleted == 0)
+	{
+		return;
+	}
+
+	// Tombstones become empty, and elements become Deleted to mark them as not placed yet.
 	for (int32 Index = 0; Index < Capacity; ++Index)
 	{
-		Metadata[Index] = EMetadataState::Empty;
+		Metadata[Index] = EMetadataState::IsFull(Metadata[Index]) ? static_cast<MetadataType>(EMetadataState::Deleted) : static_cast<MetadataType>(EMetadataState::Empty);
 	}
-	// Initialize Data array with default constructed elements if ElementType is a user-defined type.
-	if (TIsDefaultConstructable<ElementType>::Value)
+
+	// Place the elements one by one in the first slot of their probe sequence that doesn't hold a placed element.
+	// Slots between an element's ideal slot and its new one only hold placed elements, which never move again,
+	// so every placed element stays reachable.
+	for (int32 Index = 0; Index < Capacity; ++Index)
 	{
-		for (int32 Index = 0; Index < Capacity; ++Index)
+		if (!EMetadataState::IsDeleted(Metadata[Index]))
+		{
+			continue;
+		}
+
+		const uint64 Hash = MixHash(KeyOperations::GetHashFromKey(KeyOperations::GetKeyFromElement(Data[Index])));
+		// The search stops at this slot at the latest, since it isn't placed either.
+		const int32 NewIndex = FindFirstNonFullSlot(Hash);
+		if (NewIndex == Index)
+		{
+			Metadata[Index] = GetMetadataFromHash(Hash);
+		}
+		else if (EMetadataState::IsEmpty(Metadata[NewIndex]))
+		{
+			new (Data + NewIndex) ElementType(MoveTempIfPossible(Data[Index]));
+			Data[Index].~ElementType();
+			Metadata[NewIndex] = GetMetadataFromHash(Hash);
+			Metadata[Index] = EMetadataState::Empty;
+		}
+		else
 		{
-			// each element in the Data array without using placement new,
-			// so that we can get rid of the dependency on the <new> header.
-			new (Data + Index) ElementType();
+			// The new slot holds an element that isn't placed yet. Swap it in here and place it next.
+			// Elements only need to be move constructible, so swap by constructing rather than assigning.
+			ElementType Element(MoveTempIfPossible(Data[Index]));
+			Data[Index].~ElementType();
+			new (Data + Index) ElementType(MoveTempIfPossible(Data[NewIndex]));
+			Data[NewIndex].~ElementType();
+			new (Data + NewIndex) ElementType(MoveTempIfPossible(Element));
+			Metadata[NewIndex] = GetMetadataFromHash(Hash);
+			--Index;
 		}
 	}
+	NumDeleted = 0;
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::GrowForAdd()
+{
+	// Moved-from sets start over at the minimum capacity.
+	if (Capacity == 0)
+	{
+		Rehash(TSet::MinimumSetSize);
+		return;
+	}
+
+	// If most of the load is tombstones, dropping them makes enough room without growing.
+	if (static_cast<float>(Size + 1) <= MaxLoadFactor * 0.5f * static_cast<float>(Capacity))
+	{
+		Compact();
+		return;
+	}
+
+	Rehash(Capacity * 2);
+}
+
+template <typename ElementType, typename KeyOperations>
+/*static*/ int32 TSet<ElementType, KeyOperations>::GetCapacityForNumElements(int32 InNumElements)
+{
+	// Adds rehash once the load factor reaches MaxLoadFactor, so stay strictly below it.
+	int32 NewCapacity = TSet::MinimumSetSize;
+	while (static_cast<float>(InNumElements) >= MaxLoadFactor * static_cast<float>(NewCapacity))
+	{
+		NewCapacity *= 2;
+	}
+	return NewCapacity;
+}
+
+template <typename ElementType, typename KeyOperations>
+int32 TSet<ElementType, KeyOperations>::FindFirstNonFullSlot(uint64 InMixedHash) const
+{
+	int32 Index = static_cast<int32>(GetIndexFromHash(InMixedHash) & (static_cast<uint64>(Capacity) - 1));
+	while (EMetadataState::IsFull(Metadata[Index]))
+	{
+		// Think of this as Index %= Capacity.
+		// Just an optimization as capacity is always a power of 2.
+		Index = (Index + 1) & (Capacity - 1);
+	}
+	return Index;
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::Rehash(int32 InNewCapacity)
+{
+	MetadataType* OldMetadata = Metadata;
+	ElementType* OldData = Data;
+	int32 OldCapacity = Capacity;
+	// Capacity should ALWAYS be a power of 2, or 0 if the set was moved from.
+	// If this assertion triggers, something is very wrong with the algorithm.
+	ensure(OldCapacity == 0 || FMath::IsPowerOfTwo(OldCapacity));
+	ensure(static_cast<float>(Size) < MaxLoadFactor * static_cast<float>(InNewCapacity));
+	AllocateSlots(InNewCapacity);
+
 	for (int32 Index = 0; Index < OldCapacity; ++Index)
 	{
 		if (EMetadataState::IsFull(OldMetadata[Index]))
 		{
-			uint64 Hash = KeyOperations::GetHashFromKey(KeyOperations::GetKeyFromElement(OldData[Index]));
-			// Think of this as GetIndexFromHash() % Capacity.
-			// We're just using bit shifting as an optimization since Capacity will always be power of 2.
-			int32 NewIndex = GetIndexFromHash(Hash) & (Capacity - 1);
-
-			if (EMetadataState::IsFull(Metadata[NewIndex]))
-			{
-				while (true)
-				{
-					// If we reach here, that means there's a collision in the Index hash. So we need to probe to find an empty spot.
-					++NewIndex;
-					// Think of this as Index %= Capacity.
-					// Just an optimization as capacity is always a power of 2.
-					NewIndex &= (Capacity - 1);
-					// We loop until we find an empty slot, then break.
-					if (EMetadataState::IsEmpty(Metadata[NewIndex]))
-					{
-						break;
-					}
-				}
-			}
+			uint64 Hash = MixHash(KeyOperations::GetHashFromKey(KeyOperations::GetKeyFromElement(OldData[Index])));
+			// The new slots have no tombstones, so the first slot that isn't full is empty.
+			int32 NewIndex = FindFirstNonFullSlot(Hash);
 
 			// No need to recompute metadata as it will always be the same.
 			Metadata[NewIndex] = OldMetadata[Index];
 			// We move so that we don't have to copy the elements and then destroy the old elements.
-			Data[NewIndex] = MoveTempIfPossible(OldData[Index]);
-		}
-		// Elements marked deleted are still alive, we will need to clean that up.
-		if (EMetadataState::IsDeleted(OldMetadata[Index]) && TIsTriviallyDestructable<ElementType>::Value)
-		{
+			new (Data + NewIndex) ElementType(MoveTempIfPossible(OldData[Index]));
 			OldData[Index].~ElementType();
 		}
 	}
+	// Tombstones aren't carried over.
+	NumDeleted = 0;
 
 	// Delete old data.
-	Allocator->Deallocate(OldMetadata);
-	Allocator->Deallocate(OldData);
+	if (OldCapacity > 0)
+	{
+		Allocator->Deallocate(OldMetadata);
+		Allocator->Deallocate(OldData);
+	}
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::AllocateSlots(int32 InCapacity)
+{
+	ensure(FMath::IsPowerOfTwo(InCapacity));
+	Capacity = InCapacity;
+	Metadata = static_cast<MetadataType*>(Allocator->Allocate(sizeof(MetadataType) * Capacity));
+	Data = static_cast<ElementType*>(Allocator->Allocate(sizeof(ElementType) * Capacity));
+	ensure(Metadata && Data);
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		Metadata[Index] = EMetadataState::Empty;
+	}
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::ReleaseSlots()
+{
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	Empty();
+	Allocator->Deallocate(Metadata);
+	Allocator->Deallocate(Data);
+	Metadata = nullptr;
+	Data = nullptr;
+	Capacity = 0;
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::CopySlots(const TSet& InOther)
+{
+	ensure(Capacity == InOther.Capacity && Size == 0);
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	// Elements keep their slots, so nothing needs to be rehashed.
+	memcpy(Metadata, InOther.Metadata, sizeof(MetadataType) * Capacity);
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		if (EMetadataState::IsFull(Metadata[Index]))
+		{
+			new (Data + Index) ElementType(InOther.Data[Index]);
+		}
+	}
+	Size = InOther.Size;
+	NumDeleted = InOther.NumDeleted;
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::MoveSlots(TSet& InOther)
+{
+	ensure(Capacity == InOther.Capacity && Size == 0);
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	memcpy(Metadata, InOther.Metadata, sizeof(MetadataType) * Capacity);
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		if (EMetadataState::IsFull(Metadata[Index]))
+		{
+			new (Data + Index) ElementType(MoveTempIfPossible(InOther.Data[Index]));
+		}
+	}
+	Size = InOther.Size;
+	NumDeleted = InOther.NumDeleted;
+	InOther.Empty();
+}
+
+template <typename ElementType, typename KeyOperations>
+void TSet<ElementType, KeyOperations>::TakeSlots(TSet& InOther)
+{
+	ensure(Capacity == 0);
+	Allocator = InOther.Allocator;
+	Metadata = InOther.Metadata;
+	Data = InOther.Data;
+	Size = InOther.Size;
+	Capacity = InOther.Capacity;
+	NumDeleted = InOther.NumDeleted;
+
+	// The moved-from set keeps the allocator, so that it can still be added to.
+	InOther.Metadata = nullptr;
+	InOther.Data = nullptr;
+	InOther.Size = 0;
+	InOther.Capacity = 0;
+	InOther.NumDeleted = 0;
 }
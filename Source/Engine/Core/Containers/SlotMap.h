@@ -0,0 +1,327 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Containers/Array.h"
+#include "Hash/Crc64.h"
+#include "Templates/TemplateFunctionLibrary.h"
+
+/**
+ * Handle to an element of a TSlotMap<ElementType>. A slot index and the generation of the slot when the
+ * element was added. Once the element is removed, the slot's generation changes and the handle goes stale.
+ * Default constructed handles are null and never refer to an element.
+ */
+template<typename ElementType>
+struct TSlotMapHandle
+{
+	// Index of the slot in the slot map. Stays the same for the lifetime of the element.
+	uint32 Index = 0;
+	// Generation of the slot when the element was added. 0 is never used by a slot map.
+	uint32 Generation = 0;
+
+	bool IsNull() const
+	{
+		return Generation == 0;
+	}
+
+	bool operator==(const TSlotMapHandle& InOther) const
+	{
+		return Index == InOther.Index && Generation == InOther.Generation;
+	}
+
+	bool operator!=(const TSlotMapHandle& InOther) const
+	{
+		return !(*this == InOther);
+	}
+};
+
+template<typename ElementType>
+inline uint64 GetTypeHash(const TSlotMapHandle<ElementType>& InHandle)
+{
+	return FCrc64::GetTypeHash(&InHandle, sizeof(InHandle));
+}
+
+/**
+ * Container that hands out stable handles to its elements.
+ *
+ * Elements are stored densely in a single array, so iterating over them is as fast as iterating over a
+ * TArray, and they are reached from a handle through one level of indirection, a slot, instead of a
+ * pointer or a hash probe. Adding, removing and finding an element are all O(1):
+ * - Each slot stores the dense index of its element and a generation.
+ * - Removing an element moves the last element into its place and bumps the slot's generation, so handles
+ *   to the removed element go stale and Find returns nullptr for them. The slot is reused by later adds.
+ *
+ * Removing elements changes the order of the dense array, and adding elements may reallocate it,
+ * so pointers to elements are only valid until the slot map is modified. Handles stay valid until their
+ * element is removed.
+ */
+template<typename ElementType>
+class TSlotMap
+{
+public:
+	using FHandle = TSlotMapHandle<ElementType>;
+
+	/**
+	 * Default constructor. Does not allocate any memory.
+	 *
+	 * @param InAllocator: Allocator used for the elements and the slots. Must outlive the slot map.
+	 */
+	explicit TSlotMap(IAllocator& InAllocator = FDefaultArrayAllocator::GetDefaultAllocator())
+		: Elements(InAllocator)
+		, ElementSlots(InAllocator)
+		, Slots(InAllocator)
+	{
+	}
+
+	/**
+	 * Adds a copy of InElement or moves it into the slot map.
+	 *
+	 * @param InElement: Element to add.
+	 * @returns: Handle to the added element.
+	 */
+	FHandle Add(const ElementType& InElement)
+	{
+		return Emplace(InElement);
+	}
+
+	FHandle Add(ElementType&& InElement)
+	{
+		return Emplace(MoveTempIfPossible(InElement));
+	}
+
+	/**
+	 * Constructs an element at the back of the dense array.
+	 *
+	 * @param InArgs: Arguments forwarded to ElementType's constructor.
+	 * @returns: Handle to the added element.
+	 */
+	template<typename... ArgTypes>
+	FHandle Emplace(ArgTypes&&... InArgs);
+
+	/**
+	 * Removes an element from the slot map. The last element is moved into its place.
+	 *
+	 * @param InHandle: Handle to the element to remove.
+	 * @returns: true if the element was removed, false if the handle was stale or null.
+	 */
+	bool Remove(FHandle InHandle);
+
+	/**
+	 * Finds an element from its handle.
+	 *
+	 * @param InHandle: Handle to the element.
+	 * @returns: A pointer to the element, or nullptr if the handle is stale or null.
+	 */
+	const ElementType* Find(FHandle InHandle) const
+	{
+		int32 ElementIndex = GetElementIndex(InHandle);
+		return ElementIndex != InvalidIndex ? &Elements[ElementIndex] : nullptr;
+	}
+
+	ElementType* Find(FHandle InHandle)
+	{
+		return const_cast<ElementType*>(
+			static_cast<const TSlotMap&>(*this).Find(InHandle)
+			);
+	}
+
+	/**
+	 * Handle indexing operator. The handle must be valid.
+	 *
+	 * @param InHandle: Handle to the element.
+	 * @returns: Reference to the element.
+	 */
+	ElementType& operator[](FHandle InHandle)
+	{
+		ElementType* Element = Find(InHandle);
+		ensure(Element);
+		return *Element;
+	}
+
+	const ElementType& operator[](FHandle InHandle) const
+	{
+		const ElementType* Element = Find(InHandle);
+		ensure(Element);
+		return *Element;
+	}
+
+	/**
+	 * Checks whether a handle refers to an element of the slot map.
+	 *
+	 * @param InHandle: Handle to check.
+	 * @returns: true if the element hasn't been removed, false otherwise.
+	 */
+	bool IsValid(FHandle InHandle) const
+	{
+		return GetElementIndex(InHandle) != InvalidIndex;
+	}
+
+	/**
+	 * Gets the handle of an element from its position in the dense array, e.g. while iterating.
+	 *
+	 * @param InElementIndex: Index of the element in the dense array.
+	 * @returns: Handle to the element.
+	 */
+	FHandle GetHandleAt(int32 InElementIndex) const
+	{
+		ensure(0 <= InElementIndex && InElementIndex < Elements.GetSize());
+		int32 SlotIndex = ElementSlots[InElementIndex];
+		return { static_cast<uint32>(SlotIndex), Slots[SlotIndex].Generation };
+	}
+
+	/**
+	 * Removes all elements. Every handle goes stale, and memory is kept for reuse.
+	 */
+	void Empty();
+
+	/**
+	 * Allocates enough memory for at least InCapacity elements.
+	 *
+	 * @param InCapacity: Requested number of elements.
+	 */
+	void Reserve(int32 InCapacity)
+	{
+		Elements.Reserve(InCapacity);
+		ElementSlots.Reserve(InCapacity);
+		Slots.Reserve(InCapacity);
+	}
+
+	// Getters.
+	int32 GetSize() const
+	{
+		return Elements.GetSize();
+	}
+	bool IsEmpty() const
+	{
+		return Elements.GetSize() == 0;
+	}
+	// Number of slots, including the free ones.
+	int32 GetNumSlots() const
+	{
+		return Slots.GetSize();
+	}
+	// The dense array of elements. Its order changes when elements are removed.
+	const TArray<ElementType>& GetElements() const
+	{
+		return Elements;
+	}
+
+	// Iterators over the dense array.
+	ElementType* begin()
+	{
+		return Elements.begin();
+	}
+	const ElementType* begin() const
+	{
+		return Elements.begin();
+	}
+	ElementType* end()
+	{
+		return Elements.end();
+	}
+	const ElementType* end() const
+	{
+		return Elements.end();
+	}
+
+private:
+	struct FSlot
+	{
+		// Index of the slot's element in the dense array, or of the next free slot if the slot is free.
+		int32 Index;
+		// Bumped every time the slot's element is removed.
+		uint32 Generation;
+	};
+
+	// Returns the index in the dense array of a handle's element, or InvalidIndex if the handle is stale or null.
+	int32 GetElementIndex(FHandle InHandle) const
+	{
+		if (InHandle.Index >= static_cast<uint32>(Slots.GetSize()))
+		{
+			return InvalidIndex;
+		}
+		const FSlot& Slot = Slots[InHandle.Index];
+		return Slot.Generation == InHandle.Generation ? Slot.Index : InvalidIndex;
+	}
+
+	// Frees a slot, making handles to its element stale, and pushes it on the free list.
+	void FreeSlot(int32 InSlotIndex);
+
+	TArray<ElementType> Elements;
+	// Index of the slot of each element in the dense array, used to fix up slots when elements move.
+	TArray<int32> ElementSlots;
+	TArray<FSlot> Slots;
+	// First slot of the list of free slots, linked through their indices.
+	int32 FreeSlotListHead = InvalidIndex;
+};
+
+template<typename ElementType>
+template<typename... ArgTypes>
+typename TSlotMap<ElementType>::FHandle TSlotMap<ElementType>::Emplace(ArgTypes&&... InArgs)
+{
+	int32 ElementIndex = Elements.Emplace(Forward<ArgTypes>(InArgs)...);
+
+	int32 SlotIndex = FreeSlotListHead;
+	if (SlotIndex != InvalidIndex)
+	{
+		FreeSlotListHead = Slots[SlotIndex].Index;
+		Slots[SlotIndex].Index = ElementIndex;
+	}
+	else
+	{
+		// Generations start at 1, so that null handles never match a slot.
+		SlotIndex = Slots.Add({ ElementIndex, 1 });
+	}
+	ElementSlots.Add(SlotIndex);
+
+	return { static_cast<uint32>(SlotIndex), Slots[SlotIndex].Generation };
+}
+
+template<typename ElementType>
+bool TSlotMap<ElementType>::Remove(FHandle InHandle)
+{
+	int32 ElementIndex = GetElementIndex(InHandle);
+	if (ElementIndex == InvalidIndex)
+	{
+		return false;
+	}
+
+	// Fill the hole with the last element, so that the elements stay dense.
+	int32 LastElementIndex = Elements.GetSize() - 1;
+	if (ElementIndex != LastElementIndex)
+	{
+		Elements[ElementIndex] = MoveTempIfPossible(Elements[LastElementIndex]);
+		ElementSlots[ElementIndex] = ElementSlots[LastElementIndex];
+		Slots[ElementSlots[ElementIndex]].Index = ElementIndex;
+	}
+	// Removing the last element doesn't shift anything.
+	Elements.RemoveAt(LastElementIndex);
+	ElementSlots.RemoveAt(LastElementIndex);
+
+	FreeSlot(InHandle.Index);
+	return true;
+}
+
+template<typename ElementType>
+void TSlotMap<ElementType>::Empty()
+{
+	for (int32 SlotIndex : ElementSlots)
+	{
+		FreeSlot(SlotIndex);
+	}
+	Elements.Empty();
+	ElementSlots.Empty();
+}
+
+template<typename ElementType>
+void TSlotMap<ElementType>::FreeSlot(int32 InSlotIndex)
+{
+	FSlot& Slot = Slots[InSlotIndex];
+	// Skip 0 when the generation wraps around, since null handles use it.
+	if (++Slot.Generation == 0)
+	{
+		Slot.Generation = 1;
+	}
+	Slot.Index = FreeSlotListHead;
+	FreeSlotListHead = InSlotIndex;
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Containers/Array.h"
+#include "Containers/BTree.h"
+#include "Containers/Map.h"
+#include "Templates/TypeTraits/CallTraits.h"
+
+// System includes for placement new.
+#include <new>
+
+template<typename KeyType, typename ValueType>
+struct TDefaultSortedMapKeyOperations : TDefaultSortedKeyOperations<KeyType, TPair<KeyType, ValueType>>
+{
+	using KeyParamType = typename TCallTraits<KeyType>::ConstParamType;
+
+	// Overloading GetKeyFromElement so that we return the pair's key instead of the pair itself.
+	static KeyParamType GetKeyFromElement(const TPair<KeyType, ValueType>& InElement)
+	{
+		return InElement.Key;
+	}
+};
+
+/**
+ * An ordered map that does not allow for duplicate keys, stored in a B-tree.
+ * Unlike TMap, pairs are iterated in increasing key order, and can be queried by key range. Lookups are
+ * O(log n) instead of O(1), but the tree's nodes are a few cache lines each, so they stay cheap.
+ * Nodes come from the allocator the map was constructed with; copies and moves follow the same allocator rules as TMap.
+ */
+template<typename KeyType, typename ValueType, typename KeyOperations = TDefaultSortedMapKeyOperations<KeyType, ValueType>>
+class TSortedMap
+{
+	using PairType = TPair<KeyType, ValueType>;
+	using TreeType = TBTree<PairType, KeyOperations>;
+	using KeyConstParamType = typename TCallTraits<KeyType>::ConstParamType;
+
+public:
+	using FIterator = typename TreeType::FIterator;
+	using FConstIterator = typename TreeType::FConstIterator;
+
+	TSortedMap() = default;
+	~TSortedMap() = default;
+
+	TSortedMap(const TSortedMap& InMap) = default;
+	TSortedMap& operator=(const TSortedMap& InMap) = default;
+	TSortedMap(TSortedMap&& InMap) = default;
+	TSortedMap& operator=(TSortedMap&& InMap) = default;
+
+	// Constructor that stores the map's nodes in memory from the given allocator, which must outlive the map.
+	explicit TSortedMap(IAllocator& InAllocator)
+		: Tree(InAllocator)
+	{
+	}
+
+	// Copy constructor that stores the copy in memory from another allocator.
+	TSortedMap(const TSortedMap& InMap, IAllocator& InAllocator)
+		: Tree(InMap.Tree, InAllocator)
+	{
+	}
+
+	// Adds a pair, returning false without changing the map if the key is already in it, like TMap.
+	bool Add(const KeyType& InKey, const ValueType& InValue)
+	{
+		return Tree.Emplace(InKey, InKey, InValue);
+	}
+
+	bool Add(const KeyType& InKey, ValueType&& InValue)
+	{
+		return Tree.Emplace(InKey, InKey, MoveTemp(InValue));
+	}
+
+	bool Add(KeyType&& InKey, const ValueType& InValue)
+	{
+		// The key is only moved into the pair once it has been compared.
+		return Tree.Emplace(InKey, MoveTemp(InKey), InValue);
+	}
+
+	bool Add(KeyType&& InKey, ValueType&& InValue)
+	{
+		return Tree.Emplace(InKey, MoveTemp(InKey), MoveTemp(InValue));
+	}
+
+	// Removes a pair, returning false if the key wasn't in the map.
+	bool Remove(KeyConstParamType InKey)
+	{
+		return Tree.Remove(InKey);
+	}
+
+	const ValueType* Find(KeyConstParamType InKey) const
+	{
+		if (const PairType* Pair = Tree.Find(InKey))
+		{
+			return &Pair->Value;
+		}
+		return nullptr;
+	}
+
+	ValueType* Find(KeyConstParamType InKey)
+	{
+		return const_cast<ValueType*>(
+			static_cast<const TSortedMap&>(*this).Find(InKey)
+			);
+	}
+
+	bool IsKeyContained(KeyConstParamType InKey) const
+	{
+		return Tree.Find(InKey) != nullptr;
+	}
+
+	// Returns an iterator to the first pair whose key isn't before InKey.
+	FIterator LowerBound(KeyConstParamType InKey)
+	{
+		return Tree.LowerBound(InKey);
+	}
+	FConstIterator LowerBound(KeyConstParamType InKey) const
+	{
+		return Tree.LowerBound(InKey);
+	}
+
+	// Returns an iterator to the first pair whose key is after InKey.
+	FIterator UpperBound(KeyConstParamType InKey)
+	{
+		return Tree.UpperBound(InKey);
+	}
+	FConstIterator UpperBound(KeyConstParamType InKey) const
+	{
+		return Tree.UpperBound(InKey);
+	}
+
+	// Returns the pairs with keys from InMinKey to InMaxKey inclusive, in key order.
+	TSortedRange<FIterator> GetRange(KeyConstParamType InMinKey, KeyConstParamType InMaxKey)
+	{
+		return { Tree.LowerBound(InMinKey), Tree.UpperBound(InMaxKey) };
+	}
+	TSortedRange<FConstIterator> GetRange(KeyConstParamType InMinKey, KeyConstParamType InMaxKey) const
+	{
+		return { Tree.LowerBound(InMinKey), Tree.UpperBound(InMaxKey) };
+	}
+
+	/**
+	 * Replaces the map's pairs in O(n), which is faster than adding them one by one.
+	 *
+	 * @param InSortedPairs: Pairs in strictly increasing key order.
+	 */
+	void BuildFromSorted(const TArray<PairType>& InSortedPairs)
+	{
+		const PairType* Pair = InSortedPairs.GetData();
+		Tree.BuildFromSorted(InSortedPairs.GetSize(), [&Pair](PairType* InDestination)
+		{
+			new (InDestination) PairType(*Pair++);
+		});
+	}
+
+	void Empty()
+	{
+		Tree.Empty();
+	}
+
+	// Getters.
+	bool IsEmpty() const
+	{
+		return Tree.IsEmpty();
+	}
+	int32 GetSize() const
+	{
+		return Tree.GetSize();
+	}
+	IAllocator* GetAllocator() const
+	{
+		return Tree.GetAllocator();
+	}
+
+	// Iterators in increasing key order. Values can be modified, but keys must not be.
+	FIterator begin()
+	{
+		return Tree.begin();
+	}
+	FConstIterator begin() const
+	{
+		return Tree.begin();
+	}
+	FIterator end()
+	{
+		return Tree.end();
+	}
+	FConstIterator end() const
+	{
+		return Tree.end();
+	}
+
+private:
+	TreeType Tree;
+};
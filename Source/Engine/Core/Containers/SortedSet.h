@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Containers/Array.h"
+#include "Containers/BTree.h"
+#include "Templates/TypeTraits/CallTraits.h"
+
+// System includes for placement new.
+#include <new>
+
+/**
+ * An ordered set that does not allow for duplicate elements, stored in a B-tree.
+ * Unlike TSet, elements are iterated in increasing order, and can be queried by range. Lookups are
+ * O(log n) instead of O(1), but the tree's nodes are a few cache lines each, so they stay cheap.
+ * Nodes come from the allocator the set was constructed with; copies and moves follow the same allocator rules as TSet.
+ */
+template<typename ElementType, typename KeyOperations = TDefaultSortedKeyOperations<ElementType, ElementType>>
+class TSortedSet
+{
+	using TreeType = TBTree<ElementType, KeyOperations>;
+	using KeyParamType = typename KeyOperations::KeyParamType;
+
+public:
+	using FConstIterator = typename TreeType::FConstIterator;
+
+	TSortedSet() = default;
+	~TSortedSet() = default;
+
+	TSortedSet(const TSortedSet& InSet) = default;
+	TSortedSet& operator=(const TSortedSet& InSet) = default;
+	TSortedSet(TSortedSet&& InSet) = default;
+	TSortedSet& operator=(TSortedSet&& InSet) = default;
+
+	// Constructor that stores the set's nodes in memory from the given allocator, which must outlive the set.
+	explicit TSortedSet(IAllocator& InAllocator)
+		: Tree(InAllocator)
+	{
+	}
+
+	// Copy constructor that stores the copy in memory from another allocator.
+	TSortedSet(const TSortedSet& InSet, IAllocator& InAllocator)
+		: Tree(InSet.Tree, InAllocator)
+	{
+	}
+
+	// Adds an element, returning false without changing the set if an equal element is already in it.
+	bool Add(const ElementType& InElement)
+	{
+		return Tree.Emplace(KeyOperations::GetKeyFromElement(InElement), InElement);
+	}
+
+	bool Add(ElementType&& InElement)
+	{
+		return Tree.Emplace(KeyOperations::GetKeyFromElement(InElement), MoveTemp(InElement));
+	}
+
+	// Removes an element, returning false if it wasn't in the set.
+	bool Remove(KeyParamType InKey)
+	{
+		return Tree.Remove(InKey);
+	}
+
+	const ElementType* Find(KeyParamType InKey) const
+	{
+		return Tree.Find(InKey);
+	}
+
+	bool IsContained(KeyParamType InKey) const
+	{
+		return Tree.Find(InKey) != nullptr;
+	}
+
+	// Returns an iterator to the first element that isn't before InKey.
+	FConstIterator LowerBound(KeyParamType InKey) const
+	{
+		return Tree.LowerBound(InKey);
+	}
+
+	// Returns an iterator to the first element after InKey.
+	FConstIterator UpperBound(KeyParamType InKey) const
+	{
+		return Tree.UpperBound(InKey);
+	}
+
+	// Returns the elements from InMinKey to InMaxKey inclusive, in order.
+	TSortedRange<FConstIterator> GetRange(KeyParamType InMinKey, KeyParamType InMaxKey) const
+	{
+		return { Tree.LowerBound(InMinKey), Tree.UpperBound(InMaxKey) };
+	}
+
+	/**
+	 * Replaces the set's elements in O(n), which is faster than adding them one by one.
+	 *
+	 * @param InSortedElements: Elements in strictly increasing order.
+	 */
+	void BuildFromSorted(const TArray<ElementType>& InSortedElements)
+	{
+		const ElementType* Element = InSortedElements.GetData();
+		Tree.BuildFromSorted(InSortedElements.GetSize(), [&Element](ElementType* InDestination)
+		{
+			new (InDestination) ElementType(*Element++);
+		});
+	}
+
+	void Empty()
+	{
+		Tree.Empty();
+	}
+
+	// Getters.
+	bool IsEmpty() const
+	{
+		return Tree.IsEmpty();
+	}
+	int32 GetSize() const
+	{
+		return Tree.GetSize();
+	}
+	IAllocator* GetAllocator() const
+	{
+		return Tree.GetAllocator();
+	}
+
+	// Iterators in increasing order. Elements can't be modified, since that could change their order.
+	FConstIterator begin() const
+	{
+		return Tree.begin();
+	}
+	FConstIterator end() const
+	{
+		return Tree.end();
+	}
+
+private:
+	TreeType Tree;
+};
@@ -16,3 +16,6 @@ using ANSICHAR = char;
 
 // Invalid value for container index.
 static constexpr int32 InvalidIndex = -1;
+
+// Size of a cache line, to keep data written by different threads on separate lines.
+static constexpr int32 PlatformCacheLineSize = 64;
@@ -9,6 +9,8 @@
 
 // Strings.
 #include "Strings/String.h"
+#include "Strings/StringView.h"
+#include "Strings/StringBuilder.h"
 #include "Strings/StringId.h"
 
 // Smart Pointers.
@@ -34,3 +36,11 @@
 #include "Math/Color.h"
 #include "Math/Transform4D.h"
 #include "Math/Matrix4D.h"
+#include "Math/Quat.h"
+#include "Math/TransformTRS.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Geometry/Sphere.h"
+#include "Math/Geometry/Plane.h"
+#include "Math/Geometry/FrustumPlanes.h"
+#include "Math/Geometry/Ray.h"
+#include "Math/Geometry/OBB.h"
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+/**
+ * Virtual memory operations. Address space is first reserved, which uses no physical memory,
+ * and then committed and decommitted in whole pages as it is needed.
+ */
+class FGenericPlatformMemory
+{
+public:
+	/**
+	 * @returns Size in bytes of a virtual memory page. Addresses and sizes passed to the
+	 * other functions must be multiples of it.
+	 */
+	static uint64 GetPageSize()
+	{
+		return 4096;
+	}
+
+	/**
+	 * @returns Size in bytes of a huge page, which committed memory should be aligned to
+	 * for the system to back it with huge pages.
+	 */
+	static uint64 GetHugePageSize()
+	{
+		return 2 * 1024 * 1024;
+	}
+
+	/**
+	 * Reserves a range of address space without committing memory to it.
+	 *
+	 * @returns Start of the range, or nullptr if it couldn't be reserved.
+	 */
+	static void* ReserveVirtualMemory(uint64 InSize)
+	{
+		return nullptr;
+	}
+
+	/**
+	 * Commits reserved memory so it can be read and written. Committed memory is zero-filled.
+	 *
+	 * @param bInUseHugePages: Asks the system to back the memory with huge pages where it supports doing so.
+	 * @returns true if the memory was committed, false otherwise.
+	 */
+	static bool CommitVirtualMemory(void* InAddress, uint64 InSize, bool bInUseHugePages)
+	{
+		return false;
+	}
+
+	// Returns committed memory to the system. The range stays reserved.
+	static void DecommitVirtualMemory(void* InAddress, uint64 InSize)
+	{
+	}
+
+	// Releases a whole range returned by ReserveVirtualMemory.
+	static void ReleaseVirtualMemory(void* InAddress, uint64 InSize)
+	{
+	}
+};
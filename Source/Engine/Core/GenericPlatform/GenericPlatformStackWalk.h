@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+/**
+ * Call stack capture and symbol lookup, for debugging tools such as memory tracking.
+ */
+class FGenericPlatformStackWalk
+{
+public:
+	/**
+	 * Captures the return addresses of the calling thread's stack, innermost first.
+	 *
+	 * @param OutAddresses: Receives up to InMaxDepth addresses.
+	 * @param InNumFramesToSkip: Number of innermost frames to leave out, not counting this function.
+	 * @returns Number of addresses written.
+	 */
+	static int32 CaptureStackBackTrace(uint64* OutAddresses, int32 InMaxDepth, int32 InNumFramesToSkip = 0)
+	{
+		return 0;
+	}
+
+	/**
+	 * Writes a readable description of a code address, such as its function name, as a null-terminated string.
+	 *
+	 * @returns true if a symbol was found, false if only the address was written.
+	 */
+	static bool GetSymbolName(uint64 InAddress, ANSICHAR* OutName, int32 InNameSize);
+};
+
+inline bool FGenericPlatformStackWalk::GetSymbolName(uint64 InAddress, ANSICHAR* OutName, int32 InNameSize)
+{
+	static const ANSICHAR HexDigits[] = "0123456789abcdef";
+	if (InNameSize < 19)
+	{
+		if (InNameSize > 0)
+		{
+			OutName[0] = '\0';
+		}
+		return false;
+	}
+
+	OutName[0] = '0';
+	OutName[1] = 'x';
+	for (int32 Digit = 0; Digit < 16; ++Digit)
+	{
+		OutName[2 + Digit] = HexDigits[(InAddress >> (60 - 4 * Digit)) & 0xF];
+	}
+	OutName[18] = '\0';
+	return false;
+}
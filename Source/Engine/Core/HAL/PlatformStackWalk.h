@@ -0,0 +1,5 @@
+#pragma once
+
+#include "PreprocessorHelpers.h"
+
+#include PLATFORM_HEADER(PlatformStackWalk.h)
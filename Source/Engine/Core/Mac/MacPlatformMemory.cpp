@@ -0,0 +1,45 @@
+#include "Mac/MacPlatformMemory.h"
+
+// System includes for mmap, mprotect, madvise, and sysconf.
+#include <sys/mman.h>
+#include <unistd.h>
+
+uint64 FMacPlatformMemory::GetPageSize()
+{
+	return static_cast<uint64>(sysconf(_SC_PAGESIZE));
+}
+
+void* FMacPlatformMemory::ReserveVirtualMemory(uint64 InSize)
+{
+	void* Address = mmap(nullptr, InSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	return Address != MAP_FAILED ? Address : nullptr;
+}
+
+bool FMacPlatformMemory::CommitVirtualMemory(void* InAddress, uint64 InSize, bool bInUseHugePages)
+{
+	if (mprotect(InAddress, InSize, PROT_READ | PROT_WRITE) != 0)
+	{
+		return false;
+	}
+
+	// Only systems with transparent huge pages support this hint. Elsewhere, regular pages are used.
+#ifdef MADV_HUGEPAGE
+	if (bInUseHugePages)
+	{
+		madvise(InAddress, InSize, MADV_HUGEPAGE);
+	}
+#endif
+	return true;
+}
+
+void FMacPlatformMemory::DecommitVirtualMemory(void* InAddress, uint64 InSize)
+{
+	// Mapping fresh inaccessible pages over the range frees its physical memory right away,
+	// which madvise doesn't guarantee on every system.
+	mmap(InAddress, InSize, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+}
+
+void FMacPlatformMemory::ReleaseVirtualMemory(void* InAddress, uint64 InSize)
+{
+	munmap(InAddress, InSize);
+}
@@ -0,0 +1,41 @@
+#include "Mac/MacPlatformStackWalk.h"
+#include "Math/MathUtilities.h"
+
+// System includes for backtrace, dladdr, and symbol demangling.
+#include <execinfo.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <cstdio>
+#include <cstdlib>
+
+int32 FMacPlatformStackWalk::CaptureStackBackTrace(uint64* OutAddresses, int32 InMaxDepth, int32 InNumFramesToSkip /* = 0 */)
+{
+	// Capture into a local buffer first, since this function's own frame and the skipped ones come first.
+	static constexpr int32 MaxCapturedFrames = 64;
+	void* Frames[MaxCapturedFrames];
+	int32 NumFramesToSkip = InNumFramesToSkip + 1;
+	int32 NumFrames = backtrace(Frames, FMath::Min(InMaxDepth + NumFramesToSkip, MaxCapturedFrames));
+
+	int32 NumAddresses = FMath::Max(NumFrames - NumFramesToSkip, 0);
+	for (int32 Index = 0; Index < NumAddresses; ++Index)
+	{
+		OutAddresses[Index] = reinterpret_cast<uint64>(Frames[NumFramesToSkip + Index]);
+	}
+	return NumAddresses;
+}
+
+bool FMacPlatformStackWalk::GetSymbolName(uint64 InAddress, ANSICHAR* OutName, int32 InNameSize)
+{
+	Dl_info Info;
+	if (!dladdr(reinterpret_cast<void*>(InAddress), &Info) || !Info.dli_sname)
+	{
+		return FGenericPlatformStackWalk::GetSymbolName(InAddress, OutName, InNameSize);
+	}
+
+	int Status = 0;
+	ANSICHAR* DemangledName = abi::__cxa_demangle(Info.dli_sname, nullptr, nullptr, &Status);
+	uint64 Offset = InAddress - reinterpret_cast<uint64>(Info.dli_saddr);
+	snprintf(OutName, InNameSize, "%s + %llu", Status == 0 ? DemangledName : Info.dli_sname, Offset);
+	free(DemangledName);
+	return true;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "GenericPlatform/GenericPlatformStackWalk.h"
+
+class FMacPlatformStackWalk : public FGenericPlatformStackWalk
+{
+public:
+	// Begin FGenericPlatformStackWalk interface.
+	static int32 CaptureStackBackTrace(uint64* OutAddresses, int32 InMaxDepth, int32 InNumFramesToSkip = 0);
+	static bool GetSymbolName(uint64 InAddress, ANSICHAR* OutName, int32 InNameSize);
+	// End FGenericPlatformStackWalk interface.
+};
+
+using FPlatformStackWalk = FMacPlatformStackWalk;
@@ -0,0 +1,147 @@
+#include "AABB.h"
+#include "AssertionMacros.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+static FVector3D ComponentMin(const FVector3D& InA, const FVector3D& InB)
+{
+	return FVector3D(FMath::Min(InA.X, InB.X), FMath::Min(InA.Y, InB.Y), FMath::Min(InA.Z, InB.Z));
+}
+
+static FVector3D ComponentMax(const FVector3D& InA, const FVector3D& InB)
+{
+	return FVector3D(FMath::Max(InA.X, InB.X), FMath::Max(InA.Y, InB.Y), FMath::Max(InA.Z, InB.Z));
+}
+
+static FVector3D ComponentAbs(const FVector3D& InVector)
+{
+	return FVector3D(FMath::Abs(InVector.X), FMath::Abs(InVector.Y), FMath::Abs(InVector.Z));
+}
+
+// Constructors.
+FAABB::FAABB()
+	: Min(FMath::MaxFloat, FMath::MaxFloat, FMath::MaxFloat)
+	, Max(-FMath::MaxFloat, -FMath::MaxFloat, -FMath::MaxFloat)
+{
+}
+
+FAABB::FAABB(const FVector3D& InMin, const FVector3D& InMax)
+	: Min(InMin)
+	, Max(InMax)
+{
+}
+
+/*static*/ FAABB FAABB::MakeFromCenterAndExtent(const FVector3D& InCenter, const FVector3D& InExtent)
+{
+	return FAABB(InCenter - InExtent, InCenter + InExtent);
+}
+
+/*static*/ FAABB FAABB::MakeFromPoints(const FVector3D* InPoints, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FAABB Result;
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		Result.ExpandToInclude(InPoints[Index]);
+	}
+	return Result;
+}
+
+bool FAABB::IsValid() const
+{
+	return Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z;
+}
+
+// Accessors.
+FVector3D FAABB::GetCenter() const
+{
+	return (Min + Max) * 0.5f;
+}
+
+FVector3D FAABB::GetExtent() const
+{
+	return (Max - Min) * 0.5f;
+}
+
+FVector3D FAABB::GetSize() const
+{
+	return Max - Min;
+}
+
+float FAABB::GetSurfaceArea() const
+{
+	FVector3D Size = GetSize();
+	return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+void FAABB::ExpandToInclude(const FVector3D& InPoint)
+{
+	Min = ComponentMin(Min, InPoint);
+	Max = ComponentMax(Max, InPoint);
+}
+
+void FAABB::ExpandToInclude(const FAABB& InBox)
+{
+	Min = ComponentMin(Min, InBox.Min);
+	Max = ComponentMax(Max, InBox.Max);
+}
+
+// Containment and overlap tests.
+bool FAABB::Contains(const FVector3D& InPoint) const
+{
+	return InPoint.X >= Min.X && InPoint.X <= Max.X
+		&& InPoint.Y >= Min.Y && InPoint.Y <= Max.Y
+		&& InPoint.Z >= Min.Z && InPoint.Z <= Max.Z;
+}
+
+bool FAABB::Contains(const FAABB& InBox) const
+{
+	return Contains(InBox.Min) && Contains(InBox.Max);
+}
+
+bool FAABB::Intersects(const FAABB& InBox) const
+{
+	return Min.X <= InBox.Max.X && Max.X >= InBox.Min.X
+		&& Min.Y <= InBox.Max.Y && Max.Y >= InBox.Min.Y
+		&& Min.Z <= InBox.Max.Z && Max.Z >= InBox.Min.Z;
+}
+
+FVector3D FAABB::GetClosestPoint(const FVector3D& InPoint) const
+{
+	return ComponentMin(ComponentMax(InPoint, Min), Max);
+}
+
+float FAABB::GetDistanceSquared(const FVector3D& InPoint) const
+{
+	return (GetClosestPoint(InPoint) - InPoint).GetLengthSquared();
+}
+
+/**
+ * Transforms the center, and projects the extent onto each world axis using the absolute values of the
+ * transform's columns. See Graphics Gems, "Transforming Axis-Aligned Bounding Boxes" (Arvo, page 548).
+ */
+FAABB FAABB::GetTransformed(const FTransform4D& InTransform) const
+{
+	if (!IsValid())
+	{
+		return *this;
+	}
+
+	FVector3D Center = GetCenter();
+	FVector3D Extent = GetExtent();
+	FVector3D NewCenter = InTransform * Center + InTransform.GetTranslation();
+	FVector3D NewExtent = ComponentAbs(InTransform[0]) * Extent.X + ComponentAbs(InTransform[1]) * Extent.Y + ComponentAbs(InTransform[2]) * Extent.Z;
+	return MakeFromCenterAndExtent(NewCenter, NewExtent);
+}
+
+// Equality operators.
+bool FAABB::operator==(const FAABB& InBox) const
+{
+	return Min == InBox.Min && Max == InBox.Max;
+}
+
+bool FAABB::operator!=(const FAABB& InBox) const
+{
+	return !(*this == InBox);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+
+class FTransform4D;
+
+/**
+ * Axis-aligned bounding box, stored as its minimum and maximum corners.
+ * A default-constructed box is empty (its minimum is greater than its maximum) and grows to fit
+ * whatever is added with ExpandToInclude.
+ */
+class FAABB
+{
+public:
+	// Constructors.
+	FAABB();
+	FAABB(const FVector3D& InMin, const FVector3D& InMax);
+	static FAABB MakeFromCenterAndExtent(const FVector3D& InCenter, const FVector3D& InExtent);
+	static FAABB MakeFromPoints(const FVector3D* InPoints, int32 InCount);
+
+	// Copy operations.
+	FAABB(const FAABB& InBox) = default;
+	FAABB& operator=(const FAABB& InBox) = default;
+
+	// Returns false for empty boxes.
+	bool IsValid() const;
+
+	// Accessors. The extent is half the size of the box along each axis.
+	FVector3D GetCenter() const;
+	FVector3D GetExtent() const;
+	FVector3D GetSize() const;
+	float GetSurfaceArea() const;
+
+	// Grows the box to contain a point or another box.
+	void ExpandToInclude(const FVector3D& InPoint);
+	void ExpandToInclude(const FAABB& InBox);
+
+	// Containment and overlap tests. Points and boxes touching the boundary count as inside.
+	bool Contains(const FVector3D& InPoint) const;
+	bool Contains(const FAABB& InBox) const;
+	bool Intersects(const FAABB& InBox) const;
+
+	// Closest point in (or on) the box, and the squared distance to it (zero for points inside).
+	FVector3D GetClosestPoint(const FVector3D& InPoint) const;
+	float GetDistanceSquared(const FVector3D& InPoint) const;
+
+	// Smallest box containing this box after it is rotated, scaled, and translated by the transform.
+	FAABB GetTransformed(const FTransform4D& InTransform) const;
+
+	// Equality operators.
+	bool operator==(const FAABB& InBox) const;
+	bool operator!=(const FAABB& InBox) const;
+
+	FVector3D Min;
+	FVector3D Max;
+};
@@ -0,0 +1,92 @@
+#include "FrustumPlanes.h"
+#include "AABB.h"
+#include "Sphere.h"
+#include "OBB.h"
+#include "Math/Matrix4D.h"
+#include "Math/Vector4D.h"
+#include "Math/MathUtilities.h"
+
+// Constructors.
+/*static*/ FFrustumPlanes FFrustumPlanes::MakeFromViewProjection(const FMatrix4D& InViewProjection)
+{
+	// A point is inside when -W <= Row[Axis] . P <= W, so each plane is the fourth row plus or minus another row.
+	FVector4D Rows[4];
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		Rows[Row] = FVector4D(InViewProjection[0][Row], InViewProjection[1][Row], InViewProjection[2][Row], InViewProjection[3][Row]);
+	}
+
+	FFrustumPlanes Result;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		FVector4D Lower = Rows[3] + Rows[Axis];
+		FVector4D Upper = Rows[3] - Rows[Axis];
+		Result.Planes[Axis * 2] = FPlane(FVector3D(Lower), Lower.W).Normalize();
+		Result.Planes[Axis * 2 + 1] = FPlane(FVector3D(Upper), Upper.W).Normalize();
+	}
+	return Result;
+}
+
+// Accessors.
+FPlane& FFrustumPlanes::operator[](EFrustumPlane InPlane)
+{
+	return Planes[static_cast<int32>(InPlane)];
+}
+
+const FPlane& FFrustumPlanes::operator[](EFrustumPlane InPlane) const
+{
+	return Planes[static_cast<int32>(InPlane)];
+}
+
+// Containment and overlap tests.
+bool FFrustumPlanes::Contains(const FVector3D& InPoint) const
+{
+	for (const FPlane& Plane : Planes)
+	{
+		if (Plane.GetSignedDistance(InPoint) < 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// A box is outside a plane when its center is further behind the plane than the box's extent projected onto the normal.
+bool FFrustumPlanes::Intersects(const FAABB& InBox) const
+{
+	FVector3D Center = InBox.GetCenter();
+	FVector3D Extent = InBox.GetExtent();
+	for (const FPlane& Plane : Planes)
+	{
+		float ProjectedExtent = FMath::Abs(Plane.Normal.X) * Extent.X + FMath::Abs(Plane.Normal.Y) * Extent.Y + FMath::Abs(Plane.Normal.Z) * Extent.Z;
+		if (Plane.GetSignedDistance(Center) < -ProjectedExtent)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FFrustumPlanes::Intersects(const FSphere& InSphere) const
+{
+	for (const FPlane& Plane : Planes)
+	{
+		if (Plane.GetSignedDistance(InSphere.Center) < -InSphere.Radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FFrustumPlanes::Intersects(const FOBB& InBox) const
+{
+	for (const FPlane& Plane : Planes)
+	{
+		if (Plane.GetSignedDistance(InBox.Center) < -InBox.GetProjectedExtent(Plane.Normal))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Plane.h"
+
+class FMatrix4D;
+class FAABB;
+class FSphere;
+class FOBB;
+
+// Indices of the planes in FFrustumPlanes.
+enum class EFrustumPlane
+{
+	Left,
+	Right,
+	Bottom,
+	Top,
+	Near,
+	Far
+};
+
+/**
+ * The six planes bounding a view frustum, with normals pointing into the frustum, used for visibility culling.
+ *
+ * The intersection tests are conservative: shapes that are outside the frustum but near one of its
+ * corners or edges may be reported as intersecting, which is the usual trade-off for culling.
+ * FBoundsBatch (Math/Simd/BoundsBatch.h) runs the same tests over arrays of shapes.
+ */
+class FFrustumPlanes
+{
+public:
+	static constexpr int32 NumPlanes = 6;
+
+	// Constructors.
+	FFrustumPlanes() = default;
+	/**
+	 * Extracts the planes of a view-projection matrix that maps the frustum to the OpenGL clip volume
+	 * (-W <= X, Y, Z <= W). See "Fast Extraction of Viewing Frustum Planes from the World-View-Projection
+	 * Matrix" (Gribb and Hartmann).
+	 */
+	static FFrustumPlanes MakeFromViewProjection(const FMatrix4D& InViewProjection);
+
+	// Accessors.
+	FPlane& operator[](EFrustumPlane InPlane);
+	const FPlane& operator[](EFrustumPlane InPlane) const;
+
+	// Containment and overlap tests.
+	bool Contains(const FVector3D& InPoint) const;
+	bool Intersects(const FAABB& InBox) const;
+	bool Intersects(const FSphere& InSphere) const;
+	bool Intersects(const FOBB& InBox) const;
+
+	FPlane Planes[NumPlanes];
+};
@@ -0,0 +1,140 @@
+#include "OBB.h"
+#include "AABB.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+// Constructors.
+FOBB::FOBB(const FVector3D& InCenter, const FVector3D& InAxisX, const FVector3D& InAxisY, const FVector3D& InAxisZ, const FVector3D& InExtent)
+	: Center(InCenter)
+	, Axes{ InAxisX, InAxisY, InAxisZ }
+	, Extent(InExtent)
+{
+}
+
+/*static*/ FOBB FOBB::MakeFromAABB(const FAABB& InBox, const FTransform4D& InTransform)
+{
+	FVector3D BoxExtent = InBox.GetExtent();
+
+	FOBB Result;
+	Result.Center = InTransform * InBox.GetCenter() + InTransform.GetTranslation();
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const FVector3D& Column = InTransform[Axis];
+		Result.Axes[Axis] = FVector3D::Normalize(Column);
+		Result.Extent[Axis] = BoxExtent[Axis] * Column.GetLength();
+	}
+	return Result;
+}
+
+FAABB FOBB::GetAABB() const
+{
+	FVector3D WorldExtent;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		WorldExtent.X += FMath::Abs(Axes[Axis].X) * Extent[Axis];
+		WorldExtent.Y += FMath::Abs(Axes[Axis].Y) * Extent[Axis];
+		WorldExtent.Z += FMath::Abs(Axes[Axis].Z) * Extent[Axis];
+	}
+	return FAABB::MakeFromCenterAndExtent(Center, WorldExtent);
+}
+
+float FOBB::GetProjectedExtent(const FVector3D& InDirection) const
+{
+	return Extent.X * FMath::Abs(FVector3D::DotProduct(InDirection, Axes[0]))
+		+ Extent.Y * FMath::Abs(FVector3D::DotProduct(InDirection, Axes[1]))
+		+ Extent.Z * FMath::Abs(FVector3D::DotProduct(InDirection, Axes[2]));
+}
+
+FVector3D FOBB::GetClosestPoint(const FVector3D& InPoint) const
+{
+	FVector3D Offset = InPoint - Center;
+	FVector3D Result = Center;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		float Distance = FMath::Clamp(FVector3D::DotProduct(Offset, Axes[Axis]), -Extent[Axis], Extent[Axis]);
+		Result += Axes[Axis] * Distance;
+	}
+	return Result;
+}
+
+// Containment and overlap tests.
+bool FOBB::Contains(const FVector3D& InPoint) const
+{
+	FVector3D Offset = InPoint - Center;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (FMath::Abs(FVector3D::DotProduct(Offset, Axes[Axis])) > Extent[Axis])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Tries the 15 potential separating axes: the face normals of each box, and the cross products of each pair
+ * of edge directions. Everything is computed in this box's frame, where R expresses the other box's axes.
+ */
+bool FOBB::Intersects(const FOBB& InBox) const
+{
+	// Added to the absolute rotation so that nearly parallel edges, whose cross product is close to zero,
+	// don't produce a false separating axis.
+	static constexpr float ParallelEpsilon = 1.e-6f;
+
+	float R[3][3];
+	float AbsR[3][3];
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		for (int32 Column = 0; Column < 3; ++Column)
+		{
+			R[Row][Column] = FVector3D::DotProduct(Axes[Row], InBox.Axes[Column]);
+			AbsR[Row][Column] = FMath::Abs(R[Row][Column]) + ParallelEpsilon;
+		}
+	}
+
+	FVector3D Offset = InBox.Center - Center;
+	FVector3D T(FVector3D::DotProduct(Offset, Axes[0]), FVector3D::DotProduct(Offset, Axes[1]), FVector3D::DotProduct(Offset, Axes[2]));
+	const FVector3D& A = Extent;
+	const FVector3D& B = InBox.Extent;
+
+	// This box's axes.
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		float RadiusB = B.X * AbsR[Axis][0] + B.Y * AbsR[Axis][1] + B.Z * AbsR[Axis][2];
+		if (FMath::Abs(T[Axis]) > A[Axis] + RadiusB)
+		{
+			return false;
+		}
+	}
+
+	// The other box's axes.
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		float RadiusA = A.X * AbsR[0][Axis] + A.Y * AbsR[1][Axis] + A.Z * AbsR[2][Axis];
+		float Distance = T.X * R[0][Axis] + T.Y * R[1][Axis] + T.Z * R[2][Axis];
+		if (FMath::Abs(Distance) > RadiusA + B[Axis])
+		{
+			return false;
+		}
+	}
+
+	// Cross products of this box's axis I with the other box's axis J.
+	for (int32 I = 0; I < 3; ++I)
+	{
+		int32 I1 = (I + 1) % 3;
+		int32 I2 = (I + 2) % 3;
+		for (int32 J = 0; J < 3; ++J)
+		{
+			int32 J1 = (J + 1) % 3;
+			int32 J2 = (J + 2) % 3;
+			float RadiusA = A[I1] * AbsR[I2][J] + A[I2] * AbsR[I1][J];
+			float RadiusB = B[J1] * AbsR[I][J2] + B[J2] * AbsR[I][J1];
+			float Distance = T[I2] * R[I1][J] - T[I1] * R[I2][J];
+			if (FMath::Abs(Distance) > RadiusA + RadiusB)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+
+class FAABB;
+class FTransform4D;
+
+/**
+ * Oriented bounding box, stored as its center, three orthonormal axes, and the half-size of the box
+ * along each axis. Fits rotated objects more tightly than an FAABB, at the cost of slower tests.
+ */
+class FOBB
+{
+public:
+	// Constructors.
+	FOBB() = default;
+	FOBB(const FVector3D& InCenter, const FVector3D& InAxisX, const FVector3D& InAxisY, const FVector3D& InAxisZ, const FVector3D& InExtent);
+	/**
+	 * The box an FAABB becomes after being transformed. Scale is moved from the axes into the extent, so the
+	 * result is exact for transforms without shear (e.g. anything built from translation, rotation, and scale).
+	 */
+	static FOBB MakeFromAABB(const FAABB& InBox, const FTransform4D& InTransform);
+
+	// Copy operations.
+	FOBB(const FOBB& InBox) = default;
+	FOBB& operator=(const FOBB& InBox) = default;
+
+	// Smallest axis-aligned box containing this box.
+	FAABB GetAABB() const;
+	// Half the length of the box's projection onto a direction (the "radius" of the box along it).
+	float GetProjectedExtent(const FVector3D& InDirection) const;
+
+	// Closest point in (or on) the box.
+	FVector3D GetClosestPoint(const FVector3D& InPoint) const;
+
+	// Containment and overlap tests. Points and boxes touching the boundary count as inside.
+	bool Contains(const FVector3D& InPoint) const;
+	// Separating axis test. See Real-Time Collision Detection (Ericson, page 101).
+	bool Intersects(const FOBB& InBox) const;
+
+	FVector3D Center;
+	FVector3D Axes[3] = { FVector3D(1.0f, 0.0f, 0.0f), FVector3D(0.0f, 1.0f, 0.0f), FVector3D(0.0f, 0.0f, 1.0f) };
+	FVector3D Extent;
+};
@@ -0,0 +1,56 @@
+#include "Plane.h"
+#include "Math/MathUtilities.h"
+
+// Constructors.
+FPlane::FPlane(const FVector3D& InNormal, float InD)
+	: Normal(InNormal)
+	, D(InD)
+{
+}
+
+/*static*/ FPlane FPlane::MakeFromPointAndNormal(const FVector3D& InPoint, const FVector3D& InNormal)
+{
+	return FPlane(InNormal, -FVector3D::DotProduct(InNormal, InPoint));
+}
+
+/*static*/ FPlane FPlane::MakeFromPoints(const FVector3D& InPoint1, const FVector3D& InPoint2, const FVector3D& InPoint3)
+{
+	FVector3D Normal = FVector3D::Normalize(FVector3D::CrossProduct(InPoint2 - InPoint1, InPoint3 - InPoint1));
+	return MakeFromPointAndNormal(InPoint1, Normal);
+}
+
+FPlane& FPlane::Normalize()
+{
+	float LengthSquared = Normal.GetLengthSquared();
+	if (FMath::IsApproximatelyZero(LengthSquared))
+	{
+		// A plane without a normal can't be normalized (as with FVector3D::Normalize).
+		return *this;
+	}
+
+	float InverseLength = FMath::InvSqrt(LengthSquared);
+	Normal *= InverseLength;
+	D *= InverseLength;
+	return *this;
+}
+
+float FPlane::GetSignedDistance(const FVector3D& InPoint) const
+{
+	return FVector3D::DotProduct(Normal, InPoint) + D;
+}
+
+FVector3D FPlane::ProjectPoint(const FVector3D& InPoint) const
+{
+	return InPoint - Normal * GetSignedDistance(InPoint);
+}
+
+// Equality operators.
+bool FPlane::operator==(const FPlane& InPlane) const
+{
+	return Normal == InPlane.Normal && D == InPlane.D;
+}
+
+bool FPlane::operator!=(const FPlane& InPlane) const
+{
+	return !(*this == InPlane);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+
+/**
+ * Plane defined by the equation DotProduct(Normal, P) + D = 0.
+ * Points on the side the normal points to have a positive signed distance, which is in world units
+ * when the normal has unit length.
+ */
+class FPlane
+{
+public:
+	// Constructors.
+	FPlane() = default;
+	FPlane(const FVector3D& InNormal, float InD);
+	static FPlane MakeFromPointAndNormal(const FVector3D& InPoint, const FVector3D& InNormal);
+	// The normal points towards the side from which the points appear in counter-clockwise order.
+	static FPlane MakeFromPoints(const FVector3D& InPoint1, const FVector3D& InPoint2, const FVector3D& InPoint3);
+
+	// Copy operations.
+	FPlane(const FPlane& InPlane) = default;
+	FPlane& operator=(const FPlane& InPlane) = default;
+
+	// Scales the plane equation so that the normal has unit length.
+	FPlane& Normalize();
+
+	float GetSignedDistance(const FVector3D& InPoint) const;
+	// Closest point on the plane (assumes a unit-length normal).
+	FVector3D ProjectPoint(const FVector3D& InPoint) const;
+
+	// Equality operators.
+	bool operator==(const FPlane& InPlane) const;
+	bool operator!=(const FPlane& InPlane) const;
+
+	FVector3D Normal;
+	float D = 0.0f;
+};
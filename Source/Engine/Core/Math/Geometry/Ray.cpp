@@ -0,0 +1,93 @@
+#include "Ray.h"
+#include "AABB.h"
+#include "Sphere.h"
+#include "Plane.h"
+#include "Math/MathUtilities.h"
+
+// Constructors.
+FRay::FRay(const FVector3D& InOrigin, const FVector3D& InDirection)
+	: Origin(InOrigin)
+	, Direction(InDirection)
+{
+}
+
+/*static*/ FRay FRay::MakeFromPoints(const FVector3D& InStart, const FVector3D& InThrough)
+{
+	return FRay(InStart, FVector3D::Normalize(InThrough - InStart));
+}
+
+FVector3D FRay::GetPoint(float InDistance) const
+{
+	return Origin + Direction * InDistance;
+}
+
+/**
+ * Slab test: intersects the ray with the pair of planes bounding the box on each axis, and keeps the latest entry
+ * and earliest exit. A zero direction component gives infinite distances, which leave the range unchanged when the
+ * origin is between that axis' planes and empty it otherwise.
+ * This is the same computation as FBoundsBatch::RaycastAABBs.
+ */
+bool FRay::Intersects(const FAABB& InBox, float& OutDistance) const
+{
+	// Swapping the distances below would turn an empty box into an infinite one.
+	if (!InBox.IsValid())
+	{
+		return false;
+	}
+
+	float Near = 0.0f;
+	float Far = FMath::MaxFloat;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		float InverseDirection = 1.0f / Direction[Axis];
+		float Distance1 = (InBox.Min[Axis] - Origin[Axis]) * InverseDirection;
+		float Distance2 = (InBox.Max[Axis] - Origin[Axis]) * InverseDirection;
+		Near = FMath::Max(FMath::Min(Distance1, Distance2), Near);
+		Far = FMath::Min(FMath::Max(Distance1, Distance2), Far);
+	}
+
+	if (Near > Far)
+	{
+		return false;
+	}
+	OutDistance = Near;
+	return true;
+}
+
+bool FRay::Intersects(const FSphere& InSphere, float& OutDistance) const
+{
+	// Solve |Origin + Direction * T - Center|^2 = Radius^2 for T, with a unit-length direction.
+	FVector3D Offset = Origin - InSphere.Center;
+	float B = FVector3D::DotProduct(Offset, Direction);
+	float C = Offset.GetLengthSquared() - InSphere.Radius * InSphere.Radius;
+	if (C > 0.0f && B > 0.0f)
+	{
+		// The origin is outside the sphere and the ray points away from it.
+		return false;
+	}
+
+	float Discriminant = B * B - C;
+	if (Discriminant < 0.0f)
+	{
+		return false;
+	}
+	OutDistance = FMath::Max(-B - FMath::Sqrt(Discriminant), 0.0f);
+	return true;
+}
+
+bool FRay::Intersects(const FPlane& InPlane, float& OutDistance) const
+{
+	float Denominator = FVector3D::DotProduct(InPlane.Normal, Direction);
+	if (FMath::IsApproximatelyZero(Denominator))
+	{
+		return false;
+	}
+
+	float Distance = -InPlane.GetSignedDistance(Origin) / Denominator;
+	if (Distance < 0.0f)
+	{
+		return false;
+	}
+	OutDistance = Distance;
+	return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+
+class FAABB;
+class FSphere;
+class FPlane;
+
+/**
+ * Half-line starting at Origin and extending along Direction, used for picking and line-of-sight queries.
+ * Direction is expected to have unit length, so that distances along the ray are in world units.
+ *
+ * Each intersection test returns whether the ray hits the shape and, if so, the distance along the ray to
+ * the first hit (zero when the origin is inside the shape).
+ */
+class FRay
+{
+public:
+	// Constructors.
+	FRay() = default;
+	FRay(const FVector3D& InOrigin, const FVector3D& InDirection);
+	// The ray from one point through another.
+	static FRay MakeFromPoints(const FVector3D& InStart, const FVector3D& InThrough);
+
+	// Copy operations.
+	FRay(const FRay& InRay) = default;
+	FRay& operator=(const FRay& InRay) = default;
+
+	// Returns the point at the given distance along the ray.
+	FVector3D GetPoint(float InDistance) const;
+
+	// Intersection tests.
+	bool Intersects(const FAABB& InBox, float& OutDistance) const;
+	bool Intersects(const FSphere& InSphere, float& OutDistance) const;
+	// Rays parallel to the plane never hit it.
+	bool Intersects(const FPlane& InPlane, float& OutDistance) const;
+
+	FVector3D Origin;
+	FVector3D Direction = FVector3D(0.0f, 0.0f, -1.0f);
+};
@@ -0,0 +1,50 @@
+#include "Sphere.h"
+#include "AABB.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+// Constructors.
+FSphere::FSphere(const FVector3D& InCenter, float InRadius)
+	: Center(InCenter)
+	, Radius(InRadius)
+{
+}
+
+/*static*/ FSphere FSphere::MakeFromAABB(const FAABB& InBox)
+{
+	return FSphere(InBox.GetCenter(), InBox.GetExtent().GetLength());
+}
+
+// Containment and overlap tests.
+bool FSphere::Contains(const FVector3D& InPoint) const
+{
+	return (InPoint - Center).GetLengthSquared() <= Radius * Radius;
+}
+
+bool FSphere::Intersects(const FSphere& InSphere) const
+{
+	float RadiusSum = Radius + InSphere.Radius;
+	return (InSphere.Center - Center).GetLengthSquared() <= RadiusSum * RadiusSum;
+}
+
+bool FSphere::Intersects(const FAABB& InBox) const
+{
+	return InBox.GetDistanceSquared(Center) <= Radius * Radius;
+}
+
+FSphere FSphere::GetTransformed(const FTransform4D& InTransform) const
+{
+	float MaxScaleSquared = FMath::Max(InTransform[0].GetLengthSquared(), FMath::Max(InTransform[1].GetLengthSquared(), InTransform[2].GetLengthSquared()));
+	return FSphere(InTransform * Center + InTransform.GetTranslation(), Radius * FMath::Sqrt(MaxScaleSquared));
+}
+
+// Equality operators.
+bool FSphere::operator==(const FSphere& InSphere) const
+{
+	return Center == InSphere.Center && Radius == InSphere.Radius;
+}
+
+bool FSphere::operator!=(const FSphere& InSphere) const
+{
+	return !(*this == InSphere);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+
+class FAABB;
+class FTransform4D;
+
+/**
+ * Bounding sphere, stored as its center and radius.
+ */
+class FSphere
+{
+public:
+	// Constructors.
+	FSphere() = default;
+	FSphere(const FVector3D& InCenter, float InRadius);
+	// The sphere through the corners of the box.
+	static FSphere MakeFromAABB(const FAABB& InBox);
+
+	// Copy operations.
+	FSphere(const FSphere& InSphere) = default;
+	FSphere& operator=(const FSphere& InSphere) = default;
+
+	// Containment and overlap tests. Points and shapes touching the surface count as inside.
+	bool Contains(const FVector3D& InPoint) const;
+	bool Intersects(const FSphere& InSphere) const;
+	bool Intersects(const FAABB& InBox) const;
+
+	// Sphere containing this sphere after it is transformed. Non-uniform scales grow the radius by the largest scale.
+	FSphere GetTransformed(const FTransform4D& InTransform) const;
+
+	// Equality operators.
+	bool operator==(const FSphere& InSphere) const;
+	bool operator!=(const FSphere& InSphere) const;
+
+	FVector3D Center;
+	float Radius = 0.0f;
+};
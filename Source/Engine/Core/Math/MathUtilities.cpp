@@ -48,16 +48,6 @@ bool FMath::IsApproximatelyEqual(float InValue1, float InValue2, float InErrorTo
 	return IsApproximatelyZero(InValue1 - InValue2, InErrorTolerance);
 }
 
-float FMath::DegreesToRadians(float InDegrees)
-{
-	return InDegrees * (FMath::Pi / 180.0f);
-}
-
-float FMath::RadiansToDegrees(float InRadians)
-{
-	return InRadians * (180.0f / FMath::Pi);
-}
-
 float FMath::Pow(float InBase, float InExponent)
 {
 	return std::powf(InBase, InExponent);
@@ -93,29 +83,7 @@ float FMath::Round(float InValue)
 	return std::roundf(InValue);
 }
 
-int32 FMath::RoundUpToNearestPowerOfTwo(int32 InValue)
-{
-	--InValue;
-	InValue |= InValue >> 1;
-	InValue |= InValue >> 2;
-	InValue |= InValue >> 4;
-	InValue |= InValue >> 8;
-	InValue |= InValue >> 16;
-	++InValue;
-	return InValue;
-}
-
 float FMath::Abs(float InValue)
 {
 	return std::fabsf(InValue);
 }
-
-float FMath::Clamp(float InValue, float InMin, float InMax)
-{
-	return Min(InMax, Max(InValue, InMin));
-}
-
-bool FMath::IsPowerOfTwo(int32 InValue)
-{
-	return (InValue > 0) && ((InValue & (InValue - 1)) == 0);
-}
@@ -2,6 +2,14 @@
 
 #include "CoreGlobals.h"
 
+#if defined(_MSC_VER)
+// Compiler include for the bit scan intrinsics.
+#include <intrin.h>
+#endif
+
+// System include for memcpy.
+#include <cstring>
+
 struct FMath
 {
 	// Trigonometric constants.
@@ -13,6 +21,9 @@ struct FMath
 	// Default value used to determine whether two floating-point numbers are close enough to be considered equal.
 	static constexpr float Epsilon = 1.e-6f;
 
+	// Largest finite float value.
+	static constexpr float MaxFloat = 3.402823466e+38f;
+
 	// Trigonometric functions.
 	static float Cos(float InRadians);
 	static float Sin(float InRadians);
@@ -27,14 +38,18 @@ struct FMath
 	static bool IsApproximatelyEqual(float InValue1, float InValue2, float InErrorTolerance = Epsilon);
 
 	// Conversion functions between degrees and radians.
-	static float DegreesToRadians(float InDegrees);
-	static float RadiansToDegrees(float InRadians);
+	static constexpr float DegreesToRadians(float InDegrees);
+	static constexpr float RadiansToDegrees(float InRadians);
 
 	// Power functions.
 	static float Pow(float InBase, float InExponent);
 	static float Sqrt(float InValue);
 	static float InvSqrt(float InValue);
 
+	// Scalar version of VectorAtan2 in Math/Simd/VectorMath.h, with the same polynomial and error bound (see there).
+	// It is inline and doesn't call into the C runtime, which makes it about twice as fast as Atan2.
+	static float FastAtan2(float InY, float InX);
+
 	// Rounds up to the closest integer.
 	static float Ceil(float InValue);
 	// Rounds down to the closest integer.
@@ -45,23 +60,140 @@ struct FMath
 	// Rounds to the closest integer, with the halfway point (0.5) rounding away from zero.
 	static float Round(float InValue);
 	// Rounds an integer up to its closest power of 2, with values that are already a power of 2 staying the same.
-	static int32 RoundUpToNearestPowerOfTwo(int32 InValue);
+	static constexpr int32 RoundUpToNearestPowerOfTwo(int32 InValue);
 
 	// Minimum and maximum functions.
 	template<typename T>
-	static T Max(T InValue1, T InValue2)
+	static constexpr T Max(T InValue1, T InValue2)
 	{
 		return (InValue1 >= InValue2) ? InValue1 : InValue2;
 	}
 
 	template<typename T>
-	static T Min(T InValue1, T InValue2)
+	static constexpr T Min(T InValue1, T InValue2)
 	{
 		return (InValue1 <= InValue2) ? InValue1 : InValue2;
 	}
 
 	// Misc.
 	static float Abs(float InValue);
-	static float Clamp(float InValue, float InMin, float InMax);
-	static bool IsPowerOfTwo(int32 InValue);
+	static constexpr float Clamp(float InValue, float InMin, float InMax);
+	static constexpr bool IsPowerOfTwo(int32 InValue);
+
+	// Bit manipulation. The value must not be zero.
+	// Returns the index of the highest set bit, which is the base 2 logarithm rounded down.
+	static int32 FloorLog2(uint64 InValue);
+	// Returns the index of the lowest set bit.
+	static int32 CountTrailingZeros(uint64 InValue);
+	// Returns the number of set bits. Unlike the functions above, the value may be zero.
+	static int32 CountSetBits(uint64 InValue);
+	// Reinterpret the bits of a float as an integer and back.
+	static uint32 FloatToBits(float InValue);
+	static float BitsToFloat(uint32 InBits);
 };
+
+// Fast approximations.
+inline float FMath::FastAtan2(float InY, float InX)
+{
+	// Compute atan(Min / Max) in [0, Pi/4], then use the symmetries of atan2 to find the right octant.
+	const float AbsX = BitsToFloat(FloatToBits(InX) & 0x7FFFFFFFu);
+	const float AbsY = BitsToFloat(FloatToBits(InY) & 0x7FFFFFFFu);
+	const float MaxXY = Max(AbsX, AbsY);
+	if (MaxXY == 0.0f)
+	{
+		return 0.0f;
+	}
+	float Ratio = Min(AbsX, AbsY) / MaxXY;
+
+	// Above tan(Pi/8), use atan(A) = Pi/4 + atan((A - 1) / (A + 1)).
+	const bool bIsLarge = Ratio > 0.414213562373095f;
+	Ratio = bIsLarge ? (Ratio - 1.0f) / (Ratio + 1.0f) : Ratio;
+
+	const float Z = Ratio * Ratio;
+	const float Polynomial = -3.33329491539e-1f + Z * (1.99777106478e-1f + Z * (-1.38776856032e-1f + Z * 8.05374449538e-2f));
+	float Result = (Ratio + Polynomial * Z * Ratio) + (bIsLarge ? PiOverFour : 0.0f);
+
+	Result = AbsY > AbsX ? PiOverTwo - Result : Result;
+	Result = InX < 0.0f ? Pi - Result : Result;
+	return (FloatToBits(InY) & 0x80000000u) ? -Result : Result;
+}
+
+// Conversion functions between degrees and radians.
+constexpr float FMath::DegreesToRadians(float InDegrees)
+{
+	return InDegrees * (FMath::Pi / 180.0f);
+}
+
+constexpr float FMath::RadiansToDegrees(float InRadians)
+{
+	return InRadians * (180.0f / FMath::Pi);
+}
+
+constexpr int32 FMath::RoundUpToNearestPowerOfTwo(int32 InValue)
+{
+	--InValue;
+	InValue |= InValue >> 1;
+	InValue |= InValue >> 2;
+	InValue |= InValue >> 4;
+	InValue |= InValue >> 8;
+	InValue |= InValue >> 16;
+	++InValue;
+	return InValue;
+}
+
+// Misc.
+constexpr float FMath::Clamp(float InValue, float InMin, float InMax)
+{
+	return Min(InMax, Max(InValue, InMin));
+}
+
+constexpr bool FMath::IsPowerOfTwo(int32 InValue)
+{
+	return (InValue > 0) && ((InValue & (InValue - 1)) == 0);
+}
+
+// Bit manipulation.
+inline int32 FMath::FloorLog2(uint64 InValue)
+{
+#if defined(_MSC_VER)
+	unsigned long Index;
+	_BitScanReverse64(&Index, InValue);
+	return static_cast<int32>(Index);
+#else
+	return 63 - __builtin_clzll(InValue);
+#endif
+}
+
+inline int32 FMath::CountTrailingZeros(uint64 InValue)
+{
+#if defined(_MSC_VER)
+	unsigned long Index;
+	_BitScanForward64(&Index, InValue);
+	return static_cast<int32>(Index);
+#else
+	return __builtin_ctzll(InValue);
+#endif
+}
+
+inline int32 FMath::CountSetBits(uint64 InValue)
+{
+#if defined(_MSC_VER)
+	return static_cast<int32>(__popcnt64(InValue));
+#else
+	return __builtin_popcountll(InValue);
+#endif
+}
+
+inline uint32 FMath::FloatToBits(float InValue)
+{
+	uint32 Bits;
+	std::memcpy(&Bits, &InValue, sizeof(Bits));
+	return Bits;
+}
+
+inline float FMath::BitsToFloat(uint32 InBits)
+{
+	float Value;
+	std::memcpy(&Value, &InBits, sizeof(Value));
+	return Value;
+}
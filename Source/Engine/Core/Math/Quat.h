@@ -0,0 +1,7 @@
+#pragma once
+
+#ifdef MATH_USE_SSE
+	#error @TODOMath: Add implementation using SSE instrinsics. 
+#else
+	#include "Scalar/Quat.h"
+#endif
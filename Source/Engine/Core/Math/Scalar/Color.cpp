@@ -7,30 +7,7 @@
 #include "Vector3D.h"
 #include "Vector4D.h"
 
-// Definitions for class constants.
-const FColor FColor::Black(0.0f, 0.0f, 0.0f);
-const FColor FColor::White(1.0f, 1.0f, 1.0f);
-const FColor FColor::Red(1.0f, 0.0f, 0.0f);
-const FColor FColor::Green(0.0f, 1.0f, 0.0f);
-const FColor FColor::Blue(0.0f, 0.0f, 1.0f);
-
 // Constructors.
-FColor::FColor(float InR, float InG, float InB)
-	: R(FMath::Clamp(InR, 0.0f, 1.0f))
-	, G(FMath::Clamp(InG, 0.0f, 1.0f))
-	, B(FMath::Clamp(InB, 0.0f, 1.0f))
-	, A(1.0f)
-{
-}
-
-FColor::FColor(float InR, float InG, float InB, float InA)
-	: R(FMath::Clamp(InR, 0.0f, 1.0f))
-	, G(FMath::Clamp(InG, 0.0f, 1.0f))
-	, B(FMath::Clamp(InB, 0.0f, 1.0f))
-	, A(FMath::Clamp(InA, 0.0f, 1.0f))
-{
-}
-
 FColor::FColor(const FVector3D& InVector)
 	: R(FMath::Clamp(InVector.X, 0.0f, 1.0f))
 	, G(FMath::Clamp(InVector.Y, 0.0f, 1.0f))
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreGlobals.h"
+#include "Math/MathUtilities.h"
 
 // Forward declarations needed for FColor constructors.
 class FVector3D;
@@ -22,8 +23,8 @@ public:
 	// Constructors
 	FColor() = default;
 	// Construct using input R, B, and B values, with A set to 1.0f.
-	FColor(float InR, float InG, float InB);
-	FColor(float InR, float InG, float InB, float InA);
+	constexpr FColor(float InR, float InG, float InB);
+	constexpr FColor(float InR, float InG, float InB, float InA);
 	// Construct using the X, Y, and Z members of an FVector3D.
 	FColor(const FVector3D& InVector);
 	// Construct using the X, Y, Z, and W members of an FVector4D.
@@ -46,3 +47,27 @@ public:
 	float B = 0.0f;
 	float A = 0.0f;
 };
+
+// Constructors.
+constexpr FColor::FColor(float InR, float InG, float InB)
+	: R(FMath::Clamp(InR, 0.0f, 1.0f))
+	, G(FMath::Clamp(InG, 0.0f, 1.0f))
+	, B(FMath::Clamp(InB, 0.0f, 1.0f))
+	, A(1.0f)
+{
+}
+
+constexpr FColor::FColor(float InR, float InG, float InB, float InA)
+	: R(FMath::Clamp(InR, 0.0f, 1.0f))
+	, G(FMath::Clamp(InG, 0.0f, 1.0f))
+	, B(FMath::Clamp(InB, 0.0f, 1.0f))
+	, A(FMath::Clamp(InA, 0.0f, 1.0f))
+{
+}
+
+// Definitions for class constants.
+inline constexpr FColor FColor::Black(0.0f, 0.0f, 0.0f);
+inline constexpr FColor FColor::White(1.0f, 1.0f, 1.0f);
+inline constexpr FColor FColor::Red(1.0f, 0.0f, 0.0f);
+inline constexpr FColor FColor::Green(0.0f, 1.0f, 0.0f);
+inline constexpr FColor FColor::Blue(0.0f, 0.0f, 1.0f);
@@ -1,32 +1,9 @@
 #include "Matrix4D.h"
+#include "Vector3D.h"
 #include "Vector4D.h"
 #include "Math/MathUtilities.h"
 #include "AssertionMacros.h"
 
-// Definitions for class constants.
-const FMatrix4D FMatrix4D::Zero(0.0f, 0.0f, 0.0f, 0.0f,
-								0.0f, 0.0f, 0.0f, 0.0f,
-								0.0f, 0.0f, 0.0f, 0.0f,
-								0.0f, 0.0f, 0.0f, 0.0f);
-const FMatrix4D FMatrix4D::Identity(1.0f, 0.0f, 0.0f, 0.0f,
-									0.0f, 1.0f, 0.0f, 0.0f,
-									0.0f, 0.0f, 1.0f, 0.0f,
-									0.0f, 0.0f, 0.0f, 1.0f);
-
-// Constructors.
-FMatrix4D::FMatrix4D(
-	float InValue00, float InValue01, float InValue02, float InValue03,
-	float InValue10, float InValue11, float InValue12, float InValue13,
-	float InValue20, float InValue21, float InValue22, float InValue23,
-	float InValue30, float InValue31, float InValue32, float InValue33
-)
-{
-	Data[0] = InValue00; Data[4] = InValue01; Data[8] = InValue02; Data[12] =  InValue03;
-	Data[1] = InValue10; Data[5] = InValue11; Data[9] = InValue12; Data[13] =  InValue13;
-	Data[2] = InValue20; Data[6] = InValue21; Data[10] = InValue22; Data[14] = InValue23;
-	Data[3] = InValue30; Data[7] = InValue31; Data[11] = InValue32; Data[15] = InValue33;
-}
-
 // Accessors.
 FVector4D& FMatrix4D::operator[](int32 InColumn)
 {
@@ -40,24 +17,42 @@ const FVector4D& FMatrix4D::operator[](int32 InColumn) const
 	return (*reinterpret_cast<const FVector4D*>(&Data[InColumn * 4]));
 }
 
-const float* FMatrix4D::GetData() const
+// Transpose and inverse.
+// Implementation of inverse taken from "Foundations of Game Engine Development, Volume 1: Mathematics" (page 50).
+FMatrix4D FMatrix4D::GetInverted() const
 {
-	return Data;
-}
+	const FVector3D A(Data[0], Data[1], Data[2]);
+	const FVector3D B(Data[4], Data[5], Data[6]);
+	const FVector3D C(Data[8], Data[9], Data[10]);
+	const FVector3D D(Data[12], Data[13], Data[14]);
 
-float* FMatrix4D::GetData()
-{
-	return Data;
-}
+	// Bottom row of the matrix.
+	const float X = Data[3];
+	const float Y = Data[7];
+	const float Z = Data[11];
+	const float W = Data[15];
 
-// Arithmetic operations.
-FVector4D FMatrix4D::operator*(const FVector4D& InVector) const
-{
-	return FVector4D(
-		Data[0] * InVector.X + Data[4] * InVector.Y + Data[8] * InVector.Z + Data[12] * InVector.W,
-		Data[1] * InVector.X + Data[5] * InVector.Y + Data[9] * InVector.Z + Data[13] * InVector.W,
-		Data[2] * InVector.X + Data[6] * InVector.Y + Data[10] * InVector.Z + Data[14] * InVector.W,
-		Data[3] * InVector.X + Data[7] * InVector.Y + Data[11] * InVector.Z + Data[15] * InVector.W
+	FVector3D S = FVector3D::CrossProduct(A, B);
+	FVector3D T = FVector3D::CrossProduct(C, D);
+	FVector3D U = A * Y - B * X;
+	FVector3D V = C * W - D * Z;
+
+	float InverseDeterminant = 1.0f / (FVector3D::DotProduct(S, V) + FVector3D::DotProduct(T, U));
+	S *= InverseDeterminant;
+	T *= InverseDeterminant;
+	U *= InverseDeterminant;
+	V *= InverseDeterminant;
+
+	FVector3D R0 = FVector3D::CrossProduct(B, V) + T * Y;
+	FVector3D R1 = FVector3D::CrossProduct(V, A) - T * X;
+	FVector3D R2 = FVector3D::CrossProduct(D, U) + S * W;
+	FVector3D R3 = FVector3D::CrossProduct(U, C) - S * Z;
+
+	return FMatrix4D(
+		R0.X, R0.Y, R0.Z, -FVector3D::DotProduct(B, T),
+		R1.X, R1.Y, R1.Z, FVector3D::DotProduct(A, T),
+		R2.X, R2.Y, R2.Z, -FVector3D::DotProduct(D, S),
+		R3.X, R3.Y, R3.Z, FVector3D::DotProduct(C, S)
 	);
 }
 
@@ -1,8 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-
-class FVector4D;
+#include "Vector4D.h"
 
 /**
  * A 4x4 column-major matrix of floating point values.
@@ -17,10 +16,10 @@ public:
 
 	// Constructors
 	FMatrix4D() = default;
-	FMatrix4D(float InValue00, float InValue01, float InValue02, float InValue03,
-			  float InValue10, float InValue11, float InValue12, float InValue13,
-			  float InValue20, float InValue21, float InValue22, float InValue23,
-			  float InValue30, float InValue31, float InValue32, float InValue33);
+	constexpr FMatrix4D(float InValue00, float InValue01, float InValue02, float InValue03,
+						float InValue10, float InValue11, float InValue12, float InValue13,
+						float InValue20, float InValue21, float InValue22, float InValue23,
+						float InValue30, float InValue31, float InValue32, float InValue33);
 
 	// Copy operations
 	FMatrix4D(const FMatrix4D&) = default;
@@ -29,11 +28,16 @@ public:
 	// Accessors
 	FVector4D& operator[](int32 InColumn);
 	const FVector4D& operator[](int32 InColumn) const;
-	float* GetData();
-	const float* GetData() const;
+	constexpr float* GetData();
+	constexpr const float* GetData() const;
 
 	// Arithmetic operations.
-	FVector4D operator*(const FVector4D& InVector) const;
+	constexpr FMatrix4D operator*(const FMatrix4D& InMatrix) const;
+	constexpr FVector4D operator*(const FVector4D& InVector) const;
+
+	// Transpose and inverse.
+	constexpr FMatrix4D GetTransposed() const;
+	FMatrix4D GetInverted() const;
 
 	// Equality operators.
 	bool operator==(const FMatrix4D& InMatrix) const;
@@ -42,3 +46,88 @@ public:
 private:
 	float Data[4 * 4] = {0};
 };
+
+// Constructors.
+constexpr FMatrix4D::FMatrix4D(
+	float InValue00, float InValue01, float InValue02, float InValue03,
+	float InValue10, float InValue11, float InValue12, float InValue13,
+	float InValue20, float InValue21, float InValue22, float InValue23,
+	float InValue30, float InValue31, float InValue32, float InValue33
+)
+{
+	Data[0] = InValue00; Data[4] = InValue01; Data[8] = InValue02; Data[12] =  InValue03;
+	Data[1] = InValue10; Data[5] = InValue11; Data[9] = InValue12; Data[13] =  InValue13;
+	Data[2] = InValue20; Data[6] = InValue21; Data[10] = InValue22; Data[14] = InValue23;
+	Data[3] = InValue30; Data[7] = InValue31; Data[11] = InValue32; Data[15] = InValue33;
+}
+
+// Accessors.
+constexpr const float* FMatrix4D::GetData() const
+{
+	return Data;
+}
+
+constexpr float* FMatrix4D::GetData()
+{
+	return Data;
+}
+
+// Arithmetic operations.
+constexpr FMatrix4D FMatrix4D::operator*(const FMatrix4D& InMatrix) const
+{
+	const float* A = Data;
+	const float* B = InMatrix.GetData();
+	return FMatrix4D(
+		A[0]*B[0]  + A[4]*B[1]  + A[8]*B[2]   + A[12]*B[3],
+		A[0]*B[4]  + A[4]*B[5]  + A[8]*B[6]   + A[12]*B[7],
+		A[0]*B[8]  + A[4]*B[9]  + A[8]*B[10]  + A[12]*B[11],
+		A[0]*B[12] + A[4]*B[13] + A[8]*B[14]  + A[12]*B[15],
+		A[1]*B[0]  + A[5]*B[1]  + A[9]*B[2]   + A[13]*B[3],
+		A[1]*B[4]  + A[5]*B[5]  + A[9]*B[6]   + A[13]*B[7],
+		A[1]*B[8]  + A[5]*B[9]  + A[9]*B[10]  + A[13]*B[11],
+		A[1]*B[12] + A[5]*B[13] + A[9]*B[14]  + A[13]*B[15],
+		A[2]*B[0]  + A[6]*B[1]  + A[10]*B[2]  + A[14]*B[3],
+		A[2]*B[4]  + A[6]*B[5]  + A[10]*B[6]  + A[14]*B[7],
+		A[2]*B[8]  + A[6]*B[9]  + A[10]*B[10] + A[14]*B[11],
+		A[2]*B[12] + A[6]*B[13] + A[10]*B[14] + A[14]*B[15],
+		A[3]*B[0]  + A[7]*B[1]  + A[11]*B[2]  + A[15]*B[3],
+		A[3]*B[4]  + A[7]*B[5]  + A[11]*B[6]  + A[15]*B[7],
+		A[3]*B[8]  + A[7]*B[9]  + A[11]*B[10] + A[15]*B[11],
+		A[3]*B[12] + A[7]*B[13] + A[11]*B[14] + A[15]*B[15]
+	);
+}
+
+constexpr FVector4D FMatrix4D::operator*(const FVector4D& InVector) const
+{
+	return FVector4D(
+		Data[0] * InVector.X + Data[4] * InVector.Y + Data[8] * InVector.Z + Data[12] * InVector.W,
+		Data[1] * InVector.X + Data[5] * InVector.Y + Data[9] * InVector.Z + Data[13] * InVector.W,
+		Data[2] * InVector.X + Data[6] * InVector.Y + Data[10] * InVector.Z + Data[14] * InVector.W,
+		Data[3] * InVector.X + Data[7] * InVector.Y + Data[11] * InVector.Z + Data[15] * InVector.W
+	);
+}
+
+// Transpose and inverse.
+constexpr FMatrix4D FMatrix4D::GetTransposed() const
+{
+	return FMatrix4D(
+		Data[0], Data[1], Data[2], Data[3],
+		Data[4], Data[5], Data[6], Data[7],
+		Data[8], Data[9], Data[10], Data[11],
+		Data[12], Data[13], Data[14], Data[15]
+	);
+}
+
+// Definitions for class constants.
+inline constexpr FMatrix4D FMatrix4D::Zero(
+	0.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 0.0f
+);
+inline constexpr FMatrix4D FMatrix4D::Identity(
+	1.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 1.0f
+);
@@ -0,0 +1,207 @@
+#include "Quat.h"
+#include "Vector3D.h"
+#include "Transform4D.h"
+#include "Math/MathUtilities.h"
+
+// Rotation generation functions.
+/*static*/ FQuat FQuat::MakeFromAxisAngle(const FVector3D& InAxis, float InRadians)
+{
+	float HalfAngle = InRadians * 0.5f;
+	float Sin = FMath::Sin(HalfAngle);
+	return FQuat(InAxis.X * Sin, InAxis.Y * Sin, InAxis.Z * Sin, FMath::Cos(HalfAngle));
+}
+
+// Expanded form of MakeFromAxisAngle(Z) * MakeFromAxisAngle(Y) * MakeFromAxisAngle(X).
+/*static*/ FQuat FQuat::MakeFromEuler(const FVector3D& InRadians)
+{
+	float SX = FMath::Sin(InRadians.X * 0.5f);
+	float CX = FMath::Cos(InRadians.X * 0.5f);
+	float SY = FMath::Sin(InRadians.Y * 0.5f);
+	float CY = FMath::Cos(InRadians.Y * 0.5f);
+	float SZ = FMath::Sin(InRadians.Z * 0.5f);
+	float CZ = FMath::Cos(InRadians.Z * 0.5f);
+
+	return FQuat(
+		CZ * CY * SX - SZ * SY * CX,
+		CZ * SY * CX + SZ * CY * SX,
+		SZ * CY * CX - CZ * SY * SX,
+		CZ * CY * CX + SZ * SY * SX
+	);
+}
+
+/**
+ * Conversion from a rotation matrix, picking the largest of W, X, Y, Z to divide by for numerical stability.
+ * See Foundations of Game Engine Development, Volume 1: Mathematics (page 92).
+ */
+/*static*/ FQuat FQuat::MakeFromTransform(const FTransform4D& InTransform)
+{
+	FVector3D Column0 = FVector3D::Normalize(InTransform[0]);
+	FVector3D Column1 = FVector3D::Normalize(InTransform[1]);
+	FVector3D Column2 = FVector3D::Normalize(InTransform[2]);
+
+	// Row-major names for the elements of the rotation matrix (M21 is row 2, column 1).
+	float M00 = Column0.X, M01 = Column1.X, M02 = Column2.X;
+	float M10 = Column0.Y, M11 = Column1.Y, M12 = Column2.Y;
+	float M20 = Column0.Z, M21 = Column1.Z, M22 = Column2.Z;
+
+	float Trace = M00 + M11 + M22;
+	FQuat Result;
+	if (Trace > 0.0f)
+	{
+		float W = FMath::Sqrt(Trace + 1.0f) * 0.5f;
+		float F = 0.25f / W;
+		Result = FQuat((M21 - M12) * F, (M02 - M20) * F, (M10 - M01) * F, W);
+	}
+	else if (M00 > M11 && M00 > M22)
+	{
+		float X = FMath::Sqrt(M00 - M11 - M22 + 1.0f) * 0.5f;
+		float F = 0.25f / X;
+		Result = FQuat(X, (M10 + M01) * F, (M02 + M20) * F, (M21 - M12) * F);
+	}
+	else if (M11 > M22)
+	{
+		float Y = FMath::Sqrt(M11 - M00 - M22 + 1.0f) * 0.5f;
+		float F = 0.25f / Y;
+		Result = FQuat((M10 + M01) * F, Y, (M21 + M12) * F, (M02 - M20) * F);
+	}
+	else
+	{
+		float Z = FMath::Sqrt(M22 - M00 - M11 + 1.0f) * 0.5f;
+		float F = 0.25f / Z;
+		Result = FQuat((M02 + M20) * F, (M21 + M12) * F, Z, (M10 - M01) * F);
+	}
+	return Result.Normalize();
+}
+
+// Conversion functions.
+FVector3D FQuat::ToEuler() const
+{
+	// Elements of the equivalent rotation matrix RZ * RY * RX, whose row 2, column 0 is -sin(Y).
+	float M00 = 1.0f - 2.0f * (Y * Y + Z * Z);
+	float M10 = 2.0f * (X * Y + W * Z);
+	float M20 = 2.0f * (X * Z - W * Y);
+	float M21 = 2.0f * (Y * Z + W * X);
+	float M22 = 1.0f - 2.0f * (X * X + Y * Y);
+
+	float SinY = FMath::Clamp(-M20, -1.0f, 1.0f);
+	if (FMath::Abs(SinY) > 0.9999f)
+	{
+		// Gimbal lock: X and Z rotate about the same axis, so put all of the rotation into X.
+		float M11 = 1.0f - 2.0f * (X * X + Z * Z);
+		float M12 = 2.0f * (Y * Z - W * X);
+		return FVector3D(FMath::Atan2(-M12, M11), FMath::Asin(SinY), 0.0f);
+	}
+
+	return FVector3D(FMath::Atan2(M21, M22), FMath::Asin(SinY), FMath::Atan2(M10, M00));
+}
+
+FTransform4D FQuat::ToTransform() const
+{
+	float XX = X * X, YY = Y * Y, ZZ = Z * Z;
+	float XY = X * Y, XZ = X * Z, YZ = Y * Z;
+	float WX = W * X, WY = W * Y, WZ = W * Z;
+
+	return FTransform4D(
+		1.0f - 2.0f * (YY + ZZ), 2.0f * (XY - WZ), 2.0f * (XZ + WY), 0.0f,
+		2.0f * (XY + WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ - WX), 0.0f,
+		2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + YY), 0.0f
+	);
+}
+
+// Quaternion math.
+float FQuat::GetLength() const
+{
+	return FMath::Sqrt(GetLengthSquared());
+}
+
+FQuat& FQuat::Normalize()
+{
+	float LengthSquared = GetLengthSquared();
+	if (FMath::IsApproximatelyZero(LengthSquared))
+	{
+		// A zero quaternion doesn't represent a rotation, so fall back to the identity.
+		*this = Identity;
+		return *this;
+	}
+
+	float OneOverLength = FMath::InvSqrt(LengthSquared);
+	X *= OneOverLength;
+	Y *= OneOverLength;
+	Z *= OneOverLength;
+	W *= OneOverLength;
+	return *this;
+}
+
+/*static*/ FQuat FQuat::Normalize(const FQuat& InQuat)
+{
+	FQuat Quat = InQuat;
+	return Quat.Normalize();
+}
+
+// Rotations of vectors.
+// Computes Q * V * Q^-1 without the intermediate quaternion products: V + W * T + Q.xyz x T, where T = 2 * (Q.xyz x V).
+FVector3D FQuat::RotateVector(const FVector3D& InVector) const
+{
+	FVector3D Axis(X, Y, Z);
+	FVector3D T = FVector3D::CrossProduct(Axis, InVector) * 2.0f;
+	return InVector + T * W + FVector3D::CrossProduct(Axis, T);
+}
+
+FVector3D FQuat::UnrotateVector(const FVector3D& InVector) const
+{
+	return GetConjugate().RotateVector(InVector);
+}
+
+/*static*/ FQuat FQuat::Slerp(const FQuat& InQuat1, const FQuat& InQuat2, float InAlpha)
+{
+	// Negate one side when needed so that the interpolation takes the shorter of the two arcs.
+	float CosAngle = DotProduct(InQuat1, InQuat2);
+	float Sign = (CosAngle < 0.0f) ? -1.0f : 1.0f;
+	CosAngle *= Sign;
+
+	// Nearly parallel quaternions would divide by almost zero below, and are close enough to interpolate linearly.
+	if (CosAngle > 0.9995f)
+	{
+		return Nlerp(InQuat1, InQuat2, InAlpha);
+	}
+
+	float Angle = FMath::Acos(CosAngle);
+	float OneOverSinAngle = 1.0f / FMath::Sin(Angle);
+	float Weight1 = FMath::Sin((1.0f - InAlpha) * Angle) * OneOverSinAngle;
+	float Weight2 = FMath::Sin(InAlpha * Angle) * OneOverSinAngle * Sign;
+
+	return FQuat(
+		InQuat1.X * Weight1 + InQuat2.X * Weight2,
+		InQuat1.Y * Weight1 + InQuat2.Y * Weight2,
+		InQuat1.Z * Weight1 + InQuat2.Z * Weight2,
+		InQuat1.W * Weight1 + InQuat2.W * Weight2
+	);
+}
+
+/*static*/ FQuat FQuat::Nlerp(const FQuat& InQuat1, const FQuat& InQuat2, float InAlpha)
+{
+	float Weight1 = 1.0f - InAlpha;
+	float Weight2 = (DotProduct(InQuat1, InQuat2) < 0.0f) ? -InAlpha : InAlpha;
+
+	FQuat Result(
+		InQuat1.X * Weight1 + InQuat2.X * Weight2,
+		InQuat1.Y * Weight1 + InQuat2.Y * Weight2,
+		InQuat1.Z * Weight1 + InQuat2.Z * Weight2,
+		InQuat1.W * Weight1 + InQuat2.W * Weight2
+	);
+	return Result.Normalize();
+}
+
+// Equality operators.
+bool FQuat::operator==(const FQuat& InQuat) const
+{
+	return FMath::IsApproximatelyEqual(X, InQuat.X)
+		&& FMath::IsApproximatelyEqual(Y, InQuat.Y)
+		&& FMath::IsApproximatelyEqual(Z, InQuat.Z)
+		&& FMath::IsApproximatelyEqual(W, InQuat.W);
+}
+
+bool FQuat::operator!=(const FQuat& InQuat) const
+{
+	return !(*this == InQuat);
+}
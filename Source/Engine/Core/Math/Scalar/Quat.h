@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+class FVector3D;
+class FTransform4D;
+
+/**
+ * Quaternion representing a rotation in 3D space, stored as X, Y, Z (vector part) and W (scalar part).
+ * The four components are contiguous and 16-byte aligned, so a quaternion can be loaded directly into an
+ * FVectorRegister4. Functions that produce rotations return unit quaternions, and functions that consume
+ * them assume unit quaternions unless stated otherwise.
+ */
+class alignas(16) FQuat
+{
+public:
+	// Identity rotation (0, 0, 0, 1).
+	static const FQuat Identity;
+
+	// Constructors.
+	FQuat() = default;
+	constexpr FQuat(float InX, float InY, float InZ, float InW);
+
+	// Copy operations.
+	FQuat(const FQuat& InQuat) = default;
+	FQuat& operator=(const FQuat& InQuat) = default;
+
+	// Rotation generation functions.
+	// InAxis is assumed to be a unit-vector.
+	static FQuat MakeFromAxisAngle(const FVector3D& InAxis, float InRadians);
+	// Euler angles in radians, applied in the same order as FModel: X first, then Y, then Z.
+	static FQuat MakeFromEuler(const FVector3D& InRadians);
+	// Extracts the rotation of a transform. Scale is removed, but the transform must not contain shear.
+	static FQuat MakeFromTransform(const FTransform4D& InTransform);
+
+	// Conversion functions.
+	FVector3D ToEuler() const;
+	FTransform4D ToTransform() const;
+
+	// Quaternion math.
+	float GetLength() const;
+	constexpr float GetLengthSquared() const;
+	FQuat& Normalize();
+	// The conjugate is the inverse rotation of a unit quaternion.
+	constexpr FQuat GetConjugate() const;
+	// Inverse of an arbitrary (not necessarily unit) quaternion.
+	constexpr FQuat GetInverse() const;
+
+	static FQuat Normalize(const FQuat& InQuat);
+	static constexpr float DotProduct(const FQuat& InQuat1, const FQuat& InQuat2);
+
+	// Rotations of vectors.
+	FVector3D RotateVector(const FVector3D& InVector) const;
+	FVector3D UnrotateVector(const FVector3D& InVector) const;
+
+	// Interpolation along the shortest arc. Slerp moves at constant angular velocity; Nlerp is cheaper but doesn't.
+	static FQuat Slerp(const FQuat& InQuat1, const FQuat& InQuat2, float InAlpha);
+	static FQuat Nlerp(const FQuat& InQuat1, const FQuat& InQuat2, float InAlpha);
+
+	// Composition: (A * B) applies B first, then A, as with FTransform4D.
+	constexpr FQuat& operator*=(const FQuat& InQuat);
+	constexpr FQuat operator*(const FQuat& InQuat) const;
+
+	// Equality operators. Q and -Q represent the same rotation but don't compare equal.
+	bool operator==(const FQuat& InQuat) const;
+	bool operator!=(const FQuat& InQuat) const;
+
+	float X = 0.0f;
+	float Y = 0.0f;
+	float Z = 0.0f;
+	float W = 1.0f;
+};
+
+// Constructors.
+constexpr FQuat::FQuat(float InX, float InY, float InZ, float InW)
+	: X(InX)
+	, Y(InY)
+	, Z(InZ)
+	, W(InW)
+{
+}
+
+// Quaternion math.
+constexpr float FQuat::GetLengthSquared() const
+{
+	return X*X + Y*Y + Z*Z + W*W;
+}
+
+constexpr FQuat FQuat::GetConjugate() const
+{
+	return FQuat(-X, -Y, -Z, W);
+}
+
+constexpr FQuat FQuat::GetInverse() const
+{
+	float OneOverLengthSquared = 1.0f / GetLengthSquared();
+	return FQuat(-X * OneOverLengthSquared, -Y * OneOverLengthSquared, -Z * OneOverLengthSquared, W * OneOverLengthSquared);
+}
+
+/*static*/ constexpr float FQuat::DotProduct(const FQuat& InQuat1, const FQuat& InQuat2)
+{
+	return InQuat1.X * InQuat2.X + InQuat1.Y * InQuat2.Y + InQuat1.Z * InQuat2.Z + InQuat1.W * InQuat2.W;
+}
+
+// Composition.
+constexpr FQuat& FQuat::operator*=(const FQuat& InQuat)
+{
+	*this = *this * InQuat;
+	return *this;
+}
+
+constexpr FQuat FQuat::operator*(const FQuat& InQuat) const
+{
+	return FQuat(
+		W * InQuat.X + X * InQuat.W + Y * InQuat.Z - Z * InQuat.Y,
+		W * InQuat.Y - X * InQuat.Z + Y * InQuat.W + Z * InQuat.X,
+		W * InQuat.Z + X * InQuat.Y - Y * InQuat.X + Z * InQuat.W,
+		W * InQuat.W - X * InQuat.X - Y * InQuat.Y - Z * InQuat.Z
+	);
+}
+
+// Definitions for class constants.
+inline constexpr FQuat FQuat::Identity(0.0f, 0.0f, 0.0f, 1.0f);
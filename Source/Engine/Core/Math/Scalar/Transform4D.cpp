@@ -5,37 +5,6 @@
 #include "Math/MathUtilities.h"
 #include "AssertionMacros.h"
 
-// Definitions for class constants.
-const FTransform4D FTransform4D::Identity(1.0f, 0.0f, 0.0f, 0.0f,
-										  0.0f, 1.0f, 0.0f, 0.0f,
-										  0.0f, 0.0f, 1.0f, 0.0f);
-
-// Constructors.
-FTransform4D::FTransform4D()
-{
-	Data[0] = 1.0f; Data[3] = 0.0f; Data[6] = 0.0f; Data[9] = 0.0f;
-	Data[1] = 0.0f; Data[4] = 1.0f; Data[7] = 0.0f; Data[10] = 0.0f;
-	Data[2] = 0.0f; Data[5] = 0.0f; Data[8] = 1.0f; Data[11] = 0.0f;
-}
-
-FTransform4D::FTransform4D(
-	float InValue00, float InValue01, float InValue02, float InValue03,
-	float InValue10, float InValue11, float InValue12, float InValue13,
-	float InValue20, float InValue21, float InValue22, float InValue23
-)
-{
-	Data[0] = InValue00; Data[3] = InValue01; Data[6] = InValue02; Data[9] = InValue03;
-	Data[1] = InValue10; Data[4] = InValue11; Data[7] = InValue12; Data[10] = InValue13;
-	Data[2] = InValue20; Data[5] = InValue21; Data[8] = InValue22; Data[11] = InValue23;
-}
-
-FTransform4D::FTransform4D(const FVector3D& InColumn0, const FVector3D& InColumn1, const FVector3D& InColumn2, const FVector3D& InColumn3)
-{
-	Data[0] = InColumn0.X; Data[3] = InColumn1.X; Data[6] = InColumn2.X; Data[9] = InColumn3.X;
-	Data[1] = InColumn0.Y; Data[4] = InColumn1.Y; Data[7] = InColumn2.Y; Data[10] = InColumn3.Y;
-	Data[2] = InColumn0.Z; Data[5] = InColumn1.Z; Data[8] = InColumn2.Z; Data[11] = InColumn3.Z;
-}
-
 // Accessors.
 FVector3D& FTransform4D::operator[](int32 InColumn)
 {
@@ -49,16 +18,6 @@ const FVector3D& FTransform4D::operator[](int32 InColumn) const
 	return (*reinterpret_cast<const FVector3D*>(&Data[InColumn * 3]));
 }
 
-float* FTransform4D::GetData()
-{
-	return Data;
-}
-
-const float* FTransform4D::GetData() const
-{
-	return Data;
-}
-
 const FVector3D& FTransform4D::GetTranslation() const
 {
 	return (*reinterpret_cast<const FVector3D*>(&Data[9]));
@@ -70,24 +29,6 @@ void FTransform4D::SetTranslation(const FVector3D& InTranslation)
 }
 
 // Transform matrix generation functions.
-/*static*/ FTransform4D FTransform4D::MakeScale(float InScale)
-{
-	return FTransform4D(
-		InScale, 0.0f, 0.0f, 0.0f,
-		0.0f, InScale, 0.0f, 0.0f,
-		0.0f, 0.0f, InScale, 0.0f
-	);
-}
-
-/*static*/ FTransform4D FTransform4D::MakeScale(const FVector3D& InScale)
-{
-	return FTransform4D(
-		InScale.X, 0.0f, 0.0f, 0.0f,
-		0.0f, InScale.Y, 0.0f, 0.0f,
-		0.0f, 0.0f, InScale.Z, 0.0f
-	);
-}
-
 /*static*/ FTransform4D FTransform4D::MakeRotationX(float InRadians)
 {
 	float Cos = FMath::Cos(InRadians);
@@ -145,62 +86,7 @@ void FTransform4D::SetTranslation(const FVector3D& InTranslation)
 	);
 }
 
-/*static*/ FTransform4D FTransform4D::MakeTranslation(const FVector3D& InTranslation)
-{
-	return FTransform4D(
-		1.0f, 0.0f, 0.0f, InTranslation.X,
-		0.0f, 1.0f, 0.0f, InTranslation.Y,
-		0.0f, 0.0f, 1.0f, InTranslation.Z
-	);
-}
-
 // Arithmetic operations with transforms/vectors.
-FTransform4D& FTransform4D::operator*=(const FTransform4D& InTransform)
-{
-	FTransform4D Result = *this * InTransform;
-	*this = Result;
-	return *this;
-}
-
-FTransform4D FTransform4D::operator*(const FTransform4D& InTransform) const
-{
-	const float* A = Data;
-	const float* B = InTransform.GetData();
-	return FTransform4D(
-		A[0]*B[0] + A[3]*B[1]  + A[6]*B[2],
-		A[0]*B[3] + A[3]*B[4]  + A[6]*B[5],
-		A[0]*B[6] + A[3]*B[7]  + A[6]*B[8],
-		A[0]*B[9] + A[3]*B[10] + A[6]*B[11] + A[9],
-		A[1]*B[0] + A[4]*B[1]  + A[7]*B[2],
-		A[1]*B[3] + A[4]*B[4]  + A[7]*B[5],
-		A[1]*B[6] + A[4]*B[7]  + A[7]*B[8],
-		A[1]*B[9] + A[4]*B[10] + A[7]*B[11] + A[10],
-		A[2]*B[0] + A[5]*B[1]  + A[8]*B[2],
-		A[2]*B[3] + A[5]*B[4]  + A[8]*B[5],
-		A[2]*B[6] + A[5]*B[7]  + A[8]*B[8],
-		A[2]*B[9] + A[5]*B[10] + A[8]*B[11] + A[11]
-	);
-}
-
-FVector4D FTransform4D::operator*(const FVector4D& InVector) const
-{
-	return FVector4D(
-		Data[0]*InVector.X + Data[3]*InVector.Y + Data[6]*InVector.Z + Data[9]*InVector.W,
-		Data[1]*InVector.X + Data[4]*InVector.Y + Data[7]*InVector.Z + Data[10]*InVector.W,
-		Data[2]*InVector.X + Data[5]*InVector.Y + Data[8]*InVector.Z + Data[11]*InVector.W,
-		InVector.W
-	);
-}
-
-FVector3D FTransform4D::operator*(const FVector3D& InVector) const
-{
-	return FVector3D(
-		Data[0]*InVector.X + Data[3]*InVector.Y + Data[6]*InVector.Z,
-		Data[1]*InVector.X + Data[4]*InVector.Y + Data[7]*InVector.Z,
-		Data[2]*InVector.X + Data[5]*InVector.Y + Data[8]*InVector.Z
-	);
-}
-
 FMatrix4D FTransform4D::operator*(const FMatrix4D& InMatrix) const
 {
 	const float* A = Data;
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "CoreGlobals.h"
+#include "Vector3D.h"
+#include "Vector4D.h"
 
-class FVector3D;
-class FVector4D;
 class FMatrix4D;
 
 /**
@@ -17,11 +17,11 @@ public:
 	static const FTransform4D Identity;
 
 	// Default constructor produces the identity matrix.
-	FTransform4D();
-	FTransform4D(float InValue00, float InValue01, float InValue02, float InValue03,
-				 float InValue10, float InValue11, float InValue12, float InValue13,
-				 float InValue20, float InValue21, float InValue22, float InValue23);
-	FTransform4D(const FVector3D& InColumn0, const FVector3D& InColumn1, const FVector3D& InColumn2, const FVector3D& InColumn3);
+	constexpr FTransform4D();
+	constexpr FTransform4D(float InValue00, float InValue01, float InValue02, float InValue03,
+						   float InValue10, float InValue11, float InValue12, float InValue13,
+						   float InValue20, float InValue21, float InValue22, float InValue23);
+	constexpr FTransform4D(const FVector3D& InColumn0, const FVector3D& InColumn1, const FVector3D& InColumn2, const FVector3D& InColumn3);
 
 	// Copy operations.
 	FTransform4D(const FTransform4D& InTransform) = default;
@@ -30,26 +30,26 @@ public:
 	// Accessors.
 	FVector3D& operator[](int32 InColumn);
 	const FVector3D& operator[](int32 InColumn) const;
-	float* GetData();
-	const float* GetData() const;
+	constexpr float* GetData();
+	constexpr const float* GetData() const;
 	const FVector3D& GetTranslation() const;
 	void SetTranslation(const FVector3D& InTranslation);
 
 	// Transform matrix generation functions.
-	static FTransform4D MakeScale(float InScale);
-	static FTransform4D MakeScale(const FVector3D& InScale);
+	static constexpr FTransform4D MakeScale(float InScale);
+	static constexpr FTransform4D MakeScale(const FVector3D& InScale);
 	static FTransform4D MakeRotationX(float InRadians);
 	static FTransform4D MakeRotationY(float InRadians);
 	static FTransform4D MakeRotationZ(float InRadians);
 	// InAxis is assumed to be a unit-vector.
 	static FTransform4D MakeRotation(float InRadians, const FVector3D& InAxis);
-	static FTransform4D MakeTranslation(const FVector3D& InTranslation);
+	static constexpr FTransform4D MakeTranslation(const FVector3D& InTranslation);
 
 	// Arithmetic operations with transforms/vectors.
-	FTransform4D& operator*=(const FTransform4D& InTransform);
-	FTransform4D operator*(const FTransform4D& InTransform) const;
-	FVector4D operator*(const FVector4D& InVector) const;
-	FVector3D operator*(const FVector3D& InVector) const;
+	constexpr FTransform4D& operator*=(const FTransform4D& InTransform);
+	constexpr FTransform4D operator*(const FTransform4D& InTransform) const;
+	constexpr FVector4D operator*(const FVector4D& InVector) const;
+	constexpr FVector3D operator*(const FVector3D& InVector) const;
 	FMatrix4D operator*(const FMatrix4D& InMatrix) const;
 	friend FMatrix4D operator*(const FMatrix4D& InMatrix, const FTransform4D& InTransform);
 
@@ -72,3 +72,131 @@ private:
 	 */
 	float Data[3 * 4];
 };
+
+// Constructors.
+constexpr FTransform4D::FTransform4D()
+	: FTransform4D(
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f
+	)
+{
+}
+
+constexpr FTransform4D::FTransform4D(
+	float InValue00, float InValue01, float InValue02, float InValue03,
+	float InValue10, float InValue11, float InValue12, float InValue13,
+	float InValue20, float InValue21, float InValue22, float InValue23
+)
+	// Data has no default initializer, so a constexpr constructor has to initialize it here. One column per line.
+	: Data{
+		InValue00, InValue10, InValue20,
+		InValue01, InValue11, InValue21,
+		InValue02, InValue12, InValue22,
+		InValue03, InValue13, InValue23
+	}
+{
+}
+
+constexpr FTransform4D::FTransform4D(const FVector3D& InColumn0, const FVector3D& InColumn1, const FVector3D& InColumn2, const FVector3D& InColumn3)
+	: Data{
+		InColumn0.X, InColumn0.Y, InColumn0.Z,
+		InColumn1.X, InColumn1.Y, InColumn1.Z,
+		InColumn2.X, InColumn2.Y, InColumn2.Z,
+		InColumn3.X, InColumn3.Y, InColumn3.Z
+	}
+{
+}
+
+// Accessors.
+constexpr float* FTransform4D::GetData()
+{
+	return Data;
+}
+
+constexpr const float* FTransform4D::GetData() const
+{
+	return Data;
+}
+
+// Transform matrix generation functions.
+/*static*/ constexpr FTransform4D FTransform4D::MakeScale(float InScale)
+{
+	return FTransform4D(
+		InScale, 0.0f, 0.0f, 0.0f,
+		0.0f, InScale, 0.0f, 0.0f,
+		0.0f, 0.0f, InScale, 0.0f
+	);
+}
+
+/*static*/ constexpr FTransform4D FTransform4D::MakeScale(const FVector3D& InScale)
+{
+	return FTransform4D(
+		InScale.X, 0.0f, 0.0f, 0.0f,
+		0.0f, InScale.Y, 0.0f, 0.0f,
+		0.0f, 0.0f, InScale.Z, 0.0f
+	);
+}
+
+/*static*/ constexpr FTransform4D FTransform4D::MakeTranslation(const FVector3D& InTranslation)
+{
+	return FTransform4D(
+		1.0f, 0.0f, 0.0f, InTranslation.X,
+		0.0f, 1.0f, 0.0f, InTranslation.Y,
+		0.0f, 0.0f, 1.0f, InTranslation.Z
+	);
+}
+
+// Arithmetic operations with transforms/vectors.
+constexpr FTransform4D& FTransform4D::operator*=(const FTransform4D& InTransform)
+{
+	FTransform4D Result = *this * InTransform;
+	*this = Result;
+	return *this;
+}
+
+constexpr FTransform4D FTransform4D::operator*(const FTransform4D& InTransform) const
+{
+	const float* A = Data;
+	const float* B = InTransform.GetData();
+	return FTransform4D(
+		A[0]*B[0] + A[3]*B[1]  + A[6]*B[2],
+		A[0]*B[3] + A[3]*B[4]  + A[6]*B[5],
+		A[0]*B[6] + A[3]*B[7]  + A[6]*B[8],
+		A[0]*B[9] + A[3]*B[10] + A[6]*B[11] + A[9],
+		A[1]*B[0] + A[4]*B[1]  + A[7]*B[2],
+		A[1]*B[3] + A[4]*B[4]  + A[7]*B[5],
+		A[1]*B[6] + A[4]*B[7]  + A[7]*B[8],
+		A[1]*B[9] + A[4]*B[10] + A[7]*B[11] + A[10],
+		A[2]*B[0] + A[5]*B[1]  + A[8]*B[2],
+		A[2]*B[3] + A[5]*B[4]  + A[8]*B[5],
+		A[2]*B[6] + A[5]*B[7]  + A[8]*B[8],
+		A[2]*B[9] + A[5]*B[10] + A[8]*B[11] + A[11]
+	);
+}
+
+constexpr FVector4D FTransform4D::operator*(const FVector4D& InVector) const
+{
+	return FVector4D(
+		Data[0]*InVector.X + Data[3]*InVector.Y + Data[6]*InVector.Z + Data[9]*InVector.W,
+		Data[1]*InVector.X + Data[4]*InVector.Y + Data[7]*InVector.Z + Data[10]*InVector.W,
+		Data[2]*InVector.X + Data[5]*InVector.Y + Data[8]*InVector.Z + Data[11]*InVector.W,
+		InVector.W
+	);
+}
+
+constexpr FVector3D FTransform4D::operator*(const FVector3D& InVector) const
+{
+	return FVector3D(
+		Data[0]*InVector.X + Data[3]*InVector.Y + Data[6]*InVector.Z,
+		Data[1]*InVector.X + Data[4]*InVector.Y + Data[7]*InVector.Z,
+		Data[2]*InVector.X + Data[5]*InVector.Y + Data[8]*InVector.Z
+	);
+}
+
+// Definitions for class constants.
+inline constexpr FTransform4D FTransform4D::Identity(
+	1.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 1.0f, 0.0f
+);
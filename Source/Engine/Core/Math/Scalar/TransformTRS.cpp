@@ -0,0 +1,80 @@
+#include "TransformTRS.h"
+#include "Transform4D.h"
+
+// Transformations.
+FVector3D FTransformTRS::TransformPoint(const FVector3D& InPoint) const
+{
+	return Rotation.RotateVector(InPoint * Scale) + Translation;
+}
+
+FVector3D FTransformTRS::TransformVector(const FVector3D& InVector) const
+{
+	return Rotation.RotateVector(InVector * Scale);
+}
+
+FVector3D FTransformTRS::InverseTransformPoint(const FVector3D& InPoint) const
+{
+	return Rotation.UnrotateVector(InPoint - Translation) / Scale;
+}
+
+// Composition.
+FTransformTRS& FTransformTRS::operator*=(const FTransformTRS& InTransform)
+{
+	*this = *this * InTransform;
+	return *this;
+}
+
+FTransformTRS FTransformTRS::operator*(const FTransformTRS& InTransform) const
+{
+	return FTransformTRS(
+		TransformPoint(InTransform.Translation),
+		Rotation * InTransform.Rotation,
+		Scale * InTransform.Scale
+	);
+}
+
+// Inverse.
+void FTransformTRS::Invert()
+{
+	*this = GetInverted();
+}
+
+FTransformTRS FTransformTRS::GetInverted() const
+{
+	FQuat InverseRotation = Rotation.GetConjugate();
+	FVector3D InverseScale = FVector3D(1.0f, 1.0f, 1.0f) / Scale;
+	FVector3D InverseTranslation = InverseRotation.RotateVector(-Translation) * InverseScale;
+	return FTransformTRS(InverseTranslation, InverseRotation, InverseScale);
+}
+
+/*static*/ FTransformTRS FTransformTRS::Interpolate(const FTransformTRS& InTransform1, const FTransformTRS& InTransform2, float InAlpha)
+{
+	return FTransformTRS(
+		InTransform1.Translation + (InTransform2.Translation - InTransform1.Translation) * InAlpha,
+		FQuat::Slerp(InTransform1.Rotation, InTransform2.Rotation, InAlpha),
+		InTransform1.Scale + (InTransform2.Scale - InTransform1.Scale) * InAlpha
+	);
+}
+
+// Conversion functions.
+FTransform4D FTransformTRS::ToTransform() const
+{
+	// Scaling the columns of the rotation matrix is the same as multiplying by a scale matrix on the right.
+	FTransform4D Result = Rotation.ToTransform();
+	Result[0] *= Scale.X;
+	Result[1] *= Scale.Y;
+	Result[2] *= Scale.Z;
+	Result.SetTranslation(Translation);
+	return Result;
+}
+
+// Equality operators.
+bool FTransformTRS::operator==(const FTransformTRS& InTransform) const
+{
+	return Translation == InTransform.Translation && Rotation == InTransform.Rotation && Scale == InTransform.Scale;
+}
+
+bool FTransformTRS::operator!=(const FTransformTRS& InTransform) const
+{
+	return !(*this == InTransform);
+}
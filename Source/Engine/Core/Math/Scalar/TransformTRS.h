@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Quat.h"
+#include "Vector3D.h"
+
+class FTransform4D;
+
+/**
+ * A transform stored as separate translation, rotation, and scale components. Points are scaled first,
+ * then rotated, then translated, matching FTransform4D::MakeTranslation(T) * R * FTransform4D::MakeScale(S).
+ *
+ * Composing, inverting, and interpolating operate on the components directly, which is cheaper than the
+ * equivalent matrix operations and keeps rotations orthonormal. A TRS transform can't represent shear, so
+ * results of Compose and GetInverted are exact only when scales are uniform; with non-uniform scale they
+ * match what most engines do and keep each component's scale on its own axis. Convert with ToTransform
+ * when a matrix is needed (e.g. for shader uniforms).
+ */
+class FTransformTRS
+{
+public:
+	// Identity transform (no translation, no rotation, unit scale).
+	static const FTransformTRS Identity;
+
+	// Constructors.
+	FTransformTRS() = default;
+	explicit constexpr FTransformTRS(const FVector3D& InTranslation, const FQuat& InRotation = FQuat::Identity, const FVector3D& InScale = FVector3D::One);
+
+	// Copy operations.
+	FTransformTRS(const FTransformTRS& InTransform) = default;
+	FTransformTRS& operator=(const FTransformTRS& InTransform) = default;
+
+	// Transformations of points (scale, rotation, and translation) and vectors (scale and rotation only).
+	FVector3D TransformPoint(const FVector3D& InPoint) const;
+	FVector3D TransformVector(const FVector3D& InVector) const;
+	FVector3D InverseTransformPoint(const FVector3D& InPoint) const;
+
+	// Composition: (A * B) applies B first, then A, as with FTransform4D.
+	FTransformTRS& operator*=(const FTransformTRS& InTransform);
+	FTransformTRS operator*(const FTransformTRS& InTransform) const;
+
+	// Inverse.
+	void Invert();
+	FTransformTRS GetInverted() const;
+
+	// Interpolates translation and scale linearly and rotation with FQuat::Slerp.
+	static FTransformTRS Interpolate(const FTransformTRS& InTransform1, const FTransformTRS& InTransform2, float InAlpha);
+
+	// Conversion functions.
+	FTransform4D ToTransform() const;
+
+	// Equality operators.
+	bool operator==(const FTransformTRS& InTransform) const;
+	bool operator!=(const FTransformTRS& InTransform) const;
+
+	// FQuat is 16-byte aligned, so the transform is 48 bytes: 40 bytes of components followed by 8 bytes of padding.
+	FQuat Rotation;
+	FVector3D Translation = FVector3D(0.0f, 0.0f, 0.0f);
+	FVector3D Scale = FVector3D(1.0f, 1.0f, 1.0f);
+};
+
+// Constructors.
+constexpr FTransformTRS::FTransformTRS(const FVector3D& InTranslation, const FQuat& InRotation /* = FQuat::Identity */, const FVector3D& InScale /* = FVector3D::One */)
+	: Rotation(InRotation)
+	, Translation(InTranslation)
+	, Scale(InScale)
+{
+}
+
+// Definitions for class constants.
+inline constexpr FTransformTRS FTransformTRS::Identity(FVector3D::Zero, FQuat::Identity, FVector3D::One);
@@ -23,7 +23,7 @@ public:
 
 	// Constructors.
 	FVector2D() = default;
-	FVector2D(float InX, float InY);
+	constexpr FVector2D(float InX, float InY);
 	// Construct using the X and Y members of an FVector3D.
 	explicit FVector2D(const FVector3D& InVector);
 	// Construct using the X and Y members of an FVector4D.
@@ -35,36 +35,36 @@ public:
 
 	// Vector math.
 	float GetLength() const;
-	float GetLengthSquared() const;
+	constexpr float GetLengthSquared() const;
 	FVector2D& Normalize();
-	static float DotProduct(const FVector2D& InVector1, const FVector2D& InVector2);
+	static constexpr float DotProduct(const FVector2D& InVector1, const FVector2D& InVector2);
 
 	// Accessors.
 	float& operator[](int32 InIndex);
 	const float& operator[](int32 InIndex) const;
 
 	// Component-wise operations.
-	FVector2D& operator+=(const FVector2D& InVector);
-	FVector2D& operator-=(const FVector2D& InVector);
-	FVector2D& operator*= (const FVector2D& InVector);
-	FVector2D& operator/=(const FVector2D& InVector);
-	FVector2D operator+(const FVector2D& InVector) const;
-	FVector2D operator-(const FVector2D& InVector) const;
-	FVector2D operator*(const FVector2D& InVector) const;
-	FVector2D operator/(const FVector2D& InVector) const;
+	constexpr FVector2D& operator+=(const FVector2D& InVector);
+	constexpr FVector2D& operator-=(const FVector2D& InVector);
+	constexpr FVector2D& operator*= (const FVector2D& InVector);
+	constexpr FVector2D& operator/=(const FVector2D& InVector);
+	constexpr FVector2D operator+(const FVector2D& InVector) const;
+	constexpr FVector2D operator-(const FVector2D& InVector) const;
+	constexpr FVector2D operator*(const FVector2D& InVector) const;
+	constexpr FVector2D operator/(const FVector2D& InVector) const;
 
 	// Scalar operations.
-	FVector2D& operator+=(float InValue);
-	FVector2D& operator-=(float InValue);
-	FVector2D& operator*=(float InValue);
-	FVector2D& operator/=(float InValue);
-	FVector2D operator+(float InValue) const;
-	FVector2D operator-(float InValue) const;
-	FVector2D operator*(float InValue) const;
-	FVector2D operator/(float InValue) const;
+	constexpr FVector2D& operator+=(float InValue);
+	constexpr FVector2D& operator-=(float InValue);
+	constexpr FVector2D& operator*=(float InValue);
+	constexpr FVector2D& operator/=(float InValue);
+	constexpr FVector2D operator+(float InValue) const;
+	constexpr FVector2D operator-(float InValue) const;
+	constexpr FVector2D operator*(float InValue) const;
+	constexpr FVector2D operator/(float InValue) const;
 
 	// Unary minus operator (creates a negated copy of the FVector2D).
-	FVector2D operator-() const;
+	constexpr FVector2D operator-() const;
 
 	// Equality operators.
 	bool operator==(const FVector2D& InVector) const;
@@ -75,4 +75,147 @@ public:
 };
 
 // Scalar multiplication.
-FVector2D operator*(float InValue, const FVector2D& InVector);
+constexpr FVector2D operator*(float InValue, const FVector2D& InVector);
+
+// Constructors.
+constexpr FVector2D::FVector2D(float InX, float InY)
+	: X(InX)
+	, Y(InY)
+{
+}
+
+// Vector math.
+constexpr float FVector2D::GetLengthSquared() const
+{
+	return X*X + Y*Y;
+}
+
+/*static*/ constexpr float FVector2D::DotProduct(const FVector2D& InVector1, const FVector2D& InVector2)
+{
+	return InVector1.X * InVector2.X + InVector1.Y * InVector2.Y;
+}
+
+// Component-wise operations.
+constexpr FVector2D& FVector2D::operator+=(const FVector2D& InVector)
+{
+	X += InVector.X;
+	Y += InVector.Y;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator-=(const FVector2D& InVector)
+{
+	X -= InVector.X;
+	Y -= InVector.Y;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator*=(const FVector2D& InVector)
+{
+	X *= InVector.X;
+	Y *= InVector.Y;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator/=(const FVector2D& InVector)
+{
+	X /= InVector.X;
+	Y /= InVector.Y;
+	return *this;
+}
+
+constexpr FVector2D FVector2D::operator+(const FVector2D& InVector) const
+{
+	FVector2D Result = *this;
+	return Result += InVector;
+}
+
+constexpr FVector2D FVector2D::operator-(const FVector2D& InVector) const
+{
+	FVector2D Result = *this;
+	return Result -= InVector;
+}
+
+constexpr FVector2D FVector2D::operator*(const FVector2D& InVector) const
+{
+	FVector2D Result = *this;
+	return Result *= InVector;
+}
+
+constexpr FVector2D FVector2D::operator/(const FVector2D& InVector) const
+{
+	FVector2D Result = *this;
+	return Result /= InVector;
+}
+
+// Scalar operations
+constexpr FVector2D& FVector2D::operator+=(float InValue)
+{
+	X += InValue;
+	Y += InValue;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator-=(float InValue)
+{
+	X -= InValue;
+	Y -= InValue;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator*=(float InValue)
+{
+	X *= InValue;
+	Y *= InValue;
+	return *this;
+}
+
+constexpr FVector2D& FVector2D::operator/=(float InValue)
+{
+	// Multiplication is faster than division.
+	float InverseValue = 1.0f / InValue;
+	X *= InverseValue;
+	Y *= InverseValue;
+	return *this;
+}
+
+constexpr FVector2D FVector2D::operator+(float InValue) const
+{
+	FVector2D Result = *this;
+	return Result += InValue;
+}
+
+constexpr FVector2D FVector2D::operator-(float InValue) const
+{
+	FVector2D Result = *this;
+	return Result -= InValue;
+}
+
+constexpr FVector2D FVector2D::operator*(float InValue) const
+{
+	FVector2D Result = *this;
+	return Result *= InValue;
+}
+
+constexpr FVector2D FVector2D::operator/(float InValue) const
+{
+	FVector2D Result = *this;
+	return Result /= InValue;
+}
+
+constexpr FVector2D operator*(float InValue, const FVector2D& InVector)
+{
+	return InVector * InValue;
+}
+
+// Unary minus operator.
+constexpr FVector2D FVector2D::operator-() const
+{
+	return FVector2D(-X, -Y);
+}
+
+// Definitions for class constants.
+inline constexpr FVector2D FVector2D::Zero(0.0f, 0.0f);
+inline constexpr FVector2D FVector2D::One(1.0f, 1.0f);
+inline constexpr FVector2D FVector2D::XAxis(1.0f, 0.0f);
+inline constexpr FVector2D FVector2D::YAxis(0.0f, 1.0f);
@@ -26,7 +26,7 @@ public:
 	
 	// Constructors.
 	FVector3D() = default;
-	FVector3D(float InX, float InY, float InZ);
+	constexpr FVector3D(float InX, float InY, float InZ);
 	// Construct using the R, G, and B members of an FColor.
 	FVector3D(const FColor& InColor);
 	// Construct using the X and Y members of an FVector2D.
@@ -40,40 +40,40 @@ public:
 
 	// Vector math.
 	float GetLength() const;
-	float GetLengthSquared() const;
+	constexpr float GetLengthSquared() const;
 	FVector3D& Normalize();
 
 	static float Length(const FVector3D& InVector1, const FVector3D& InVector2);
 	static FVector3D Normalize(const FVector3D& InVector);
-	static float DotProduct(const FVector3D& InVector1, const FVector3D& InVector2);
-	static FVector3D CrossProduct(const FVector3D& InVector1, const FVector3D& InVector2);
+	static constexpr float DotProduct(const FVector3D& InVector1, const FVector3D& InVector2);
+	static constexpr FVector3D CrossProduct(const FVector3D& InVector1, const FVector3D& InVector2);
 
 	// Accessors.
 	float& operator[](int32 InIndex);
 	const float& operator[](int32 InIndex) const;
 
 	// Component-wise operations.
-	FVector3D& operator+=(const FVector3D& InVector);
-	FVector3D& operator-=(const FVector3D& InVector);
-	FVector3D& operator*= (const FVector3D& InVector);
-	FVector3D& operator/=(const FVector3D& InVector);
-	FVector3D operator+(const FVector3D& InVector) const;
-	FVector3D operator-(const FVector3D& InVector) const;
-	FVector3D operator*(const FVector3D& InVector) const;
-	FVector3D operator/(const FVector3D& InVector) const;
+	constexpr FVector3D& operator+=(const FVector3D& InVector);
+	constexpr FVector3D& operator-=(const FVector3D& InVector);
+	constexpr FVector3D& operator*= (const FVector3D& InVector);
+	constexpr FVector3D& operator/=(const FVector3D& InVector);
+	constexpr FVector3D operator+(const FVector3D& InVector) const;
+	constexpr FVector3D operator-(const FVector3D& InVector) const;
+	constexpr FVector3D operator*(const FVector3D& InVector) const;
+	constexpr FVector3D operator/(const FVector3D& InVector) const;
 
 	// Scalar operations.
-	FVector3D& operator+=(float InValue);
-	FVector3D& operator-=(float InValue);
-	FVector3D& operator*=(float InValue);
-	FVector3D& operator/=(float InValue);
-	FVector3D operator+(float InValue) const;
-	FVector3D operator-(float InValue) const;
-	FVector3D operator*(float InValue) const;
-	FVector3D operator/(float InValue) const;
+	constexpr FVector3D& operator+=(float InValue);
+	constexpr FVector3D& operator-=(float InValue);
+	constexpr FVector3D& operator*=(float InValue);
+	constexpr FVector3D& operator/=(float InValue);
+	constexpr FVector3D operator+(float InValue) const;
+	constexpr FVector3D operator-(float InValue) const;
+	constexpr FVector3D operator*(float InValue) const;
+	constexpr FVector3D operator/(float InValue) const;
 
 	// Unary minus operator (creates a negated copy of the FVector3D).
-	FVector3D operator-() const;
+	constexpr FVector3D operator-() const;
 
 	// Equality operators.
 	bool operator==(const FVector3D& InVector) const;
@@ -85,4 +85,166 @@ public:
 };
 
 // Scalar multiplication.
-FVector3D operator*(float InValue, const FVector3D& InVector);
+constexpr FVector3D operator*(float InValue, const FVector3D& InVector);
+
+// Constructors.
+constexpr FVector3D::FVector3D(float InX, float InY, float InZ)
+	: X(InX)
+	, Y(InY)
+	, Z(InZ)
+{
+}
+
+// Vector math.
+constexpr float FVector3D::GetLengthSquared() const
+{
+	return X*X + Y*Y + Z*Z;
+}
+
+/*static*/ constexpr float FVector3D::DotProduct(const FVector3D& InVector1, const FVector3D& InVector2)
+{
+	return InVector1.X * InVector2.X + InVector1.Y * InVector2.Y + InVector1.Z * InVector2.Z;
+}
+
+/*static*/ constexpr FVector3D FVector3D::CrossProduct(const FVector3D& InVector1, const FVector3D& InVector2)
+{
+	return FVector3D(
+		InVector1.Y * InVector2.Z - InVector1.Z * InVector2.Y,
+		InVector1.Z * InVector2.X - InVector1.X * InVector2.Z,
+		InVector1.X * InVector2.Y - InVector1.Y * InVector2.X
+	);
+}
+
+// Component-wise operations.
+constexpr FVector3D& FVector3D::operator+=(const FVector3D& InVector)
+{
+	X += InVector.X;
+	Y += InVector.Y;
+	Z += InVector.Z;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator-=(const FVector3D& InVector)
+{
+	X -= InVector.X;
+	Y -= InVector.Y;
+	Z -= InVector.Z;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator*=(const FVector3D& InVector)
+{
+	X *= InVector.X;
+	Y *= InVector.Y;
+	Z *= InVector.Z;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator/=(const FVector3D& InVector)
+{
+	X /= InVector.X;
+	Y /= InVector.Y;
+	Z /= InVector.Z;
+	return *this;
+}
+
+constexpr FVector3D FVector3D::operator+(const FVector3D& InVector) const
+{
+	FVector3D Result = *this;
+	return Result += InVector;
+}
+
+constexpr FVector3D FVector3D::operator-(const FVector3D& InVector) const
+{
+	FVector3D Result = *this;
+	return Result -= InVector;
+}
+
+constexpr FVector3D FVector3D::operator*(const FVector3D& InVector) const
+{
+	FVector3D Result = *this;
+	return Result *= InVector;
+}
+
+constexpr FVector3D FVector3D::operator/(const FVector3D& InVector) const
+{
+	FVector3D Result = *this;
+	return Result /= InVector;
+}
+
+// Scalar operations.
+constexpr FVector3D& FVector3D::operator+=(float InValue)
+{
+	X += InValue;
+	Y += InValue;
+	Z += InValue;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator-=(float InValue)
+{
+	X -= InValue;
+	Y -= InValue;
+	Z -= InValue;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator*=(float InValue)
+{
+	X *= InValue;
+	Y *= InValue;
+	Z *= InValue;
+	return *this;
+}
+
+constexpr FVector3D& FVector3D::operator/=(float InValue)
+{
+	// Multiplication is faster than division.
+	float InverseValue = 1.0f / InValue;
+	X *= InverseValue;
+	Y *= InverseValue;
+	Z *= InverseValue;
+	return *this;
+}
+
+constexpr FVector3D FVector3D::operator+(float InValue) const
+{
+	FVector3D Result = *this;
+	return Result += InValue;
+}
+
+constexpr FVector3D FVector3D::operator-(float InValue) const
+{
+	FVector3D Result = *this;
+	return Result -= InValue;
+}
+
+constexpr FVector3D FVector3D::operator*(float InValue) const
+{
+	FVector3D Result = *this;
+	return Result *= InValue;
+}
+
+constexpr FVector3D FVector3D::operator/(float InValue) const
+{
+	FVector3D Result = *this;
+	return Result /= InValue;
+}
+
+constexpr FVector3D operator*(float InValue, const FVector3D& InVector)
+{
+	return InVector * InValue;
+}
+
+// Unary minus operator.
+constexpr FVector3D FVector3D::operator-() const
+{
+	return FVector3D(-X, -Y, -Z);
+}
+
+// Definitions for class constants.
+inline constexpr FVector3D FVector3D::Zero(0.0f, 0.0f, 0.0f);
+inline constexpr FVector3D FVector3D::One(1.0f, 1.0f, 1.0f);
+inline constexpr FVector3D FVector3D::XAxis(1.0f, 0.0f, 0.0f);
+inline constexpr FVector3D FVector3D::YAxis(0.0f, 1.0f, 0.0f);
+inline constexpr FVector3D FVector3D::ZAxis(0.0f, 0.0f, 1.0f);
@@ -27,7 +27,7 @@ public:
 
 	// Constructors.
 	FVector4D() = default;
-	FVector4D(float InX, float InY, float InZ, float InW);
+	constexpr FVector4D(float InX, float InY, float InZ, float InW);
 	// Construct using the X and Y members of an FVector2D.
 	explicit FVector4D(const FVector2D& InVector, float InZ = 0.0f, float InW = 0.0f);
 	// Construct using the X, Y, and Z members of an FVector3D.
@@ -39,38 +39,38 @@ public:
 
 	// Vector math.
 	float GetLength() const;
-	float GetLengthSquared() const;
+	constexpr float GetLengthSquared() const;
 	FVector4D& Normalize();
-	static float DotProduct(const FVector4D& InVector1, const FVector4D& InVector2);
+	static constexpr float DotProduct(const FVector4D& InVector1, const FVector4D& InVector2);
 	// Calculates the cross product using X, Y, and Z. W is set to zero.
-	static FVector4D CrossProduct(const FVector4D& InVector1, const FVector4D& InVector2);
+	static constexpr FVector4D CrossProduct(const FVector4D& InVector1, const FVector4D& InVector2);
 
 	// Accessors.
 	float& operator[](int32 InIndex);
 	const float& operator[](int32 InIndex) const;
 
 	// Component-wise operations.
-	FVector4D& operator+=(const FVector4D& InVector);
-	FVector4D& operator-=(const FVector4D& InVector);
-	FVector4D& operator*= (const FVector4D& InVector);
-	FVector4D& operator/=(const FVector4D& InVector);
-	FVector4D operator+(const FVector4D& InVector) const;
-	FVector4D operator-(const FVector4D& InVector) const;
-	FVector4D operator*(const FVector4D& InVector) const;
-	FVector4D operator/(const FVector4D& InVector) const;
+	constexpr FVector4D& operator+=(const FVector4D& InVector);
+	constexpr FVector4D& operator-=(const FVector4D& InVector);
+	constexpr FVector4D& operator*= (const FVector4D& InVector);
+	constexpr FVector4D& operator/=(const FVector4D& InVector);
+	constexpr FVector4D operator+(const FVector4D& InVector) const;
+	constexpr FVector4D operator-(const FVector4D& InVector) const;
+	constexpr FVector4D operator*(const FVector4D& InVector) const;
+	constexpr FVector4D operator/(const FVector4D& InVector) const;
 
 	// Scalar operations.
-	FVector4D& operator+=(float InValue);
-	FVector4D& operator-=(float InValue);
-	FVector4D& operator*=(float InValue);
-	FVector4D& operator/=(float InValue);
-	FVector4D operator+(float InValue) const;
-	FVector4D operator-(float InValue) const;
-	FVector4D operator*(float InValue) const;
-	FVector4D operator/(float InValue) const;
+	constexpr FVector4D& operator+=(float InValue);
+	constexpr FVector4D& operator-=(float InValue);
+	constexpr FVector4D& operator*=(float InValue);
+	constexpr FVector4D& operator/=(float InValue);
+	constexpr FVector4D operator+(float InValue) const;
+	constexpr FVector4D operator-(float InValue) const;
+	constexpr FVector4D operator*(float InValue) const;
+	constexpr FVector4D operator/(float InValue) const;
 
 	// Unary minus operator (creates a negated copy of the FVector4D).
-	FVector4D operator-() const;
+	constexpr FVector4D operator-() const;
 
 	// Equality operators.
 	bool operator==(const FVector4D& InVector) const;
@@ -83,4 +83,177 @@ public:
 };
 
 // Scalar multiplication.
-FVector4D operator*(float InValue, const FVector4D& InVector);
+constexpr FVector4D operator*(float InValue, const FVector4D& InVector);
+
+// Constructors.
+constexpr FVector4D::FVector4D(float InX, float InY, float InZ, float InW)
+	: X(InX)
+	, Y(InY)
+	, Z(InZ)
+	, W(InW)
+{
+}
+
+// Vector math.
+constexpr float FVector4D::GetLengthSquared() const
+{
+	return X*X + Y*Y + Z*Z + W*W;
+}
+
+/*static*/ constexpr float FVector4D::DotProduct(const FVector4D& InVector1, const FVector4D& InVector2)
+{
+	return InVector1.X * InVector2.X + InVector1.Y * InVector2.Y + InVector1.Z * InVector2.Z + InVector1.W * InVector2.W;
+}
+
+/*static*/ constexpr FVector4D FVector4D::CrossProduct(const FVector4D& InVector1, const FVector4D& InVector2)
+{
+	return FVector4D(
+		InVector1.Y * InVector2.Z - InVector1.Z * InVector2.Y,
+		InVector1.Z * InVector2.X - InVector1.X * InVector2.Z,
+		InVector1.X * InVector2.Y - InVector1.Y * InVector2.X,
+		0.0f
+	);
+}
+
+// Component-wise operations.
+constexpr FVector4D& FVector4D::operator+=(const FVector4D& InVector)
+{
+	X += InVector.X;
+	Y += InVector.Y;
+	Z += InVector.Z;
+	W += InVector.W;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator-=(const FVector4D& InVector)
+{
+	X -= InVector.X;
+	Y -= InVector.Y;
+	Z -= InVector.Z;
+	W -= InVector.W;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator*=(const FVector4D& InVector)
+{
+	X *= InVector.X;
+	Y *= InVector.Y;
+	Z *= InVector.Z;
+	W *= InVector.W;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator/=(const FVector4D& InVector)
+{
+	X /= InVector.X;
+	Y /= InVector.Y;
+	Z /= InVector.Z;
+	W /= InVector.W;
+	return *this;
+}
+
+constexpr FVector4D FVector4D::operator+(const FVector4D& InVector) const
+{
+	FVector4D Result = *this;
+	return Result += InVector;
+}
+
+constexpr FVector4D FVector4D::operator-(const FVector4D& InVector) const
+{
+	FVector4D Result = *this;
+	return Result -= InVector;
+}
+
+constexpr FVector4D FVector4D::operator*(const FVector4D& InVector) const
+{
+	FVector4D Result = *this;
+	return Result *= InVector;
+}
+
+constexpr FVector4D FVector4D::operator/(const FVector4D& InVector) const
+{
+	FVector4D Result = *this;
+	return Result /= InVector;
+}
+
+// Scalar operations
+constexpr FVector4D& FVector4D::operator+=(float InValue)
+{
+	X += InValue;
+	Y += InValue;
+	Z += InValue;
+	W += InValue;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator-=(float InValue)
+{
+	X -= InValue;
+	Y -= InValue;
+	Z -= InValue;
+	W -= InValue;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator*=(float InValue)
+{
+	X *= InValue;
+	Y *= InValue;
+	Z *= InValue;
+	W *= InValue;
+	return *this;
+}
+
+constexpr FVector4D& FVector4D::operator/=(float InValue)
+{
+	// Multiplication is faster than division.
+	float InverseValue = 1.0f / InValue;
+	X *= InverseValue;
+	Y *= InverseValue;
+	Z *= InverseValue;
+	W *= InverseValue;
+	return *this;
+}
+
+constexpr FVector4D FVector4D::operator+(float InValue) const
+{
+	FVector4D Result = *this;
+	return Result += InValue;
+}
+
+constexpr FVector4D FVector4D::operator-(float InValue) const
+{
+	FVector4D Result = *this;
+	return Result -= InValue;
+}
+
+constexpr FVector4D FVector4D::operator*(float InValue) const
+{
+	FVector4D Result = *this;
+	return Result *= InValue;
+}
+
+constexpr FVector4D FVector4D::operator/(float InValue) const
+{
+	FVector4D Result = *this;
+	return Result /= InValue;
+}
+
+constexpr FVector4D operator*(float InValue, const FVector4D& InVector)
+{
+	return InVector * InValue;
+}
+
+// Unary minus operator.
+constexpr FVector4D FVector4D::operator-() const
+{
+	return FVector4D(-X, -Y, -Z, -W);
+}
+
+// Definitions for class constants.
+inline constexpr FVector4D FVector4D::Zero(0.0f, 0.0f, 0.0f, 0.0f);
+inline constexpr FVector4D FVector4D::One(1.0f, 1.0f, 1.0f, 1.0f);
+inline constexpr FVector4D FVector4D::XAxis(1.0f, 0.0f, 0.0f, 0.0f);
+inline constexpr FVector4D FVector4D::YAxis(0.0f, 1.0f, 0.0f, 0.0f);
+inline constexpr FVector4D FVector4D::ZAxis(0.0f, 0.0f, 1.0f, 0.0f);
+inline constexpr FVector4D FVector4D::UnitW(0.0f, 0.0f, 0.0f, 1.0f);
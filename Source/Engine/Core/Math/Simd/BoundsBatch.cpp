@@ -0,0 +1,284 @@
+#include "BoundsBatch.h"
+#include "Math/Simd/VectorRegister.h"
+#include "Math/MathUtilities.h"
+#include "AssertionMacros.h"
+
+static_assert(sizeof(FAABB) == 6 * sizeof(float), "The kernels assume FAABB is two packed FVector3Ds.");
+static_assert(sizeof(FSphere) == 4 * sizeof(float), "The kernels assume FSphere is four packed floats.");
+
+/**
+ * Loads four consecutive boxes with one register per component of their corners. The boxes are eight packed
+ * 3D vectors (Min0, Max0, Min1, Max1, ...), so deinterleaving them gives the corners of two boxes per register.
+ */
+static void LoadAABBs(const FAABB* InBoxes, FVectorRegister4 (&OutMin)[3], FVectorRegister4 (&OutMax)[3])
+{
+	const float* Data = &InBoxes->Min.X;
+	FVectorRegister4 First[3];
+	FVectorRegister4 Second[3];
+	VectorDeinterleave3(VectorLoad(Data), VectorLoad(Data + 4), VectorLoad(Data + 8), First[0], First[1], First[2]);
+	VectorDeinterleave3(VectorLoad(Data + 12), VectorLoad(Data + 16), VectorLoad(Data + 20), Second[0], Second[1], Second[2]);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		OutMin[Axis] = VectorShuffle<0, 2, 0, 2>(First[Axis], Second[Axis]);
+		OutMax[Axis] = VectorShuffle<1, 3, 1, 3>(First[Axis], Second[Axis]);
+	}
+}
+
+// Inverse of LoadAABBs.
+static void StoreAABBs(const FVectorRegister4 (&InMin)[3], const FVectorRegister4 (&InMax)[3], FAABB* OutBoxes)
+{
+	FVectorRegister4 First[3];
+	FVectorRegister4 Second[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		First[Axis] = VectorSwizzle<0, 2, 1, 3>(VectorShuffle<0, 1, 0, 1>(InMin[Axis], InMax[Axis]));
+		Second[Axis] = VectorSwizzle<0, 2, 1, 3>(VectorShuffle<2, 3, 2, 3>(InMin[Axis], InMax[Axis]));
+	}
+
+	float* Data = &OutBoxes->Min.X;
+	FVectorRegister4 A, B, C;
+	VectorInterleave3(First[0], First[1], First[2], A, B, C);
+	VectorStore(A, Data);
+	VectorStore(B, Data + 4);
+	VectorStore(C, Data + 8);
+	VectorInterleave3(Second[0], Second[1], Second[2], A, B, C);
+	VectorStore(A, Data + 12);
+	VectorStore(B, Data + 16);
+	VectorStore(C, Data + 20);
+}
+
+// The frustum's planes, one register per component, with each value splatted across the lanes.
+struct FSplatPlanes
+{
+	explicit FSplatPlanes(const FFrustumPlanes& InFrustum)
+	{
+		for (int32 Plane = 0; Plane < FFrustumPlanes::NumPlanes; ++Plane)
+		{
+			const FPlane& Source = InFrustum.Planes[Plane];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Normal[Plane][Axis] = VectorSplat(Source.Normal[Axis]);
+				AbsNormal[Plane][Axis] = VectorSplat(FMath::Abs(Source.Normal[Axis]));
+			}
+			D[Plane] = VectorSplat(Source.D);
+		}
+	}
+
+	// Returns Dot(Normal, X) + D.
+	FVectorRegister4 GetSignedDistance(int32 InPlane, const FVectorRegister4 (&InPoint)[3]) const
+	{
+		FVectorRegister4 Distance = VectorMultiplyAdd(Normal[InPlane][0], InPoint[0], D[InPlane]);
+		Distance = VectorMultiplyAdd(Normal[InPlane][1], InPoint[1], Distance);
+		return VectorMultiplyAdd(Normal[InPlane][2], InPoint[2], Distance);
+	}
+
+	FVectorRegister4 Normal[FFrustumPlanes::NumPlanes][3];
+	FVectorRegister4 AbsNormal[FFrustumPlanes::NumPlanes][3];
+	FVectorRegister4 D[FFrustumPlanes::NumPlanes];
+};
+
+// Writes the visibility of four shapes from a mask of the lanes found to be outside, and returns how many are visible.
+static int32 StoreVisibility(FVectorRegister4 InOutsideMask, bool* OutVisible)
+{
+	int32 OutsideBits = VectorMaskBits(InOutsideMask);
+	int32 NumVisible = 0;
+	for (int32 Lane = 0; Lane < VectorRegister4Lanes; ++Lane)
+	{
+		bool bVisible = (OutsideBits & (1 << Lane)) == 0;
+		OutVisible[Lane] = bVisible;
+		NumVisible += bVisible ? 1 : 0;
+	}
+	return NumVisible;
+}
+
+/*static*/ int32 FBoundsBatch::CullAABBs(const FFrustumPlanes& InFrustum, const FAABB* InBoxes, bool* OutVisible, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FSplatPlanes Planes(InFrustum);
+	FVectorRegister4 Half = VectorSplat(0.5f);
+
+	int32 NumVisible = 0;
+	int32 Index = 0;
+	for (; Index + VectorRegister4Lanes <= InCount; Index += VectorRegister4Lanes)
+	{
+		FVectorRegister4 Min[3];
+		FVectorRegister4 Max[3];
+		LoadAABBs(InBoxes + Index, Min, Max);
+
+		FVectorRegister4 Center[3];
+		FVectorRegister4 Extent[3];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Center[Axis] = VectorMultiply(VectorAdd(Min[Axis], Max[Axis]), Half);
+			Extent[Axis] = VectorMultiply(VectorSubtract(Max[Axis], Min[Axis]), Half);
+		}
+
+		FVectorRegister4 Outside = VectorZero();
+		for (int32 Plane = 0; Plane < FFrustumPlanes::NumPlanes; ++Plane)
+		{
+			FVectorRegister4 ProjectedExtent = VectorMultiply(Planes.AbsNormal[Plane][0], Extent[0]);
+			ProjectedExtent = VectorMultiplyAdd(Planes.AbsNormal[Plane][1], Extent[1], ProjectedExtent);
+			ProjectedExtent = VectorMultiplyAdd(Planes.AbsNormal[Plane][2], Extent[2], ProjectedExtent);
+			FVectorRegister4 Distance = Planes.GetSignedDistance(Plane, Center);
+			Outside = VectorBitwiseOr(Outside, VectorCompareLT(Distance, VectorNegate(ProjectedExtent)));
+		}
+		NumVisible += StoreVisibility(Outside, OutVisible + Index);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		OutVisible[Index] = InFrustum.Intersects(InBoxes[Index]);
+		NumVisible += OutVisible[Index] ? 1 : 0;
+	}
+	return NumVisible;
+}
+
+/*static*/ int32 FBoundsBatch::CullSpheres(const FFrustumPlanes& InFrustum, const FSphere* InSpheres, bool* OutVisible, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FSplatPlanes Planes(InFrustum);
+
+	int32 NumVisible = 0;
+	int32 Index = 0;
+	for (; Index + VectorRegister4Lanes <= InCount; Index += VectorRegister4Lanes)
+	{
+		// Each sphere fills a register, so transposing gives one register per component.
+		const float* Data = &InSpheres[Index].Center.X;
+		FVectorRegister4 Center[3] = { VectorLoad(Data), VectorLoad(Data + 4), VectorLoad(Data + 8) };
+		FVectorRegister4 Radius = VectorLoad(Data + 12);
+		VectorTranspose4x4(Center[0], Center[1], Center[2], Radius);
+
+		FVectorRegister4 NegativeRadius = VectorNegate(Radius);
+		FVectorRegister4 Outside = VectorZero();
+		for (int32 Plane = 0; Plane < FFrustumPlanes::NumPlanes; ++Plane)
+		{
+			Outside = VectorBitwiseOr(Outside, VectorCompareLT(Planes.GetSignedDistance(Plane, Center), NegativeRadius));
+		}
+		NumVisible += StoreVisibility(Outside, OutVisible + Index);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		OutVisible[Index] = InFrustum.Intersects(InSpheres[Index]);
+		NumVisible += OutVisible[Index] ? 1 : 0;
+	}
+	return NumVisible;
+}
+
+// The same slab test as FRay::Intersects, for four boxes at once.
+/*static*/ int32 FBoundsBatch::RaycastAABBs(const FRay& InRay, const FAABB* InBoxes, float* OutDistances, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FVectorRegister4 Origin[3];
+	FVectorRegister4 InverseDirection[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Origin[Axis] = VectorSplat(InRay.Origin[Axis]);
+		InverseDirection[Axis] = VectorSplat(1.0f / InRay.Direction[Axis]);
+	}
+	FVectorRegister4 Miss = VectorSplat(FMath::MaxFloat);
+
+	int32 Index = 0;
+	for (; Index + VectorRegister4Lanes <= InCount; Index += VectorRegister4Lanes)
+	{
+		FVectorRegister4 Min[3];
+		FVectorRegister4 Max[3];
+		LoadAABBs(InBoxes + Index, Min, Max);
+
+		FVectorRegister4 Near = VectorZero();
+		FVectorRegister4 Far = Miss;
+		FVectorRegister4 Hit = VectorCompareLE(Min[0], Max[0]);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			FVectorRegister4 Distance1 = VectorMultiply(VectorSubtract(Min[Axis], Origin[Axis]), InverseDirection[Axis]);
+			FVectorRegister4 Distance2 = VectorMultiply(VectorSubtract(Max[Axis], Origin[Axis]), InverseDirection[Axis]);
+			Near = VectorMax(VectorMin(Distance1, Distance2), Near);
+			Far = VectorMin(VectorMax(Distance1, Distance2), Far);
+			// Empty boxes are never hit.
+			Hit = VectorBitwiseAnd(Hit, VectorCompareLE(Min[Axis], Max[Axis]));
+		}
+		Hit = VectorBitwiseAnd(Hit, VectorCompareLE(Near, Far));
+		VectorStore(VectorSelect(Hit, Near, Miss), OutDistances + Index);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		float Distance;
+		OutDistances[Index] = InRay.Intersects(InBoxes[Index], Distance) ? Distance : FMath::MaxFloat;
+	}
+
+	// Finding the closest hit is cheap next to the tests, so it's done in a separate pass.
+	int32 ClosestIndex = InvalidIndex;
+	float ClosestDistance = FMath::MaxFloat;
+	for (Index = 0; Index < InCount; ++Index)
+	{
+		if (OutDistances[Index] < ClosestDistance)
+		{
+			ClosestIndex = Index;
+			ClosestDistance = OutDistances[Index];
+		}
+	}
+	return ClosestIndex;
+}
+
+// The same algorithm as FAABB::GetTransformed, for four boxes at once.
+/*static*/ void FBoundsBatch::TransformAABBs(const FTransform4D& InTransform, const FAABB* InBoxes, FAABB* OutBoxes, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	const float* Data = InTransform.GetData();
+	FVectorRegister4 M[12];
+	FVectorRegister4 AbsM[9];
+	for (int32 Element = 0; Element < 12; ++Element)
+	{
+		M[Element] = VectorSplat(Data[Element]);
+	}
+	for (int32 Element = 0; Element < 9; ++Element)
+	{
+		AbsM[Element] = VectorAbs(M[Element]);
+	}
+	FVectorRegister4 Half = VectorSplat(0.5f);
+
+	int32 Index = 0;
+	for (; Index + VectorRegister4Lanes <= InCount; Index += VectorRegister4Lanes)
+	{
+		FVectorRegister4 Min[3];
+		FVectorRegister4 Max[3];
+		LoadAABBs(InBoxes + Index, Min, Max);
+
+		FVectorRegister4 Center[3];
+		FVectorRegister4 Extent[3];
+		FVectorRegister4 Valid = VectorCompareLE(Min[0], Max[0]);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Center[Axis] = VectorMultiply(VectorAdd(Min[Axis], Max[Axis]), Half);
+			Extent[Axis] = VectorMultiply(VectorSubtract(Max[Axis], Min[Axis]), Half);
+			Valid = VectorBitwiseAnd(Valid, VectorCompareLE(Min[Axis], Max[Axis]));
+		}
+
+		FVectorRegister4 NewMin[3];
+		FVectorRegister4 NewMax[3];
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			FVectorRegister4 NewCenter = VectorMultiplyAdd(M[Row], Center[0], M[9 + Row]);
+			NewCenter = VectorMultiplyAdd(M[3 + Row], Center[1], NewCenter);
+			NewCenter = VectorMultiplyAdd(M[6 + Row], Center[2], NewCenter);
+			FVectorRegister4 NewExtent = VectorMultiply(AbsM[Row], Extent[0]);
+			NewExtent = VectorMultiplyAdd(AbsM[3 + Row], Extent[1], NewExtent);
+			NewExtent = VectorMultiplyAdd(AbsM[6 + Row], Extent[2], NewExtent);
+
+			// Empty boxes are passed through unchanged.
+			NewMin[Row] = VectorSelect(Valid, VectorSubtract(NewCenter, NewExtent), Min[Row]);
+			NewMax[Row] = VectorSelect(Valid, VectorAdd(NewCenter, NewExtent), Max[Row]);
+		}
+		StoreAABBs(NewMin, NewMax, OutBoxes + Index);
+	}
+
+	for (; Index < InCount; ++Index)
+	{
+		OutBoxes[Index] = InBoxes[Index].GetTransformed(InTransform);
+	}
+}
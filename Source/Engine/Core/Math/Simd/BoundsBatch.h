@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Geometry/Sphere.h"
+#include "Math/Geometry/FrustumPlanes.h"
+#include "Math/Geometry/Ray.h"
+#include "Math/Transform4D.h"
+
+/**
+ * Vectorized versions of the bounding volume tests, for culling, picking, and building spatial indices,
+ * where the same test runs against many shapes.
+ *
+ * Each kernel processes 4 shapes per iteration, and remaining shapes go through the scalar member
+ * functions. Results match the scalar functions except for floating-point rounding in borderline cases
+ * (the vectorized code may use fused multiply-adds). As with FTransformBatch, every kernel is a pure
+ * function of its inputs, so a large array can be split into ranges and processed on several threads.
+ */
+struct FBoundsBatch
+{
+	/**
+	 * Writes whether each shape intersects the frustum (see FFrustumPlanes::Intersects) and returns
+	 * the number that do.
+	 */
+	static int32 CullAABBs(const FFrustumPlanes& InFrustum, const FAABB* InBoxes, bool* OutVisible, int32 InCount);
+	static int32 CullSpheres(const FFrustumPlanes& InFrustum, const FSphere* InSpheres, bool* OutVisible, int32 InCount);
+
+	/**
+	 * Writes the distance along the ray to each box (see FRay::Intersects), or FMath::MaxFloat for boxes
+	 * the ray misses. Returns the index of the closest box hit, or InvalidIndex if none are.
+	 */
+	static int32 RaycastAABBs(const FRay& InRay, const FAABB* InBoxes, float* OutDistances, int32 InCount);
+
+	// Computes OutBoxes[i] = InBoxes[i].GetTransformed(InTransform). Outputs may alias their inputs exactly.
+	static void TransformAABBs(const FTransform4D& InTransform, const FAABB* InBoxes, FAABB* OutBoxes, int32 InCount);
+};
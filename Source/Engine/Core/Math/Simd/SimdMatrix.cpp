@@ -0,0 +1,157 @@
+#include "SimdMatrix.h"
+
+// Returns the register with its W lane replaced by the W lane of InW.
+static FVectorRegister4 VectorSetW(FVectorRegister4 InXYZ, FVectorRegister4 InW)
+{
+	FVectorRegister4 XYZMask = FSimdMatrix::XYZMask();
+	return VectorSelect(XYZMask, InXYZ, InW);
+}
+
+// 4x4 matrices.
+/*static*/ FMatrix4D FSimdMatrix::Multiply(const FMatrix4D& InA, const FMatrix4D& InB)
+{
+	const float* A = InA.GetData();
+	const float* B = InB.GetData();
+	FVectorRegister4 A0 = VectorLoad(A + 0);
+	FVectorRegister4 A1 = VectorLoad(A + 4);
+	FVectorRegister4 A2 = VectorLoad(A + 8);
+	FVectorRegister4 A3 = VectorLoad(A + 12);
+
+	// Each column of the result is a linear combination of the columns of A, weighted by a column of B.
+	FMatrix4D Result;
+	float* Output = Result.GetData();
+	for (int32 Column = 0; Column < 4; ++Column)
+	{
+		FVectorRegister4 BColumn = VectorLoad(B + Column * 4);
+		FVectorRegister4 Sum = VectorMultiply(A0, VectorReplicate<0>(BColumn));
+		Sum = VectorMultiplyAdd(A1, VectorReplicate<1>(BColumn), Sum);
+		Sum = VectorMultiplyAdd(A2, VectorReplicate<2>(BColumn), Sum);
+		Sum = VectorMultiplyAdd(A3, VectorReplicate<3>(BColumn), Sum);
+		VectorStore(Sum, Output + Column * 4);
+	}
+	return Result;
+}
+
+/*static*/ FMatrix4D FSimdMatrix::Transpose(const FMatrix4D& InMatrix)
+{
+	const float* Data = InMatrix.GetData();
+	FVectorRegister4 Column0 = VectorLoad(Data + 0);
+	FVectorRegister4 Column1 = VectorLoad(Data + 4);
+	FVectorRegister4 Column2 = VectorLoad(Data + 8);
+	FVectorRegister4 Column3 = VectorLoad(Data + 12);
+	VectorTranspose4x4(Column0, Column1, Column2, Column3);
+
+	FMatrix4D Result;
+	float* Output = Result.GetData();
+	VectorStore(Column0, Output + 0);
+	VectorStore(Column1, Output + 4);
+	VectorStore(Column2, Output + 8);
+	VectorStore(Column3, Output + 12);
+	return Result;
+}
+
+// Same algorithm as FMatrix4D::GetInverted, with each 3D vector held in a register.
+/*static*/ FMatrix4D FSimdMatrix::Inverse(const FMatrix4D& InMatrix)
+{
+	const float* Data = InMatrix.GetData();
+	// The W lane of each column holds the bottom row of the matrix, and is ignored by VectorCross and VectorDot3.
+	FVectorRegister4 A = VectorLoad(Data + 0);
+	FVectorRegister4 B = VectorLoad(Data + 4);
+	FVectorRegister4 C = VectorLoad(Data + 8);
+	FVectorRegister4 D = VectorLoad(Data + 12);
+	FVectorRegister4 X = VectorReplicate<3>(A);
+	FVectorRegister4 Y = VectorReplicate<3>(B);
+	FVectorRegister4 Z = VectorReplicate<3>(C);
+	FVectorRegister4 W = VectorReplicate<3>(D);
+
+	FVectorRegister4 S = VectorCross(A, B);
+	FVectorRegister4 T = VectorCross(C, D);
+	FVectorRegister4 U = VectorMultiplySubtract(A, Y, VectorMultiply(B, X));
+	FVectorRegister4 V = VectorMultiplySubtract(C, W, VectorMultiply(D, Z));
+
+	FVectorRegister4 InverseDeterminant = VectorReciprocal(VectorAdd(VectorDot3(S, V), VectorDot3(T, U)));
+	S = VectorMultiply(S, InverseDeterminant);
+	T = VectorMultiply(T, InverseDeterminant);
+	U = VectorMultiply(U, InverseDeterminant);
+	V = VectorMultiply(V, InverseDeterminant);
+
+	FVectorRegister4 R0 = VectorMultiplyAdd(T, Y, VectorCross(B, V));
+	FVectorRegister4 R1 = VectorNegateMultiplyAdd(T, X, VectorCross(V, A));
+	FVectorRegister4 R2 = VectorMultiplyAdd(S, W, VectorCross(D, U));
+	FVectorRegister4 R3 = VectorNegateMultiplyAdd(S, Z, VectorCross(U, C));
+
+	R0 = VectorSetW(R0, VectorNegate(VectorDot3(B, T)));
+	R1 = VectorSetW(R1, VectorDot3(A, T));
+	R2 = VectorSetW(R2, VectorNegate(VectorDot3(D, S)));
+	R3 = VectorSetW(R3, VectorDot3(C, S));
+
+	// R0-R3 are the rows of the inverse, so transpose them into columns.
+	VectorTranspose4x4(R0, R1, R2, R3);
+
+	FMatrix4D Result;
+	float* Output = Result.GetData();
+	VectorStore(R0, Output + 0);
+	VectorStore(R1, Output + 4);
+	VectorStore(R2, Output + 8);
+	VectorStore(R3, Output + 12);
+	return Result;
+}
+
+// 3x4 transforms.
+/*static*/ FTransform4D FSimdMatrix::Multiply(const FTransform4D& InA, const FTransform4D& InB)
+{
+	FVectorRegister4 A[4];
+	FVectorRegister4 B[4];
+	LoadColumns(InA, A);
+	LoadColumns(InB, B);
+
+	FVectorRegister4 Columns[4] = {
+		TransformVector(A, B[0]),
+		TransformVector(A, B[1]),
+		TransformVector(A, B[2]),
+		TransformPoint(A, B[3])
+	};
+
+	FTransform4D Result;
+	StoreColumns(Columns, Result);
+	return Result;
+}
+
+// Same algorithm as FTransform4D::GetInverted, with each 3D vector held in a register.
+/*static*/ FTransform4D FSimdMatrix::Inverse(const FTransform4D& InTransform)
+{
+	FVectorRegister4 Columns[4];
+	LoadColumns(InTransform, Columns);
+	const FVectorRegister4 A = Columns[0];
+	const FVectorRegister4 B = Columns[1];
+	const FVectorRegister4 C = Columns[2];
+	const FVectorRegister4 D = Columns[3];
+
+	FVectorRegister4 S = VectorCross(A, B);
+	FVectorRegister4 T = VectorCross(C, D);
+
+	FVectorRegister4 InverseDeterminant = VectorReciprocal(VectorDot3(S, C));
+	S = VectorMultiply(S, InverseDeterminant);
+	T = VectorMultiply(T, InverseDeterminant);
+	FVectorRegister4 V = VectorMultiply(C, InverseDeterminant);
+
+	FVectorRegister4 R0 = VectorCross(B, V);
+	FVectorRegister4 R1 = VectorCross(V, A);
+	FVectorRegister4 R2 = S;
+	FVectorRegister4 R3 = VectorZero();
+
+	R0 = VectorSetW(R0, VectorNegate(VectorDot3(B, T)));
+	R1 = VectorSetW(R1, VectorDot3(A, T));
+	R2 = VectorSetW(R2, VectorNegate(VectorDot3(D, S)));
+
+	// R0-R2 are the rows of the inverse, so transpose them into columns (the implicit fourth row is dropped).
+	VectorTranspose4x4(R0, R1, R2, R3);
+	Columns[0] = R0;
+	Columns[1] = R1;
+	Columns[2] = R2;
+	Columns[3] = R3;
+
+	FTransform4D Result;
+	StoreColumns(Columns, Result);
+	return Result;
+}
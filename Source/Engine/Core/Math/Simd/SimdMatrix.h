@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Simd/VectorRegister.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+#include "Math/Matrix4D.h"
+#include "Math/Transform4D.h"
+
+/**
+ * Vectorized versions of the FMatrix4D and FTransform4D operations.
+ *
+ * Results match the scalar member functions up to floating-point rounding (the vectorized code may
+ * use fused multiply-adds and evaluates sums in a different order). Use these in code that multiplies,
+ * inverts, or applies many matrices per frame.
+ */
+struct FSimdMatrix
+{
+	// 4x4 matrices.
+	static FMatrix4D Multiply(const FMatrix4D& InA, const FMatrix4D& InB);
+	static FMatrix4D Transpose(const FMatrix4D& InMatrix);
+	static FMatrix4D Inverse(const FMatrix4D& InMatrix);
+	static FVector4D Transform(const FMatrix4D& InMatrix, const FVector4D& InVector);
+
+	// 3x4 transforms.
+	static FTransform4D Multiply(const FTransform4D& InA, const FTransform4D& InB);
+	static FTransform4D Inverse(const FTransform4D& InTransform);
+	// Applies rotation, scale, and translation.
+	static FVector3D TransformPoint(const FTransform4D& InTransform, const FVector3D& InPoint);
+	// Applies rotation and scale only, as with FTransform4D::operator*(const FVector3D&).
+	static FVector3D TransformVector(const FTransform4D& InTransform, const FVector3D& InVector);
+
+	// Register-level building blocks, shared with the batch kernels.
+
+	// Loads the four columns of a 3x4 transform. The W lane of each column is zero.
+	static void LoadColumns(const FTransform4D& InTransform, FVectorRegister4 (&OutColumns)[4])
+	{
+		const float* Data = InTransform.GetData();
+		// The first three columns are followed by at least one more float, so they can be loaded 4-wide.
+		OutColumns[0] = VectorBitwiseAnd(VectorLoad(Data + 0), XYZMask());
+		OutColumns[1] = VectorBitwiseAnd(VectorLoad(Data + 3), XYZMask());
+		OutColumns[2] = VectorBitwiseAnd(VectorLoad(Data + 6), XYZMask());
+		OutColumns[3] = VectorLoad3(Data + 9);
+	}
+
+	// Stores the X, Y, and Z lanes of four columns into a 3x4 transform.
+	static void StoreColumns(const FVectorRegister4 (&InColumns)[4], FTransform4D& OutTransform)
+	{
+		float* Data = OutTransform.GetData();
+		// Each 4-wide store writes one float too many, which the next column's store then overwrites.
+		VectorStore(InColumns[0], Data + 0);
+		VectorStore(InColumns[1], Data + 3);
+		VectorStore(InColumns[2], Data + 6);
+		VectorStore3(InColumns[3], Data + 9);
+	}
+
+	// Returns Columns[0] * X + Columns[1] * Y + Columns[2] * Z (+ Columns[3] when transforming points).
+	static FVectorRegister4 TransformPoint(const FVectorRegister4 (&InColumns)[4], FVectorRegister4 InPoint)
+	{
+		FVectorRegister4 Result = VectorMultiplyAdd(InColumns[0], VectorReplicate<0>(InPoint), InColumns[3]);
+		Result = VectorMultiplyAdd(InColumns[1], VectorReplicate<1>(InPoint), Result);
+		return VectorMultiplyAdd(InColumns[2], VectorReplicate<2>(InPoint), Result);
+	}
+
+	static FVectorRegister4 TransformVector(const FVectorRegister4 (&InColumns)[4], FVectorRegister4 InVector)
+	{
+		FVectorRegister4 Result = VectorMultiply(InColumns[0], VectorReplicate<0>(InVector));
+		Result = VectorMultiplyAdd(InColumns[1], VectorReplicate<1>(InVector), Result);
+		return VectorMultiplyAdd(InColumns[2], VectorReplicate<2>(InVector), Result);
+	}
+
+	// Mask that keeps the X, Y, and Z lanes and clears W.
+	static FVectorRegister4 XYZMask()
+	{
+		return VectorCompareNE(VectorSet(1.0f, 1.0f, 1.0f, 0.0f), VectorZero());
+	}
+};
+
+inline FVector3D FSimdMatrix::TransformPoint(const FTransform4D& InTransform, const FVector3D& InPoint)
+{
+	FVectorRegister4 Columns[4];
+	LoadColumns(InTransform, Columns);
+
+	FVector3D Result;
+	VectorStore3(TransformPoint(Columns, VectorLoad3(&InPoint.X)), &Result.X);
+	return Result;
+}
+
+inline FVector3D FSimdMatrix::TransformVector(const FTransform4D& InTransform, const FVector3D& InVector)
+{
+	FVectorRegister4 Columns[4];
+	LoadColumns(InTransform, Columns);
+
+	FVector3D Result;
+	VectorStore3(TransformVector(Columns, VectorLoad3(&InVector.X)), &Result.X);
+	return Result;
+}
+
+inline FVector4D FSimdMatrix::Transform(const FMatrix4D& InMatrix, const FVector4D& InVector)
+{
+	const float* Data = InMatrix.GetData();
+	FVectorRegister4 Vector = VectorLoad(&InVector.X);
+
+	FVectorRegister4 Result = VectorMultiply(VectorLoad(Data + 0), VectorReplicate<0>(Vector));
+	Result = VectorMultiplyAdd(VectorLoad(Data + 4), VectorReplicate<1>(Vector), Result);
+	Result = VectorMultiplyAdd(VectorLoad(Data + 8), VectorReplicate<2>(Vector), Result);
+	Result = VectorMultiplyAdd(VectorLoad(Data + 12), VectorReplicate<3>(Vector), Result);
+
+	FVector4D Output;
+	VectorStore(Result, &Output.X);
+	return Output;
+}
@@ -0,0 +1,265 @@
+#include "TransformBatch.h"
+#include "Math/Simd/VectorRegister8.h"
+#include "Math/Simd/SimdMatrix.h"
+#include "Math/Simd/VectorMath.h"
+#include "Math/MathUtilities.h"
+
+static_assert(sizeof(FVector3D) == 3 * sizeof(float), "The array kernels assume FVector3D is three packed floats.");
+static_assert(sizeof(FTransform4D) == 12 * sizeof(float), "The array kernels assume FTransform4D is twelve packed floats.");
+
+// Splats every element of a transform into its own 8-wide register, indexed like FTransform4D::GetData.
+static void SplatTransform(const FTransform4D& InTransform, FVectorRegister8 (&OutElements)[12])
+{
+	const float* Data = InTransform.GetData();
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		OutElements[Index] = Vector8Splat(Data[Index]);
+	}
+}
+
+static void SplatTransform(const FTransform4D& InTransform, FVectorRegister4 (&OutElements)[12])
+{
+	const float* Data = InTransform.GetData();
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		OutElements[Index] = VectorSplat(Data[Index]);
+	}
+}
+
+/**
+ * Transforms vectors held one component per register. M holds the transform's elements (see SplatTransform),
+ * and the translation is only added when transforming points.
+ */
+template<typename RegisterType, bool bIsPoint>
+static void TransformComponents(const RegisterType (&M)[12], RegisterType& InOutX, RegisterType& InOutY, RegisterType& InOutZ)
+{
+	RegisterType X = InOutX;
+	RegisterType Y = InOutY;
+	RegisterType Z = InOutZ;
+	if (bIsPoint)
+	{
+		InOutX = VectorMultiplyAdd(M[0], X, M[9]);
+		InOutY = VectorMultiplyAdd(M[1], X, M[10]);
+		InOutZ = VectorMultiplyAdd(M[2], X, M[11]);
+	}
+	else
+	{
+		InOutX = VectorMultiply(M[0], X);
+		InOutY = VectorMultiply(M[1], X);
+		InOutZ = VectorMultiply(M[2], X);
+	}
+	InOutX = VectorMultiplyAdd(M[3], Y, InOutX);
+	InOutY = VectorMultiplyAdd(M[4], Y, InOutY);
+	InOutZ = VectorMultiplyAdd(M[5], Y, InOutZ);
+	InOutX = VectorMultiplyAdd(M[6], Z, InOutX);
+	InOutY = VectorMultiplyAdd(M[7], Z, InOutY);
+	InOutZ = VectorMultiplyAdd(M[8], Z, InOutZ);
+}
+
+// Transforms a single vector, for the elements left over after the vectorized loop.
+template<bool bIsPoint>
+static FVector3D TransformRemainder(const FVectorRegister4 (&InColumns)[4], const FVector3D& InVector)
+{
+	FVectorRegister4 Vector = VectorLoad3(&InVector.X);
+	FVector3D Result;
+	VectorStore3(bIsPoint ? FSimdMatrix::TransformPoint(InColumns, Vector) : FSimdMatrix::TransformVector(InColumns, Vector), &Result.X);
+	return Result;
+}
+
+template<bool bIsPoint>
+static void TransformStreams(const FTransform4D& InTransform, FConstVector3DStreams InVectors, FVector3DStreams OutVectors, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FVectorRegister8 M[12];
+	SplatTransform(InTransform, M);
+
+	int32 Index = 0;
+	for (; Index + VectorRegister8Lanes <= InCount; Index += VectorRegister8Lanes)
+	{
+		FVectorRegister8 X = Vector8Load(InVectors.X + Index);
+		FVectorRegister8 Y = Vector8Load(InVectors.Y + Index);
+		FVectorRegister8 Z = Vector8Load(InVectors.Z + Index);
+		TransformComponents<FVectorRegister8, bIsPoint>(M, X, Y, Z);
+		Vector8Store(X, OutVectors.X + Index);
+		Vector8Store(Y, OutVectors.Y + Index);
+		Vector8Store(Z, OutVectors.Z + Index);
+	}
+
+	FVectorRegister4 Columns[4];
+	FSimdMatrix::LoadColumns(InTransform, Columns);
+	for (; Index < InCount; ++Index)
+	{
+		FVector3D Result = TransformRemainder<bIsPoint>(Columns, FVector3D(InVectors.X[Index], InVectors.Y[Index], InVectors.Z[Index]));
+		OutVectors.X[Index] = Result.X;
+		OutVectors.Y[Index] = Result.Y;
+		OutVectors.Z[Index] = Result.Z;
+	}
+}
+
+template<bool bIsPoint>
+static void TransformArray(const FTransform4D& InTransform, const FVector3D* InVectors, FVector3D* OutVectors, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FVectorRegister4 M[12];
+	SplatTransform(InTransform, M);
+
+	int32 Index = 0;
+	for (; Index + VectorRegister4Lanes <= InCount; Index += VectorRegister4Lanes)
+	{
+		// Four packed vectors fill exactly three registers.
+		const float* Input = &InVectors[Index].X;
+		FVectorRegister4 X, Y, Z;
+		VectorDeinterleave3(VectorLoad(Input), VectorLoad(Input + 4), VectorLoad(Input + 8), X, Y, Z);
+		TransformComponents<FVectorRegister4, bIsPoint>(M, X, Y, Z);
+
+		FVectorRegister4 A, B, C;
+		VectorInterleave3(X, Y, Z, A, B, C);
+		float* Output = &OutVectors[Index].X;
+		VectorStore(A, Output);
+		VectorStore(B, Output + 4);
+		VectorStore(C, Output + 8);
+	}
+
+	FVectorRegister4 Columns[4];
+	FSimdMatrix::LoadColumns(InTransform, Columns);
+	for (; Index < InCount; ++Index)
+	{
+		OutVectors[Index] = TransformRemainder<bIsPoint>(Columns, InVectors[Index]);
+	}
+}
+
+/*static*/ void FTransformBatch::TransformPoints(const FTransform4D& InTransform, FConstVector3DStreams InPoints, FVector3DStreams OutPoints, int32 InCount)
+{
+	TransformStreams<true>(InTransform, InPoints, OutPoints, InCount);
+}
+
+/*static*/ void FTransformBatch::TransformPoints(const FTransform4D& InTransform, const FVector3D* InPoints, FVector3D* OutPoints, int32 InCount)
+{
+	TransformArray<true>(InTransform, InPoints, OutPoints, InCount);
+}
+
+/*static*/ void FTransformBatch::TransformVectors(const FTransform4D& InTransform, FConstVector3DStreams InVectors, FVector3DStreams OutVectors, int32 InCount)
+{
+	TransformStreams<false>(InTransform, InVectors, OutVectors, InCount);
+}
+
+/*static*/ void FTransformBatch::TransformVectors(const FTransform4D& InTransform, const FVector3D* InVectors, FVector3D* OutVectors, int32 InCount)
+{
+	TransformArray<false>(InTransform, InVectors, OutVectors, InCount);
+}
+
+/*static*/ void FTransformBatch::MultiplyTransforms(const FTransform4D& InTransform, const FTransform4D* InTransforms, FTransform4D* OutTransforms, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	FVectorRegister4 Left[4];
+	FSimdMatrix::LoadColumns(InTransform, Left);
+
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		FVectorRegister4 Right[4];
+		FSimdMatrix::LoadColumns(InTransforms[Index], Right);
+
+		FVectorRegister4 Columns[4] = {
+			FSimdMatrix::TransformVector(Left, Right[0]),
+			FSimdMatrix::TransformVector(Left, Right[1]),
+			FSimdMatrix::TransformVector(Left, Right[2]),
+			FSimdMatrix::TransformPoint(Left, Right[3])
+		};
+		FSimdMatrix::StoreColumns(Columns, OutTransforms[Index]);
+	}
+}
+
+/**
+ * The columns of RZ * RY * RX, scaled by S, are:
+ *   (CZ*CY, SZ*CY, -SY) * S.X
+ *   (CZ*SY*SX - SZ*CX, SZ*SY*SX + CZ*CX, CY*SX) * S.Y
+ *   (CZ*SY*CX + SZ*SX, SZ*SY*CX - CZ*SX, CY*CX) * S.Z
+ * This is evaluated for four transforms at once, one transform per lane.
+ */
+/*static*/ void FTransformBatch::ComposeTransforms(FConstVector3DStreams InTranslations, FConstVector3DStreams InRotations, FConstVector3DStreams InScales, FTransform4D* OutTransforms, int32 InCount)
+{
+	ensure(InCount >= 0);
+
+	// The remainder is padded with zero components and written through a temporary.
+	for (int32 Index = 0; Index < InCount; Index += VectorRegister4Lanes)
+	{
+		int32 NumLanes = FMath::Min(InCount - Index, VectorRegister4Lanes);
+
+		// Rotations, scales, and translations, one register per component.
+		FVectorRegister4 Components[9];
+		if (NumLanes == VectorRegister4Lanes)
+		{
+			const float* Sources[9] = {
+				InRotations.X, InRotations.Y, InRotations.Z,
+				InScales.X, InScales.Y, InScales.Z,
+				InTranslations.X, InTranslations.Y, InTranslations.Z
+			};
+			for (int32 Component = 0; Component < 9; ++Component)
+			{
+				Components[Component] = VectorLoad(Sources[Component] + Index);
+			}
+		}
+		else
+		{
+			alignas(16) float Padded[9][VectorRegister4Lanes] = {};
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+			{
+				Padded[0][Lane] = InRotations.X[Index + Lane];
+				Padded[1][Lane] = InRotations.Y[Index + Lane];
+				Padded[2][Lane] = InRotations.Z[Index + Lane];
+				Padded[3][Lane] = InScales.X[Index + Lane];
+				Padded[4][Lane] = InScales.Y[Index + Lane];
+				Padded[5][Lane] = InScales.Z[Index + Lane];
+				Padded[6][Lane] = InTranslations.X[Index + Lane];
+				Padded[7][Lane] = InTranslations.Y[Index + Lane];
+				Padded[8][Lane] = InTranslations.Z[Index + Lane];
+			}
+			for (int32 Component = 0; Component < 9; ++Component)
+			{
+				Components[Component] = VectorLoad(Padded[Component]);
+			}
+		}
+
+		FVectorRegister4 SX, CX, SY, CY, SZ, CZ;
+		VectorSinCos(Components[0], SX, CX);
+		VectorSinCos(Components[1], SY, CY);
+		VectorSinCos(Components[2], SZ, CZ);
+		FVectorRegister4 ScaleX = Components[3];
+		FVectorRegister4 ScaleY = Components[4];
+		FVectorRegister4 ScaleZ = Components[5];
+
+		FVectorRegister4 CZSY = VectorMultiply(CZ, SY);
+		FVectorRegister4 SZSY = VectorMultiply(SZ, SY);
+
+		// Elements indexed like FTransform4D::GetData, one transform per lane.
+		FVectorRegister4 E[12];
+		E[0] = VectorMultiply(VectorMultiply(CZ, CY), ScaleX);
+		E[1] = VectorMultiply(VectorMultiply(SZ, CY), ScaleX);
+		E[2] = VectorNegate(VectorMultiply(SY, ScaleX));
+		E[3] = VectorMultiply(VectorMultiplySubtract(CZSY, SX, VectorMultiply(SZ, CX)), ScaleY);
+		E[4] = VectorMultiply(VectorMultiplyAdd(SZSY, SX, VectorMultiply(CZ, CX)), ScaleY);
+		E[5] = VectorMultiply(VectorMultiply(CY, SX), ScaleY);
+		E[6] = VectorMultiply(VectorMultiplyAdd(CZSY, CX, VectorMultiply(SZ, SX)), ScaleZ);
+		E[7] = VectorMultiply(VectorMultiplySubtract(SZSY, CX, VectorMultiply(CZ, SX)), ScaleZ);
+		E[8] = VectorMultiply(VectorMultiply(CY, CX), ScaleZ);
+		E[9] = Components[6];
+		E[10] = Components[7];
+		E[11] = Components[8];
+
+		// Transposing each group of four elements gives four consecutive floats of each transform.
+		VectorTranspose4x4(E[0], E[1], E[2], E[3]);
+		VectorTranspose4x4(E[4], E[5], E[6], E[7]);
+		VectorTranspose4x4(E[8], E[9], E[10], E[11]);
+
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			float* Output = OutTransforms[Index + Lane].GetData();
+			VectorStore(E[Lane], Output);
+			VectorStore(E[4 + Lane], Output + 4);
+			VectorStore(E[8 + Lane], Output + 8);
+		}
+	}
+}
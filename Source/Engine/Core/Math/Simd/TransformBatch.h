@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Vector3D.h"
+#include "Math/Transform4D.h"
+
+/**
+ * A structure-of-arrays view of 3D vectors, where each component is stored in its own array.
+ * FloatType is either float (for outputs) or const float (for inputs).
+ */
+template<typename FloatType>
+struct TVector3DStreams
+{
+	TVector3DStreams(FloatType* InX, FloatType* InY, FloatType* InZ)
+		: X(InX)
+		, Y(InY)
+		, Z(InZ)
+	{
+	}
+
+	// Allows passing mutable streams where read-only streams are expected.
+	template<typename OtherFloatType>
+	TVector3DStreams(const TVector3DStreams<OtherFloatType>& InStreams)
+		: X(InStreams.X)
+		, Y(InStreams.Y)
+		, Z(InStreams.Z)
+	{
+	}
+
+	// Returns the streams advanced by InOffset elements.
+	TVector3DStreams operator+(int32 InOffset) const
+	{
+		return TVector3DStreams(X + InOffset, Y + InOffset, Z + InOffset);
+	}
+
+	FloatType* X;
+	FloatType* Y;
+	FloatType* Z;
+};
+
+using FVector3DStreams = TVector3DStreams<float>;
+using FConstVector3DStreams = TVector3DStreams<const float>;
+
+/**
+ * Vectorized kernels that apply a transform to many elements at once, for code that would otherwise
+ * loop over FTransform4D::operator* (bounding boxes, light positions, skinning, etc.).
+ *
+ * Kernels over streams (structure-of-arrays) process 8 elements per iteration, and kernels over arrays
+ * (array-of-structures) process 4, except MultiplyTransforms which keeps each column of one transform
+ * in a register. Remaining elements go through the same math one at a time.
+ *
+ * Every kernel is a pure function of its inputs, so a large batch can be split into ranges (using
+ * Streams + Offset or plain pointer offsets) and processed on several threads, as long as the output
+ * ranges don't overlap. Outputs may alias their inputs exactly.
+ */
+struct FTransformBatch
+{
+	// Points are transformed by rotation, scale, and translation.
+	static void TransformPoints(const FTransform4D& InTransform, FConstVector3DStreams InPoints, FVector3DStreams OutPoints, int32 InCount);
+	static void TransformPoints(const FTransform4D& InTransform, const FVector3D* InPoints, FVector3D* OutPoints, int32 InCount);
+
+	// Vectors (directions) are transformed by rotation and scale only.
+	static void TransformVectors(const FTransform4D& InTransform, FConstVector3DStreams InVectors, FVector3DStreams OutVectors, int32 InCount);
+	static void TransformVectors(const FTransform4D& InTransform, const FVector3D* InVectors, FVector3D* OutVectors, int32 InCount);
+
+	// Computes OutTransforms[i] = InTransform * InTransforms[i], e.g. to move many local transforms into a parent's space.
+	static void MultiplyTransforms(const FTransform4D& InTransform, const FTransform4D* InTransforms, FTransform4D* OutTransforms, int32 InCount);
+
+	/**
+	 * Builds world transforms from translation, rotation, and scale components, matching
+	 * FModel::GetWorldTransform: T * RZ * RY * RX * S. Rotations are Euler angles in radians.
+	 */
+	static void ComposeTransforms(FConstVector3DStreams InTranslations, FConstVector3DStreams InRotations, FConstVector3DStreams InScales, FTransform4D* OutTransforms, int32 InCount);
+};
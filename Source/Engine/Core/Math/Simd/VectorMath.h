@@ -0,0 +1,227 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Math/Simd/VectorRegister.h"
+#include "Math/Simd/VectorRegister8.h"
+#include "Math/MathUtilities.h"
+
+/**
+ * Vectorized approximations of transcendental functions, for FVectorRegister4 and FVectorRegister8.
+ *
+ * The functions are polynomial approximations with Cody-Waite range reduction (adapted from the Cephes
+ * single-precision library). Maximum errors below are measured against the correctly rounded result over
+ * the stated input range, in units in the last place (ULP); outside the stated ranges results stay finite
+ * but lose accuracy. Denormal inputs and results are not handled specially.
+ *
+ *   VectorSin, VectorCos, VectorSinCos   2 ULP      |X| <= 8192 (absolute error below 1e-10 where |result| < 1e-3)
+ *   VectorAtan2                          3 ULP      finite X and Y, returns 0 when both are zero
+ *   VectorExp                            2 ULP      X in [-87.3, 88.3] (inputs are clamped to this range)
+ *   VectorLog                            2 ULP      positive normal X; returns -inf for 0 and NaN for X < 0
+ *   VectorPow                           16 ULP      X > 0 and |Y * log(X)| <= 10; returns 0 when X is 0
+ *   VectorReciprocalSqrtFast             4 ULP      positive normal X
+ *
+ * FMath::FastAtan2 is a scalar version of VectorAtan2, with the same error bound.
+ */
+
+// Tags naming the register types. The register types can be compiler vector types, whose attributes are
+// dropped when they are used as template arguments, so the traits below are specialized on the tags instead.
+struct FVectorRegister4Tag
+{
+};
+
+struct FVectorRegister8Tag
+{
+};
+
+// Maps a register type to its tag. Only used in unevaluated contexts.
+FVectorRegister4Tag GetVectorRegisterTag(FVectorRegister4);
+FVectorRegister8Tag GetVectorRegisterTag(FVectorRegister8);
+
+// Per-register-type helpers that can't be written as overloads, looked up with TVectorRegisterTraitsOf.
+template<typename TagType>
+struct TVectorRegisterTraits;
+
+template<>
+struct TVectorRegisterTraits<FVectorRegister4Tag>
+{
+	static FVectorRegister4 Splat(float InValue)
+	{
+		return VectorSplat(InValue);
+	}
+
+	static FVectorRegister4 SplatInt(int32 InValue)
+	{
+		return VectorSplatInt(InValue);
+	}
+};
+
+template<>
+struct TVectorRegisterTraits<FVectorRegister8Tag>
+{
+	static FVectorRegister8 Splat(float InValue)
+	{
+		return Vector8Splat(InValue);
+	}
+
+	static FVectorRegister8 SplatInt(int32 InValue)
+	{
+		return Vector8SplatInt(InValue);
+	}
+};
+
+template<typename RegisterType>
+using TVectorRegisterTraitsOf = TVectorRegisterTraits<decltype(GetVectorRegisterTag(RegisterType()))>;
+
+// Evaluates C0 + C1 * X + C2 * X^2 + ... using Horner's method.
+template<typename RegisterType>
+inline RegisterType VectorPolynomial(RegisterType /* InX */, float InCoefficient)
+{
+	return TVectorRegisterTraitsOf<RegisterType>::Splat(InCoefficient);
+}
+
+template<typename RegisterType, typename... CoefficientTypes>
+inline RegisterType VectorPolynomial(RegisterType InX, float InCoefficient, CoefficientTypes... InCoefficients)
+{
+	// The remaining coefficients form a polynomial one degree lower.
+	return VectorMultiplyAdd(VectorPolynomial(InX, InCoefficients...), InX, TVectorRegisterTraitsOf<RegisterType>::Splat(InCoefficient));
+}
+
+template<typename RegisterType>
+inline void VectorSinCos(RegisterType InAngle, RegisterType& OutSin, RegisterType& OutCos)
+{
+	using Traits = TVectorRegisterTraitsOf<RegisterType>;
+
+	// Reduce the angle to R in [-Pi/4, Pi/4], with Angle = R + Quadrant * Pi/2. Pi/2 is split into three
+	// parts so that Quadrant * Part is exact for the first two.
+	RegisterType Quadrant = VectorRound(VectorMultiply(InAngle, Traits::Splat(0.636619772367581343f)));
+	RegisterType R = VectorNegateMultiplyAdd(Quadrant, Traits::Splat(1.5703125f), InAngle);
+	R = VectorNegateMultiplyAdd(Quadrant, Traits::Splat(4.837512969970703125e-4f), R);
+	R = VectorNegateMultiplyAdd(Quadrant, Traits::Splat(7.54978995489188216e-8f), R);
+
+	RegisterType R2 = VectorMultiply(R, R);
+	RegisterType SinR = VectorMultiplyAdd(VectorMultiply(R, R2), VectorPolynomial(R2, -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f), R);
+	RegisterType CosR = VectorMultiplyAdd(VectorMultiply(R2, R2), VectorPolynomial(R2, 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f), VectorNegateMultiplyAdd(R2, Traits::Splat(0.5f), Traits::Splat(1.0f)));
+
+	// Odd quadrants swap sin and cos. Sin is negated in quadrants 2 and 3, and cos in quadrants 1 and 2.
+	RegisterType QuadrantInt = VectorFloatToInt(Quadrant);
+	RegisterType One = Traits::SplatInt(1);
+	RegisterType Two = Traits::SplatInt(2);
+	RegisterType SwapMask = VectorIntCompareEQ(VectorBitwiseAnd(QuadrantInt, One), One);
+	RegisterType SinSign = VectorIntShiftLeft<30>(VectorBitwiseAnd(QuadrantInt, Two));
+	RegisterType CosSign = VectorIntShiftLeft<30>(VectorBitwiseAnd(VectorIntAdd(QuadrantInt, One), Two));
+
+	OutSin = VectorBitwiseXor(VectorSelect(SwapMask, CosR, SinR), SinSign);
+	OutCos = VectorBitwiseXor(VectorSelect(SwapMask, SinR, CosR), CosSign);
+}
+
+template<typename RegisterType>
+inline RegisterType VectorSin(RegisterType InAngle)
+{
+	RegisterType Sin, Cos;
+	VectorSinCos(InAngle, Sin, Cos);
+	return Sin;
+}
+
+template<typename RegisterType>
+inline RegisterType VectorCos(RegisterType InAngle)
+{
+	RegisterType Sin, Cos;
+	VectorSinCos(InAngle, Sin, Cos);
+	return Cos;
+}
+
+template<typename RegisterType>
+inline RegisterType VectorAtan2(RegisterType InY, RegisterType InX)
+{
+	using Traits = TVectorRegisterTraitsOf<RegisterType>;
+
+	// Compute atan(Min / Max) in [0, Pi/4], then use the symmetries of atan2 to find the right octant.
+	RegisterType AbsX = VectorAbs(InX);
+	RegisterType AbsY = VectorAbs(InY);
+	RegisterType Max = VectorMax(AbsX, AbsY);
+	RegisterType Ratio = VectorDivide(VectorMin(AbsX, AbsY), Max);
+
+	// Above tan(Pi/8), use atan(A) = Pi/4 + atan((A - 1) / (A + 1)).
+	RegisterType One = Traits::Splat(1.0f);
+	RegisterType IsLarge = VectorCompareGT(Ratio, Traits::Splat(0.414213562373095f));
+	RegisterType Reduced = VectorSelect(IsLarge, VectorDivide(VectorSubtract(Ratio, One), VectorAdd(Ratio, One)), Ratio);
+	RegisterType Offset = VectorBitwiseAnd(IsLarge, Traits::Splat(FMath::PiOverFour));
+
+	RegisterType Z = VectorMultiply(Reduced, Reduced);
+	RegisterType Polynomial = VectorPolynomial(Z, -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f, 8.05374449538e-2f);
+	RegisterType Result = VectorAdd(VectorMultiplyAdd(VectorMultiply(Polynomial, Z), Reduced, Reduced), Offset);
+
+	Result = VectorSelect(VectorCompareGT(AbsY, AbsX), VectorSubtract(Traits::Splat(FMath::PiOverTwo), Result), Result);
+	Result = VectorSelect(VectorCompareLT(InX, Traits::Splat(0.0f)), VectorSubtract(Traits::Splat(FMath::Pi), Result), Result);
+	Result = VectorBitwiseAndNot(Result, VectorCompareEQ(Max, Traits::Splat(0.0f)));
+
+	// Result is non-negative here, so copying the sign of Y gives the lower half-plane.
+	RegisterType SignMask = Traits::SplatInt(static_cast<int32>(0x80000000u));
+	return VectorBitwiseOr(Result, VectorBitwiseAnd(InY, SignMask));
+}
+
+template<typename RegisterType>
+inline RegisterType VectorExp(RegisterType InX)
+{
+	using Traits = TVectorRegisterTraitsOf<RegisterType>;
+
+	// The bounds keep 2^N a normal float.
+	RegisterType X = VectorClamp(InX, Traits::Splat(-87.3365447505531f), Traits::Splat(88.3762626647949f));
+
+	// Exp(X) = 2^N * Exp(R), with N = round(X / Ln2) and R = X - N * Ln2 in [-Ln2/2, Ln2/2].
+	RegisterType N = VectorRound(VectorMultiply(X, Traits::Splat(1.44269504088896341f)));
+	RegisterType R = VectorNegateMultiplyAdd(N, Traits::Splat(0.693359375f), X);
+	R = VectorNegateMultiplyAdd(N, Traits::Splat(-2.12194440e-4f), R);
+
+	RegisterType Polynomial = VectorPolynomial(R, 5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f, 8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f);
+	RegisterType ExpR = VectorAdd(VectorMultiplyAdd(VectorMultiply(Polynomial, R), R, R), Traits::Splat(1.0f));
+
+	// Build 2^N directly from its exponent bits.
+	RegisterType Scale = VectorIntShiftLeft<23>(VectorIntAdd(VectorFloatToInt(N), Traits::SplatInt(127)));
+	return VectorMultiply(ExpR, Scale);
+}
+
+template<typename RegisterType>
+inline RegisterType VectorLog(RegisterType InX)
+{
+	using Traits = TVectorRegisterTraitsOf<RegisterType>;
+	RegisterType One = Traits::Splat(1.0f);
+
+	// Split X into Mantissa * 2^Exponent, with the mantissa in [0.5, 1).
+	RegisterType Exponent = VectorIntToFloat(VectorIntSubtract(VectorIntShiftRight<23>(InX), Traits::SplatInt(126)));
+	RegisterType Mantissa = VectorBitwiseOr(VectorBitwiseAnd(InX, Traits::SplatInt(0x007FFFFF)), Traits::SplatInt(0x3F000000));
+
+	// Shift the mantissa into [sqrt(0.5), sqrt(2)) and subtract one, so the polynomial is centered on zero.
+	RegisterType IsSmall = VectorCompareLT(Mantissa, Traits::Splat(0.707106781186547524f));
+	Exponent = VectorSubtract(Exponent, VectorBitwiseAnd(IsSmall, One));
+	RegisterType M = VectorAdd(VectorSubtract(Mantissa, One), VectorBitwiseAnd(IsSmall, Mantissa));
+
+	RegisterType Z = VectorMultiply(M, M);
+	RegisterType Polynomial = VectorPolynomial(M, 3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f, -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f, 1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f);
+	RegisterType Y = VectorMultiply(VectorMultiply(Polynomial, M), Z);
+	Y = VectorMultiplyAdd(Exponent, Traits::Splat(-2.12194440e-4f), Y);
+	Y = VectorNegateMultiplyAdd(Z, Traits::Splat(0.5f), Y);
+	RegisterType Result = VectorMultiplyAdd(Exponent, Traits::Splat(0.693359375f), VectorAdd(M, Y));
+
+	// Bit patterns of -infinity and NaN.
+	RegisterType Zero = Traits::Splat(0.0f);
+	Result = VectorSelect(VectorCompareEQ(InX, Zero), Traits::SplatInt(static_cast<int32>(0xFF800000u)), Result);
+	return VectorSelect(VectorCompareLT(InX, Zero), Traits::SplatInt(0x7FC00000), Result);
+}
+
+template<typename RegisterType>
+inline RegisterType VectorPow(RegisterType InBase, RegisterType InExponent)
+{
+	RegisterType Result = VectorExp(VectorMultiply(InExponent, VectorLog(InBase)));
+	return VectorBitwiseAndNot(Result, VectorCompareEQ(InBase, TVectorRegisterTraitsOf<RegisterType>::Splat(0.0f)));
+}
+
+// 1 / sqrt(X) from the hardware estimate, refined with one Newton-Raphson step.
+template<typename RegisterType>
+inline RegisterType VectorReciprocalSqrtFast(RegisterType InX)
+{
+	using Traits = TVectorRegisterTraitsOf<RegisterType>;
+	RegisterType Estimate = VectorReciprocalSqrtEstimate(InX);
+	RegisterType HalfXEstimate = VectorMultiply(VectorMultiply(Traits::Splat(0.5f), InX), Estimate);
+	return VectorMultiply(Estimate, VectorNegateMultiplyAdd(HalfXEstimate, Estimate, Traits::Splat(1.5f)));
+}
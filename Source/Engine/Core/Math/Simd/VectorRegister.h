@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+/**
+ * Portable 4-wide float vector registers.
+ *
+ * The instruction set is chosen at compile time from the flags the compiler was invoked with:
+ * SSE2 on x86/x64 (which every x64 target supports), NEON on ARM, and a plain float[4] fallback
+ * everywhere else. Defining MATH_SIMD_FORCE_SCALAR selects the fallback regardless of the target,
+ * which is useful for validating vectorized code paths against a known-good implementation.
+ *
+ * Every backend provides the same set of free functions operating on FVectorRegister4:
+ *   Creation:    VectorZero, VectorSet, VectorSplat, VectorLoad, VectorLoad3, VectorStore, VectorStore3
+ *   Swizzles:    VectorReplicate<Index>, VectorSwizzle<X, Y, Z, W>, VectorShuffle<X, Y, Z, W>, VectorGetComponent
+ *   Arithmetic:  VectorAdd, VectorSubtract, VectorMultiply, VectorDivide, VectorMultiplyAdd, VectorNegate,
+ *                VectorAbs, VectorMin, VectorMax, VectorSqrt, VectorReciprocal, VectorReciprocalSqrt
+ *   Comparisons: VectorCompareEQ/NE/GT/GE/LT/LE (producing all-ones or all-zeros lane masks), VectorSelect,
+ *                VectorBitwiseAnd/Or/Xor/AndNot, VectorMaskBits
+ *   Rounding:    VectorRound, VectorReciprocalSqrtEstimate
+ *   Integers:    VectorSplatInt, VectorFloatToInt, VectorIntToFloat, VectorIntAdd, VectorIntSubtract,
+ *                VectorIntCompareEQ, VectorIntShiftLeft<Bits>, VectorIntShiftRight<Bits>
+ *
+ * Functions built on top of those (dot and cross products, transposes, etc.) live in this file and
+ * are shared by all backends. The 8-wide equivalents live in VectorRegister8.h.
+ */
+
+#if defined(MATH_SIMD_FORCE_SCALAR)
+	#define MATH_SIMD_SCALAR 1
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MATH_SIMD_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define MATH_SIMD_NEON 1
+#else
+	#define MATH_SIMD_SCALAR 1
+#endif
+
+#if defined(MATH_SIMD_SSE)
+	#include "Math/Simd/VectorRegisterSSE.h"
+#elif defined(MATH_SIMD_NEON)
+	#include "Math/Simd/VectorRegisterNEON.h"
+#else
+	#include "Math/Simd/VectorRegisterScalar.h"
+#endif
+
+// Number of float lanes in FVectorRegister4.
+static constexpr int32 VectorRegister4Lanes = 4;
+
+// Returns A * B - C.
+inline FVectorRegister4 VectorMultiplySubtract(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC)
+{
+	return VectorSubtract(VectorMultiply(InA, InB), InC);
+}
+
+// Returns C - A * B.
+inline FVectorRegister4 VectorNegateMultiplyAdd(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC)
+{
+	return VectorSubtract(InC, VectorMultiply(InA, InB));
+}
+
+// Returns A + (B - A) * Alpha.
+inline FVectorRegister4 VectorLerp(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InAlpha)
+{
+	return VectorMultiplyAdd(VectorSubtract(InB, InA), InAlpha, InA);
+}
+
+inline FVectorRegister4 VectorClamp(FVectorRegister4 InValue, FVectorRegister4 InMin, FVectorRegister4 InMax)
+{
+	return VectorMin(VectorMax(InValue, InMin), InMax);
+}
+
+// Dot product of the X, Y, and Z lanes, replicated to all four lanes.
+inline FVectorRegister4 VectorDot3(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	FVectorRegister4 Product = VectorMultiply(InA, InB);
+	FVectorRegister4 Sum = VectorAdd(VectorReplicate<0>(Product), VectorReplicate<1>(Product));
+	return VectorAdd(Sum, VectorReplicate<2>(Product));
+}
+
+// Dot product of all four lanes, replicated to all four lanes.
+inline FVectorRegister4 VectorDot4(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	FVectorRegister4 Product = VectorMultiply(InA, InB);
+	// (X+Z, Y+W, Z+X, W+Y), then add the swapped pairs.
+	FVectorRegister4 Sum = VectorAdd(Product, VectorSwizzle<2, 3, 0, 1>(Product));
+	return VectorAdd(Sum, VectorSwizzle<1, 0, 3, 2>(Sum));
+}
+
+// Cross product of the X, Y, and Z lanes. The W lane of the result is zero when both inputs have the same W.
+inline FVectorRegister4 VectorCross(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	FVectorRegister4 AYZX = VectorSwizzle<1, 2, 0, 3>(InA);
+	FVectorRegister4 BYZX = VectorSwizzle<1, 2, 0, 3>(InB);
+	// A x B = (A * B.yzx - A.yzx * B).yzx
+	FVectorRegister4 Result = VectorSubtract(VectorMultiply(InA, BYZX), VectorMultiply(AYZX, InB));
+	return VectorSwizzle<1, 2, 0, 3>(Result);
+}
+
+// Transposes four registers holding the rows (or columns) of a 4x4 matrix in place.
+inline void VectorTranspose4x4(FVectorRegister4& InOutRow0, FVectorRegister4& InOutRow1, FVectorRegister4& InOutRow2, FVectorRegister4& InOutRow3)
+{
+	// (R0.x, R0.y, R1.x, R1.y), (R0.z, R0.w, R1.z, R1.w), ...
+	FVectorRegister4 Temp0 = VectorShuffle<0, 1, 0, 1>(InOutRow0, InOutRow1);
+	FVectorRegister4 Temp1 = VectorShuffle<2, 3, 2, 3>(InOutRow0, InOutRow1);
+	FVectorRegister4 Temp2 = VectorShuffle<0, 1, 0, 1>(InOutRow2, InOutRow3);
+	FVectorRegister4 Temp3 = VectorShuffle<2, 3, 2, 3>(InOutRow2, InOutRow3);
+
+	InOutRow0 = VectorShuffle<0, 2, 0, 2>(Temp0, Temp2);
+	InOutRow1 = VectorShuffle<1, 3, 1, 3>(Temp0, Temp2);
+	InOutRow2 = VectorShuffle<0, 2, 0, 2>(Temp1, Temp3);
+	InOutRow3 = VectorShuffle<1, 3, 1, 3>(Temp1, Temp3);
+}
+
+/**
+ * Converts four packed 3D vectors (12 consecutive floats: x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into
+ * one register per component.
+ */
+inline void VectorDeinterleave3(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC, FVectorRegister4& OutX, FVectorRegister4& OutY, FVectorRegister4& OutZ)
+{
+	OutX = VectorShuffle<0, 3, 0, 2>(InA, VectorShuffle<2, 2, 1, 1>(InB, InC));
+	OutY = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 0, 0>(InA, InB), VectorShuffle<3, 3, 2, 2>(InB, InC));
+	OutZ = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 1, 1>(InA, InB), VectorShuffle<0, 0, 3, 3>(InC, InC));
+}
+
+// Inverse of VectorDeinterleave3.
+inline void VectorInterleave3(FVectorRegister4 InX, FVectorRegister4 InY, FVectorRegister4 InZ, FVectorRegister4& OutA, FVectorRegister4& OutB, FVectorRegister4& OutC)
+{
+	OutA = VectorShuffle<0, 2, 0, 2>(VectorShuffle<0, 0, 0, 0>(InX, InY), VectorShuffle<0, 0, 1, 1>(InZ, InX));
+	OutB = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 1, 1>(InY, InZ), VectorShuffle<2, 2, 2, 2>(InX, InY));
+	OutC = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 3, 3>(InZ, InX), VectorShuffle<3, 3, 3, 3>(InY, InZ));
+}
+
+// Returns true if any lane of the mask is set.
+inline bool VectorAnyTrue(FVectorRegister4 InMask)
+{
+	return VectorMaskBits(InMask) != 0;
+}
+
+// Returns true if every lane of the mask is set.
+inline bool VectorAllTrue(FVectorRegister4 InMask)
+{
+	return VectorMaskBits(InMask) == 0xF;
+}
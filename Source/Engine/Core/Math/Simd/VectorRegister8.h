@@ -0,0 +1,400 @@
+#pragma once
+
+#include "Math/Simd/VectorRegister.h"
+
+/**
+ * Portable 8-wide float vector registers, for kernels that process data in structure-of-arrays form.
+ *
+ * Maps to a single AVX register when the compiler targets AVX, and to a pair of FVectorRegister4
+ * otherwise. Element-wise functions share their names with the 4-wide versions (VectorAdd, VectorSelect,
+ * etc.) so that kernels can be written once as templates over the register type. Functions that can't be
+ * overloaded on their arguments use a Vector8 prefix (Vector8Zero, Vector8Splat, Vector8SplatInt, Vector8Load,
+ * Vector8Store).
+ */
+
+#if defined(MATH_SIMD_SSE) && defined(__AVX__)
+	#define MATH_SIMD_AVX 1
+	#include <immintrin.h>
+#endif
+
+// Number of float lanes in FVectorRegister8.
+static constexpr int32 VectorRegister8Lanes = 8;
+
+#if defined(MATH_SIMD_AVX)
+
+using FVectorRegister8 = __m256;
+
+inline FVectorRegister8 Vector8Zero()
+{
+	return _mm256_setzero_ps();
+}
+
+inline FVectorRegister8 Vector8Splat(float InValue)
+{
+	return _mm256_set1_ps(InValue);
+}
+
+inline FVectorRegister8 Vector8Load(const float* InPtr)
+{
+	return _mm256_loadu_ps(InPtr);
+}
+
+inline void Vector8Store(FVectorRegister8 InVector, float* OutPtr)
+{
+	_mm256_storeu_ps(OutPtr, InVector);
+}
+
+inline FVectorRegister8 VectorAdd(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_add_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorSubtract(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_sub_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorMultiply(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_mul_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorDivide(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_div_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorMultiplyAdd(FVectorRegister8 InA, FVectorRegister8 InB, FVectorRegister8 InC)
+{
+#if defined(__FMA__)
+	return _mm256_fmadd_ps(InA, InB, InC);
+#else
+	return _mm256_add_ps(_mm256_mul_ps(InA, InB), InC);
+#endif
+}
+
+inline FVectorRegister8 VectorNegate(FVectorRegister8 InVector)
+{
+	return _mm256_xor_ps(InVector, _mm256_set1_ps(-0.0f));
+}
+
+inline FVectorRegister8 VectorAbs(FVectorRegister8 InVector)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), InVector);
+}
+
+inline FVectorRegister8 VectorMin(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_min_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorMax(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_max_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorSqrt(FVectorRegister8 InVector)
+{
+	return _mm256_sqrt_ps(InVector);
+}
+
+inline FVectorRegister8 VectorReciprocal(FVectorRegister8 InVector)
+{
+	return _mm256_div_ps(_mm256_set1_ps(1.0f), InVector);
+}
+
+inline FVectorRegister8 VectorReciprocalSqrt(FVectorRegister8 InVector)
+{
+	return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(InVector));
+}
+
+inline FVectorRegister8 VectorCompareEQ(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_EQ_OQ);
+}
+
+inline FVectorRegister8 VectorCompareNE(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_NEQ_UQ);
+}
+
+inline FVectorRegister8 VectorCompareGT(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_GT_OQ);
+}
+
+inline FVectorRegister8 VectorCompareGE(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_GE_OQ);
+}
+
+inline FVectorRegister8 VectorCompareLT(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_LT_OQ);
+}
+
+inline FVectorRegister8 VectorCompareLE(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_cmp_ps(InA, InB, _CMP_LE_OQ);
+}
+
+inline FVectorRegister8 VectorSelect(FVectorRegister8 InMask, FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_blendv_ps(InB, InA, InMask);
+}
+
+inline FVectorRegister8 VectorBitwiseAnd(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_and_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorBitwiseOr(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_or_ps(InA, InB);
+}
+
+inline FVectorRegister8 VectorBitwiseXor(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_xor_ps(InA, InB);
+}
+
+// Returns A & ~B.
+inline FVectorRegister8 VectorBitwiseAndNot(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_andnot_ps(InB, InA);
+}
+
+// Packs the sign bit of each lane into the low eight bits of the result.
+inline int32 VectorMaskBits(FVectorRegister8 InMask)
+{
+	return _mm256_movemask_ps(InMask);
+}
+
+inline FVectorRegister8 VectorRound(FVectorRegister8 InVector)
+{
+	return _mm256_round_ps(InVector, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+inline FVectorRegister8 VectorReciprocalSqrtEstimate(FVectorRegister8 InVector)
+{
+	return _mm256_rsqrt_ps(InVector);
+}
+
+// Integer lanes.
+inline FVectorRegister8 Vector8SplatInt(int32 InValue)
+{
+	return _mm256_castsi256_ps(_mm256_set1_epi32(InValue));
+}
+
+inline FVectorRegister8 VectorFloatToInt(FVectorRegister8 InVector)
+{
+	return _mm256_castsi256_ps(_mm256_cvtps_epi32(InVector));
+}
+
+inline FVectorRegister8 VectorIntToFloat(FVectorRegister8 InVector)
+{
+	return _mm256_cvtepi32_ps(_mm256_castps_si256(InVector));
+}
+
+#if defined(__AVX2__)
+inline FVectorRegister8 VectorIntAdd(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(InA), _mm256_castps_si256(InB)));
+}
+
+inline FVectorRegister8 VectorIntSubtract(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_castps_si256(InA), _mm256_castps_si256(InB)));
+}
+
+inline FVectorRegister8 VectorIntCompareEQ(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_castps_si256(InA), _mm256_castps_si256(InB)));
+}
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftLeft(FVectorRegister8 InVector)
+{
+	return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(InVector), Bits));
+}
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftRight(FVectorRegister8 InVector)
+{
+	return _mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(InVector), Bits));
+}
+#else
+// AVX without AVX2 has no 256-bit integer instructions, so integer operations work on each half.
+#define VECTOR8_SPLIT_OP(Expression) \
+	_mm256_insertf128_ps(_mm256_castps128_ps256(Expression(_mm256_castps256_ps128(InA), _mm256_castps256_ps128(InB))), \
+		Expression(_mm256_extractf128_ps(InA, 1), _mm256_extractf128_ps(InB, 1)), 1)
+
+inline FVectorRegister8 VectorIntAdd(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return VECTOR8_SPLIT_OP(VectorIntAdd);
+}
+
+inline FVectorRegister8 VectorIntSubtract(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return VECTOR8_SPLIT_OP(VectorIntSubtract);
+}
+
+inline FVectorRegister8 VectorIntCompareEQ(FVectorRegister8 InA, FVectorRegister8 InB)
+{
+	return VECTOR8_SPLIT_OP(VectorIntCompareEQ);
+}
+
+#undef VECTOR8_SPLIT_OP
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftLeft(FVectorRegister8 InVector)
+{
+	FVectorRegister4 Low = VectorIntShiftLeft<Bits>(_mm256_castps256_ps128(InVector));
+	FVectorRegister4 High = VectorIntShiftLeft<Bits>(_mm256_extractf128_ps(InVector, 1));
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(Low), High, 1);
+}
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftRight(FVectorRegister8 InVector)
+{
+	FVectorRegister4 Low = VectorIntShiftRight<Bits>(_mm256_castps256_ps128(InVector));
+	FVectorRegister4 High = VectorIntShiftRight<Bits>(_mm256_extractf128_ps(InVector, 1));
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(Low), High, 1);
+}
+#endif
+
+#else
+
+struct FVectorRegister8
+{
+	FVectorRegister4 Low;
+	FVectorRegister4 High;
+};
+
+inline FVectorRegister8 Vector8Zero()
+{
+	return FVectorRegister8{ VectorZero(), VectorZero() };
+}
+
+inline FVectorRegister8 Vector8Splat(float InValue)
+{
+	return FVectorRegister8{ VectorSplat(InValue), VectorSplat(InValue) };
+}
+
+inline FVectorRegister8 Vector8Load(const float* InPtr)
+{
+	return FVectorRegister8{ VectorLoad(InPtr), VectorLoad(InPtr + 4) };
+}
+
+inline void Vector8Store(FVectorRegister8 InVector, float* OutPtr)
+{
+	VectorStore(InVector.Low, OutPtr);
+	VectorStore(InVector.High, OutPtr + 4);
+}
+
+// Forwards element-wise operations to both halves.
+#define VECTOR8_UNARY_OP(Name) \
+	inline FVectorRegister8 Name(FVectorRegister8 InVector) \
+	{ \
+		return FVectorRegister8{ Name(InVector.Low), Name(InVector.High) }; \
+	}
+#define VECTOR8_BINARY_OP(Name) \
+	inline FVectorRegister8 Name(FVectorRegister8 InA, FVectorRegister8 InB) \
+	{ \
+		return FVectorRegister8{ Name(InA.Low, InB.Low), Name(InA.High, InB.High) }; \
+	}
+#define VECTOR8_TERNARY_OP(Name) \
+	inline FVectorRegister8 Name(FVectorRegister8 InA, FVectorRegister8 InB, FVectorRegister8 InC) \
+	{ \
+		return FVectorRegister8{ Name(InA.Low, InB.Low, InC.Low), Name(InA.High, InB.High, InC.High) }; \
+	}
+
+VECTOR8_BINARY_OP(VectorAdd)
+VECTOR8_BINARY_OP(VectorSubtract)
+VECTOR8_BINARY_OP(VectorMultiply)
+VECTOR8_BINARY_OP(VectorDivide)
+VECTOR8_TERNARY_OP(VectorMultiplyAdd)
+VECTOR8_UNARY_OP(VectorNegate)
+VECTOR8_UNARY_OP(VectorAbs)
+VECTOR8_BINARY_OP(VectorMin)
+VECTOR8_BINARY_OP(VectorMax)
+VECTOR8_UNARY_OP(VectorSqrt)
+VECTOR8_UNARY_OP(VectorReciprocal)
+VECTOR8_UNARY_OP(VectorReciprocalSqrt)
+VECTOR8_BINARY_OP(VectorCompareEQ)
+VECTOR8_BINARY_OP(VectorCompareNE)
+VECTOR8_BINARY_OP(VectorCompareGT)
+VECTOR8_BINARY_OP(VectorCompareGE)
+VECTOR8_BINARY_OP(VectorCompareLT)
+VECTOR8_BINARY_OP(VectorCompareLE)
+VECTOR8_TERNARY_OP(VectorSelect)
+VECTOR8_BINARY_OP(VectorBitwiseAnd)
+VECTOR8_BINARY_OP(VectorBitwiseOr)
+VECTOR8_BINARY_OP(VectorBitwiseXor)
+VECTOR8_BINARY_OP(VectorBitwiseAndNot)
+VECTOR8_UNARY_OP(VectorRound)
+VECTOR8_UNARY_OP(VectorReciprocalSqrtEstimate)
+VECTOR8_UNARY_OP(VectorFloatToInt)
+VECTOR8_UNARY_OP(VectorIntToFloat)
+VECTOR8_BINARY_OP(VectorIntAdd)
+VECTOR8_BINARY_OP(VectorIntSubtract)
+VECTOR8_BINARY_OP(VectorIntCompareEQ)
+
+#undef VECTOR8_UNARY_OP
+#undef VECTOR8_BINARY_OP
+#undef VECTOR8_TERNARY_OP
+
+inline int32 VectorMaskBits(FVectorRegister8 InMask)
+{
+	return VectorMaskBits(InMask.Low) | (VectorMaskBits(InMask.High) << 4);
+}
+
+inline FVectorRegister8 Vector8SplatInt(int32 InValue)
+{
+	return FVectorRegister8{ VectorSplatInt(InValue), VectorSplatInt(InValue) };
+}
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftLeft(FVectorRegister8 InVector)
+{
+	return FVectorRegister8{ VectorIntShiftLeft<Bits>(InVector.Low), VectorIntShiftLeft<Bits>(InVector.High) };
+}
+
+template<int32 Bits>
+inline FVectorRegister8 VectorIntShiftRight(FVectorRegister8 InVector)
+{
+	return FVectorRegister8{ VectorIntShiftRight<Bits>(InVector.Low), VectorIntShiftRight<Bits>(InVector.High) };
+}
+
+#endif
+
+// Shared helpers, mirroring the 4-wide versions.
+inline FVectorRegister8 VectorMultiplySubtract(FVectorRegister8 InA, FVectorRegister8 InB, FVectorRegister8 InC)
+{
+	return VectorSubtract(VectorMultiply(InA, InB), InC);
+}
+
+inline FVectorRegister8 VectorNegateMultiplyAdd(FVectorRegister8 InA, FVectorRegister8 InB, FVectorRegister8 InC)
+{
+	return VectorSubtract(InC, VectorMultiply(InA, InB));
+}
+
+inline FVectorRegister8 VectorLerp(FVectorRegister8 InA, FVectorRegister8 InB, FVectorRegister8 InAlpha)
+{
+	return VectorMultiplyAdd(VectorSubtract(InB, InA), InAlpha, InA);
+}
+
+inline FVectorRegister8 VectorClamp(FVectorRegister8 InValue, FVectorRegister8 InMin, FVectorRegister8 InMax)
+{
+	return VectorMin(VectorMax(InValue, InMin), InMax);
+}
+
+inline bool VectorAnyTrue(FVectorRegister8 InMask)
+{
+	return VectorMaskBits(InMask) != 0;
+}
+
+inline bool VectorAllTrue(FVectorRegister8 InMask)
+{
+	return VectorMaskBits(InMask) == 0xFF;
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+/**
+ * NEON implementation of FVectorRegister4. Include Math/Simd/VectorRegister.h instead of this file.
+ */
+
+#include "CoreGlobals.h"
+
+#include <arm_neon.h>
+// System include (for sqrtf on 32-bit ARM, which has no vector square root).
+#include <cmath>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+	#define MATH_SIMD_NEON_A64 1
+#endif
+
+using FVectorRegister4 = float32x4_t;
+
+// Creation.
+inline FVectorRegister4 VectorZero()
+{
+	return vdupq_n_f32(0.0f);
+}
+
+inline FVectorRegister4 VectorSet(float InX, float InY, float InZ, float InW)
+{
+	alignas(16) float Values[4] = { InX, InY, InZ, InW };
+	return vld1q_f32(Values);
+}
+
+inline FVectorRegister4 VectorSplat(float InValue)
+{
+	return vdupq_n_f32(InValue);
+}
+
+inline FVectorRegister4 VectorLoad(const float* InPtr)
+{
+	return vld1q_f32(InPtr);
+}
+
+inline FVectorRegister4 VectorLoad3(const float* InPtr)
+{
+	float32x2_t XY = vld1_f32(InPtr);
+	float32x2_t ZW = vld1_lane_f32(InPtr + 2, vdup_n_f32(0.0f), 0);
+	return vcombine_f32(XY, ZW);
+}
+
+inline void VectorStore(FVectorRegister4 InVector, float* OutPtr)
+{
+	vst1q_f32(OutPtr, InVector);
+}
+
+inline void VectorStore3(FVectorRegister4 InVector, float* OutPtr)
+{
+	vst1_f32(OutPtr, vget_low_f32(InVector));
+	vst1q_lane_f32(OutPtr + 2, InVector, 2);
+}
+
+// Swizzles.
+template<int32 Index>
+inline FVectorRegister4 VectorReplicate(FVectorRegister4 InVector)
+{
+	static_assert(0 <= Index && Index <= 3, "Invalid lane index.");
+	return vdupq_n_f32(vgetq_lane_f32(InVector, Index));
+}
+
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorShuffle(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	float32x4_t Result = vdupq_n_f32(vgetq_lane_f32(InA, X));
+	Result = vsetq_lane_f32(vgetq_lane_f32(InA, Y), Result, 1);
+	Result = vsetq_lane_f32(vgetq_lane_f32(InB, Z), Result, 2);
+	Result = vsetq_lane_f32(vgetq_lane_f32(InB, W), Result, 3);
+	return Result;
+}
+
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorSwizzle(FVectorRegister4 InVector)
+{
+	return VectorShuffle<X, Y, Z, W>(InVector, InVector);
+}
+
+inline float VectorGetComponent(FVectorRegister4 InVector, int32 InIndex)
+{
+	alignas(16) float Values[4];
+	vst1q_f32(Values, InVector);
+	return Values[InIndex];
+}
+
+// Arithmetic.
+inline FVectorRegister4 VectorAdd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vaddq_f32(InA, InB);
+}
+
+inline FVectorRegister4 VectorSubtract(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vsubq_f32(InA, InB);
+}
+
+inline FVectorRegister4 VectorMultiply(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vmulq_f32(InA, InB);
+}
+
+inline FVectorRegister4 VectorDivide(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+#if defined(MATH_SIMD_NEON_A64)
+	return vdivq_f32(InA, InB);
+#else
+	// Refine the reciprocal estimate with two Newton-Raphson steps to get close to full precision.
+	float32x4_t Reciprocal = vrecpeq_f32(InB);
+	Reciprocal = vmulq_f32(vrecpsq_f32(InB, Reciprocal), Reciprocal);
+	Reciprocal = vmulq_f32(vrecpsq_f32(InB, Reciprocal), Reciprocal);
+	return vmulq_f32(InA, Reciprocal);
+#endif
+}
+
+inline FVectorRegister4 VectorMultiplyAdd(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC)
+{
+#if defined(MATH_SIMD_NEON_A64)
+	return vfmaq_f32(InC, InA, InB);
+#else
+	return vmlaq_f32(InC, InA, InB);
+#endif
+}
+
+inline FVectorRegister4 VectorNegate(FVectorRegister4 InVector)
+{
+	return vnegq_f32(InVector);
+}
+
+inline FVectorRegister4 VectorAbs(FVectorRegister4 InVector)
+{
+	return vabsq_f32(InVector);
+}
+
+inline FVectorRegister4 VectorMin(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vminq_f32(InA, InB);
+}
+
+inline FVectorRegister4 VectorMax(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vmaxq_f32(InA, InB);
+}
+
+inline FVectorRegister4 VectorSqrt(FVectorRegister4 InVector)
+{
+#if defined(MATH_SIMD_NEON_A64)
+	return vsqrtq_f32(InVector);
+#else
+	alignas(16) float Values[4];
+	vst1q_f32(Values, InVector);
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Values[Lane] = std::sqrt(Values[Lane]);
+	}
+	return vld1q_f32(Values);
+#endif
+}
+
+inline FVectorRegister4 VectorReciprocal(FVectorRegister4 InVector)
+{
+	return VectorDivide(vdupq_n_f32(1.0f), InVector);
+}
+
+inline FVectorRegister4 VectorReciprocalSqrt(FVectorRegister4 InVector)
+{
+	return VectorDivide(vdupq_n_f32(1.0f), VectorSqrt(InVector));
+}
+
+// Comparisons.
+inline FVectorRegister4 VectorCompareEQ(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vceqq_f32(InA, InB));
+}
+
+inline FVectorRegister4 VectorCompareNE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(InA, InB)));
+}
+
+inline FVectorRegister4 VectorCompareGT(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vcgtq_f32(InA, InB));
+}
+
+inline FVectorRegister4 VectorCompareGE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vcgeq_f32(InA, InB));
+}
+
+inline FVectorRegister4 VectorCompareLT(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vcltq_f32(InA, InB));
+}
+
+inline FVectorRegister4 VectorCompareLE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vcleq_f32(InA, InB));
+}
+
+inline FVectorRegister4 VectorSelect(FVectorRegister4 InMask, FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vbslq_f32(vreinterpretq_u32_f32(InMask), InA, InB);
+}
+
+inline FVectorRegister4 VectorBitwiseAnd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+}
+
+inline FVectorRegister4 VectorBitwiseOr(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+}
+
+inline FVectorRegister4 VectorBitwiseXor(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+}
+
+// Returns A & ~B.
+inline FVectorRegister4 VectorBitwiseAndNot(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+}
+
+inline int32 VectorMaskBits(FVectorRegister4 InMask)
+{
+	uint32x4_t SignBits = vshrq_n_u32(vreinterpretq_u32_f32(InMask), 31);
+	return static_cast<int32>(vgetq_lane_u32(SignBits, 0)
+		| (vgetq_lane_u32(SignBits, 1) << 1)
+		| (vgetq_lane_u32(SignBits, 2) << 2)
+		| (vgetq_lane_u32(SignBits, 3) << 3));
+}
+
+// Rounds each lane to the nearest integer. Only valid for |X| < 2^31.
+inline FVectorRegister4 VectorRound(FVectorRegister4 InVector)
+{
+#if defined(MATH_SIMD_NEON_A64)
+	return vrndnq_f32(InVector);
+#else
+	// Round half away from zero by adding 0.5 with the sign of X, then truncating.
+	uint32x4_t SignBit = vandq_u32(vreinterpretq_u32_f32(InVector), vdupq_n_u32(0x80000000u));
+	float32x4_t Half = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), SignBit));
+	return vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(InVector, Half)));
+#endif
+}
+
+// Approximate 1 / sqrt(X). The hardware estimate is only good to about 2^-8, so one refinement step brings it
+// to at least the precision of the SSE estimate.
+inline FVectorRegister4 VectorReciprocalSqrtEstimate(FVectorRegister4 InVector)
+{
+	float32x4_t Estimate = vrsqrteq_f32(InVector);
+	return vmulq_f32(Estimate, vrsqrtsq_f32(vmulq_f32(InVector, Estimate), Estimate));
+}
+
+// Integer lanes. These functions treat each lane as a 32-bit integer instead of a float.
+inline FVectorRegister4 VectorSplatInt(int32 InValue)
+{
+	return vreinterpretq_f32_s32(vdupq_n_s32(InValue));
+}
+
+// Converts float lanes to integer lanes, rounding to the nearest integer.
+inline FVectorRegister4 VectorFloatToInt(FVectorRegister4 InVector)
+{
+	return vreinterpretq_f32_s32(vcvtq_s32_f32(VectorRound(InVector)));
+}
+
+inline FVectorRegister4 VectorIntToFloat(FVectorRegister4 InVector)
+{
+	return vcvtq_f32_s32(vreinterpretq_s32_f32(InVector));
+}
+
+inline FVectorRegister4 VectorIntAdd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(InA), vreinterpretq_s32_f32(InB)));
+}
+
+inline FVectorRegister4 VectorIntSubtract(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_s32(vsubq_s32(vreinterpretq_s32_f32(InA), vreinterpretq_s32_f32(InB)));
+}
+
+inline FVectorRegister4 VectorIntCompareEQ(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return vreinterpretq_f32_u32(vceqq_s32(vreinterpretq_s32_f32(InA), vreinterpretq_s32_f32(InB)));
+}
+
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftLeft(FVectorRegister4 InVector)
+{
+	return vreinterpretq_f32_u32(vshlq_n_u32(vreinterpretq_u32_f32(InVector), Bits));
+}
+
+// Logical shift (zeros are shifted in).
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftRight(FVectorRegister4 InVector)
+{
+	return vreinterpretq_f32_u32(vshrq_n_u32(vreinterpretq_u32_f32(InVector), Bits));
+}
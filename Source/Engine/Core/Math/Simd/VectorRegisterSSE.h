@@ -0,0 +1,279 @@
+#pragma once
+
+/**
+ * SSE implementation of FVectorRegister4. Include Math/Simd/VectorRegister.h instead of this file.
+ */
+
+#include "CoreGlobals.h"
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#if defined(__FMA__)
+	#include <immintrin.h>
+#endif
+
+using FVectorRegister4 = __m128;
+
+// Builds the immediate operand of _mm_shuffle_ps.
+#define VECTOR_SHUFFLE_MASK(X, Y, Z, W) ((X) | ((Y) << 2) | ((Z) << 4) | ((W) << 6))
+
+// Creation.
+inline FVectorRegister4 VectorZero()
+{
+	return _mm_setzero_ps();
+}
+
+inline FVectorRegister4 VectorSet(float InX, float InY, float InZ, float InW)
+{
+	return _mm_setr_ps(InX, InY, InZ, InW);
+}
+
+inline FVectorRegister4 VectorSplat(float InValue)
+{
+	return _mm_set1_ps(InValue);
+}
+
+// Loads four floats. The address doesn't need to be aligned.
+inline FVectorRegister4 VectorLoad(const float* InPtr)
+{
+	return _mm_loadu_ps(InPtr);
+}
+
+// Loads three floats into X, Y, and Z, and sets W to zero. Never reads past InPtr[2].
+inline FVectorRegister4 VectorLoad3(const float* InPtr)
+{
+	// Going through __m64, which may alias anything, rather than double keeps the compiler from reordering
+	// the load with earlier stores to the same floats.
+	__m128 XY = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(InPtr));
+	__m128 Z = _mm_load_ss(InPtr + 2);
+	return _mm_movelh_ps(XY, Z);
+}
+
+// Stores four floats. The address doesn't need to be aligned.
+inline void VectorStore(FVectorRegister4 InVector, float* OutPtr)
+{
+	_mm_storeu_ps(OutPtr, InVector);
+}
+
+// Stores the X, Y, and Z lanes. Never writes past OutPtr[2].
+inline void VectorStore3(FVectorRegister4 InVector, float* OutPtr)
+{
+	_mm_storel_pi(reinterpret_cast<__m64*>(OutPtr), InVector);
+	_mm_store_ss(OutPtr + 2, _mm_movehl_ps(InVector, InVector));
+}
+
+// Swizzles.
+template<int32 Index>
+inline FVectorRegister4 VectorReplicate(FVectorRegister4 InVector)
+{
+	static_assert(0 <= Index && Index <= 3, "Invalid lane index.");
+	return _mm_shuffle_ps(InVector, InVector, VECTOR_SHUFFLE_MASK(Index, Index, Index, Index));
+}
+
+// Returns (V[X], V[Y], V[Z], V[W]).
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorSwizzle(FVectorRegister4 InVector)
+{
+	return _mm_shuffle_ps(InVector, InVector, VECTOR_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+// Returns (A[X], A[Y], B[Z], B[W]).
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorShuffle(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_shuffle_ps(InA, InB, VECTOR_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+inline float VectorGetComponent(FVectorRegister4 InVector, int32 InIndex)
+{
+	alignas(16) float Values[4];
+	_mm_store_ps(Values, InVector);
+	return Values[InIndex];
+}
+
+// Arithmetic.
+inline FVectorRegister4 VectorAdd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_add_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorSubtract(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_sub_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorMultiply(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_mul_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorDivide(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_div_ps(InA, InB);
+}
+
+// Returns A * B + C, fused when the target supports FMA.
+inline FVectorRegister4 VectorMultiplyAdd(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC)
+{
+#if defined(__FMA__)
+	return _mm_fmadd_ps(InA, InB, InC);
+#else
+	return _mm_add_ps(_mm_mul_ps(InA, InB), InC);
+#endif
+}
+
+inline FVectorRegister4 VectorNegate(FVectorRegister4 InVector)
+{
+	return _mm_xor_ps(InVector, _mm_set1_ps(-0.0f));
+}
+
+inline FVectorRegister4 VectorAbs(FVectorRegister4 InVector)
+{
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), InVector);
+}
+
+inline FVectorRegister4 VectorMin(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_min_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorMax(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_max_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorSqrt(FVectorRegister4 InVector)
+{
+	return _mm_sqrt_ps(InVector);
+}
+
+inline FVectorRegister4 VectorReciprocal(FVectorRegister4 InVector)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), InVector);
+}
+
+inline FVectorRegister4 VectorReciprocalSqrt(FVectorRegister4 InVector)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(InVector));
+}
+
+// Comparisons. Each lane of the result is all ones if the comparison holds, and all zeros otherwise.
+inline FVectorRegister4 VectorCompareEQ(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmpeq_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorCompareNE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmpneq_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorCompareGT(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmpgt_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorCompareGE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmpge_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorCompareLT(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmplt_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorCompareLE(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_cmple_ps(InA, InB);
+}
+
+// Returns lanes of A where the mask is set, and lanes of B elsewhere.
+inline FVectorRegister4 VectorSelect(FVectorRegister4 InMask, FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_or_ps(_mm_and_ps(InMask, InA), _mm_andnot_ps(InMask, InB));
+}
+
+inline FVectorRegister4 VectorBitwiseAnd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_and_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorBitwiseOr(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_or_ps(InA, InB);
+}
+
+inline FVectorRegister4 VectorBitwiseXor(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_xor_ps(InA, InB);
+}
+
+// Returns A & ~B.
+inline FVectorRegister4 VectorBitwiseAndNot(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_andnot_ps(InB, InA);
+}
+
+// Packs the sign bit of each lane into the low four bits of the result (X is bit 0).
+inline int32 VectorMaskBits(FVectorRegister4 InMask)
+{
+	return _mm_movemask_ps(InMask);
+}
+
+// Rounds each lane to the nearest integer (ties to even). Only valid for |X| < 2^31.
+inline FVectorRegister4 VectorRound(FVectorRegister4 InVector)
+{
+	return _mm_cvtepi32_ps(_mm_cvtps_epi32(InVector));
+}
+
+// Approximate 1 / sqrt(X), with a relative error of at most 1.5 * 2^-12.
+inline FVectorRegister4 VectorReciprocalSqrtEstimate(FVectorRegister4 InVector)
+{
+	return _mm_rsqrt_ps(InVector);
+}
+
+// Integer lanes. These functions treat each lane as a 32-bit integer instead of a float.
+inline FVectorRegister4 VectorSplatInt(int32 InValue)
+{
+	return _mm_castsi128_ps(_mm_set1_epi32(InValue));
+}
+
+// Converts float lanes to integer lanes, rounding to the nearest integer.
+inline FVectorRegister4 VectorFloatToInt(FVectorRegister4 InVector)
+{
+	return _mm_castsi128_ps(_mm_cvtps_epi32(InVector));
+}
+
+inline FVectorRegister4 VectorIntToFloat(FVectorRegister4 InVector)
+{
+	return _mm_cvtepi32_ps(_mm_castps_si128(InVector));
+}
+
+inline FVectorRegister4 VectorIntAdd(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(InA), _mm_castps_si128(InB)));
+}
+
+inline FVectorRegister4 VectorIntSubtract(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_castsi128_ps(_mm_sub_epi32(_mm_castps_si128(InA), _mm_castps_si128(InB)));
+}
+
+inline FVectorRegister4 VectorIntCompareEQ(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_castps_si128(InA), _mm_castps_si128(InB)));
+}
+
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftLeft(FVectorRegister4 InVector)
+{
+	return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(InVector), Bits));
+}
+
+// Logical shift (zeros are shifted in).
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftRight(FVectorRegister4 InVector)
+{
+	return _mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(InVector), Bits));
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+/**
+ * Scalar fallback implementation of FVectorRegister4, used on targets without a supported vector
+ * instruction set. Include Math/Simd/VectorRegister.h instead of this file.
+ */
+
+#include "CoreGlobals.h"
+
+// System includes (for memcpy and sqrtf).
+#include <cstring>
+#include <cmath>
+
+struct alignas(16) FVectorRegister4
+{
+	float V[4];
+};
+
+namespace VectorRegisterScalar
+{
+	// Lane masks are represented as floats whose bits are all ones or all zeros, as with the hardware backends.
+	inline uint32 ToBits(float InValue)
+	{
+		uint32 Bits;
+		memcpy(&Bits, &InValue, sizeof(Bits));
+		return Bits;
+	}
+
+	inline float FromBits(uint32 InBits)
+	{
+		float Value;
+		memcpy(&Value, &InBits, sizeof(Value));
+		return Value;
+	}
+
+	inline float MaskFromBool(bool InValue)
+	{
+		return FromBits(InValue ? 0xFFFFFFFFu : 0u);
+	}
+}
+
+// Creation.
+inline FVectorRegister4 VectorZero()
+{
+	return FVectorRegister4{ { 0.0f, 0.0f, 0.0f, 0.0f } };
+}
+
+inline FVectorRegister4 VectorSet(float InX, float InY, float InZ, float InW)
+{
+	return FVectorRegister4{ { InX, InY, InZ, InW } };
+}
+
+inline FVectorRegister4 VectorSplat(float InValue)
+{
+	return FVectorRegister4{ { InValue, InValue, InValue, InValue } };
+}
+
+inline FVectorRegister4 VectorLoad(const float* InPtr)
+{
+	return FVectorRegister4{ { InPtr[0], InPtr[1], InPtr[2], InPtr[3] } };
+}
+
+inline FVectorRegister4 VectorLoad3(const float* InPtr)
+{
+	return FVectorRegister4{ { InPtr[0], InPtr[1], InPtr[2], 0.0f } };
+}
+
+inline void VectorStore(FVectorRegister4 InVector, float* OutPtr)
+{
+	OutPtr[0] = InVector.V[0];
+	OutPtr[1] = InVector.V[1];
+	OutPtr[2] = InVector.V[2];
+	OutPtr[3] = InVector.V[3];
+}
+
+inline void VectorStore3(FVectorRegister4 InVector, float* OutPtr)
+{
+	OutPtr[0] = InVector.V[0];
+	OutPtr[1] = InVector.V[1];
+	OutPtr[2] = InVector.V[2];
+}
+
+// Swizzles.
+template<int32 Index>
+inline FVectorRegister4 VectorReplicate(FVectorRegister4 InVector)
+{
+	static_assert(0 <= Index && Index <= 3, "Invalid lane index.");
+	return VectorSplat(InVector.V[Index]);
+}
+
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorSwizzle(FVectorRegister4 InVector)
+{
+	return FVectorRegister4{ { InVector.V[X], InVector.V[Y], InVector.V[Z], InVector.V[W] } };
+}
+
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline FVectorRegister4 VectorShuffle(FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return FVectorRegister4{ { InA.V[X], InA.V[Y], InB.V[Z], InB.V[W] } };
+}
+
+inline float VectorGetComponent(FVectorRegister4 InVector, int32 InIndex)
+{
+	return InVector.V[InIndex];
+}
+
+// Applies a binary operation to each lane.
+#define VECTOR_SCALAR_BINARY_OP(Name, Expression) \
+	inline FVectorRegister4 Name(FVectorRegister4 InA, FVectorRegister4 InB) \
+	{ \
+		FVectorRegister4 Result; \
+		for (int32 Lane = 0; Lane < 4; ++Lane) \
+		{ \
+			float A = InA.V[Lane]; \
+			float B = InB.V[Lane]; \
+			Result.V[Lane] = (Expression); \
+		} \
+		return Result; \
+	}
+
+// Arithmetic.
+VECTOR_SCALAR_BINARY_OP(VectorAdd, A + B)
+VECTOR_SCALAR_BINARY_OP(VectorSubtract, A - B)
+VECTOR_SCALAR_BINARY_OP(VectorMultiply, A * B)
+VECTOR_SCALAR_BINARY_OP(VectorDivide, A / B)
+VECTOR_SCALAR_BINARY_OP(VectorMin, (A < B) ? A : B)
+VECTOR_SCALAR_BINARY_OP(VectorMax, (A > B) ? A : B)
+
+inline FVectorRegister4 VectorMultiplyAdd(FVectorRegister4 InA, FVectorRegister4 InB, FVectorRegister4 InC)
+{
+	return VectorAdd(VectorMultiply(InA, InB), InC);
+}
+
+inline FVectorRegister4 VectorNegate(FVectorRegister4 InVector)
+{
+	return VectorSet(-InVector.V[0], -InVector.V[1], -InVector.V[2], -InVector.V[3]);
+}
+
+inline FVectorRegister4 VectorAbs(FVectorRegister4 InVector)
+{
+	return VectorSet(std::fabs(InVector.V[0]), std::fabs(InVector.V[1]), std::fabs(InVector.V[2]), std::fabs(InVector.V[3]));
+}
+
+inline FVectorRegister4 VectorSqrt(FVectorRegister4 InVector)
+{
+	return VectorSet(std::sqrt(InVector.V[0]), std::sqrt(InVector.V[1]), std::sqrt(InVector.V[2]), std::sqrt(InVector.V[3]));
+}
+
+inline FVectorRegister4 VectorReciprocal(FVectorRegister4 InVector)
+{
+	return VectorDivide(VectorSplat(1.0f), InVector);
+}
+
+inline FVectorRegister4 VectorReciprocalSqrt(FVectorRegister4 InVector)
+{
+	return VectorDivide(VectorSplat(1.0f), VectorSqrt(InVector));
+}
+
+// Comparisons.
+VECTOR_SCALAR_BINARY_OP(VectorCompareEQ, VectorRegisterScalar::MaskFromBool(A == B))
+VECTOR_SCALAR_BINARY_OP(VectorCompareNE, VectorRegisterScalar::MaskFromBool(A != B))
+VECTOR_SCALAR_BINARY_OP(VectorCompareGT, VectorRegisterScalar::MaskFromBool(A > B))
+VECTOR_SCALAR_BINARY_OP(VectorCompareGE, VectorRegisterScalar::MaskFromBool(A >= B))
+VECTOR_SCALAR_BINARY_OP(VectorCompareLT, VectorRegisterScalar::MaskFromBool(A < B))
+VECTOR_SCALAR_BINARY_OP(VectorCompareLE, VectorRegisterScalar::MaskFromBool(A <= B))
+
+// Bitwise operations.
+VECTOR_SCALAR_BINARY_OP(VectorBitwiseAnd, VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(A) & VectorRegisterScalar::ToBits(B)))
+VECTOR_SCALAR_BINARY_OP(VectorBitwiseOr, VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(A) | VectorRegisterScalar::ToBits(B)))
+VECTOR_SCALAR_BINARY_OP(VectorBitwiseXor, VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(A) ^ VectorRegisterScalar::ToBits(B)))
+VECTOR_SCALAR_BINARY_OP(VectorBitwiseAndNot, VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(A) & ~VectorRegisterScalar::ToBits(B)))
+
+// Integer lanes. These functions treat each lane as a 32-bit integer instead of a float.
+#define VECTOR_SCALAR_INT_BINARY_OP(Name, Expression) \
+	VECTOR_SCALAR_BINARY_OP(Name, VectorRegisterScalar::FromBits(static_cast<uint32>(Expression)))
+
+VECTOR_SCALAR_INT_BINARY_OP(VectorIntAdd, VectorRegisterScalar::ToBits(A) + VectorRegisterScalar::ToBits(B))
+VECTOR_SCALAR_INT_BINARY_OP(VectorIntSubtract, VectorRegisterScalar::ToBits(A) - VectorRegisterScalar::ToBits(B))
+VECTOR_SCALAR_INT_BINARY_OP(VectorIntCompareEQ, VectorRegisterScalar::ToBits(A) == VectorRegisterScalar::ToBits(B) ? 0xFFFFFFFFu : 0u)
+
+#undef VECTOR_SCALAR_INT_BINARY_OP
+#undef VECTOR_SCALAR_BINARY_OP
+
+inline FVectorRegister4 VectorSelect(FVectorRegister4 InMask, FVectorRegister4 InA, FVectorRegister4 InB)
+{
+	return VectorBitwiseOr(VectorBitwiseAnd(InMask, InA), VectorBitwiseAndNot(InB, InMask));
+}
+
+inline int32 VectorMaskBits(FVectorRegister4 InMask)
+{
+	int32 Bits = 0;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Bits |= ((VectorRegisterScalar::ToBits(InMask.V[Lane]) >> 31) & 1) << Lane;
+	}
+	return Bits;
+}
+
+// Rounds each lane to the nearest integer (ties to even). Only valid for |X| < 2^31.
+inline FVectorRegister4 VectorRound(FVectorRegister4 InVector)
+{
+	return VectorSet(std::nearbyint(InVector.V[0]), std::nearbyint(InVector.V[1]), std::nearbyint(InVector.V[2]), std::nearbyint(InVector.V[3]));
+}
+
+// There is no cheaper estimate without hardware support, so this is exact.
+inline FVectorRegister4 VectorReciprocalSqrtEstimate(FVectorRegister4 InVector)
+{
+	return VectorReciprocalSqrt(InVector);
+}
+
+inline FVectorRegister4 VectorSplatInt(int32 InValue)
+{
+	return VectorSplat(VectorRegisterScalar::FromBits(static_cast<uint32>(InValue)));
+}
+
+// Converts float lanes to integer lanes, rounding to the nearest integer.
+inline FVectorRegister4 VectorFloatToInt(FVectorRegister4 InVector)
+{
+	FVectorRegister4 Result;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Result.V[Lane] = VectorRegisterScalar::FromBits(static_cast<uint32>(static_cast<int32>(std::nearbyint(InVector.V[Lane]))));
+	}
+	return Result;
+}
+
+inline FVectorRegister4 VectorIntToFloat(FVectorRegister4 InVector)
+{
+	FVectorRegister4 Result;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Result.V[Lane] = static_cast<float>(static_cast<int32>(VectorRegisterScalar::ToBits(InVector.V[Lane])));
+	}
+	return Result;
+}
+
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftLeft(FVectorRegister4 InVector)
+{
+	FVectorRegister4 Result;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Result.V[Lane] = VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(InVector.V[Lane]) << Bits);
+	}
+	return Result;
+}
+
+// Logical shift (zeros are shifted in).
+template<int32 Bits>
+inline FVectorRegister4 VectorIntShiftRight(FVectorRegister4 InVector)
+{
+	FVectorRegister4 Result;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Result.V[Lane] = VectorRegisterScalar::FromBits(VectorRegisterScalar::ToBits(InVector.V[Lane]) >> Bits);
+	}
+	return Result;
+}
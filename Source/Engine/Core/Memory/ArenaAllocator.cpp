@@ -1,12 +1,17 @@
 #include "ArenaAllocator.h"
 #include "MemoryManager.h"
 #include "AlignmentUtilities.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
 
+// System include for memset.
+#include <cstring>
 
 FArenaAllocator::FArenaAllocator(void* InStart, int32 InCapacity)
 	: Start((int8*)InStart)
 	, Capacity(InCapacity)
 	, NumBytesUsed(0)
+	, HighWaterMark(0)
 {
 }
 
@@ -30,6 +35,7 @@ void* FArenaAllocator::Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment
 	}
 
 	NumBytesUsed = NewOffset;
+	HighWaterMark = FMath::Max(HighWaterMark, NumBytesUsed);
 	return Start + AlignedOffset;
 }
 
@@ -40,7 +46,17 @@ void FArenaAllocator::Deallocate(void* InAddress)
 
 void FArenaAllocator::Clear()
 {
-	NumBytesUsed = 0;
+	RewindToMarker(0);
+}
+
+void FArenaAllocator::RewindToMarker(FMarker InMarker)
+{
+	ensure(InMarker >= 0 && InMarker <= NumBytesUsed);
+
+#if ARENA_ALLOCATOR_POISON
+	memset(Start + InMarker, PoisonValue, NumBytesUsed - InMarker);
+#endif
+	NumBytesUsed = InMarker;
 }
 
 FArenaAllocator& FArenaAllocator::GetDefaultAllocator()
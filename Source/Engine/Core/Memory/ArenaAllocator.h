@@ -4,8 +4,21 @@
 #include "IAllocator.h"
 #include "Alignment.h"
 
+// Whether rewound and cleared arena memory is filled with FArenaAllocator::PoisonValue, so that code still
+// using it reads obviously wrong data. On by default in builds with assertions.
+#ifndef ARENA_ALLOCATOR_POISON
+	#ifdef NDEBUG
+		#define ARENA_ALLOCATOR_POISON 0
+	#else
+		#define ARENA_ALLOCATOR_POISON 1
+	#endif
+#endif
+
 /**
  * Linearly allocates memory arenas for use by engine subsystems.
+ *
+ * Memory is freed in bulk, either all at once with Clear() or, like a stack, by rewinding to a marker taken
+ * earlier (see FScopedArenaMark).
  */
 class FArenaAllocator : public IAllocator
 {
@@ -36,6 +49,45 @@ public:
 	 */
 	void Clear();
 
+	// Position in the arena that the allocator can be rewound to.
+	using FMarker = int32;
+
+	// Returns a marker for the current position. Allocations made after it can be freed by RewindToMarker.
+	FMarker GetMarker() const
+	{
+		return NumBytesUsed;
+	}
+
+	/**
+	 * Deallocates all memory allocated since the marker was taken.
+	 * Markers must be rewound to in the reverse order they were taken.
+	 */
+	void RewindToMarker(FMarker InMarker);
+
+	int32 GetNumBytesUsed() const
+	{
+		return NumBytesUsed;
+	}
+
+	int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// Returns the largest number of bytes used since the allocator was created or the high-water mark was reset.
+	int32 GetHighWaterMark() const
+	{
+		return HighWaterMark;
+	}
+
+	void ResetHighWaterMark()
+	{
+		HighWaterMark = NumBytesUsed;
+	}
+
+	// Byte written over deallocated memory when ARENA_ALLOCATOR_POISON is enabled.
+	static constexpr uint8 PoisonValue = 0xDD;
+
 	static FArenaAllocator& GetDefaultAllocator();
 
 private:
@@ -45,4 +97,36 @@ private:
 	int32 Capacity;
 	// Number of bytes of allocator memory already used.
     int32 NumBytesUsed;
+	// Largest value of NumBytesUsed since the high-water mark was reset.
+	int32 HighWaterMark;
 };
+
+/**
+ * Takes a marker in an arena allocator when constructed and rewinds to it when destroyed, so that temporary
+ * allocations made within a scope are freed when it ends.
+ */
+template<typename ArenaType>
+class TScopedArenaMark
+{
+public:
+	explicit TScopedArenaMark(ArenaType& InAllocator)
+		: Allocator(InAllocator)
+		, Marker(InAllocator.GetMarker())
+	{
+	}
+
+	~TScopedArenaMark()
+	{
+		Allocator.RewindToMarker(Marker);
+	}
+
+	// Non-copyable.
+	TScopedArenaMark(const TScopedArenaMark&) = delete;
+	TScopedArenaMark& operator=(const TScopedArenaMark&) = delete;
+
+private:
+	ArenaType& Allocator;
+	typename ArenaType::FMarker Marker;
+};
+
+using FScopedArenaMark = TScopedArenaMark<FArenaAllocator>;
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "EpochManager.h"
+#include "AssertionMacros.h"
+
+// System include for yielding while waiting for readers.
+#include <thread>
+
+// Gives the calling thread's record back when it exits, so that threads that come and go don't add records forever.
+struct FEpochManager::FThreadRecordReleaser
+{
+	~FThreadRecordReleaser()
+	{
+		FThreadState& State = GetThreadState();
+		State.Record->bInUse.store(false, std::memory_order_release);
+		State.Record = nullptr;
+	}
+};
+
+struct FEpochManager::FRetiredObject
+{
+	void* Object;
+	FDeleter Deleter;
+	void* Context;
+	// Epoch the object was retired in. Readers that entered in a later epoch can't reach it.
+	uint64 Epoch;
+	FRetiredObject* Next;
+};
+
+/*static*/ FEpochManager& FEpochManager::Get()
+{
+	// Never destroyed, so that containers destroyed during static destruction can still retire objects.
+	static FEpochManager* EpochManager = new FEpochManager;
+	return *EpochManager;
+}
+
+void FEpochManager::Retire(void* InObject, FDeleter InDeleter, void* InContext)
+{
+	ensure(InObject && InDeleter);
+	// Readers that load the advanced epoch synchronize with the advance, so they see the object unlinked.
+	const uint64 Epoch = GlobalEpoch.fetch_add(1, std::memory_order_acq_rel);
+
+	bool bShouldCollect;
+	{
+		std::lock_guard<std::mutex> Lock(RetiredMutex);
+		FRetiredObject* Retired = FreeEntries;
+		if (Retired)
+		{
+			FreeEntries = Retired->Next;
+		}
+		else
+		{
+			Retired = new FRetiredObject;
+		}
+		*Retired = FRetiredObject{ InObject, InDeleter, InContext, Epoch, RetiredObjects };
+		RetiredObjects = Retired;
+		++NumRetired;
+		bShouldCollect = NumRetired >= NumRetiredAtNextCollect;
+	}
+
+	if (bShouldCollect)
+	{
+		Collect();
+	}
+}
+
+void FEpochManager::Collect()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	FreeRetiredObjects(GetOldestActiveEpoch());
+}
+
+void FEpochManager::Synchronize()
+{
+	ensure(!IsInReadScope());
+	const uint64 Epoch = GlobalEpoch.fetch_add(1, std::memory_order_seq_cst);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	// Readers that entered after the advance can't reach anything retired before the call.
+	for (FThreadRecord* Record = ThreadRecords.load(std::memory_order_acquire); Record; Record = Record->Next)
+	{
+		for (uint64 ReaderEpoch = Record->Epoch.load(std::memory_order_acquire); ReaderEpoch != 0 && ReaderEpoch <= Epoch;
+			ReaderEpoch = Record->Epoch.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	FreeRetiredObjects(Epoch + 1);
+}
+
+int32 FEpochManager::GetNumRetired()
+{
+	std::lock_guard<std::mutex> Lock(RetiredMutex);
+	return NumRetired;
+}
+
+FEpochManager::FThreadRecord* FEpochManager::AcquireThreadRecord()
+{
+	thread_local FThreadRecordReleaser Releaser;
+
+	FThreadRecord* Head = ThreadRecords.load(std::memory_order_acquire);
+	for (FThreadRecord* Record = Head; Record; Record = Record->Next)
+	{
+		bool bInUse = false;
+		if (!Record->bInUse.load(std::memory_order_relaxed)
+			&& Record->bInUse.compare_exchange_strong(bInUse, true, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			return Record;
+		}
+	}
+
+	FThreadRecord* Record = new FThreadRecord;
+	Record->Next = Head;
+	while (!ThreadRecords.compare_exchange_weak(Record->Next, Record, std::memory_order_release, std::memory_order_acquire))
+	{
+	}
+	return Record;
+}
+
+uint64 FEpochManager::GetOldestActiveEpoch()
+{
+	uint64 OldestEpoch = GlobalEpoch.load(std::memory_order_seq_cst);
+	for (FThreadRecord* Record = ThreadRecords.load(std::memory_order_acquire); Record; Record = Record->Next)
+	{
+		const uint64 ReaderEpoch = Record->Epoch.load(std::memory_order_acquire);
+		if (ReaderEpoch != 0 && ReaderEpoch < OldestEpoch)
+		{
+			OldestEpoch = ReaderEpoch;
+		}
+	}
+	return OldestEpoch;
+}
+
+void FEpochManager::FreeRetiredObjects(uint64 InSafeEpoch)
+{
+	// Unlink the objects under the lock, but free them outside of it, so that deleters may retire objects too.
+	FRetiredObject* SafeObjects = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(RetiredMutex);
+		FRetiredObject** Link = &RetiredObjects;
+		while (FRetiredObject* Retired = *Link)
+		{
+			if (Retired->Epoch < InSafeEpoch)
+			{
+				*Link = Retired->Next;
+				Retired->Next = SafeObjects;
+				SafeObjects = Retired;
+				--NumRetired;
+			}
+			else
+			{
+				Link = &Retired->Next;
+			}
+		}
+		NumRetiredAtNextCollect = NumRetired + CollectThreshold;
+	}
+
+	if (!SafeObjects)
+	{
+		return;
+	}
+
+	FRetiredObject* LastSafeObject = nullptr;
+	for (FRetiredObject* Retired = SafeObjects; Retired; Retired = Retired->Next)
+	{
+		Retired->Deleter(Retired->Object, Retired->Context);
+		LastSafeObject = Retired;
+	}
+
+	std::lock_guard<std::mutex> Lock(RetiredMutex);
+	LastSafeObject->Next = FreeEntries;
+	FreeEntries = SafeObjects;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+// System includes for the epochs and the retired object lock.
+#include <atomic>
+#include <mutex>
+
+/**
+ * Epoch-based reclamation, so that lock-free readers can traverse shared data while writers unlink and
+ * replace parts of it. A writer that unlinks an object retires it instead of freeing it, and the object is
+ * freed once every reader that could still be looking at it has left its read scope.
+ *
+ * A global epoch is advanced each time an object is retired, and the object is stamped with the epoch before
+ * the advance. Readers publish the epoch they entered in, so an object can be freed once every active reader
+ * entered after it was retired. Readers only write their own cache line and never wait, and a reader that
+ * stays in its scope holds up the freeing of objects retired after it entered, not the writers themselves.
+ *
+ * Entering a read scope costs a full barrier. Scopes nest, and only the outermost one is published.
+ */
+class FEpochManager
+{
+public:
+	// Frees a retired object. InContext is what was passed to Retire along with the object.
+	using FDeleter = void (*)(void* InObject, void* InContext);
+
+	// Number of objects retired since the last collection after which Retire tries to free them.
+	static constexpr int32 CollectThreshold = 64;
+
+	static FEpochManager& Get();
+
+	// Non-copyable.
+	FEpochManager(const FEpochManager&) = delete;
+	FEpochManager& operator=(const FEpochManager&) = delete;
+
+	// Enters and exits a read scope on the calling thread. Prefer FEpochReadScope.
+	void EnterRead()
+	{
+		FThreadState& State = GetThreadState();
+		if (State.Depth++ > 0)
+		{
+			return;
+		}
+		if (!State.Record)
+		{
+			State.Record = AcquireThreadRecord();
+		}
+
+		// Acquire, so that everything unlinked before the epoch was advanced is seen unlinked.
+		const uint64 Epoch = GlobalEpoch.load(std::memory_order_acquire);
+		// Pairs with the fence in Collect: either the collector sees this epoch, or this thread sees the object unlinked.
+		// On x86 an exchange is a full barrier and costs less than a store followed by a fence.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		State.Record->Epoch.exchange(Epoch, std::memory_order_seq_cst);
+#else
+		State.Record->Epoch.store(Epoch, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	void ExitRead()
+	{
+		FThreadState& State = GetThreadState();
+		if (--State.Depth > 0)
+		{
+			return;
+		}
+
+		// Release, so that the reads of this scope are done before a collector that sees the thread inactive frees anything.
+		State.Record->Epoch.store(0, std::memory_order_release);
+	}
+
+	/**
+	 * Frees an object once no reader can reach it anymore. The caller must have unlinked the object from
+	 * every structure readers traverse, so that readers entering from now on can't find it.
+	 *
+	 * @param InObject: Object to free.
+	 * @param InDeleter: Called with the object and InContext to free it, from whichever thread collects it.
+	 * @param InContext: Passed to InDeleter, e.g. the allocator the object came from.
+	 */
+	void Retire(void* InObject, FDeleter InDeleter, void* InContext);
+
+	// Frees the retired objects that no active reader can reach. Can be called e.g. once per frame.
+	void Collect();
+
+	/**
+	 * Waits for every reader that entered before the call to leave its scope, then frees every object
+	 * retired before the call, e.g. before destroying the allocator they came from.
+	 * Must not be called from inside a read scope.
+	 */
+	void Synchronize();
+
+	// Number of retired objects that haven't been freed yet.
+	int32 GetNumRetired();
+
+	// Whether the calling thread is in a read scope.
+	bool IsInReadScope() const
+	{
+		return GetThreadState().Depth > 0;
+	}
+
+private:
+	struct FRetiredObject;
+	struct FThreadRecordReleaser;
+
+	// Published epoch of a thread, on a cache line of its own since its thread writes it on every read scope.
+	struct alignas(PlatformCacheLineSize) FThreadRecord
+	{
+		// Epoch the thread entered its outermost read scope in, or 0 outside of read scopes.
+		std::atomic<uint64> Epoch{ 0 };
+		// Cleared when the thread exits, so that another thread can take the record.
+		std::atomic<bool> bInUse{ true };
+		// Set before the record is published and never changed.
+		FThreadRecord* Next = nullptr;
+	};
+
+	// Trivially destructible, so that read scopes access it directly; FThreadRecordReleaser gives the record back.
+	struct FThreadState
+	{
+		FThreadRecord* Record;
+		int32 Depth;
+	};
+
+	FEpochManager() = default;
+
+	// Finds a record left by a thread that exited, or adds a new one.
+	FThreadRecord* AcquireThreadRecord();
+	// Returns the oldest epoch an active reader entered in, or the current epoch if no reader is active.
+	uint64 GetOldestActiveEpoch();
+	// Frees the retired objects stamped with an epoch older than InSafeEpoch. Takes the lock.
+	void FreeRetiredObjects(uint64 InSafeEpoch);
+
+	static FThreadState& GetThreadState()
+	{
+		thread_local FThreadState State{ nullptr, 0 };
+		return State;
+	}
+
+	// Starts at 1, since a record's epoch of 0 means that its thread is not reading.
+	std::atomic<uint64> GlobalEpoch{ 1 };
+	// Records of every thread that ever entered a read scope. Records are reused but never freed.
+	std::atomic<FThreadRecord*> ThreadRecords{ nullptr };
+
+	std::mutex RetiredMutex;
+	FRetiredObject* RetiredObjects = nullptr;
+	// Entries of freed objects, reused by Retire so that retiring doesn't allocate. Never freed.
+	FRetiredObject* FreeEntries = nullptr;
+	int32 NumRetired = 0;
+	// Objects readers held up don't count towards the next collection, so that a long read scope doesn't make every Retire collect.
+	int32 NumRetiredAtNextCollect = CollectThreshold;
+};
+
+// Read scope for the lifetime of the object, during which retired objects that were reachable when it began aren't freed.
+class FEpochReadScope
+{
+public:
+	explicit FEpochReadScope(FEpochManager& InEpochManager = FEpochManager::Get())
+		: EpochManager(InEpochManager)
+	{
+		EpochManager.EnterRead();
+	}
+	~FEpochReadScope()
+	{
+		EpochManager.ExitRead();
+	}
+
+	// Non-copyable.
+	FEpochReadScope(const FEpochReadScope&) = delete;
+	FEpochReadScope& operator=(const FEpochReadScope&) = delete;
+
+private:
+	FEpochManager& EpochManager;
+};
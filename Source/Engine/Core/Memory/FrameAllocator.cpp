@@ -0,0 +1,38 @@
+#include "FrameAllocator.h"
+#include "MemoryManager.h"
+#include "Math/MathUtilities.h"
+
+FFrameAllocator::FFrameAllocator(void* InStart, int32 InCapacity)
+	: Arenas{
+		FArenaAllocator(InStart, InCapacity / 2),
+		FArenaAllocator(static_cast<int8*>(InStart) + InCapacity / 2, InCapacity / 2)
+	}
+{
+}
+
+void* FFrameAllocator::Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment /* = EMemoryAlignment::Default */)
+{
+	return GetCurrentArena().Allocate(InSizeBytes, InAlignment);
+}
+
+void FFrameAllocator::Deallocate(void* InAddress)
+{
+	// Do nothing
+}
+
+void FFrameAllocator::EndFrame()
+{
+	FArenaAllocator& FinishedArena = GetCurrentArena();
+	LastFrameHighWaterMark = FinishedArena.GetHighWaterMark();
+	PeakHighWaterMark = FMath::Max(PeakHighWaterMark, LastFrameHighWaterMark);
+
+	CurrentArenaIndex = 1 - CurrentArenaIndex;
+	FArenaAllocator& NextArena = GetCurrentArena();
+	NextArena.Clear();
+	NextArena.ResetHighWaterMark();
+}
+
+/*static*/ FFrameAllocator& FFrameAllocator::GetDefaultAllocator()
+{
+	return FMemoryManager::Get().GetFrameAllocator();
+}
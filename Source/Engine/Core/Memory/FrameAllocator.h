@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "IAllocator.h"
+#include "Alignment.h"
+#include "ArenaAllocator.h"
+
+/**
+ * Double-buffered arena for memory that only lives for a frame, such as render queues, culling results,
+ * and UI scratch strings.
+ *
+ * Allocations come from the current frame's arena, and EndFrame() swaps arenas and clears the new current
+ * one. Memory allocated during a frame therefore stays valid until the end of the following frame, so results
+ * produced in one frame can be consumed in the next. Deallocate does nothing.
+ */
+class FFrameAllocator : public IAllocator
+{
+public:
+	/**
+	 * Constructor. Splits the given memory evenly between the two frame arenas.
+	 * Clients must provide the allocator memory themselves.
+	 *
+	 * @param InStart: Starting address of the allocator's memory.
+	 * @param InCapacity: Total size in bytes of the allocator's memory.
+	 */
+	explicit FFrameAllocator(void* InStart, int32 InCapacity);
+
+	// Non-copyable.
+	FFrameAllocator(const FFrameAllocator&) = delete;
+	FFrameAllocator& operator=(const FFrameAllocator&) = delete;
+
+	// Begin IAllocator interface.
+	virtual void* Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment = EMemoryAlignment::Default) override;
+	virtual void  Deallocate(void* InAddress) override;
+	// End IAllocator interface.
+
+	/**
+	 * Finishes the current frame: records its high-water mark, then makes the other arena current and clears it,
+	 * which frees the memory allocated during the previous frame.
+	 */
+	void EndFrame();
+
+	// Arena that allocations are currently made from, e.g. for scoped marks.
+	FArenaAllocator& GetCurrentArena()
+	{
+		return Arenas[CurrentArenaIndex];
+	}
+
+	// Returns the number of bytes used by the last finished frame.
+	int32 GetLastFrameHighWaterMark() const
+	{
+		return LastFrameHighWaterMark;
+	}
+
+	// Returns the largest number of bytes used by any finished frame.
+	int32 GetPeakHighWaterMark() const
+	{
+		return PeakHighWaterMark;
+	}
+
+	// Returns the number of bytes available to each frame.
+	int32 GetFrameCapacity() const
+	{
+		return Arenas[0].GetCapacity();
+	}
+
+	static FFrameAllocator& GetDefaultAllocator();
+
+private:
+	FArenaAllocator Arenas[2];
+	int32 CurrentArenaIndex = 0;
+	int32 LastFrameHighWaterMark = 0;
+	int32 PeakHighWaterMark = 0;
+};
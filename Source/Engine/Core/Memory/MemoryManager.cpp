@@ -1,4 +1,5 @@
 #include "MemoryManager.h"
+#include "MemoryTracker.h"
 #include "AssertionMacros.h"
 
 // System includes for malloc and placement new.
@@ -8,15 +9,30 @@
 FMemoryManager::FMemoryManager()
 	// 50 MB
 	: TotalSize(50 * 1024 * 1024)
+	, PoolAllocator(EPoolThreading::ThreadCached)
+	, PersistentPoolAllocator(EPoolThreading::ThreadCached)
 {
 	MemoryStart = (int8*)malloc(TotalSize);
 	ensure(MemoryStart);
-	ArenaAllocator = new (MemoryStart) FArenaAllocator(MemoryStart + sizeof(FArenaAllocator), TotalSize - sizeof(FArenaAllocator));
+
+	// Engine memory starts with the allocators, followed by the frame allocator's memory, the heap's memory and the arena's memory.
+	int8* FrameMemory = MemoryStart + sizeof(FArenaAllocator) + sizeof(FFrameAllocator) + sizeof(FTLSFAllocator);
+	int8* HeapMemory = FrameMemory + FrameMemorySize;
+	int8* ArenaMemory = HeapMemory + HeapMemorySize;
+	ArenaAllocator = new (MemoryStart) FArenaAllocator(ArenaMemory, static_cast<int32>(TotalSize - (ArenaMemory - MemoryStart)));
+	FrameAllocator = new (MemoryStart + sizeof(FArenaAllocator)) FFrameAllocator(FrameMemory, FrameMemorySize);
+	TLSFAllocator = new (MemoryStart + sizeof(FArenaAllocator) + sizeof(FFrameAllocator)) FTLSFAllocator(HeapMemory, HeapMemorySize);
+
+	TRACK_ALLOCATOR_NAME(&PoolAllocator, "Engine pool");
+	TRACK_PERSISTENT_ALLOCATOR_NAME(&PersistentPoolAllocator, "Engine persistent pool");
+	TRACK_ALLOCATOR_NAME(TLSFAllocator, "Engine heap");
 }
 
 FMemoryManager::~FMemoryManager()
 {
-	// We need to manually call the destructor because we used placement new to construct the arena allocator.
+	// We need to manually call the destructors because we used placement new to construct the allocators.
+	TLSFAllocator->~FTLSFAllocator();
+	FrameAllocator->~FFrameAllocator();
 	ArenaAllocator->~FArenaAllocator();
 	free(MemoryStart);
 }
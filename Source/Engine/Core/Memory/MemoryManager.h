@@ -2,6 +2,9 @@
 
 #include "CoreGlobals.h"
 #include "Memory/ArenaAllocator.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/PoolAllocator.h"
+#include "Memory/TLSFAllocator.h"
 
 /**
  * Singleton class that owns and provides access to engine memory.
@@ -24,14 +27,48 @@ public:
 		return *ArenaAllocator; 
 	}
 
+	FFrameAllocator& GetFrameAllocator()
+	{
+		return *FrameAllocator;
+	}
+
+	FPoolAllocator& GetPoolAllocator()
+	{
+		return PoolAllocator;
+	}
+
+	FPoolAllocator& GetPersistentPoolAllocator()
+	{
+		return PersistentPoolAllocator;
+	}
+
+	FTLSFAllocator& GetTLSFAllocator()
+	{
+		return *TLSFAllocator;
+	}
+
 private:
 	FMemoryManager();
 	~FMemoryManager();
 
+	// Size in bytes of the engine memory used by the frame allocator, for both frames.
+	static constexpr int32 FrameMemorySize = 8 * 1024 * 1024;
+	// Size in bytes of the engine memory used by the general-purpose heap.
+	static constexpr int32 HeapMemorySize = 16 * 1024 * 1024;
+
 	// Starting address of engine memory.
 	int8* MemoryStart;
 	// Total size in bytes of engine memory.
 	uint64 TotalSize;
 	// Allocator used to provide memory arenas for engine subsystems.
 	FArenaAllocator* ArenaAllocator;
+	// Allocator for memory that lives for a frame. Reset at the end of each engine frame.
+	FFrameAllocator* FrameAllocator;
+	// General-purpose heap for allocations of any size and lifetime, freed in any order.
+	FTLSFAllocator* TLSFAllocator;
+	// Allocator for small objects, such as shared pointer control blocks, that any thread can use.
+	FPoolAllocator PoolAllocator;
+	// Pool for registries that live until the program exits, such as the string ID registry.
+	// Its allocations are left out of the leak report.
+	FPoolAllocator PersistentPoolAllocator;
 };
@@ -0,0 +1,271 @@
+#include "MemoryTracker.h"
+#include "AssertionMacros.h"
+
+const ANSICHAR* GetMemoryTagName(EMemoryTag InTag)
+{
+	switch (InTag)
+	{
+	case EMemoryTag::Untagged:
+		return "Untagged";
+	case EMemoryTag::Renderer:
+		return "Renderer";
+	case EMemoryTag::Scene:
+		return "Scene";
+	case EMemoryTag::SceneEditor:
+		return "SceneEditor";
+	default:
+		return "Invalid";
+	}
+}
+
+#if MEMORY_TRACKING
+
+#include "HAL/PlatformStackWalk.h"
+
+// System includes for the allocation records, locking, and printing the leak report.
+// The tracker's own containers use the global heap, which isn't tracked, so recording an allocation never recurses.
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+	// Deepest nesting of tag scopes on a thread. Deeper scopes are attributed to the outermost MaxTagDepth tags.
+	constexpr int32 MaxTagDepth = 32;
+
+	// The tag stack is trivially destructible, so threads don't register a destructor for it.
+	thread_local EMemoryTag TagStack[MaxTagDepth];
+	thread_local int32 TagDepth = 0;
+
+	struct FAllocationRecord
+	{
+		const IAllocator* Allocator;
+		uint64 SizeBytes;
+		// Allocation number, compared against checkpoints.
+		uint64 Index;
+		EMemoryTag Tag;
+		// Empty unless call stacks were being captured.
+		std::vector<uint64> CallStack;
+	};
+
+	void AddAllocation(FMemoryStats& InOutStats, uint64 InSizeBytes)
+	{
+		InOutStats.LiveBytes += InSizeBytes;
+		InOutStats.PeakBytes = std::max(InOutStats.PeakBytes, InOutStats.LiveBytes);
+		InOutStats.TotalBytes += InSizeBytes;
+		++InOutStats.NumLiveAllocations;
+		++InOutStats.NumTotalAllocations;
+	}
+
+	void RemoveAllocation(FMemoryStats& InOutStats, uint64 InSizeBytes)
+	{
+		InOutStats.LiveBytes -= InSizeBytes;
+		--InOutStats.NumLiveAllocations;
+	}
+}
+
+struct FMemoryTracker::FState
+{
+	mutable std::mutex Mutex;
+	std::unordered_map<const void*, FAllocationRecord> Allocations;
+	FMemoryStats TagStats[static_cast<int32>(EMemoryTag::Count)];
+	std::vector<FAllocatorMemoryStats> AllocatorStats;
+	uint64 NumAllocations = 0;
+	std::atomic<bool> bCaptureCallStacks{ false };
+
+	// Returns the counters of an allocator, adding them if it hasn't been seen yet. The lock must be held.
+	FAllocatorMemoryStats& FindAllocatorStats(const IAllocator* InAllocator)
+	{
+		for (FAllocatorMemoryStats& Entry : AllocatorStats)
+		{
+			if (Entry.Allocator == InAllocator)
+			{
+				return Entry;
+			}
+		}
+		AllocatorStats.push_back({ InAllocator, "Unnamed", FMemoryStats(), true });
+		return AllocatorStats.back();
+	}
+
+	// Removes a live allocation from the counters. The lock must be held.
+	void RemoveRecord(const FAllocationRecord& InRecord)
+	{
+		RemoveAllocation(TagStats[static_cast<int32>(InRecord.Tag)], InRecord.SizeBytes);
+		RemoveAllocation(FindAllocatorStats(InRecord.Allocator).Stats, InRecord.SizeBytes);
+	}
+};
+
+/*static*/ FMemoryTracker& FMemoryTracker::Get()
+{
+	// Never destroyed, so that allocators destroyed during static destruction can still report to it.
+	static FMemoryTracker* MemoryTracker = new FMemoryTracker;
+	return *MemoryTracker;
+}
+
+FMemoryTracker::FMemoryTracker()
+	: State(new FState)
+{
+}
+
+FMemoryTracker::~FMemoryTracker()
+{
+	delete State;
+}
+
+void FMemoryTracker::OnAllocate(const IAllocator* InAllocator, const void* InAddress, uint64 InSizeBytes)
+{
+	FAllocationRecord Record = { InAllocator, InSizeBytes, 0, GetCurrentTag(), {} };
+	if (State->bCaptureCallStacks.load(std::memory_order_relaxed))
+	{
+		// Skip this function and the allocator's Allocate.
+		uint64 CallStack[MaxCallStackDepth];
+		int32 Depth = FPlatformStackWalk::CaptureStackBackTrace(CallStack, MaxCallStackDepth, 2);
+		Record.CallStack.assign(CallStack, CallStack + Depth);
+	}
+
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	Record.Index = State->NumAllocations++;
+
+	// An allocator that freed its memory without deallocating can hand out an address that is still recorded.
+	auto Iterator = State->Allocations.find(InAddress);
+	if (Iterator != State->Allocations.end())
+	{
+		State->RemoveRecord(Iterator->second);
+		State->Allocations.erase(Iterator);
+	}
+
+	AddAllocation(State->TagStats[static_cast<int32>(Record.Tag)], InSizeBytes);
+	AddAllocation(State->FindAllocatorStats(InAllocator).Stats, InSizeBytes);
+	State->Allocations.emplace(InAddress, std::move(Record));
+}
+
+void FMemoryTracker::OnDeallocate(const IAllocator* InAllocator, const void* InAddress)
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	auto Iterator = State->Allocations.find(InAddress);
+	if (Iterator == State->Allocations.end())
+	{
+		// Allocated before the allocator was tracked, or already forgotten with its allocator.
+		return;
+	}
+	ensure(Iterator->second.Allocator == InAllocator);
+	State->RemoveRecord(Iterator->second);
+	State->Allocations.erase(Iterator);
+}
+
+void FMemoryTracker::OnAllocatorDestroyed(const IAllocator* InAllocator)
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	for (auto Iterator = State->Allocations.begin(); Iterator != State->Allocations.end();)
+	{
+		if (Iterator->second.Allocator == InAllocator)
+		{
+			RemoveAllocation(State->TagStats[static_cast<int32>(Iterator->second.Tag)], Iterator->second.SizeBytes);
+			Iterator = State->Allocations.erase(Iterator);
+		}
+		else
+		{
+			++Iterator;
+		}
+	}
+
+	std::vector<FAllocatorMemoryStats>& AllocatorStats = State->AllocatorStats;
+	AllocatorStats.erase(std::remove_if(AllocatorStats.begin(), AllocatorStats.end(),
+		[InAllocator](const FAllocatorMemoryStats& InEntry) { return InEntry.Allocator == InAllocator; }), AllocatorStats.end());
+}
+
+void FMemoryTracker::RegisterAllocator(const IAllocator* InAllocator, const ANSICHAR* InName, bool bInReportLeaks /* = true */)
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	FAllocatorMemoryStats& Entry = State->FindAllocatorStats(InAllocator);
+	Entry.Name = InName;
+	Entry.bReportLeaks = bInReportLeaks;
+}
+
+void FMemoryTracker::SetCaptureCallStacks(bool bInCaptureCallStacks)
+{
+	State->bCaptureCallStacks.store(bInCaptureCallStacks, std::memory_order_relaxed);
+}
+
+FMemoryStats FMemoryTracker::GetTagStats(EMemoryTag InTag) const
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	return State->TagStats[static_cast<int32>(InTag)];
+}
+
+std::vector<FAllocatorMemoryStats> FMemoryTracker::GetAllocatorStats() const
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	return State->AllocatorStats;
+}
+
+uint64 FMemoryTracker::GetAllocationCheckpoint() const
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+	return State->NumAllocations;
+}
+
+uint64 FMemoryTracker::ReportLeaks(uint64 InCheckpoint /* = 0 */) const
+{
+	std::lock_guard<std::mutex> Lock(State->Mutex);
+
+	// Report leaks in the order they were allocated.
+	std::vector<std::pair<const void*, const FAllocationRecord*>> Leaks;
+	uint64 NumLeakedBytes = 0;
+	for (const auto& Entry : State->Allocations)
+	{
+		if (Entry.second.Index >= InCheckpoint && State->FindAllocatorStats(Entry.second.Allocator).bReportLeaks)
+		{
+			Leaks.emplace_back(Entry.first, &Entry.second);
+			NumLeakedBytes += Entry.second.SizeBytes;
+		}
+	}
+	std::sort(Leaks.begin(), Leaks.end(), [](const auto& InA, const auto& InB) { return InA.second->Index < InB.second->Index; });
+
+	// @TODOLog: Replace this once logging is implemented.
+	for (const auto& Leak : Leaks)
+	{
+		const FAllocationRecord& Record = *Leak.second;
+		std::cout << "Leaked " << Record.SizeBytes << " bytes at " << Leak.first
+			<< " (tag " << GetMemoryTagName(Record.Tag) << ", allocator " << State->FindAllocatorStats(Record.Allocator).Name << ")" << std::endl;
+		for (uint64 Address : Record.CallStack)
+		{
+			ANSICHAR SymbolName[256];
+			FPlatformStackWalk::GetSymbolName(Address, SymbolName, sizeof(SymbolName));
+			std::cout << "    " << SymbolName << std::endl;
+		}
+	}
+	if (!Leaks.empty())
+	{
+		std::cout << Leaks.size() << " memory leaks, " << NumLeakedBytes << " bytes in total." << std::endl;
+	}
+	return Leaks.size();
+}
+
+/*static*/ void FMemoryTracker::PushTag(EMemoryTag InTag)
+{
+	if (TagDepth < MaxTagDepth)
+	{
+		TagStack[TagDepth] = InTag;
+	}
+	++TagDepth;
+}
+
+/*static*/ void FMemoryTracker::PopTag()
+{
+	ensure(TagDepth > 0);
+	--TagDepth;
+}
+
+/*static*/ EMemoryTag FMemoryTracker::GetCurrentTag()
+{
+	if (TagDepth == 0)
+	{
+		return EMemoryTag::Untagged;
+	}
+	return TagStack[std::min(TagDepth, MaxTagDepth) - 1];
+}
+
+#endif
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "HAL/PreprocessorHelpers.h"
+
+// System include for returning allocator statistics.
+#include <vector>
+
+/**
+ * Memory tracking attributes allocations made through the engine allocators to tags and allocators,
+ * and can report the allocations still live at shutdown. It is enabled in debug builds by default, which the
+ * MEMORY_TRACKING CMake option overrides. When it is disabled the tracking macros expand to nothing, so the
+ * allocators have no tracking overhead at all.
+ */
+#ifndef MEMORY_TRACKING
+	#ifdef NDEBUG
+		#define MEMORY_TRACKING 0
+	#else
+		#define MEMORY_TRACKING 1
+	#endif
+#endif
+
+class IAllocator;
+
+/**
+ * What an allocation is for. Allocations are attributed to the innermost tag scope of the thread
+ * that makes them, or to Untagged outside of any scope.
+ */
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	Renderer,
+	Scene,
+	SceneEditor,
+	Count
+};
+
+// Returns a readable name for a memory tag.
+const ANSICHAR* GetMemoryTagName(EMemoryTag InTag);
+
+/**
+ * Allocation counters for a tag or allocator. Sizes are the requested sizes.
+ */
+struct FMemoryStats
+{
+	// Bytes currently allocated.
+	uint64 LiveBytes = 0;
+	// Highest LiveBytes has been.
+	uint64 PeakBytes = 0;
+	// Bytes allocated since tracking started, including freed ones.
+	uint64 TotalBytes = 0;
+	uint64 NumLiveAllocations = 0;
+	uint64 NumTotalAllocations = 0;
+};
+
+/**
+ * Counters of one allocator.
+ */
+struct FAllocatorMemoryStats
+{
+	const IAllocator* Allocator;
+	const ANSICHAR* Name;
+	FMemoryStats Stats;
+	// False for allocators of data that lives until the program exits, whose allocations aren't leaks.
+	bool bReportLeaks;
+};
+
+#if MEMORY_TRACKING
+
+/**
+ * Singleton that records the live allocations of the tracked allocators and keeps counters per tag and per allocator.
+ * Allocators report to it through the TRACK_ALLOCATION and TRACK_DEALLOCATION macros. It can be used from any thread.
+ */
+class FMemoryTracker
+{
+public:
+	// Maximum number of return addresses recorded per allocation when capturing call stacks.
+	static constexpr int32 MaxCallStackDepth = 16;
+
+	// Non-copyable.
+	FMemoryTracker(const FMemoryTracker&) = delete;
+	FMemoryTracker& operator=(const FMemoryTracker&) = delete;
+
+	static FMemoryTracker& Get();
+
+	void OnAllocate(const IAllocator* InAllocator, const void* InAddress, uint64 InSizeBytes);
+	void OnDeallocate(const IAllocator* InAllocator, const void* InAddress);
+	// Forgets an allocator that is being destroyed, along with any allocations it still had.
+	void OnAllocatorDestroyed(const IAllocator* InAllocator);
+
+	/**
+	 * Names an allocator in the statistics and leak report.
+	 *
+	 * @param bInReportLeaks: Whether the leak report includes the allocator's allocations. Pass false for allocators
+	 *                        of registries and caches that live until the program exits. They are still counted.
+	 */
+	void RegisterAllocator(const IAllocator* InAllocator, const ANSICHAR* InName, bool bInReportLeaks = true);
+
+	/**
+	 * Records the call stack of every allocation from now on, for the leak report. This makes allocating
+	 * much slower, so it is off by default.
+	 */
+	void SetCaptureCallStacks(bool bInCaptureCallStacks);
+
+	FMemoryStats GetTagStats(EMemoryTag InTag) const;
+	std::vector<FAllocatorMemoryStats> GetAllocatorStats() const;
+
+	// Returns a number that identifies the next allocation. Pass it to ReportLeaks to ignore earlier allocations.
+	uint64 GetAllocationCheckpoint() const;
+
+	/**
+	 * Prints the allocations that are still live, with their call stacks if they were captured.
+	 * Allocators registered without leak reporting are skipped.
+	 *
+	 * @param InCheckpoint: Only allocations made after this checkpoint are reported.
+	 * @returns Number of live allocations reported.
+	 */
+	uint64 ReportLeaks(uint64 InCheckpoint = 0) const;
+
+	// Tag stack of the calling thread. Use MEMORY_TAG_SCOPE rather than calling these directly.
+	static void PushTag(EMemoryTag InTag);
+	static void PopTag();
+	static EMemoryTag GetCurrentTag();
+
+private:
+	struct FState;
+
+	FMemoryTracker();
+	~FMemoryTracker();
+
+	FState* State;
+};
+
+/**
+ * Attributes the allocations of the calling thread to a tag until the end of the scope.
+ */
+class FScopedMemoryTag
+{
+public:
+	explicit FScopedMemoryTag(EMemoryTag InTag)
+	{
+		FMemoryTracker::PushTag(InTag);
+	}
+
+	~FScopedMemoryTag()
+	{
+		FMemoryTracker::PopTag();
+	}
+
+	// Non-copyable.
+	FScopedMemoryTag(const FScopedMemoryTag&) = delete;
+	FScopedMemoryTag& operator=(const FScopedMemoryTag&) = delete;
+};
+
+#define MEMORY_TAG_SCOPE(Tag) FScopedMemoryTag CONCAT(ScopedMemoryTag, __LINE__)(Tag)
+#define TRACK_ALLOCATION(Allocator, Address, SizeBytes) do { if (Address) { FMemoryTracker::Get().OnAllocate(Allocator, Address, SizeBytes); } } while (0)
+#define TRACK_DEALLOCATION(Allocator, Address) do { if (Address) { FMemoryTracker::Get().OnDeallocate(Allocator, Address); } } while (0)
+#define TRACK_ALLOCATOR_DESTROYED(Allocator) FMemoryTracker::Get().OnAllocatorDestroyed(Allocator)
+#define TRACK_ALLOCATOR_NAME(Allocator, Name) FMemoryTracker::Get().RegisterAllocator(Allocator, Name)
+#define TRACK_PERSISTENT_ALLOCATOR_NAME(Allocator, Name) FMemoryTracker::Get().RegisterAllocator(Allocator, Name, false)
+
+#else
+
+#define MEMORY_TAG_SCOPE(Tag)
+#define TRACK_ALLOCATION(Allocator, Address, SizeBytes)
+#define TRACK_DEALLOCATION(Allocator, Address)
+#define TRACK_ALLOCATOR_DESTROYED(Allocator)
+#define TRACK_ALLOCATOR_NAME(Allocator, Name)
+#define TRACK_PERSISTENT_ALLOCATOR_NAME(Allocator, Name)
+
+#endif
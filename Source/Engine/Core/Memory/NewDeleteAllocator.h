@@ -2,6 +2,7 @@
 #include "CoreGlobals.h"
 #include "Alignment.h"
 #include "IAllocator.h"
+#include "MemoryTracker.h"
 
 /**
  * Allocator that uses operator new and delete.
@@ -16,10 +17,13 @@ public:
 	// Begin IAllocator interface.
 	void* Allocate(int32 InSize, EMemoryAlignment InAlignment = EMemoryAlignment::Default) override 
 	{ 
-		return ::operator new(InSize); 
+		void* Memory = ::operator new(InSize);
+		TRACK_ALLOCATION(this, Memory, InSize);
+		return Memory;
 	}
 	void  Deallocate(void* InAddress) override 
 	{ 
+		TRACK_DEALLOCATION(this, InAddress);
 		::operator delete(InAddress); 
 	}
 	// End IAllocator interface.
@@ -31,6 +35,9 @@ public:
 	}
 
 private:
-	FNewDeleteAllocator() = default;
+	FNewDeleteAllocator()
+	{
+		TRACK_ALLOCATOR_NAME(this, "FNewDeleteAllocator");
+	}
 	~FNewDeleteAllocator() = default;
 };
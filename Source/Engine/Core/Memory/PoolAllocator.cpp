@@ -0,0 +1,662 @@
+#include "PoolAllocator.h"
+#include "MemoryManager.h"
+#include "MemoryTracker.h"
+#include "AssertionMacros.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/MathUtilities.h"
+
+// System include for operator new.
+#include <new>
+
+namespace
+{
+	// Sizes above 512 bytes are a quarter apart, so no more than a fifth of a block goes unused.
+	constexpr int32 SizeClassSizes[FPoolAllocator::NumSizeClasses] =
+	{
+		8, 16, 32, 48, 64, 96, 128, 192, 256, 384, 512,
+		640, 768, 896, 1024, 1280, 1536, 1792, 2048, 2560, 3072, 3584, 4096,
+		5120, 6144, 7168, 8192, 10240, 12288, 14336, 16384, 20480, 24576, 28672, 32768
+	};
+	static_assert(SizeClassSizes[FPoolAllocator::NumSizeClasses - 1] == FPoolAllocator::MaxBlockSize, "The largest size class must be MaxBlockSize.");
+
+	// Sizes up to this are looked up in steps of 8 bytes, and larger ones in steps of 128 bytes.
+	constexpr int32 MaxFineSize = 1024;
+	constexpr int32 CoarseStep = 128;
+
+	// Maps a size rounded up to a step, divided by the step, to the smallest size class that fits it.
+	struct FSizeClassLookup
+	{
+		constexpr FSizeClassLookup()
+			: FineSizeClasses{}
+			, CoarseSizeClasses{}
+		{
+			int32 SizeClass = 0;
+			for (int32 Index = 0; Index <= MaxFineSize / 8; ++Index)
+			{
+				while (SizeClassSizes[SizeClass] < Index * 8)
+				{
+					++SizeClass;
+				}
+				FineSizeClasses[Index] = static_cast<uint8>(SizeClass);
+			}
+
+			SizeClass = 0;
+			for (int32 Index = 0; Index <= FPoolAllocator::MaxBlockSize / CoarseStep; ++Index)
+			{
+				while (SizeClassSizes[SizeClass] < Index * CoarseStep)
+				{
+					++SizeClass;
+				}
+				CoarseSizeClasses[Index] = static_cast<uint8>(SizeClass);
+			}
+		}
+
+		uint8 FineSizeClasses[MaxFineSize / 8 + 1];
+		uint8 CoarseSizeClasses[FPoolAllocator::MaxBlockSize / CoarseStep + 1];
+	};
+
+	constexpr FSizeClassLookup SizeClassLookup;
+
+	int32 GetSizeClass(int32 InSizeBytes)
+	{
+		if (InSizeBytes <= MaxFineSize)
+		{
+			return SizeClassLookup.FineSizeClasses[(InSizeBytes + 7) / 8];
+		}
+		return SizeClassLookup.CoarseSizeClasses[(InSizeBytes + CoarseStep - 1) / CoarseStep];
+	}
+
+	// Number of blocks moved between a thread cache and the pools at once. Smaller for larger blocks,
+	// so that each size class caches a similar number of bytes.
+	int32 GetThreadCacheBatchSize(int32 InSizeClass)
+	{
+		return FMath::Clamp(4096 / SizeClassSizes[InSizeClass], 2, 64);
+	}
+
+	// Number of pages carved at once for a size class. Spans of larger blocks hold at least 8 of them,
+	// so that little of the span is left over after the last block.
+	int32 GetNumPagesPerSpan(int32 InSizeClass)
+	{
+		return FMath::Max(1, (8 * SizeClassSizes[InSizeClass] + FPoolAllocator::PageSize - 1) / FPoolAllocator::PageSize);
+	}
+
+	// Rounds a size up to a multiple of a power-of-two alignment.
+	uint64 RoundUp(uint64 InSize, uint64 InAlignment)
+	{
+		return (InSize + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	// Header in front of a large allocation. Its size keeps the block 16-byte aligned.
+	struct FLargeHeader
+	{
+		// Requested size, for debugging.
+		uint64 SizeBytes;
+		// Set while the block is allocated, to catch addresses that didn't come from this allocator and double frees.
+		uint64 Magic;
+	};
+	static_assert(sizeof(FLargeHeader) == 16, "Large blocks must stay 16-byte aligned.");
+
+	constexpr uint64 LargeBlockMagic = 0x4B4C42454752414CULL;
+
+	// Takes the pool lock, unless the allocator is single-threaded.
+	std::unique_lock<std::mutex> LockPools(std::mutex& InMutex, EPoolThreading InThreading)
+	{
+		if (InThreading == EPoolThreading::SingleThreaded)
+		{
+			return std::unique_lock<std::mutex>(InMutex, std::defer_lock);
+		}
+		return std::unique_lock<std::mutex>(InMutex);
+	}
+
+	// Protects the links between thread caches and their allocators, for when a thread exits
+	// while an allocator it used is being destroyed.
+	std::mutex& GetThreadCacheMutex()
+	{
+		static std::mutex ThreadCacheMutex;
+		return ThreadCacheMutex;
+	}
+}
+
+struct FPoolAllocator::FFreeBlock
+{
+	FFreeBlock* Next;
+};
+
+// Entry of the page table, which has one per page of the reserved range.
+struct FPoolAllocator::FPageInfo
+{
+	// Size class of the page's blocks.
+	int32 SizeClass;
+	// Thread cache the page was carved for, which other threads return its blocks to. nullptr if the page is shared.
+	FThreadCache* Owner;
+};
+
+struct FPoolAllocator::FThreadCache
+{
+	// Allocator the cache belongs to. Cleared if the allocator is destroyed before the thread exits.
+	std::atomic<FPoolAllocator*> Owner;
+	// Next cache of the same allocator.
+	FThreadCache* NextCache = nullptr;
+	FFreeBlock* FreeLists[NumSizeClasses] = {};
+	int32 NumFreeBlocks[NumSizeClasses] = {};
+	// Blocks of this cache's pages freed by other threads, of any size class.
+	std::atomic<FFreeBlock*> RemoteFrees{ nullptr };
+	// Set when the cache's thread exits, until another thread reuses the cache. Protected by the pool lock.
+	bool bIsAbandoned = false;
+};
+
+// Caches of the thread-cached allocators used by a thread. Most threads only use the default allocator,
+// and allocators used after the table is full fall back to taking the lock. The table is trivially
+// destructible, so finding a cache doesn't need a thread-local initialization check.
+struct FPoolAllocator::FThreadCacheTable
+{
+	static constexpr int32 MaxCaches = 4;
+
+	// Returns the cached blocks to their allocators, and deletes the caches of allocators that were destroyed.
+	void Release()
+	{
+		std::lock_guard<std::mutex> CacheLock(GetThreadCacheMutex());
+		for (FThreadCache*& Cache : Caches)
+		{
+			if (Cache)
+			{
+				// The allocator keeps the cache for other threads to free blocks to, unless it was destroyed.
+				if (FPoolAllocator* Owner = Cache->Owner.load(std::memory_order_relaxed))
+				{
+					Owner->ReleaseThreadCache(*Cache);
+				}
+				else
+				{
+					delete Cache;
+				}
+				Cache = nullptr;
+			}
+		}
+	}
+
+	FThreadCache* Caches[MaxCaches];
+};
+
+// Releases the thread's cache table when the thread exits. Constructed when the thread creates its first cache.
+struct FPoolAllocator::FThreadCacheTableReleaser
+{
+	~FThreadCacheTableReleaser()
+	{
+		GetThreadCacheTable().Release();
+	}
+};
+
+FPoolAllocator::FPoolAllocator(EPoolThreading InThreading /* = EPoolThreading::SingleThreaded */, uint64 InReserveSize /* = DefaultReserveSize */)
+	: Threading(InThreading)
+{
+	// Construct the mutex before the allocator so that, if both are static, the mutex is destroyed last.
+	GetThreadCacheMutex();
+
+	// Page sizes are powers of two up to 64 KB, so the pages after the table are aligned to them. If the range
+	// can't be reserved, every request is served like a large one.
+	uint64 NumReservedPages = InReserveSize / PageSize;
+	uint64 PageTableSize = RoundUp(NumReservedPages * sizeof(FPageInfo), PageSize);
+	ReservationSize = PageTableSize + NumReservedPages * PageSize;
+	ReservationStart = static_cast<int8*>(FPlatformMemory::ReserveVirtualMemory(ReservationSize));
+	if (ReservationStart)
+	{
+		PageInfos = reinterpret_cast<FPageInfo*>(ReservationStart);
+		FirstPage = ReservationStart + PageTableSize;
+		MaxPages = static_cast<int32>(NumReservedPages);
+	}
+
+	for (std::atomic<FFreeBlock*>(&SizeClassBatches)[NumCentralBatches] : CentralBatches)
+	{
+		for (std::atomic<FFreeBlock*>& Batch : SizeClassBatches)
+		{
+			Batch.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+}
+
+FPoolAllocator::~FPoolAllocator()
+{
+	TRACK_ALLOCATOR_DESTROYED(this);
+
+	// Threads still holding caches delete them when they exit, without touching the freed pages.
+	// Caches of threads that already exited are deleted here.
+	{
+		std::lock_guard<std::mutex> CacheLock(GetThreadCacheMutex());
+		FThreadCache* Cache = ThreadCaches;
+		while (Cache)
+		{
+			FThreadCache* NextCache = Cache->NextCache;
+			if (Cache->bIsAbandoned)
+			{
+				delete Cache;
+			}
+			else
+			{
+				Cache->Owner.store(nullptr, std::memory_order_relaxed);
+			}
+			Cache = NextCache;
+		}
+	}
+
+	if (ReservationStart)
+	{
+		FPlatformMemory::ReleaseVirtualMemory(ReservationStart, ReservationSize);
+	}
+}
+
+void* FPoolAllocator::Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment /* = EMemoryAlignment::Default */)
+{
+	// Every block is aligned to at least 8 bytes, which satisfies any EMemoryAlignment.
+	if (InSizeBytes <= 0)
+	{
+		return nullptr;
+	}
+
+	void* Memory = InSizeBytes <= MaxBlockSize ? AllocateBlock(GetSizeClass(InSizeBytes)) : nullptr;
+	if (!Memory)
+	{
+		// Too large for the pools, or the reserved range is full.
+		Memory = AllocateLarge(InSizeBytes);
+	}
+	TRACK_ALLOCATION(this, Memory, InSizeBytes);
+	return Memory;
+}
+
+void FPoolAllocator::Deallocate(void* InAddress)
+{
+	if (!InAddress)
+	{
+		return;
+	}
+	TRACK_DEALLOCATION(this, InAddress);
+
+	if (!IsInPools(InAddress))
+	{
+		DeallocateLarge(InAddress);
+		return;
+	}
+
+	const FPageInfo& Page = GetPageInfo(InAddress);
+	int32 SizeClass = Page.SizeClass;
+	FFreeBlock* Block = static_cast<FFreeBlock*>(InAddress);
+	if (Threading == EPoolThreading::ThreadCached)
+	{
+		FThreadCache* Cache = FindThreadCache();
+		if (Page.Owner && Page.Owner != Cache)
+		{
+			// The block's page belongs to another thread, so hand the block back to that thread.
+			PushRemoteFree(*Page.Owner, Block);
+			return;
+		}
+
+		if (Cache)
+		{
+			Block->Next = Cache->FreeLists[SizeClass];
+			Cache->FreeLists[SizeClass] = Block;
+			++Cache->NumFreeBlocks[SizeClass];
+
+			int32 BatchSize = GetThreadCacheBatchSize(SizeClass);
+			if (Cache->NumFreeBlocks[SizeClass] > 2 * BatchSize)
+			{
+				FlushThreadCache(*Cache, SizeClass, BatchSize);
+			}
+			return;
+		}
+	}
+
+	std::unique_lock<std::mutex> Lock = LockPools(Mutex, Threading);
+	PushBlock(SizeClass, Block);
+}
+
+/*static*/ int32 FPoolAllocator::GetBlockSize(int32 InSizeBytes)
+{
+	if (InSizeBytes <= 0 || InSizeBytes > MaxBlockSize)
+	{
+		return FMath::Max(InSizeBytes, 0);
+	}
+	return SizeClassSizes[GetSizeClass(InSizeBytes)];
+}
+
+int32 FPoolAllocator::GetNumPages()
+{
+	std::unique_lock<std::mutex> Lock = LockPools(Mutex, Threading);
+	return NumPages;
+}
+
+/*static*/ FPoolAllocator& FPoolAllocator::GetDefaultAllocator()
+{
+	return FMemoryManager::Get().GetPoolAllocator();
+}
+
+/*static*/ FPoolAllocator& FPoolAllocator::GetPersistentAllocator()
+{
+	return FMemoryManager::Get().GetPersistentPoolAllocator();
+}
+
+void* FPoolAllocator::AllocateBlock(int32 InSizeClass)
+{
+	if (Threading == EPoolThreading::ThreadCached)
+	{
+		if (FThreadCache* Cache = FindThreadCache())
+		{
+			if (!Cache->FreeLists[InSizeClass])
+			{
+				RefillThreadCache(*Cache, InSizeClass);
+			}
+
+			FFreeBlock* Block = Cache->FreeLists[InSizeClass];
+			if (Block)
+			{
+				Cache->FreeLists[InSizeClass] = Block->Next;
+				--Cache->NumFreeBlocks[InSizeClass];
+			}
+			return Block;
+		}
+	}
+
+	std::unique_lock<std::mutex> Lock = LockPools(Mutex, Threading);
+	return PopBlock(InSizeClass);
+}
+
+// Pool operations.
+void* FPoolAllocator::PopBlock(int32 InSizeClass, FThreadCache* InPageOwner /* = nullptr */)
+{
+	FSizeClassPool& Pool = Pools[InSizeClass];
+	if (!Pool.FreeList && !AddSpan(InSizeClass, InPageOwner))
+	{
+		return nullptr;
+	}
+
+	FFreeBlock* Block = Pool.FreeList;
+	Pool.FreeList = Block->Next;
+	return Block;
+}
+
+void FPoolAllocator::PushBlock(int32 InSizeClass, FFreeBlock* InBlock)
+{
+	FSizeClassPool& Pool = Pools[InSizeClass];
+	InBlock->Next = Pool.FreeList;
+	Pool.FreeList = InBlock;
+}
+
+bool FPoolAllocator::AddSpan(int32 InSizeClass, FThreadCache* InPageOwner)
+{
+	int32 NumSpanPages = GetNumPagesPerSpan(InSizeClass);
+	if (NumSpanPages > MaxPages - NumPages)
+	{
+		return false;
+	}
+
+	// Commit the table entries of the new pages first, a page of the table at a time.
+	uint64 NumPageInfoBytesNeeded = RoundUp((NumPages + NumSpanPages) * sizeof(FPageInfo), PageSize);
+	if (NumPageInfoBytesNeeded > NumPageInfoBytesCommitted)
+	{
+		if (!FPlatformMemory::CommitVirtualMemory(ReservationStart + NumPageInfoBytesCommitted, NumPageInfoBytesNeeded - NumPageInfoBytesCommitted, false))
+		{
+			return false;
+		}
+		NumPageInfoBytesCommitted = NumPageInfoBytesNeeded;
+	}
+
+	int8* SpanMemory = FirstPage + static_cast<uint64>(NumPages) * PageSize;
+	if (!FPlatformMemory::CommitVirtualMemory(SpanMemory, static_cast<uint64>(NumSpanPages) * PageSize, false))
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < NumSpanPages; ++Index)
+	{
+		PageInfos[NumPages + Index] = FPageInfo{ InSizeClass, InPageOwner };
+	}
+	NumPages += NumSpanPages;
+
+	// Link the blocks in address order, so that consecutive allocations are adjacent in memory.
+	FSizeClassPool& Pool = Pools[InSizeClass];
+	int32 BlockSize = SizeClassSizes[InSizeClass];
+	int32 NumBlocks = NumSpanPages * PageSize / BlockSize;
+	int8* FirstBlock = SpanMemory;
+	FFreeBlock* Next = Pool.FreeList;
+	for (int32 Index = NumBlocks - 1; Index >= 0; --Index)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(FirstBlock + Index * BlockSize);
+		Block->Next = Next;
+		Next = Block;
+	}
+	Pool.FreeList = Next;
+	return true;
+}
+
+// Thread cache operations.
+FPoolAllocator::FThreadCache* FPoolAllocator::FindThreadCache()
+{
+	FThreadCacheTable& Table = GetThreadCacheTable();
+	for (FThreadCache* Cache : Table.Caches)
+	{
+		if (Cache && Cache->Owner.load(std::memory_order_relaxed) == this)
+		{
+			return Cache;
+		}
+	}
+	return CreateThreadCache(Table);
+}
+
+FPoolAllocator::FThreadCache* FPoolAllocator::CreateThreadCache(FThreadCacheTable& InTable)
+{
+	thread_local FThreadCacheTableReleaser Releaser;
+	std::lock_guard<std::mutex> CacheLock(GetThreadCacheMutex());
+
+	// Delete caches whose allocators were destroyed to make room.
+	FThreadCache** FreeSlot = nullptr;
+	for (FThreadCache*& Cache : InTable.Caches)
+	{
+		if (Cache && !Cache->Owner.load(std::memory_order_relaxed))
+		{
+			delete Cache;
+			Cache = nullptr;
+		}
+		if (!Cache && !FreeSlot)
+		{
+			FreeSlot = &Cache;
+		}
+	}
+	if (!FreeSlot)
+	{
+		return nullptr;
+	}
+
+	// Reuse the cache of a thread that exited, along with its pages, before creating a new one.
+	FThreadCache* Cache = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		for (FThreadCache* AbandonedCache = ThreadCaches; AbandonedCache; AbandonedCache = AbandonedCache->NextCache)
+		{
+			if (AbandonedCache->bIsAbandoned)
+			{
+				AbandonedCache->bIsAbandoned = false;
+				Cache = AbandonedCache;
+				break;
+			}
+		}
+
+		if (!Cache)
+		{
+			Cache = new FThreadCache;
+			Cache->Owner.store(this, std::memory_order_relaxed);
+			Cache->NextCache = ThreadCaches;
+			ThreadCaches = Cache;
+		}
+	}
+	*FreeSlot = Cache;
+	return Cache;
+}
+
+void FPoolAllocator::RefillThreadCache(FThreadCache& InCache, int32 InSizeClass)
+{
+	// Take back the blocks other threads freed first, then a batch another thread gave up,
+	// and only then take the lock to get blocks from the pools.
+	if (InCache.RemoteFrees.load(std::memory_order_relaxed))
+	{
+		DrainRemoteFrees(InCache);
+		if (InCache.FreeLists[InSizeClass])
+		{
+			return;
+		}
+	}
+
+	int32 BatchSize = GetThreadCacheBatchSize(InSizeClass);
+	if (FFreeBlock* Batch = PopCentralBatch(InSizeClass))
+	{
+		InCache.FreeLists[InSizeClass] = Batch;
+		InCache.NumFreeBlocks[InSizeClass] = BatchSize;
+		return;
+	}
+
+	// Fewer blocks than a batch, possibly none, are left once the reserved range is full.
+	std::lock_guard<std::mutex> Lock(Mutex);
+	for (int32 Index = 0; Index < BatchSize; ++Index)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(PopBlock(InSizeClass, &InCache));
+		if (!Block)
+		{
+			break;
+		}
+		Block->Next = InCache.FreeLists[InSizeClass];
+		InCache.FreeLists[InSizeClass] = Block;
+		++InCache.NumFreeBlocks[InSizeClass];
+	}
+}
+
+void FPoolAllocator::FlushThreadCache(FThreadCache& InCache, int32 InSizeClass, int32 InNumBlocks)
+{
+	// Give whole batches to the central cache while it has room.
+	int32 BatchSize = GetThreadCacheBatchSize(InSizeClass);
+	while (InNumBlocks >= BatchSize)
+	{
+		FFreeBlock* Batch = InCache.FreeLists[InSizeClass];
+		FFreeBlock* LastBlock = Batch;
+		for (int32 Index = 1; Index < BatchSize; ++Index)
+		{
+			LastBlock = LastBlock->Next;
+		}
+		FFreeBlock* RemainingBlocks = LastBlock->Next;
+		LastBlock->Next = nullptr;
+		if (!PushCentralBatch(InSizeClass, Batch))
+		{
+			LastBlock->Next = RemainingBlocks;
+			break;
+		}
+
+		InCache.FreeLists[InSizeClass] = RemainingBlocks;
+		InCache.NumFreeBlocks[InSizeClass] -= BatchSize;
+		InNumBlocks -= BatchSize;
+	}
+
+	if (InNumBlocks == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	for (int32 Index = 0; Index < InNumBlocks && InCache.FreeLists[InSizeClass]; ++Index)
+	{
+		FFreeBlock* Block = InCache.FreeLists[InSizeClass];
+		InCache.FreeLists[InSizeClass] = Block->Next;
+		--InCache.NumFreeBlocks[InSizeClass];
+		PushBlock(InSizeClass, Block);
+	}
+}
+
+void FPoolAllocator::ReleaseThreadCache(FThreadCache& InCache)
+{
+	DrainRemoteFrees(InCache);
+	for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		FlushThreadCache(InCache, SizeClass, InCache.NumFreeBlocks[SizeClass]);
+	}
+
+	// Other threads can still free blocks of the cache's pages, so the cache stays in the list until a new thread reuses it.
+	std::lock_guard<std::mutex> Lock(Mutex);
+	InCache.bIsAbandoned = true;
+}
+
+/*static*/ FPoolAllocator::FThreadCacheTable& FPoolAllocator::GetThreadCacheTable()
+{
+	thread_local FThreadCacheTable Table;
+	return Table;
+}
+
+// Remote frees and the central cache.
+/*static*/ void FPoolAllocator::PushRemoteFree(FThreadCache& InPageOwner, FFreeBlock* InBlock)
+{
+	// Only the owner removes blocks, and always the whole queue at once, so pushing can't suffer from ABA.
+	FFreeBlock* Head = InPageOwner.RemoteFrees.load(std::memory_order_relaxed);
+	do
+	{
+		InBlock->Next = Head;
+	}
+	while (!InPageOwner.RemoteFrees.compare_exchange_weak(Head, InBlock, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void FPoolAllocator::DrainRemoteFrees(FThreadCache& InCache)
+{
+	FFreeBlock* Block = InCache.RemoteFrees.exchange(nullptr, std::memory_order_acquire);
+	while (Block)
+	{
+		FFreeBlock* NextBlock = Block->Next;
+		int32 SizeClass = GetPageInfo(Block).SizeClass;
+		Block->Next = InCache.FreeLists[SizeClass];
+		InCache.FreeLists[SizeClass] = Block;
+		++InCache.NumFreeBlocks[SizeClass];
+		Block = NextBlock;
+	}
+}
+
+bool FPoolAllocator::PushCentralBatch(int32 InSizeClass, FFreeBlock* InBatch)
+{
+	// Slots only go from empty to full by compare-exchange, and from full to empty by exchange,
+	// so a batch is never taken twice.
+	for (std::atomic<FFreeBlock*>& Slot : CentralBatches[InSizeClass])
+	{
+		FFreeBlock* Expected = nullptr;
+		if (!Slot.load(std::memory_order_relaxed) && Slot.compare_exchange_strong(Expected, InBatch, std::memory_order_release, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FPoolAllocator::FFreeBlock* FPoolAllocator::PopCentralBatch(int32 InSizeClass)
+{
+	for (std::atomic<FFreeBlock*>& Slot : CentralBatches[InSizeClass])
+	{
+		if (Slot.load(std::memory_order_relaxed))
+		{
+			if (FFreeBlock* Batch = Slot.exchange(nullptr, std::memory_order_acquire))
+			{
+				return Batch;
+			}
+		}
+	}
+	return nullptr;
+}
+
+FPoolAllocator::FPageInfo& FPoolAllocator::GetPageInfo(const void* InAddress) const
+{
+	return PageInfos[(static_cast<const int8*>(InAddress) - FirstPage) / PageSize];
+}
+
+// Large allocations.
+/*static*/ void* FPoolAllocator::AllocateLarge(int32 InSizeBytes)
+{
+	void* Memory = ::operator new(sizeof(FLargeHeader) + InSizeBytes);
+	new (Memory) FLargeHeader{ static_cast<uint64>(InSizeBytes), LargeBlockMagic };
+	return static_cast<int8*>(Memory) + sizeof(FLargeHeader);
+}
+
+/*static*/ void FPoolAllocator::DeallocateLarge(void* InAddress)
+{
+	FLargeHeader* Header = reinterpret_cast<FLargeHeader*>(static_cast<int8*>(InAddress) - sizeof(FLargeHeader));
+	ensure(Header->Magic == LargeBlockMagic);
+	Header->Magic = 0;
+	::operator delete(Header);
+}
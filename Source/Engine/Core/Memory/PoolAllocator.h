@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "IAllocator.h"
+#include "Alignment.h"
+
+// System includes for the pool lock and the lock-free central cache.
+#include <atomic>
+#include <mutex>
+
+/**
+ * How a pool allocator can be used from several threads.
+ */
+enum class EPoolThreading : uint8
+{
+	// No synchronization. Only one thread may use the allocator at a time.
+	SingleThreaded,
+	// A lock protects the pools, so any thread can allocate and deallocate.
+	Locked,
+	// Like Locked, but each thread also keeps a cache of free blocks per size class, so most allocations
+	// and deallocations don't take the lock. Blocks freed by another thread go back to the thread that
+	// carved them through a lock-free queue, and surplus blocks move between threads in lock-free batches.
+	ThreadCached
+};
+
+/**
+ * Allocates small and medium objects, such as control blocks and container storage, from pools of fixed-size blocks.
+ *
+ * Requests are rounded up to one of a few size classes, spaced at most a quarter apart above 512 bytes. Each size
+ * class carves blocks out of spans of 64 KB pages and keeps the free ones in an intrusive list (a free block stores
+ * the address of the next one), so allocating and deallocating are a few pointer operations.
+ *
+ * The allocator reserves a range of address space up front and commits pages in it as the pools grow. A table at
+ * the start of the range names the size class of each page, which lets Deallocate find a block's pool from its
+ * address alone, and keeps the pages themselves free of headers. Requests larger than the largest size class,
+ * and any request once the range is full, come from the system with a small header in front of the block.
+ *
+ * Thread-cached allocators are built for many threads allocating at once, including producer/consumer
+ * patterns where one thread frees what another allocated:
+ * - Each thread has its own free lists per size class, and pages carved for a thread belong to it.
+ * - A block freed by a thread other than its page's owner is pushed onto the owner's remote-free queue with
+ *   a single atomic operation. The owner takes the whole queue at once when its own free list runs out.
+ * - A thread that collects more free blocks than it needs gives a batch of them to a lock-free central cache,
+ *   where any thread can take the whole batch with a single atomic operation.
+ * - The lock is only taken when the central cache is empty or full, and to carve new pages.
+ *
+ * Blocks are aligned to at least 8 bytes, and blocks of 16 bytes or more to 16 bytes.
+ * Pages are returned to the system when the allocator is destroyed.
+ */
+class FPoolAllocator : public IAllocator
+{
+public:
+	// Size of the pages blocks are carved from.
+	static constexpr int32 PageSize = 64 * 1024;
+	// Largest request served from the pools.
+	static constexpr int32 MaxBlockSize = 32 * 1024;
+	static constexpr int32 NumSizeClasses = 35;
+	// Address space reserved for the pools by default. Only the pages in use are committed.
+	static constexpr uint64 DefaultReserveSize = 4ull * 1024 * 1024 * 1024;
+	// Number of batches of free blocks the central cache holds per size class.
+	static constexpr int32 NumCentralBatches = 8;
+
+	/**
+	 * Constructor. Reserves address space for the pools. Pages are committed on demand.
+	 *
+	 * @param InThreading: Which threads may use the allocator.
+	 * @param InReserveSize: Largest number of bytes of pages the pools can hold.
+	 */
+	explicit FPoolAllocator(EPoolThreading InThreading = EPoolThreading::SingleThreaded, uint64 InReserveSize = DefaultReserveSize);
+
+	// Destructor. Releases all pages, so every block must have been deallocated or be no longer used.
+	~FPoolAllocator();
+
+	// Non-copyable.
+	FPoolAllocator(const FPoolAllocator&) = delete;
+	FPoolAllocator& operator=(const FPoolAllocator&) = delete;
+
+	// Begin IAllocator interface.
+	virtual void* Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment = EMemoryAlignment::Default) override;
+	virtual void  Deallocate(void* InAddress) override;
+	// End IAllocator interface.
+
+	// Returns the number of usable bytes in a block allocated for the given size.
+	static int32 GetBlockSize(int32 InSizeBytes);
+
+	// Returns the number of pages committed for the pools, not counting large allocations.
+	int32 GetNumPages();
+
+	EPoolThreading GetThreading() const
+	{
+		return Threading;
+	}
+
+	static FPoolAllocator& GetDefaultAllocator();
+
+	// Returns the pool for registries that live until the program exits, whose allocations aren't reported as leaks.
+	static FPoolAllocator& GetPersistentAllocator();
+
+private:
+	struct FFreeBlock;
+	struct FPageInfo;
+	struct FThreadCache;
+	struct FThreadCacheTable;
+	struct FThreadCacheTableReleaser;
+
+	struct FSizeClassPool
+	{
+		FFreeBlock* FreeList = nullptr;
+	};
+
+	// Returns a block of a size class from the calling thread's cache or the pools, or nullptr if the pools are full.
+	void* AllocateBlock(int32 InSizeClass);
+
+	// Pool operations. The lock must be held unless the allocator is single-threaded.
+	// Pages carved for a thread cache belong to it. PopBlock returns nullptr if the pools are full.
+	void* PopBlock(int32 InSizeClass, FThreadCache* InPageOwner = nullptr);
+	void PushBlock(int32 InSizeClass, FFreeBlock* InBlock);
+	bool AddSpan(int32 InSizeClass, FThreadCache* InPageOwner);
+
+	// Thread cache operations.
+	FThreadCache* FindThreadCache();
+	FThreadCache* CreateThreadCache(FThreadCacheTable& InTable);
+	void RefillThreadCache(FThreadCache& InCache, int32 InSizeClass);
+	void FlushThreadCache(FThreadCache& InCache, int32 InSizeClass, int32 InNumBlocks);
+	void ReleaseThreadCache(FThreadCache& InCache);
+	static FThreadCacheTable& GetThreadCacheTable();
+
+	// Remote frees and the central cache. These don't take the lock.
+	static void PushRemoteFree(FThreadCache& InPageOwner, FFreeBlock* InBlock);
+	void DrainRemoteFrees(FThreadCache& InCache);
+	bool PushCentralBatch(int32 InSizeClass, FFreeBlock* InBatch);
+	FFreeBlock* PopCentralBatch(int32 InSizeClass);
+
+	// Returns whether an address is in the pools' pages, rather than a large allocation.
+	bool IsInPools(const void* InAddress) const
+	{
+		const int8* Address = static_cast<const int8*>(InAddress);
+		return Address >= FirstPage && Address < FirstPage + static_cast<uint64>(MaxPages) * PageSize;
+	}
+
+	// Returns the entry of the page containing a block.
+	FPageInfo& GetPageInfo(const void* InAddress) const;
+
+	static void* AllocateLarge(int32 InSizeBytes);
+	static void DeallocateLarge(void* InAddress);
+
+	FSizeClassPool Pools[NumSizeClasses];
+	// Reserved address range: the page table, followed by room for MaxPages pages.
+	int8* ReservationStart = nullptr;
+	uint64 ReservationSize = 0;
+	FPageInfo* PageInfos = nullptr;
+	int8* FirstPage = nullptr;
+	int32 MaxPages = 0;
+	// Pages are committed in order, so the first NumPages pages are in use.
+	int32 NumPages = 0;
+	uint64 NumPageInfoBytesCommitted = 0;
+	EPoolThreading Threading;
+	// Protects the pools when the allocator isn't single-threaded.
+	std::mutex Mutex;
+	// Caches created by threads that used this allocator, if it is thread-cached. Caches of threads that exited
+	// stay in the list, since other threads may still free blocks to them, and are reused by new threads.
+	FThreadCache* ThreadCaches = nullptr;
+	// Full batches of free blocks per size class, each a list of GetThreadCacheBatchSize blocks. Empty slots are nullptr.
+	std::atomic<FFreeBlock*> CentralBatches[NumSizeClasses][NumCentralBatches];
+};
@@ -0,0 +1,341 @@
+#include "TLSFAllocator.h"
+#include "MemoryManager.h"
+#include "MemoryTracker.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
+
+namespace
+{
+	// Set in a block's size while the block is free.
+	constexpr uint64 FreeFlag = 1;
+	// Bytes before the memory of every block.
+	constexpr uint64 BlockOverhead = 16;
+	// Smallest block size, which leaves room for the free list links.
+	constexpr uint64 MinBlockSize = 16;
+
+	// Rounds a value up to a multiple of a power-of-two alignment.
+	uint64 RoundUp(uint64 InValue, uint64 InAlignment)
+	{
+		return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+	}
+}
+
+struct FTLSFAllocator::FBlockHeader
+{
+	// Block just before this one in memory, or nullptr for the first block.
+	FBlockHeader* PrevPhysical;
+	// Size of the block's memory after the header, with FreeFlag set while the block is free.
+	uint64 SizeAndFlags;
+	// Free list links. These are stored in the block's memory, so they're only valid while the block is free.
+	FBlockHeader* NextFree;
+	FBlockHeader* PrevFree;
+
+	uint64 GetSize() const
+	{
+		return SizeAndFlags & ~FreeFlag;
+	}
+
+	void SetSize(uint64 InSize)
+	{
+		SizeAndFlags = InSize | (SizeAndFlags & FreeFlag);
+	}
+
+	bool IsFree() const
+	{
+		return (SizeAndFlags & FreeFlag) != 0;
+	}
+
+	void SetFree(bool bInIsFree)
+	{
+		SizeAndFlags = bInIsFree ? (SizeAndFlags | FreeFlag) : (SizeAndFlags & ~FreeFlag);
+	}
+
+	void* GetMemory()
+	{
+		return reinterpret_cast<int8*>(this) + BlockOverhead;
+	}
+
+	// Block just after this one in memory. The last block is followed by a zero-size sentinel that's never free.
+	FBlockHeader* GetNextPhysical()
+	{
+		return reinterpret_cast<FBlockHeader*>(static_cast<int8*>(GetMemory()) + GetSize());
+	}
+
+	static FBlockHeader* FromMemory(const void* InAddress)
+	{
+		return reinterpret_cast<FBlockHeader*>(const_cast<int8*>(static_cast<const int8*>(InAddress)) - BlockOverhead);
+	}
+};
+
+FTLSFAllocator::FTLSFAllocator(void* InStart, uint64 InCapacity)
+{
+	// Keep every header and block 8-byte aligned.
+	uint64 Start = RoundUp(reinterpret_cast<uint64>(InStart), 1ull << AlignmentLog2);
+	uint64 End = (reinterpret_cast<uint64>(InStart) + InCapacity) & ~((1ull << AlignmentLog2) - 1);
+	ensure(End >= Start + 2 * BlockOverhead + MinBlockSize);
+
+	// The memory holds one free block followed by the sentinel's header.
+	uint64 BlockSize = FMath::Min(End - Start - 2 * BlockOverhead, (1ull << FirstLevelMax) - (1ull << AlignmentLog2));
+	FBlockHeader* Block = reinterpret_cast<FBlockHeader*>(Start);
+	Block->PrevPhysical = nullptr;
+	Block->SizeAndFlags = BlockSize;
+
+	FBlockHeader* Sentinel = Block->GetNextPhysical();
+	Sentinel->PrevPhysical = Block;
+	Sentinel->SizeAndFlags = 0;
+
+	InsertFreeBlock(Block);
+}
+
+FTLSFAllocator::~FTLSFAllocator()
+{
+	TRACK_ALLOCATOR_DESTROYED(this);
+}
+
+void* FTLSFAllocator::Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment /* = EMemoryAlignment::Default */)
+{
+	return InSizeBytes > 0 ? AllocateAligned(static_cast<uint64>(InSizeBytes), static_cast<uint64>(InAlignment)) : nullptr;
+}
+
+void FTLSFAllocator::Deallocate(void* InAddress)
+{
+	if (!InAddress)
+	{
+		return;
+	}
+
+	TRACK_DEALLOCATION(this, InAddress);
+
+	FBlockHeader* Block = FBlockHeader::FromMemory(InAddress);
+	ensure(!Block->IsFree());
+	NumBytesUsed -= Block->GetSize();
+
+	// Merge with the neighboring blocks if they're free, so free memory is never split into adjacent blocks.
+	FBlockHeader* PrevBlock = Block->PrevPhysical;
+	if (PrevBlock && PrevBlock->IsFree())
+	{
+		RemoveFreeBlock(PrevBlock);
+		PrevBlock->SetSize(PrevBlock->GetSize() + BlockOverhead + Block->GetSize());
+		Block = PrevBlock;
+		Block->GetNextPhysical()->PrevPhysical = Block;
+	}
+
+	FBlockHeader* NextBlock = Block->GetNextPhysical();
+	if (NextBlock->IsFree())
+	{
+		RemoveFreeBlock(NextBlock);
+		Block->SetSize(Block->GetSize() + BlockOverhead + NextBlock->GetSize());
+		Block->GetNextPhysical()->PrevPhysical = Block;
+	}
+
+	InsertFreeBlock(Block);
+}
+
+void* FTLSFAllocator::AllocateAligned(uint64 InSizeBytes, uint64 InAlignment)
+{
+	ensure(InAlignment > 0 && (InAlignment & (InAlignment - 1)) == 0);
+	if (!InSizeBytes || InSizeBytes >= (1ull << FirstLevelMax))
+	{
+		return nullptr;
+	}
+
+	uint64 Size = FMath::Max(RoundUp(InSizeBytes, 1ull << AlignmentLog2), MinBlockSize);
+
+	// For larger alignments, look for a block that can have its start moved forward to an aligned address,
+	// with the skipped bytes large enough to become a free block of their own.
+	const uint64 MinGapSize = BlockOverhead + MinBlockSize;
+	bool bNeedsGap = InAlignment > (1ull << AlignmentLog2);
+	FBlockHeader* Block = FindFreeBlock(bNeedsGap ? Size + InAlignment + MinGapSize : Size);
+	if (!Block)
+	{
+		return nullptr;
+	}
+	RemoveFreeBlock(Block);
+
+	if (bNeedsGap)
+	{
+		uint64 Memory = reinterpret_cast<uint64>(Block->GetMemory());
+		uint64 AlignedMemory = RoundUp(Memory, InAlignment);
+		if (AlignedMemory != Memory && AlignedMemory - Memory < MinGapSize)
+		{
+			AlignedMemory = RoundUp(Memory + MinGapSize, InAlignment);
+		}
+		if (AlignedMemory != Memory)
+		{
+			Block = TrimBlockFront(Block, AlignedMemory - Memory);
+		}
+	}
+
+	TrimBlock(Block, Size);
+	NumBytesUsed += Block->GetSize();
+	TRACK_ALLOCATION(this, Block->GetMemory(), InSizeBytes);
+	return Block->GetMemory();
+}
+
+/*static*/ uint64 FTLSFAllocator::GetAllocationSize(const void* InAddress)
+{
+	return FBlockHeader::FromMemory(InAddress)->GetSize();
+}
+
+uint64 FTLSFAllocator::GetLargestFreeBlockSize() const
+{
+	if (!FirstLevelBitmap)
+	{
+		return 0;
+	}
+
+	// The largest block is in the highest non-empty list, but that list isn't sorted.
+	int32 FirstLevel = FMath::FloorLog2(FirstLevelBitmap);
+	int32 SecondLevel = FMath::FloorLog2(SecondLevelBitmaps[FirstLevel]);
+	uint64 LargestSize = 0;
+	for (FBlockHeader* Block = FreeLists[FirstLevel][SecondLevel]; Block; Block = Block->NextFree)
+	{
+		LargestSize = FMath::Max(LargestSize, Block->GetSize());
+	}
+	return LargestSize;
+}
+
+float FTLSFAllocator::GetFragmentation() const
+{
+	if (!NumBytesFree)
+	{
+		return 0.0f;
+	}
+	return 1.0f - static_cast<float>(static_cast<double>(GetLargestFreeBlockSize()) / static_cast<double>(NumBytesFree));
+}
+
+/*static*/ FTLSFAllocator& FTLSFAllocator::GetDefaultAllocator()
+{
+	return FMemoryManager::Get().GetTLSFAllocator();
+}
+
+/*static*/ void FTLSFAllocator::MapSizeToLists(uint64 InSize, int32& OutFirstLevel, int32& OutSecondLevel)
+{
+	if (InSize < SmallBlockSize)
+	{
+		OutFirstLevel = 0;
+		OutSecondLevel = static_cast<int32>(InSize >> AlignmentLog2);
+	}
+	else
+	{
+		// The first level is the power of two below the size, and the second level comes from the next bits.
+		int32 Log2 = FMath::FloorLog2(InSize);
+		OutFirstLevel = Log2 - (FirstLevelShift - 1);
+		OutSecondLevel = static_cast<int32>(InSize >> (Log2 - SecondLevelCountLog2)) ^ SecondLevelCount;
+	}
+}
+
+FTLSFAllocator::FBlockHeader* FTLSFAllocator::FindFreeBlock(uint64 InSize) const
+{
+	// Blocks in a list can be smaller than the size, so round it up to the start of the next list.
+	// Every block in the list found is then large enough.
+	if (InSize >= SmallBlockSize)
+	{
+		InSize += (1ull << (FMath::FloorLog2(InSize) - SecondLevelCountLog2)) - 1;
+		if (InSize >= (1ull << FirstLevelMax))
+		{
+			return nullptr;
+		}
+	}
+
+	int32 FirstLevel;
+	int32 SecondLevel;
+	MapSizeToLists(InSize, FirstLevel, SecondLevel);
+
+	// Look for a list of larger blocks at the same first level, then at the higher ones.
+	uint32 SecondLevelBitmap = SecondLevelBitmaps[FirstLevel] & (~0u << SecondLevel);
+	if (!SecondLevelBitmap)
+	{
+		uint64 FirstLevelBitmapAbove = FirstLevelBitmap & (~0ull << (FirstLevel + 1));
+		if (!FirstLevelBitmapAbove)
+		{
+			return nullptr;
+		}
+		FirstLevel = FMath::CountTrailingZeros(FirstLevelBitmapAbove);
+		SecondLevelBitmap = SecondLevelBitmaps[FirstLevel];
+	}
+	SecondLevel = FMath::CountTrailingZeros(SecondLevelBitmap);
+	return FreeLists[FirstLevel][SecondLevel];
+}
+
+void FTLSFAllocator::InsertFreeBlock(FBlockHeader* InBlock)
+{
+	int32 FirstLevel;
+	int32 SecondLevel;
+	MapSizeToLists(InBlock->GetSize(), FirstLevel, SecondLevel);
+
+	FBlockHeader*& Head = FreeLists[FirstLevel][SecondLevel];
+	InBlock->NextFree = Head;
+	InBlock->PrevFree = nullptr;
+	if (Head)
+	{
+		Head->PrevFree = InBlock;
+	}
+	Head = InBlock;
+
+	FirstLevelBitmap |= 1ull << FirstLevel;
+	SecondLevelBitmaps[FirstLevel] |= 1u << SecondLevel;
+	InBlock->SetFree(true);
+	NumBytesFree += InBlock->GetSize();
+}
+
+void FTLSFAllocator::RemoveFreeBlock(FBlockHeader* InBlock)
+{
+	int32 FirstLevel;
+	int32 SecondLevel;
+	MapSizeToLists(InBlock->GetSize(), FirstLevel, SecondLevel);
+
+	if (InBlock->NextFree)
+	{
+		InBlock->NextFree->PrevFree = InBlock->PrevFree;
+	}
+	if (InBlock->PrevFree)
+	{
+		InBlock->PrevFree->NextFree = InBlock->NextFree;
+	}
+	else
+	{
+		FreeLists[FirstLevel][SecondLevel] = InBlock->NextFree;
+		if (!InBlock->NextFree)
+		{
+			SecondLevelBitmaps[FirstLevel] &= ~(1u << SecondLevel);
+			if (!SecondLevelBitmaps[FirstLevel])
+			{
+				FirstLevelBitmap &= ~(1ull << FirstLevel);
+			}
+		}
+	}
+
+	InBlock->SetFree(false);
+	NumBytesFree -= InBlock->GetSize();
+}
+
+void FTLSFAllocator::TrimBlock(FBlockHeader* InBlock, uint64 InSize)
+{
+	// Only split if the remainder can hold a block.
+	if (InBlock->GetSize() < InSize + BlockOverhead + MinBlockSize)
+	{
+		return;
+	}
+
+	FBlockHeader* Remainder = reinterpret_cast<FBlockHeader*>(static_cast<int8*>(InBlock->GetMemory()) + InSize);
+	Remainder->PrevPhysical = InBlock;
+	Remainder->SizeAndFlags = InBlock->GetSize() - InSize - BlockOverhead;
+	InBlock->SetSize(InSize);
+	Remainder->GetNextPhysical()->PrevPhysical = Remainder;
+
+	// Blocks taken from the free lists never have free neighbors, so the remainder doesn't need merging.
+	InsertFreeBlock(Remainder);
+}
+
+FTLSFAllocator::FBlockHeader* FTLSFAllocator::TrimBlockFront(FBlockHeader* InBlock, uint64 InGap)
+{
+	FBlockHeader* Remainder = reinterpret_cast<FBlockHeader*>(reinterpret_cast<int8*>(InBlock) + InGap);
+	Remainder->PrevPhysical = InBlock;
+	Remainder->SizeAndFlags = InBlock->GetSize() - InGap;
+	InBlock->SizeAndFlags = InGap - BlockOverhead;
+	Remainder->GetNextPhysical()->PrevPhysical = Remainder;
+
+	InsertFreeBlock(InBlock);
+	return Remainder;
+}
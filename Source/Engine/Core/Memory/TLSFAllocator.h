@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "IAllocator.h"
+#include "Alignment.h"
+
+/**
+ * General-purpose allocator over a fixed memory region, using the Two-Level Segregated Fit algorithm
+ * (Masmano et al., "TLSF: a New Dynamic Memory Allocator for Real-Time Systems").
+ *
+ * Free blocks are kept in lists segregated by size: the first level splits sizes by powers of two, and the
+ * second level splits each power of two into 32 ranges. A bitmap per level records which lists are non-empty,
+ * so finding a block that fits takes a couple of bit scans. Allocating and deallocating therefore take constant
+ * time regardless of the heap's state, and adjacent free blocks are merged immediately, which keeps
+ * fragmentation low.
+ *
+ * Each block has a 16-byte header, and allocations are 8-byte aligned unless more is requested through
+ * AllocateAligned. The allocator isn't thread-safe.
+ */
+class FTLSFAllocator : public IAllocator
+{
+public:
+	/**
+	 * Constructor. Manages the given memory as a single free block.
+	 * Clients must provide the allocator memory themselves.
+	 *
+	 * @param InStart: Starting address of the allocator's memory.
+	 * @param InCapacity: Total size in bytes of the allocator's memory.
+	 */
+	explicit FTLSFAllocator(void* InStart, uint64 InCapacity);
+
+	// Destructor. The allocator's memory is owned by the client.
+	~FTLSFAllocator();
+
+	// Non-copyable.
+	FTLSFAllocator(const FTLSFAllocator&) = delete;
+	FTLSFAllocator& operator=(const FTLSFAllocator&) = delete;
+
+	// Begin IAllocator interface.
+	virtual void* Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment = EMemoryAlignment::Default) override;
+	virtual void  Deallocate(void* InAddress) override;
+	// End IAllocator interface.
+
+	/**
+	 * Allocates memory with a 64-bit size and any power-of-two alignment.
+	 *
+	 * @returns The allocated memory, or nullptr if InSizeBytes is 0 or no free block is large enough.
+	 */
+	void* AllocateAligned(uint64 InSizeBytes, uint64 InAlignment);
+
+	// Returns the usable size of an allocation, which can be larger than requested.
+	static uint64 GetAllocationSize(const void* InAddress);
+
+	// Returns the number of bytes in allocated blocks, not counting headers.
+	uint64 GetNumBytesUsed() const
+	{
+		return NumBytesUsed;
+	}
+
+	// Returns the number of bytes in free blocks, not counting headers.
+	uint64 GetNumBytesFree() const
+	{
+		return NumBytesFree;
+	}
+
+	// Returns the size of the largest free block.
+	uint64 GetLargestFreeBlockSize() const;
+
+	/**
+	 * Returns how fragmented free memory is, from 0 when it is one contiguous block
+	 * to close to 1 when it is split into many small blocks.
+	 */
+	float GetFragmentation() const;
+
+	static FTLSFAllocator& GetDefaultAllocator();
+
+	// Number of second-level lists per power of two, as a power of two.
+	static constexpr int32 SecondLevelCountLog2 = 5;
+	static constexpr int32 SecondLevelCount = 1 << SecondLevelCountLog2;
+	// Block sizes are multiples of this.
+	static constexpr int32 AlignmentLog2 = 3;
+	// Sizes below this share the first first-level list, with second-level lists 8 bytes apart.
+	static constexpr int32 FirstLevelShift = SecondLevelCountLog2 + AlignmentLog2;
+	static constexpr uint64 SmallBlockSize = 1ull << FirstLevelShift;
+	// Largest supported block size is 2^FirstLevelMax.
+	static constexpr int32 FirstLevelMax = 40;
+	static constexpr int32 FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+
+private:
+	struct FBlockHeader;
+
+	// Converts a size to the first and second level indices of the list it belongs to.
+	static void MapSizeToLists(uint64 InSize, int32& OutFirstLevel, int32& OutSecondLevel);
+	// Finds a non-empty list whose blocks are all at least InSize bytes, or returns nullptr.
+	FBlockHeader* FindFreeBlock(uint64 InSize) const;
+
+	void InsertFreeBlock(FBlockHeader* InBlock);
+	void RemoveFreeBlock(FBlockHeader* InBlock);
+	// Splits the block so it is InSize bytes long, returning the remainder to the free lists.
+	void TrimBlock(FBlockHeader* InBlock, uint64 InSize);
+	// Splits off the first InGap bytes of a free block as a free block, returning the rest.
+	FBlockHeader* TrimBlockFront(FBlockHeader* InBlock, uint64 InGap);
+
+	// Bit I is set if any second-level list of first level I is non-empty.
+	uint64 FirstLevelBitmap = 0;
+	// Bit J of entry I is set if list [I][J] is non-empty.
+	uint32 SecondLevelBitmaps[FirstLevelCount] = {};
+	FBlockHeader* FreeLists[FirstLevelCount][SecondLevelCount] = {};
+
+	uint64 NumBytesUsed = 0;
+	uint64 NumBytesFree = 0;
+};
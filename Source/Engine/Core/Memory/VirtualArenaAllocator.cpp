@@ -0,0 +1,104 @@
+#include "VirtualArenaAllocator.h"
+#include "AssertionMacros.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/MathUtilities.h"
+
+// System include for memset.
+#include <cstring>
+
+namespace
+{
+	// Committing less than this at a time would make growing the arena mostly system calls.
+	constexpr uint64 MinCommitGranularity = 64 * 1024;
+
+	// Rounds a size up to a multiple of a power-of-two alignment.
+	uint64 RoundUp(uint64 InSize, uint64 InAlignment)
+	{
+		return (InSize + InAlignment - 1) & ~(InAlignment - 1);
+	}
+}
+
+FVirtualArenaAllocator::FVirtualArenaAllocator(uint64 InReserveSize, bool bInUseHugePages /* = false */)
+	: bUseHugePages(bInUseHugePages)
+{
+	CommitGranularity = bUseHugePages ? FPlatformMemory::GetHugePageSize() : FMath::Max(FPlatformMemory::GetPageSize(), MinCommitGranularity);
+	Capacity = RoundUp(InReserveSize, CommitGranularity);
+
+	// Huge pages can only back memory aligned to their size, which the reservation may not be.
+	ReservationSize = bUseHugePages ? Capacity + CommitGranularity : Capacity;
+	ReservationStart = static_cast<int8*>(FPlatformMemory::ReserveVirtualMemory(ReservationSize));
+	if (!ReservationStart)
+	{
+		Capacity = 0;
+		return;
+	}
+	Start = ReservationStart + (RoundUp(reinterpret_cast<uint64>(ReservationStart), CommitGranularity) - reinterpret_cast<uint64>(ReservationStart));
+}
+
+FVirtualArenaAllocator::~FVirtualArenaAllocator()
+{
+	if (ReservationStart)
+	{
+		FPlatformMemory::ReleaseVirtualMemory(ReservationStart, ReservationSize);
+	}
+}
+
+void* FVirtualArenaAllocator::Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment /* = EMemoryAlignment::Default */)
+{
+	return InSizeBytes > 0 ? Allocate64(static_cast<uint64>(InSizeBytes), InAlignment) : nullptr;
+}
+
+void FVirtualArenaAllocator::Deallocate(void* InAddress)
+{
+	// Do nothing
+}
+
+void* FVirtualArenaAllocator::Allocate64(uint64 InSizeBytes, EMemoryAlignment InAlignment /* = EMemoryAlignment::Default */)
+{
+	if (!InSizeBytes)
+	{
+		return nullptr;
+	}
+
+	// Start is aligned to the commit granularity, so aligning the offset aligns the address.
+	uint64 AlignedOffset = RoundUp(NumBytesUsed, static_cast<uint64>(InAlignment));
+	if (InSizeBytes > Capacity - FMath::Min(AlignedOffset, Capacity))
+	{
+		return nullptr;
+	}
+
+	uint64 NewOffset = AlignedOffset + InSizeBytes;
+	if (NewOffset > NumBytesCommitted)
+	{
+		uint64 NewNumBytesCommitted = FMath::Min(RoundUp(NewOffset, CommitGranularity), Capacity);
+		if (!FPlatformMemory::CommitVirtualMemory(Start + NumBytesCommitted, NewNumBytesCommitted - NumBytesCommitted, bUseHugePages))
+		{
+			return nullptr;
+		}
+		NumBytesCommitted = NewNumBytesCommitted;
+	}
+
+	NumBytesUsed = NewOffset;
+	HighWaterMark = FMath::Max(HighWaterMark, NumBytesUsed);
+	return Start + AlignedOffset;
+}
+
+void FVirtualArenaAllocator::RewindToMarker(FMarker InMarker)
+{
+	ensure(InMarker <= NumBytesUsed);
+
+#if ARENA_ALLOCATOR_POISON
+	memset(Start + InMarker, FArenaAllocator::PoisonValue, NumBytesUsed - InMarker);
+#endif
+	NumBytesUsed = InMarker;
+}
+
+void FVirtualArenaAllocator::Reset()
+{
+	if (NumBytesCommitted)
+	{
+		FPlatformMemory::DecommitVirtualMemory(Start, NumBytesCommitted);
+	}
+	NumBytesUsed = 0;
+	NumBytesCommitted = 0;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "IAllocator.h"
+#include "Alignment.h"
+#include "ArenaAllocator.h"
+
+/**
+ * Arena allocator backed by reserved virtual memory, for arenas whose final size isn't known up front,
+ * such as those used while loading a scene.
+ *
+ * The constructor only reserves address space, so the reservation can be far larger than the arena will
+ * ever need. Memory is committed in chunks as allocations reach it and returned to the system by Reset().
+ * Sizes are 64-bit, so an arena can hold more than 2 GB.
+ */
+class FVirtualArenaAllocator : public IAllocator
+{
+public:
+	/**
+	 * Constructor. Reserves address space for the arena without committing any memory.
+	 *
+	 * @param InReserveSize: Largest number of bytes the arena can hold.
+	 * @param bInUseHugePages: Whether to ask the system to back the arena with huge pages. Memory is then
+	 *                         committed in huge page units.
+	 */
+	explicit FVirtualArenaAllocator(uint64 InReserveSize, bool bInUseHugePages = false);
+
+	// Destructor. Releases the reserved address space.
+	~FVirtualArenaAllocator();
+
+	// Non-copyable.
+	FVirtualArenaAllocator(const FVirtualArenaAllocator&) = delete;
+	FVirtualArenaAllocator& operator=(const FVirtualArenaAllocator&) = delete;
+
+	// Begin IAllocator interface.
+	virtual void* Allocate(int32 InSizeBytes, EMemoryAlignment InAlignment = EMemoryAlignment::Default) override;
+	virtual void  Deallocate(void* InAddress) override;
+	// End IAllocator interface.
+
+	/**
+	 * Allocates memory with a 64-bit size, committing more memory if needed.
+	 *
+	 * @returns The allocated memory, or nullptr if InSizeBytes is 0, the reservation is full, or
+	 *          the system couldn't commit memory.
+	 */
+	void* Allocate64(uint64 InSizeBytes, EMemoryAlignment InAlignment = EMemoryAlignment::Default);
+
+	// Position in the arena that the allocator can be rewound to.
+	using FMarker = uint64;
+
+	// Returns a marker for the current position. Allocations made after it can be freed by RewindToMarker.
+	FMarker GetMarker() const
+	{
+		return NumBytesUsed;
+	}
+
+	/**
+	 * Deallocates all memory allocated since the marker was taken. The memory stays committed for
+	 * later allocations. Markers must be rewound to in the reverse order they were taken.
+	 */
+	void RewindToMarker(FMarker InMarker);
+
+	// Deallocates all memory and decommits it.
+	void Reset();
+
+	// Returns whether address space was reserved for the arena.
+	bool IsValid() const
+	{
+		return Start != nullptr;
+	}
+
+	uint64 GetNumBytesUsed() const
+	{
+		return NumBytesUsed;
+	}
+
+	uint64 GetNumBytesCommitted() const
+	{
+		return NumBytesCommitted;
+	}
+
+	uint64 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// Returns the largest number of bytes used since the allocator was created or the high-water mark was reset.
+	uint64 GetHighWaterMark() const
+	{
+		return HighWaterMark;
+	}
+
+	void ResetHighWaterMark()
+	{
+		HighWaterMark = NumBytesUsed;
+	}
+
+private:
+	// Reserved address range, as returned by the platform.
+	int8* ReservationStart = nullptr;
+	uint64 ReservationSize = 0;
+	// Start of the arena within the reservation, aligned to the commit granularity.
+	int8* Start = nullptr;
+	uint64 Capacity = 0;
+	uint64 NumBytesUsed = 0;
+	uint64 NumBytesCommitted = 0;
+	uint64 HighWaterMark = 0;
+	// Number of bytes committed at a time.
+	uint64 CommitGranularity = 0;
+	bool bUseHugePages = false;
+};
+
+using FScopedVirtualArenaMark = TScopedArenaMark<FVirtualArenaAllocator>;
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Memory/NewDeleteAllocator.h"
+
+// System include for placement new.
+#include <new>
 
 /**
  * Maintains strong and weak reference counts associate with a resource.
@@ -8,9 +13,43 @@
 class FControlBlock
 {
 public:
+	// Destroys an object and returns its memory to the allocator it came from.
+	using FDestroyObjectFunction = void (*)(void* InObject, IAllocator& InAllocator);
+
+	// Creates a control block for an object allocated with new. The control block is allocated with new too.
 	static FControlBlock* Create()
 	{
-		return new FControlBlock;
+		FNewDeleteAllocator& NewDeleteAllocator = FNewDeleteAllocator::GetDefaultAllocator();
+		void* Memory = NewDeleteAllocator.Allocate(sizeof(FControlBlock));
+		ensure(Memory);
+
+		FControlBlock* ControlBlock = new (Memory) FControlBlock;
+		ControlBlock->Allocator = &NewDeleteAllocator;
+		return ControlBlock;
+	}
+
+	/**
+	 * Creates a control block in memory from an allocator, for an object allocated from the same allocator.
+	 * The object is then destroyed through the control block rather than with delete.
+	 */
+	static FControlBlock* Create(IAllocator& InAllocator, void* InObject, FDestroyObjectFunction InDestroyObject)
+	{
+		void* Memory = InAllocator.Allocate(sizeof(FControlBlock));
+		ensure(Memory);
+
+		FControlBlock* ControlBlock = new (Memory) FControlBlock;
+		ControlBlock->Allocator = &InAllocator;
+		ControlBlock->Object = InObject;
+		ControlBlock->DestroyObjectFunction = InDestroyObject;
+		return ControlBlock;
+	}
+
+	// Frees a control block made by either Create function.
+	static void Destroy(FControlBlock* InControlBlock)
+	{
+		IAllocator* BlockAllocator = InControlBlock->Allocator;
+		InControlBlock->~FControlBlock();
+		BlockAllocator->Deallocate(InControlBlock);
 	}
 
 	FControlBlock() = default;
@@ -52,7 +91,22 @@ public:
 		return WeakRefCount;
 	}
 
+	// Destroys the object if the control block was created with an allocator, and returns whether it was.
+	bool DestroyObject()
+	{
+		if (!DestroyObjectFunction)
+		{
+			return false;
+		}
+		DestroyObjectFunction(Object, *Allocator);
+		return true;
+	}
+
 private:
 	int32 StrongRefCount = 0;
 	int32 WeakRefCount = 0;
+	// Allocator the control block came from. The object came from it too if DestroyObjectFunction is set.
+	IAllocator* Allocator = nullptr;
+	void* Object = nullptr;
+	FDestroyObjectFunction DestroyObjectFunction = nullptr;
 };
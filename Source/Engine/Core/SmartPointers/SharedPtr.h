@@ -4,6 +4,7 @@
 #include "SmartPointers/WeakPtr.h"
 #include "SmartPointers/UniquePtr.h"
 #include "Templates/TemplateFunctionLibrary.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
 #include "AssertionMacros.h"
 
 template <typename ObjectType> class TWeakPtr;
@@ -76,6 +77,8 @@ public:
 
 private:
 	explicit TSharedPtr(const TWeakPtr<ObjectType>& InWeakPtr);
+	// Takes ownership of an object whose control block has already been created.
+	TSharedPtr(ObjectType* InObject, FControlBlock* InControlBlock);
 	void ReleaseStrongOwnership();
 
 	ObjectType* Object = nullptr;
@@ -88,13 +91,44 @@ private:
 	// Allow TWeakPtr access to TSharedPtr internals.
 	template<typename OtherType>
 	friend class TWeakPtr;
+
+	template<typename OtherType, typename... ArgTypes>
+	friend TSharedPtr<OtherType> MakeSharedWithAllocator(IAllocator& InAllocator, ArgTypes&&... InArgs);
+};
+
+// Only points to the object and control block, so it can be moved with a memcpy.
+template<typename ObjectType>
+struct TIsTriviallyRelocatable<TSharedPtr<ObjectType>>
+{
+	static constexpr bool Value = true;
 };
 
-// Factory function for creating TSharedPtrs.
+/**
+ * Factory function for creating TSharedPtrs whose object and control block are allocated from InAllocator,
+ * e.g. an arena for objects that live as long as a subsystem. The allocator must outlive the
+ * object and every pointer to it.
+ */
+template<typename ObjectType, typename... ArgTypes>
+TSharedPtr<ObjectType> MakeSharedWithAllocator(IAllocator& InAllocator, ArgTypes&&... InArgs)
+{
+	void* Memory = InAllocator.Allocate(sizeof(ObjectType));
+	ensure(Memory);
+
+	ObjectType* Object = new (Memory) ObjectType(Forward<ArgTypes>(InArgs)...);
+	FControlBlock* ControlBlock = FControlBlock::Create(InAllocator, Object, [](void* InObject, IAllocator& InObjectAllocator)
+	{
+		static_cast<ObjectType*>(InObject)->~ObjectType();
+		InObjectAllocator.Deallocate(InObject);
+	});
+	return TSharedPtr<ObjectType>(Object, ControlBlock);
+}
+
+// Factory function for creating TSharedPtrs. The object and its control block are allocated with new.
+// Use MakeSharedWithAllocator with FPoolAllocator::GetDefaultAllocator() for many small shared objects.
 template<typename ObjectType, typename... ArgTypes>
 TSharedPtr<ObjectType> MakeShared(ArgTypes&&... InArgs)
 {
-	return TSharedPtr<ObjectType>(new ObjectType(Forward<ArgTypes>(InArgs)...));
+	return MakeSharedWithAllocator<ObjectType>(FNewDeleteAllocator::GetDefaultAllocator(), Forward<ArgTypes>(InArgs)...);
 }
 
 template<typename ObjectType>
@@ -105,12 +139,16 @@ void TSharedPtr<ObjectType>::ReleaseStrongOwnership()
 		ControlBlock->DecrementStrongRef();
 		if (ControlBlock->GetStrongRefCount() == 0 && Object)
 		{
-			delete Object;
+			// Objects made by MakeSharedWithAllocator are destroyed by their control block.
+			if (!ControlBlock->DestroyObject())
+			{
+				delete Object;
+			}
 			Object = nullptr;
 
 			if (ControlBlock->GetWeakRefCount() == 0)
 			{
-				delete ControlBlock;
+				FControlBlock::Destroy(ControlBlock);
 				ControlBlock = nullptr;
 			}
 		}
@@ -142,6 +180,14 @@ TSharedPtr<ObjectType>::TSharedPtr(TUniquePtr<OtherType>&& InUniquePtr)
 	InUniquePtr.Object = nullptr;
 }
 
+template<typename ObjectType>
+TSharedPtr<ObjectType>::TSharedPtr(ObjectType* InObject, FControlBlock* InControlBlock)
+	: Object(InObject)
+	, ControlBlock(InControlBlock)
+{
+	ControlBlock->IncrementStrongRef();
+}
+
 template<typename ObjectType>
 TSharedPtr<ObjectType>::TSharedPtr(decltype(nullptr))
 {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Templates/TemplateFunctionLibrary.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
 
 /**
  * Smart pointer used for exclusive ownership of a resource.
@@ -60,6 +61,13 @@ private:
 	friend class TSharedPtr;
 };
 
+// Only points to the object, so it can be moved with a memcpy.
+template<typename ObjectType>
+struct TIsTriviallyRelocatable<TUniquePtr<ObjectType>>
+{
+	static constexpr bool Value = true;
+};
+
 // Factory function for creating TUniquePtr.
 template<typename ObjectType, typename... ArgTypes>
 TUniquePtr<ObjectType> MakeUnique(ArgTypes&&... InArgs)
@@ -4,6 +4,7 @@
 #include "SmartPointers/ControlBlock.h"
 #include "SmartPointers/SharedPtr.h"
 #include "Templates/TemplateFunctionLibrary.h"
+#include "Templates/TypeTraits/IsTriviallyRelocatable.h"
 #include "AssertionMacros.h"
 
 template <typename ObjectType> class TSharedPtr;
@@ -82,6 +83,13 @@ private:
 	friend class TSharedPtr;
 };
 
+// Like TSharedPtr, only points to the object and control block.
+template<typename ObjectType>
+struct TIsTriviallyRelocatable<TWeakPtr<ObjectType>>
+{
+	static constexpr bool Value = true;
+};
+
 template<typename ObjectType>
 template<typename OtherType, typename ImplicitConversionCheck>
 TWeakPtr<ObjectType>::TWeakPtr(const TSharedPtr<OtherType>& InSharedPtr)
@@ -104,7 +112,7 @@ void TWeakPtr<ObjectType>::ReleaseWeakOwnership()
 		// Checking the weak ref count first so we can short-curcuit in the common case where weak refs still exist.
 		if (ControlBlock->GetWeakRefCount() == 0 && ControlBlock->GetStrongRefCount() == 0)
 		{
-			delete ControlBlock;
+			FControlBlock::Destroy(ControlBlock);
 			ControlBlock = nullptr;
 		}
 	}
@@ -1,37 +1,33 @@
 #pragma once
 
 #include "CoreGlobals.h"
+#include "AssertionMacros.h"
 #include "Math/MathUtilities.h"
-#include "Memory/MemoryManager.h"
+#include "Memory/NewDeleteAllocator.h"
 #include "Hash/Crc64.h"
+#include "Strings/StringView.h"
 
 // System includes (for memcpy, memcmp, and related functionality).
 #include <cstring>
 
 /**
- * Returns the length of the string, disregarding the null-terminating character.
+ * Null-terminated string with small-string optimization.
+ *
+ * Strings of up to InlineCapacity - 1 characters are stored inline within the string object
+ * itself, so the short asset, uniform, and key names used throughout the engine never touch
+ * the allocator. Longer strings are stored in memory provided by the string's allocator.
  */
-template<typename CharType>
-static int32 StrLen(const CharType* InPtr)
-{
-	const CharType* Ptr = InPtr;
-
-	// Both ANSI and Unicode strings are null-terminated.
-	while (*Ptr)
-	{
-		++Ptr;
-	}
-	
-	return (int32)(Ptr - InPtr);
-}
-
 template<typename CharType>
 class TBasicString
 {
 public:
+	// Number of characters (including the null-terminating character) that can be stored without allocating.
+	static constexpr int32 InlineCapacity = 24;
+
 	// Constructors.
 	TBasicString() = default;
 	TBasicString(const CharType* InCharTypeString);
+	explicit TBasicString(const TStringView<CharType>& InStringView);
 
 	// Destructor.
 	~TBasicString();
@@ -45,6 +41,7 @@ public:
 	TBasicString& operator=(TBasicString&& InOther);
 
 	TBasicString& operator=(const CharType* InCharTypeString);
+	TBasicString& operator=(const TStringView<CharType>& InStringView);
 
 	// Returns the substring from [InStartIndex, InEndIndex).
 	TBasicString<CharType> Substring(int32 InStartIndex, int32 InEndIndex) const;
@@ -55,7 +52,13 @@ public:
 	
 	bool IsEmpty() const
 	{
-		return BasicString.empty();
+		return Size == 0;
+	}
+
+	// Returns true if the characters are stored inline instead of in allocator memory.
+	bool IsInline() const
+	{
+		return Data == InlineData;
 	}
 
 	// Getters.
@@ -83,14 +86,28 @@ public:
 	{ 
 		return Allocator; 
 	}
+	TStringView<CharType> GetView() const
+	{
+		return TStringView<CharType>(Data, Size);
+	}
 
 	// Setters.
-	void SetAllocator(const IAllocator* InAllocator) 
+	// Only valid while the string holds no characters from its current allocator.
+	void SetAllocator(IAllocator* InAllocator) 
 	{ 
+		ensure(!Data || IsInline());
 		Allocator = InAllocator; 
 	}
 
 private:
+	// Copies InSize characters into the string, growing the character array if necessary, and null-terminates it.
+	void Assign(const CharType* InCharacters, int32 InSize);
+	// Makes sure that the character array can store at least InCapacity characters (including the null-terminating character).
+	// Existing characters are only preserved if bInPreserveCharacters is true.
+	void Grow(int32 InCapacity, bool bInPreserveCharacters);
+	// Releases the character array if it was provided by the allocator.
+	void ReleaseData();
+
 	CharType* Data = nullptr;
 	// Size represents the number of characters in the string, disregarding the null-terminating character.
 	int32 Size = 0;
@@ -98,16 +115,18 @@ private:
 	int32 Capacity = 0;
 	// If you encountered an Allocator in an invalid state (i.e. nullptr), 
 	// you're most likely are using a string that has been moved from.
-	IAllocator* Allocator = &FMemoryManager::Get().GetArenaAllocator();
+	IAllocator* Allocator = &FNewDeleteAllocator::GetDefaultAllocator();
+	// Storage used for short strings. Data points here whenever the string fits.
+	CharType InlineData[InlineCapacity];
 };
 
+template<typename CharType>
+constexpr int32 TBasicString<CharType>::InlineCapacity;
+
 template<typename CharType>
 TBasicString<CharType>::~TBasicString()
 {
-	if (Data && Allocator)
-	{
-		Allocator->Deallocate(Data);
-	}
+	ReleaseData();
 };
 
 template<typename CharType>
@@ -116,10 +135,17 @@ TBasicString<CharType>::TBasicString(const CharType * InCharTypeString)
 	// Construction from null or empty strings is a no-op.
 	if (InCharTypeString && *InCharTypeString)
 	{
-		Size = StrLen(InCharTypeString);
-		Capacity = Size + 1;
-		Data = static_cast<CharType*>(Allocator->Allocate(Capacity * sizeof(CharType)));
-		memcpy(Data, InCharTypeString, Capacity);
+		Assign(InCharTypeString, StrLen(InCharTypeString));
+	}
+}
+
+template<typename CharType>
+TBasicString<CharType>::TBasicString(const TStringView<CharType>& InStringView)
+{
+	// Construction from empty views is a no-op.
+	if (!InStringView.IsEmpty())
+	{
+		Assign(InStringView.GetData(), InStringView.GetSize());
 	}
 }
 
@@ -128,20 +154,33 @@ TBasicString<CharType>::TBasicString(const TBasicString<CharType>&InOther)
 {
 	if (InOther.Data)
 	{
-		Data = static_cast<CharType*>(Allocator->Allocate(InOther.Capacity * sizeof(CharType)));
+		Grow(InOther.Size + 1, false);
 		Size = InOther.Size;
-		Capacity = InOther.Capacity;
-		memcpy(Data, InOther.Data, Size + 1);
+		memcpy(Data, InOther.Data, (Size + 1) * sizeof(CharType));
 	}
 };
 
 template<typename CharType>
 TBasicString<CharType>::TBasicString(TBasicString<CharType> && InOther)
-	: Data(InOther.Data)
-	, Size(InOther.Size)
+	: Size(InOther.Size)
 	, Capacity(InOther.Capacity)
 	, Allocator(InOther.Allocator)
 {
+	if (InOther.IsInline())
+	{
+		// Inline characters can't be stolen, so they're copied instead.
+		Data = InlineData;
+		memcpy(InlineData, InOther.InlineData, (Size + 1) * sizeof(CharType));
+	}
+	else
+	{
+		Data = InOther.Data;
+	}
+
+	InOther.Data = nullptr;
+	InOther.Size = 0;
+	InOther.Capacity = 0;
+	InOther.Allocator = nullptr;
 };
 
 template<typename CharType>
@@ -153,30 +192,22 @@ TBasicString<CharType>& TBasicString<CharType>::operator=(const TBasicString<Cha
 		return *this;
 	}
 
-	if (!Data)
-	{
-		// Assigning to an empty string.
-		Data = static_cast<CharType*>(Allocator->Allocate(InOther.Capacity * sizeof(CharType)));
-		Size = InOther.Size;
-		Capacity = InOther.Capacity;
-		memcpy(Data, InOther.Data, Size + 1);
-	}
-	else if (Capacity >= InOther.Capacity)
-	{
-		// Reuse the Data array if it's large enough to store the input string.
-		Size = InOther.Size;
-		memcpy(Data, InOther.Data, Size + 1);
-	}
-	else
+	if (!InOther.Data)
 	{
-		// The Data array isn't large enough to store the input string, so we need to allocate more space.
-		Allocator->Deallocate(Data);
-		Data = static_cast<CharType*>(Allocator->Allocate(InOther.Capacity * sizeof(CharType)));
-		Size = InOther.Size;
-		Capacity = InOther.Capacity;
-		memcpy(Data, InOther.Data, Size + 1);
+		// Assigning an empty string keeps the current character array around for reuse.
+		Size = 0;
+		if (Data)
+		{
+			Data[0] = CharType('\0');
+		}
+		return *this;
 	}
 
+	// The Data array is only reallocated if it isn't large enough to store the input string.
+	Grow(InOther.Size + 1, false);
+	Size = InOther.Size;
+	memcpy(Data, InOther.Data, (Size + 1) * sizeof(CharType));
+
 	return *this;
 };
 
@@ -189,15 +220,20 @@ TBasicString<CharType>& TBasicString<CharType>::operator=(TBasicString<CharType>
 		return *this;
 	}
 
-	if (Data)
-	{
-		Allocator->Deallocate(Data);
-	}
+	ReleaseData();
 
-	Data = InOther.Data;
 	Size = InOther.Size;
 	Capacity = InOther.Capacity;
 	Allocator = InOther.Allocator;
+	if (InOther.IsInline())
+	{
+		Data = InlineData;
+		memcpy(InlineData, InOther.InlineData, (Size + 1) * sizeof(CharType));
+	}
+	else
+	{
+		Data = InOther.Data;
+	}
 
 	InOther.Data = nullptr;
 	InOther.Size = 0;
@@ -210,29 +246,16 @@ TBasicString<CharType>& TBasicString<CharType>::operator=(TBasicString<CharType>
 template<typename CharType>
 TBasicString<CharType>& TBasicString<CharType>::operator=(const CharType* InCharTypeString)
 {
-	Size = StrLen(InCharTypeString);
-
-	if (!Data)
-	{
-		// Assigning to an empty string.
-		Capacity = Size + 1;
-		Data = static_cast<CharType*>(Allocator->Allocate(Capacity * sizeof(CharType)));
-		memcpy(Data, InCharTypeString, Capacity);
-	}
-	else if (Capacity >= Size + 1)
-	{
-		// Reuse the Data array if it's large enough to store the input string.
-		memcpy(Data, InCharTypeString, Size + 1);
-	}
-	else
-	{
-		// The Data array isn't large enough to store the input string, so we need to allocate more space.
-		Capacity = Size + 1;
-		Allocator->Deallocate(Data);
-		Data = static_cast<CharType*>(Allocator->Allocate(Capacity * sizeof(CharType)));
-		memcpy(Data, InCharTypeString, Capacity);
-	}
+	Assign(InCharTypeString, InCharTypeString ? StrLen(InCharTypeString) : 0);
+	return *this;
+}
 
+template<typename CharType>
+TBasicString<CharType>& TBasicString<CharType>::operator=(const TStringView<CharType>& InStringView)
+{
+	// Assigning from a view into this string's own characters is safe, 
+	// since the Data array is never reallocated when it already holds the view.
+	Assign(InStringView.GetData(), InStringView.GetSize());
 	return *this;
 }
 
@@ -240,23 +263,7 @@ TBasicString<CharType>& TBasicString<CharType>::operator=(const CharType* InChar
 template<typename CharType>
 TBasicString<CharType> TBasicString<CharType>::Substring(int32 InStartIndex, int32 InEndIndex) const
 {
-	if (InStartIndex >= InEndIndex)
-	{
-		return TBasicString();
-	}
-
-	int32 Start = FMath::Clamp(InStartIndex, 0, Size);
-	int32 End = FMath::Clamp(InEndIndex, 0, Size);
-	int32 CharacterCount = End - Start;
-
-	TBasicString Substring;
-	Substring.Size = CharacterCount;
-	Substring.Capacity = CharacterCount + 1;
-	Substring.Data = static_cast<CharType*>(Allocator->Allocate(Substring.Capacity * sizeof(CharType)));
-	memcpy(Substring.Data, this->GetData() + Start, Substring.Size);
-	Substring.Data[Substring.Size] = CharType('\0');
-
-	return Substring;
+	return TBasicString(GetView().Substring(InStartIndex, InEndIndex));
 }
 
 // InCharacterCount disregards the null-terminating character.
@@ -269,24 +276,61 @@ void TBasicString<CharType>::Reserve(int32 InCharacterCount)
 		return;
 	}
 
-	int32 NewCapacity = InCharacterCount + 1;
+	bool bWasEmpty = (Data == nullptr);
+	Grow(InCharacterCount + 1, true);
+	if (bWasEmpty)
+	{
+		Data[0] = CharType('\0');
+	}
+}
+
+template<typename CharType>
+void TBasicString<CharType>::Assign(const CharType* InCharacters, int32 InSize)
+{
+	Grow(InSize + 1, false);
+	if (InSize > 0)
+	{
+		// memmove instead of memcpy, since the source characters may be a view into this string.
+		memmove(Data, InCharacters, InSize * sizeof(CharType));
+	}
+	Data[InSize] = CharType('\0');
+	Size = InSize;
+}
+
+template<typename CharType>
+void TBasicString<CharType>::Grow(int32 InCapacity, bool bInPreserveCharacters)
+{
+	if (Data && InCapacity <= Capacity)
+	{
+		return;
+	}
 
-	if (!Data)
+	if (!Data && InCapacity <= InlineCapacity)
 	{
-		Data = static_cast<CharType*>(Allocator->Allocate(NewCapacity * sizeof(CharType)));
-		Capacity = NewCapacity;
+		Data = InlineData;
+		Capacity = InlineCapacity;
 		return;
 	}
 
 	// Similar to Unreal's FString, we only reserve more space for the 
 	// string when the requested capacity is greater than the current capacity.
-	if (NewCapacity > Capacity)
+	CharType* NewData = static_cast<CharType*>(Allocator->Allocate(InCapacity * sizeof(CharType)));
+	if (bInPreserveCharacters && Data)
+	{
+		memcpy(NewData, Data, (Size + 1) * sizeof(CharType));
+	}
+
+	ReleaseData();
+	Data = NewData;
+	Capacity = InCapacity;
+}
+
+template<typename CharType>
+void TBasicString<CharType>::ReleaseData()
+{
+	if (Data && !IsInline() && Allocator)
 	{
-		CharType* OldData = Data;
-		Data = static_cast<CharType*>(Allocator->Allocate(NewCapacity * sizeof(CharType)));
-		memcpy(Data, OldData, Size + 1);
-		Allocator->Deallocate(OldData);
-		Capacity = NewCapacity;
+		Allocator->Deallocate(Data);
 	}
 }
 
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Memory/NewDeleteAllocator.h"
+#include "Strings/String.h"
+#include "Strings/StringView.h"
+#include "Strings/StringFormat.h"
+
+// System includes (for memcpy and memmove).
+#include <cstring>
+
+/**
+ * Builds strings by appending text and numbers into a growable, always null-terminated buffer.
+ *
+ * The first InlineCapacity characters (including the null-terminating character) are stored within
+ * the builder itself, so builders created on the stack for short strings such as uniform names or file
+ * paths never allocate. Longer strings spill into memory provided by the builder's allocator, which can
+ * be an arena for builders whose contents only need to live for a frame.
+ */
+template<typename CharType, int32 InlineCapacity = 128>
+class TStringBuilder
+{
+	static_assert(InlineCapacity > 0, "String builders need room for at least the null-terminating character.");
+
+public:
+	/**
+	 * Constructor.
+	 *
+	 * @param InAllocator: Allocator used once the builder outgrows its inline storage.
+	 */
+	explicit TStringBuilder(IAllocator& InAllocator = FNewDeleteAllocator::GetDefaultAllocator());
+	~TStringBuilder();
+
+	// Non-copyable. Builders are meant to be short-lived; copy the result with ToString instead.
+	TStringBuilder(const TStringBuilder&) = delete;
+	TStringBuilder& operator=(const TStringBuilder&) = delete;
+
+	// Text.
+	TStringBuilder& Append(CharType InCharacter);
+	TStringBuilder& Append(const CharType* InCharTypeString);
+	TStringBuilder& Append(const TStringView<CharType>& InStringView);
+	TStringBuilder& Append(const TBasicString<CharType>& InString);
+
+	// Numbers.
+	TStringBuilder& Append(int32 InValue);
+	TStringBuilder& Append(uint32 InValue);
+	TStringBuilder& Append(int64 InValue);
+	TStringBuilder& Append(uint64 InValue);
+	TStringBuilder& Append(float InValue);
+	TStringBuilder& Append(double InValue);
+
+	// Removes the last InCount characters.
+	void RemoveSuffix(int32 InCount);
+
+	// Empties the builder without releasing its memory, so that it can be reused.
+	void Reset();
+
+	// Getters.
+	const CharType* GetData() const
+	{
+		return Data;
+	}
+	int32 GetSize() const
+	{
+		return Size;
+	}
+	int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+	bool IsInline() const
+	{
+		return Data == InlineData;
+	}
+
+	// Conversions. The view is invalidated by any subsequent modification of the builder.
+	TStringView<CharType> ToView() const
+	{
+		return TStringView<CharType>(Data, Size);
+	}
+	TBasicString<CharType> ToString() const
+	{
+		return TBasicString<CharType>(ToView());
+	}
+
+private:
+	// Appends characters into space that has already been reserved with Grow.
+	void AppendCharacters(const CharType* InCharacters, int32 InCount);
+	// Appends ANSI text produced by FStringFormat, widening it to CharType.
+	void AppendFormatted(const ANSICHAR* InCharacters, int32 InCount);
+	// Ensures there's space for InCount more characters plus the null-terminating character.
+	void Grow(int32 InCount);
+
+	CharType* Data = InlineData;
+	// Number of characters, disregarding the null-terminating character.
+	int32 Size = 0;
+	// Capacity represents the size of the Data array.
+	int32 Capacity = InlineCapacity;
+	IAllocator* Allocator;
+	CharType InlineData[InlineCapacity];
+};
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>::TStringBuilder(IAllocator& InAllocator /* = FNewDeleteAllocator::GetDefaultAllocator() */)
+	: Allocator(&InAllocator)
+{
+	InlineData[0] = 0;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>::~TStringBuilder()
+{
+	if (!IsInline())
+	{
+		Allocator->Deallocate(Data);
+	}
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(CharType InCharacter)
+{
+	Grow(1);
+	Data[Size++] = InCharacter;
+	Data[Size] = 0;
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(const CharType* InCharTypeString)
+{
+	return Append(TStringView<CharType>(InCharTypeString));
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(const TStringView<CharType>& InStringView)
+{
+	const CharType* Characters = InStringView.GetData();
+	int32 Count = InStringView.GetSize();
+	if (Count == 0)
+	{
+		return *this;
+	}
+
+	// Appending a view of the builder itself is supported, so remember where the view starts in case Grow reallocates.
+	bool bIsSelfView = (Data <= Characters && Characters < Data + Size);
+	int32 SelfOffset = static_cast<int32>(Characters - Data);
+	Grow(Count);
+	if (bIsSelfView)
+	{
+		Characters = Data + SelfOffset;
+	}
+
+	AppendCharacters(Characters, Count);
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(const TBasicString<CharType>& InString)
+{
+	return Append(InString.GetView());
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(int32 InValue)
+{
+	return Append(static_cast<int64>(InValue));
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(uint32 InValue)
+{
+	return Append(static_cast<uint64>(InValue));
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(int64 InValue)
+{
+	ANSICHAR Buffer[FStringFormat::MaxIntegerLength];
+	int32 Length = FStringFormat::FormatInteger(InValue, Buffer);
+	AppendFormatted(Buffer, Length);
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(uint64 InValue)
+{
+	ANSICHAR Buffer[FStringFormat::MaxIntegerLength];
+	int32 Length = FStringFormat::FormatUnsignedInteger(InValue, Buffer);
+	AppendFormatted(Buffer, Length);
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(float InValue)
+{
+	ANSICHAR Buffer[FStringFormat::MaxFloatLength];
+	int32 Length = FStringFormat::FormatFloat(InValue, Buffer);
+	AppendFormatted(Buffer, Length);
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+TStringBuilder<CharType, InlineCapacity>& TStringBuilder<CharType, InlineCapacity>::Append(double InValue)
+{
+	ANSICHAR Buffer[FStringFormat::MaxFloatLength];
+	int32 Length = FStringFormat::FormatDouble(InValue, Buffer);
+	AppendFormatted(Buffer, Length);
+	return *this;
+}
+
+template<typename CharType, int32 InlineCapacity>
+void TStringBuilder<CharType, InlineCapacity>::RemoveSuffix(int32 InCount)
+{
+	ensure(0 <= InCount && InCount <= Size);
+	Size -= InCount;
+	Data[Size] = 0;
+}
+
+template<typename CharType, int32 InlineCapacity>
+void TStringBuilder<CharType, InlineCapacity>::Reset()
+{
+	Size = 0;
+	Data[0] = 0;
+}
+
+template<typename CharType, int32 InlineCapacity>
+void TStringBuilder<CharType, InlineCapacity>::AppendCharacters(const CharType* InCharacters, int32 InCount)
+{
+	memmove(Data + Size, InCharacters, InCount * sizeof(CharType));
+	Size += InCount;
+	Data[Size] = 0;
+}
+
+template<typename CharType, int32 InlineCapacity>
+void TStringBuilder<CharType, InlineCapacity>::AppendFormatted(const ANSICHAR* InCharacters, int32 InCount)
+{
+	Grow(InCount);
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		Data[Size + Index] = static_cast<CharType>(InCharacters[Index]);
+	}
+	Size += InCount;
+	Data[Size] = 0;
+}
+
+template<typename CharType, int32 InlineCapacity>
+void TStringBuilder<CharType, InlineCapacity>::Grow(int32 InCount)
+{
+	int32 RequiredCapacity = Size + InCount + 1;
+	if (RequiredCapacity <= Capacity)
+	{
+		return;
+	}
+
+	// Grow geometrically so that repeated appends stay amortized constant time.
+	int32 NewCapacity = FMath::Max(RequiredCapacity, Capacity * 2);
+	CharType* NewData = static_cast<CharType*>(Allocator->Allocate(NewCapacity * sizeof(CharType)));
+	memcpy(NewData, Data, (Size + 1) * sizeof(CharType));
+
+	if (!IsInline())
+	{
+		Allocator->Deallocate(Data);
+	}
+
+	Data = NewData;
+	Capacity = NewCapacity;
+}
+
+template<int32 InlineCapacity = 128>
+using TANSIStringBuilder = TStringBuilder<ANSICHAR, InlineCapacity>;
+template<int32 InlineCapacity = 128>
+using TU8StringBuilder = TStringBuilder<U8CHAR, InlineCapacity>;
+
+using FANSIStringBuilder = TANSIStringBuilder<>;
+using FU8StringBuilder = TU8StringBuilder<>;
@@ -0,0 +1,109 @@
+#include "StringFormat.h"
+#include "AssertionMacros.h"
+
+// System includes (for snprintf, strtof, and strtod).
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+constexpr int32 FStringFormat::MaxIntegerLength;
+constexpr int32 FStringFormat::MaxFloatLength;
+
+int32 FStringFormat::FormatInteger(int64 InValue, ANSICHAR* OutBuffer)
+{
+	if (InValue >= 0)
+	{
+		return FormatUnsignedInteger(static_cast<uint64>(InValue), OutBuffer);
+	}
+
+	// Negate in unsigned arithmetic so that the minimum int64 value doesn't overflow.
+	OutBuffer[0] = '-';
+	uint64 Magnitude = 0 - static_cast<uint64>(InValue);
+	return 1 + FormatUnsignedInteger(Magnitude, OutBuffer + 1);
+}
+
+int32 FStringFormat::FormatUnsignedInteger(uint64 InValue, ANSICHAR* OutBuffer)
+{
+	// Write digits back to front into a scratch buffer, then copy them out in order.
+	ANSICHAR Digits[MaxIntegerLength];
+	int32 NumDigits = 0;
+	do
+	{
+		Digits[NumDigits++] = static_cast<ANSICHAR>('0' + (InValue % 10));
+		InValue /= 10;
+	} while (InValue != 0);
+
+	for (int32 Index = 0; Index < NumDigits; ++Index)
+	{
+		OutBuffer[Index] = Digits[NumDigits - 1 - Index];
+	}
+	OutBuffer[NumDigits] = '\0';
+	return NumDigits;
+}
+
+// Formats non-finite values. Returns 0 if the value is finite.
+static int32 FormatNonFinite(double InValue, ANSICHAR* OutBuffer)
+{
+	const ANSICHAR* Text = nullptr;
+	if (std::isnan(InValue))
+	{
+		Text = "nan";
+	}
+	else if (std::isinf(InValue))
+	{
+		Text = (InValue > 0.0) ? "inf" : "-inf";
+	}
+	else
+	{
+		return 0;
+	}
+
+	int32 Length = static_cast<int32>(strlen(Text));
+	memcpy(OutBuffer, Text, Length + 1);
+	return Length;
+}
+
+int32 FStringFormat::FormatFloat(float InValue, ANSICHAR* OutBuffer)
+{
+	if (int32 Length = FormatNonFinite(InValue, OutBuffer))
+	{
+		return Length;
+	}
+
+	// 9 significant digits are always enough to round-trip a float, so search upwards for the shortest representation.
+	int32 Length = 0;
+	for (int32 Precision = 1; Precision <= 9; ++Precision)
+	{
+		Length = snprintf(OutBuffer, MaxFloatLength, "%.*g", Precision, InValue);
+		if (std::strtof(OutBuffer, nullptr) == InValue)
+		{
+			break;
+		}
+	}
+
+	ensure(0 < Length && Length < MaxFloatLength);
+	return Length;
+}
+
+int32 FStringFormat::FormatDouble(double InValue, ANSICHAR* OutBuffer)
+{
+	if (int32 Length = FormatNonFinite(InValue, OutBuffer))
+	{
+		return Length;
+	}
+
+	// 17 significant digits are always enough to round-trip a double.
+	int32 Length = 0;
+	for (int32 Precision = 1; Precision <= 17; ++Precision)
+	{
+		Length = snprintf(OutBuffer, MaxFloatLength, "%.*g", Precision, InValue);
+		if (std::strtod(OutBuffer, nullptr) == InValue)
+		{
+			break;
+		}
+	}
+
+	ensure(0 < Length && Length < MaxFloatLength);
+	return Length;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreGlobals.h"
+
+/**
+ * Allocation-free conversion of numbers to ANSI text.
+ *
+ * Every function writes into a caller-provided buffer, null-terminates it, and returns the number
+ * of characters written (disregarding the null-terminating character). Buffers must be at least
+ * as large as the corresponding Max*Length constant.
+ */
+struct FStringFormat
+{
+	// Buffer sizes (including the null-terminating character) large enough for any value of the given type.
+	static constexpr int32 MaxIntegerLength = 21;
+	static constexpr int32 MaxFloatLength = 32;
+
+	// Integer formatting in base 10.
+	static int32 FormatInteger(int64 InValue, ANSICHAR* OutBuffer);
+	static int32 FormatUnsignedInteger(uint64 InValue, ANSICHAR* OutBuffer);
+
+	/**
+	 * Formats a floating-point number using the fewest significant digits that parse back to exactly the same value
+	 * (e.g. 0.1f is formatted as "0.1" rather than "0.100000001"). Non-finite values are formatted as "nan", "inf", or "-inf".
+	 */
+	static int32 FormatFloat(float InValue, ANSICHAR* OutBuffer);
+	static int32 FormatDouble(double InValue, ANSICHAR* OutBuffer);
+};
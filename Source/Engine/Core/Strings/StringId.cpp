@@ -11,10 +11,13 @@ FStringId::FStringId()
 FStringId::FStringId(const ANSICHAR* InANSIString)
 	: Id(GetTypeHash(InANSIString))
 {
-	if (!FStringIdRegistry::Get().StringIdRegistry.IsKeyContained(Id))
-	{
-		FStringIdRegistry::Get().StringIdRegistry.Add(Id, InANSIString);
-	}
+	FStringIdRegistry::Get().Register(Id, InANSIString);
+}
+
+FStringId::FStringId(const FANSIStringView& InANSIStringView)
+	: Id(GetTypeHash(InANSIStringView))
+{
+	FStringIdRegistry::Get().Register(Id, InANSIStringView);
 }
 
 uint64 FStringId::GetId() const
@@ -24,7 +27,7 @@ uint64 FStringId::GetId() const
 
 const FANSIString& FStringId::GetString() const
 {
-	FANSIString* String = FStringIdRegistry::Get().StringIdRegistry.Find(Id);
+	const FANSIString* String = FStringIdRegistry::Get().Find(Id);
 	// All FStringIds should be stored in the FStringIdRegistry.
 	ensure(String);
 	return *String;
@@ -3,6 +3,7 @@
 #include "CoreGlobals.h"
 #include "Containers/Map.h"
 #include "Strings/String.h"
+#include "Strings/StringView.h"
 #include "StringIdRegistry.h"
 
 /*
@@ -15,6 +16,8 @@ public:
 	// Constructors.
 	FStringId();
 	FStringId(const ANSICHAR* InANSIString);
+	// Construct from a view, so that callers don't need to materialize a null-terminated temporary.
+	FStringId(const FANSIStringView& InANSIStringView);
 
 	// Copy operations.
 	FStringId(const FStringId& InStringId) = default;
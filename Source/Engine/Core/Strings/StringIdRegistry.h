@@ -1,10 +1,22 @@
 #pragma once
 
+#include "Containers/Array.h"
 #include "Containers/Map.h"
+#include "Memory/PoolAllocator.h"
 #include "String.h"
 
+// System include for the lock that lets lookups run alongside each other.
+#include <shared_mutex>
+
 /**
  * A registry of hashed string IDs to their original strings for fast retrieval and single storage.
+ *
+ * IDs are created and looked up from the game and render threads alike. Lookups share a lock, and only
+ * registering a new string takes it exclusively. Registered strings are never moved or freed while the
+ * registry exists, so references returned by FStringId::GetString stay valid.
+ *
+ * The registry lives until the program exits, so its storage comes from the persistent pool, which the
+ * leak report leaves out.
  */
 class FStringIdRegistry
 {
@@ -15,9 +27,57 @@ public:
 		return StringIdRegistry;
 	}
 
+	~FStringIdRegistry()
+	{
+		for (FANSIString* String : Strings)
+		{
+			delete String;
+		}
+	}
+
 private:
-	FStringIdRegistry() = default;
-	TMap<uint64, FANSIString> StringIdRegistry;
+	FStringIdRegistry()
+		: StringIdRegistry(FPoolAllocator::GetPersistentAllocator())
+		, Strings(FPoolAllocator::GetPersistentAllocator())
+	{
+	}
+
+	// Registers the string of an ID, unless it has been registered already.
+	template<typename StringType>
+	void Register(uint64 InId, const StringType& InString)
+	{
+		// Most IDs are created from strings that have been registered already, which only takes the shared lock.
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			if (StringIdRegistry.IsKeyContained(InId))
+			{
+				return;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> Lock(Mutex);
+		if (!StringIdRegistry.IsKeyContained(InId))
+		{
+			FANSIString* String = new FANSIString;
+			String->SetAllocator(&FPoolAllocator::GetPersistentAllocator());
+			*String = InString;
+			Strings.Add(String);
+			StringIdRegistry.Add(InId, String);
+		}
+	}
+
+	const FANSIString* Find(uint64 InId) const
+	{
+		std::shared_lock<std::shared_mutex> Lock(Mutex);
+		FANSIString* const* String = StringIdRegistry.Find(InId);
+		return String ? *String : nullptr;
+	}
+
+	// The strings are allocated separately, so that the map can grow without moving them.
+	TMap<uint64, FANSIString*> StringIdRegistry;
+	// Owns the registered strings.
+	TArray<FANSIString*> Strings;
+	mutable std::shared_mutex Mutex;
 
 	friend class FStringId;
 };
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "CoreGlobals.h"
+#include "AssertionMacros.h"
+#include "Math/MathUtilities.h"
+#include "Hash/Crc64.h"
+
+// System includes (for memcmp).
+#include <cstring>
+
+template<typename CharType>
+class TBasicString;
+
+/**
+ * Returns the length of the string, disregarding the null-terminating character.
+ */
+template<typename CharType>
+static int32 StrLen(const CharType* InPtr)
+{
+	const CharType* Ptr = InPtr;
+
+	// Both ANSI and Unicode strings are null-terminated.
+	while (*Ptr)
+	{
+		++Ptr;
+	}
+
+	return (int32)(Ptr - InPtr);
+}
+
+/**
+ * Non-owning view into a contiguous sequence of characters.
+ *
+ * Views are cheap to copy and never allocate, which makes them the preferred way of
+ * passing string data into functions that only read it (e.g. file parsers and FStringId).
+ * Note that a view isn't guaranteed to be null-terminated, and that the viewed
+ * characters must outlive the view.
+ */
+template<typename CharType>
+class TStringView
+{
+public:
+	// Constructors.
+	TStringView() = default;
+	TStringView(const CharType* InCharTypeString)
+		: Data(InCharTypeString)
+		, Size(InCharTypeString ? StrLen(InCharTypeString) : 0)
+	{
+	}
+	TStringView(const CharType* InData, int32 InSize)
+		: Data(InData)
+		, Size(InSize)
+	{
+		ensure(InSize >= 0);
+	}
+	TStringView(const TBasicString<CharType>& InString)
+		: Data(InString.GetData())
+		, Size(InString.GetSize())
+	{
+	}
+
+	// Copy operations.
+	TStringView(const TStringView&) = default;
+	TStringView& operator=(const TStringView&) = default;
+
+	// Returns the view of the characters in [InStartIndex, InEndIndex).
+	TStringView Substring(int32 InStartIndex, int32 InEndIndex) const
+	{
+		if (InStartIndex >= InEndIndex)
+		{
+			return TStringView();
+		}
+
+		int32 Start = FMath::Clamp(InStartIndex, 0, Size);
+		int32 End = FMath::Clamp(InEndIndex, 0, Size);
+		return TStringView(Data + Start, End - Start);
+	}
+
+	// Returns the index of the first instance of a character, or InvalidIndex if it isn't found.
+	int32 Find(CharType InCharacter, int32 InStartIndex = 0) const
+	{
+		for (int32 Index = FMath::Max(InStartIndex, 0); Index < Size; ++Index)
+		{
+			if (Data[Index] == InCharacter)
+			{
+				return Index;
+			}
+		}
+
+		return InvalidIndex;
+	}
+
+	bool IsEmpty() const
+	{
+		return Size == 0;
+	}
+
+	// Accessors.
+	const CharType& operator[](int32 InIndex) const
+	{
+		ensure(0 <= InIndex && InIndex < Size);
+		return Data[InIndex];
+	}
+
+	// Getters.
+	const CharType* GetData() const
+	{
+		return Data;
+	}
+	int32 GetSize() const
+	{
+		return Size;
+	}
+
+	// Iterators.
+	const CharType* begin() const
+	{
+		return Data;
+	}
+	const CharType* end() const
+	{
+		return Data + Size;
+	}
+
+private:
+	const CharType* Data = nullptr;
+	// Number of characters in the view. Views never include a null-terminating character.
+	int32 Size = 0;
+};
+
+// Global operators
+template<typename CharType>
+inline bool operator==(const TStringView<CharType>& InView1, const TStringView<CharType>& InView2)
+{
+	return (InView1.GetSize() == InView2.GetSize()) && (memcmp(InView1.GetData(), InView2.GetData(), InView1.GetSize() * sizeof(CharType)) == 0);
+}
+
+template<typename CharType>
+inline bool operator==(const TStringView<CharType>& InView, const CharType* InCharTypeString)
+{
+	return InView == TStringView<CharType>(InCharTypeString);
+}
+
+template<typename CharType>
+inline bool operator==(const CharType* InCharTypeString, const TStringView<CharType>& InView)
+{
+	return InView == InCharTypeString;
+}
+
+template<typename CharType>
+inline bool operator!=(const TStringView<CharType>& InView1, const TStringView<CharType>& InView2)
+{
+	return !(InView1 == InView2);
+}
+
+template<typename CharType>
+inline bool operator!=(const TStringView<CharType>& InView, const CharType* InCharTypeString)
+{
+	return !(InView == InCharTypeString);
+}
+
+template<typename CharType>
+inline bool operator!=(const CharType* InCharTypeString, const TStringView<CharType>& InView)
+{
+	return !(InView == InCharTypeString);
+}
+
+// Hashing support for string views. Produces the same hash as the equivalent TBasicString.
+inline uint64 GetTypeHash(const TStringView<ANSICHAR>& InStringView)
+{
+	int32 SizeBytes = InStringView.GetSize() * sizeof(ANSICHAR);
+	return FCrc64::GetTypeHash(InStringView.GetData(), SizeBytes);
+}
+
+inline uint64 GetTypeHash(const TStringView<U8CHAR>& InStringView)
+{
+	int32 SizeBytes = InStringView.GetSize() * sizeof(U8CHAR);
+	return FCrc64::GetTypeHash(InStringView.GetData(), SizeBytes);
+}
+
+using FU8StringView = TStringView<U8CHAR>;
+using FANSIStringView = TStringView<ANSICHAR>;
@@ -0,0 +1,43 @@
+#pragma once
+
+// Follows Unreal's TLess. Binary predicate that orders objects with operator<, used as the default
+// predicate of sorting and searching algorithms.
+template<typename T = void>
+struct TLess
+{
+	bool operator()(const T& InA, const T& InB) const
+	{
+		return InA < InB;
+	}
+};
+
+// Deduces the types of the objects from the call, so that objects of different types can be compared.
+template<>
+struct TLess<void>
+{
+	template<typename TA, typename TB>
+	bool operator()(const TA& InA, const TB& InB) const
+	{
+		return InA < InB;
+	}
+};
+
+// Orders objects in reverse, with operator< on swapped operands, so that only operator< is needed.
+template<typename T = void>
+struct TGreater
+{
+	bool operator()(const T& InA, const T& InB) const
+	{
+		return InB < InA;
+	}
+};
+
+template<>
+struct TGreater<void>
+{
+	template<typename TA, typename TB>
+	bool operator()(const TA& InA, const TB& InB) const
+	{
+		return InB < InA;
+	}
+};
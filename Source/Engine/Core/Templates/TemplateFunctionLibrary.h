@@ -51,3 +51,13 @@ inline T&& Forward(typename TRemoveReference<T>::Type&& InObject)
 
 template <typename T>
 T&& DeclVal();
+
+// Follows Unreal's implementation.
+// Swaps two objects by moving them, so that swapping doesn't copy.
+template <typename T>
+inline void Swap(T& InOutA, T& InOutB)
+{
+	T Temp = MoveTemp(InOutA);
+	InOutA = MoveTemp(InOutB);
+	InOutB = MoveTemp(Temp);
+}
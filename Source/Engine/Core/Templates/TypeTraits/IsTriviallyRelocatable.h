@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * Traits to determine if objects of a type can be moved to another address with a memcpy, without calling
+ * their move constructor and destructor. Containers use it to grow with a single copy.
+ * Trivially copyable types are relocatable. Specialize it for other types that don't point into themselves,
+ * such as smart pointers.
+ */
+template<typename T>
+struct TIsTriviallyRelocatable
+{
+	static constexpr bool Value = __is_trivially_copyable(T);
+};
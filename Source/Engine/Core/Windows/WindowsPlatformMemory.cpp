@@ -0,0 +1,34 @@
+#include "WindowsPlatformMemory.h"
+
+// System include for VirtualAlloc, VirtualFree, and GetSystemInfo.
+#include "Windows.h"
+
+uint64 FWindowsPlatformMemory::GetPageSize()
+{
+	SYSTEM_INFO SystemInfo;
+	GetSystemInfo(&SystemInfo);
+	return SystemInfo.dwPageSize;
+}
+
+void* FWindowsPlatformMemory::ReserveVirtualMemory(uint64 InSize)
+{
+	return VirtualAlloc(nullptr, InSize, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool FWindowsPlatformMemory::CommitVirtualMemory(void* InAddress, uint64 InSize, bool bInUseHugePages)
+{
+	// Large pages on Windows must be reserved and committed at once and need the "Lock pages in memory"
+	// privilege, so memory committed on demand always uses regular pages.
+	return VirtualAlloc(InAddress, InSize, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void FWindowsPlatformMemory::DecommitVirtualMemory(void* InAddress, uint64 InSize)
+{
+	VirtualFree(InAddress, InSize, MEM_DECOMMIT);
+}
+
+void FWindowsPlatformMemory::ReleaseVirtualMemory(void* InAddress, uint64 InSize)
+{
+	// The size must be zero when releasing a whole reservation.
+	VirtualFree(InAddress, 0, MEM_RELEASE);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "GenericPlatform/GenericPlatformMemory.h"
+
+class FWindowsPlatformMemory : public FGenericPlatformMemory
+{
+public:
+	// Begin FGenericPlatformMemory interface.
+	static uint64 GetPageSize();
+	static void* ReserveVirtualMemory(uint64 InSize);
+	static bool CommitVirtualMemory(void* InAddress, uint64 InSize, bool bInUseHugePages);
+	static void DecommitVirtualMemory(void* InAddress, uint64 InSize);
+	static void ReleaseVirtualMemory(void* InAddress, uint64 InSize);
+	// End FGenericPlatformMemory interface.
+};
+
+using FPlatformMemory = FWindowsPlatformMemory;
@@ -0,0 +1,52 @@
+#include "WindowsPlatformStackWalk.h"
+#include "Math/MathUtilities.h"
+
+// System includes for RtlCaptureStackBackTrace and the DbgHelp symbol functions.
+#include "Windows.h"
+#include <DbgHelp.h>
+#include <cstdio>
+#include <mutex>
+
+namespace
+{
+	// DbgHelp functions are single-threaded, and symbols are loaded on first use.
+	std::mutex SymbolMutex;
+	bool bSymbolsInitialized = false;
+}
+
+int32 FWindowsPlatformStackWalk::CaptureStackBackTrace(uint64* OutAddresses, int32 InMaxDepth, int32 InNumFramesToSkip /* = 0 */)
+{
+	static constexpr int32 MaxCapturedFrames = 62;
+	void* Frames[MaxCapturedFrames];
+	// Skip this function's frame as well.
+	USHORT NumFrames = RtlCaptureStackBackTrace(InNumFramesToSkip + 1, FMath::Min(InMaxDepth, MaxCapturedFrames), Frames, nullptr);
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		OutAddresses[Index] = reinterpret_cast<uint64>(Frames[Index]);
+	}
+	return NumFrames;
+}
+
+bool FWindowsPlatformStackWalk::GetSymbolName(uint64 InAddress, ANSICHAR* OutName, int32 InNameSize)
+{
+	std::lock_guard<std::mutex> Lock(SymbolMutex);
+	HANDLE Process = GetCurrentProcess();
+	if (!bSymbolsInitialized)
+	{
+		SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS);
+		bSymbolsInitialized = SymInitialize(Process, nullptr, TRUE) == TRUE;
+	}
+
+	alignas(SYMBOL_INFO) int8 SymbolBuffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+	SYMBOL_INFO* Symbol = reinterpret_cast<SYMBOL_INFO*>(SymbolBuffer);
+	Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+	Symbol->MaxNameLen = MAX_SYM_NAME;
+	DWORD64 Displacement = 0;
+	if (!bSymbolsInitialized || !SymFromAddr(Process, InAddress, &Displacement, Symbol))
+	{
+		return FGenericPlatformStackWalk::GetSymbolName(InAddress, OutName, InNameSize);
+	}
+
+	snprintf(OutName, InNameSize, "%s + %llu", Symbol->Name, static_cast<uint64>(Displacement));
+	return true;
+}
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "HAL/PlatformApplication.h"
 #include "HAL/PlatformTime.h"
+#include "Memory/MemoryManager.h"
+#include "Memory/MemoryTracker.h"
 #include "RenderManager.h"
 #include "ViceApplication.h"
 #include "SceneEditor.h"
@@ -14,7 +16,25 @@ static constexpr int32 DefaultWindowHeight = 720;
 // Run engine at a fixed 60 frames per second.
 static constexpr int32 FrameInterval = 16.6666;
 
+// Render on a dedicated thread that owns the graphics context, so that the game thread builds a frame while the render thread submits the last one.
+static constexpr bool bUseRenderThread = false;
+// Frames the render thread can be behind the game thread. More frames absorb spikes on either thread at the cost of input latency.
+static constexpr int32 MaxFramesInFlight = 1;
+
 void FEngine::Run()
+{
+#if MEMORY_TRACKING
+	// Allocations made while the engine runs should all be freed once its subsystems are destroyed. Registries that
+	// live until exit, such as the string ID registry, allocate from the persistent pool, which isn't reported.
+	uint64 LeakCheckpoint = FMemoryTracker::Get().GetAllocationCheckpoint();
+	RunSubsystems();
+	FMemoryTracker::Get().ReportLeaks(LeakCheckpoint);
+#else
+	RunSubsystems();
+#endif
+}
+
+void FEngine::RunSubsystems()
 {
 	TUniquePtr<FGenericApplication> Application = FPlatformApplication::CreateApplication();
 	TUniquePtr<FGenericWindow> Window = Application->MakeWindow(WindowTitle, DefaultWindowWidth, DefaultWindowHeight);
@@ -31,6 +51,12 @@ void FEngine::Run()
 	Application->SetApplicationMessageHandler(ViceApplication);
 	ViceApplication->Init();
 
+	// Hand the graphics context over to the render thread once the application has created its GPU resources.
+	if (bUseRenderThread)
+	{
+		FRenderManager::StartRenderThread(MaxFramesInFlight);
+	}
+
 	FPlatformTime::Init();
 	double PrevTime = FPlatformTime::CurrentTimeMilliseconds();
 	double CurrTime = FPlatformTime::CurrentTimeMilliseconds();
@@ -43,10 +69,14 @@ void FEngine::Run()
 		if (DeltaTimeMilliseconds >= FrameInterval)
 		{
 			// Update engine subsystems.
+			FRenderManager::BeginFrame();
 			ViceApplication->Update(DeltaTimeMilliseconds);
 			FRenderManager::Update(DeltaTimeMilliseconds);
 			FPlatformApplication::PumpMessages();
 
+			// Free the memory of the frame before this one. This frame's allocations stay valid for one more frame.
+			FMemoryManager::Get().GetFrameAllocator().EndFrame();
+
 			DeltaTimeMilliseconds -= FrameInterval;
 		}
 
@@ -54,7 +84,8 @@ void FEngine::Run()
 		CurrTime = FPlatformTime::CurrentTimeMilliseconds();
 	}
 
-	// Shutdown engine subsystems.
+	// Shutdown engine subsystems, once the graphics context is back on this thread.
+	FRenderManager::StopRenderThread();
 	ViceApplication->Shutdown();
 	FRenderManager::Shutdown();
 }
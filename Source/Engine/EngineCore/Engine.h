@@ -5,4 +5,8 @@ class FEngine
 public:
 	// Handles initialization/shutdown of engine subsystems and runs the engine loop.
 	static void Run();
+
+private:
+	// Runs the engine loop between initializing and shutting down the subsystems. Every subsystem is destroyed when it returns.
+	static void RunSubsystems();
 };
@@ -3,74 +3,74 @@
 #include "CoreMinimal.h"
 #include "RHI/RHI.h"
 #include "Camera/Camera.h"
-#include "Materials/Material.h"
-#include "Geometry/Mesh.h"
+#include "ResourceManager.h"
 #include "Geometry/Model.h"
 #include "Lights/DirectionalLight.h"
 #include "Lights/PointLight.h"
 
-#include <string>
 
 // Helper functions for updating shader uniform data.
 static void UpdateMaterialUniforms(FMaterial& InMaterial);
-static void UpdateMatrixUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FModel>& InModel, const TSharedPtr<FCamera>& InCamera);
-static void UpdateCameraUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FCamera>& InCamera);
-static void UpdateLightUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FScene>& InScene);
+static void UpdateMatrixUniforms(FPipeline& InPipeline, const FModelRenderInfo& InModel, const FCamera& InCamera);
+static void UpdateCameraUniforms(FPipeline& InPipeline, const FCamera& InCamera);
+static void UpdateLightUniforms(FPipeline& InPipeline, const FRenderFrame& InFrame);
 
-void FForwardRenderer::Render()
+void FForwardRenderer::Render(const FRenderFrame& InFrame)
 {
-	if (!Scene)
+	if (!InFrame.bHasScene)
 	{
 		return;
 	}
 
-	RenderTarget->Bind();
+	InFrame.RenderTarget->Bind();
 
 	FRHI::EnableDepthTesting();
 	FRHI::ClearColorBuffer();
 	FRHI::ClearDepthBuffer();
 
-	RenderSkybox();
+	RenderSkybox(InFrame);
 
-	for (const TSharedPtr<FModel>& Model : Scene->GetVisibleModels())
+	for (const FModelRenderInfo& Model : InFrame.Models)
 	{
-		RenderModel(Model);
+		RenderModel(InFrame, Model);
 	}
 
-	RenderTarget->Unbind();
+	InFrame.RenderTarget->Unbind();
 
 	FRHI::SwapBuffers();
 }
 
-void FForwardRenderer::RenderSkybox()
+void FForwardRenderer::RenderSkybox(const FRenderFrame& InFrame)
 {
-	const TSharedPtr<FSkybox>& Skybox = Scene->GetSkybox();
-	if (!Skybox || !Skybox->IsVisible())
+	const FSkybox* Skybox = InFrame.Skybox;
+	if (!Skybox)
 	{
 		return;
 	}
 
+	const FCamera& Camera = InFrame.Camera;
+
 	// Make sure skybox is always fully rendered (i.e. not as a wireframe or as points).
 	FRHI::SetDrawingMode(EDrawingMode::Filled);
 	// Disable depth buffer writing while the skybox is being rendered,
 	// so that other scene objects always appear in front of the skybox.
 	FRHI::DisableDepthBufferWriting();
 
-	TSharedPtr<FPipeline> SkyboxPipeline = Skybox->GetMesh().GetMaterial().GetPipeline();
-	SkyboxPipeline->Bind();
+	FPipeline& SkyboxPipeline = Skybox->GetMaterial().GetPipeline();
+	SkyboxPipeline.Bind();
 
 	// Remove translation component from the view matrix so that the skybox appears to stretch out infinitely.
-	FTransform4D ViewTransform = Camera->GetLookAt();
+	FTransform4D ViewTransform = Camera.GetLookAt();
 	ViewTransform.SetTranslation(FVector3D::Zero);
-	SkyboxPipeline->SetMatrix4D(FUniformNames::ViewMatrix, ViewTransform.ToMatrix());
+	SkyboxPipeline.SetMatrix4D(FUniformNames::ViewMatrix, ViewTransform.ToMatrix());
 
 	// Keep frustum near/far plane distances constant so that the skybox is never clipped.
-	FFrustum Frustum = Camera->GetFrustum();
+	FFrustum Frustum = Camera.GetFrustum();
 	Frustum.NearDistance = 0.1f;
 	Frustum.FarDistance = 2.0f;
 
 	FMatrix4D Projection;
-	if (Camera->GetProjectionType() == EProjectionType::Perspective)
+	if (Camera.GetProjectionType() == EProjectionType::Perspective)
 	{
 		Projection = FCamera::MakePerspectiveProjection(Frustum);
 	}
@@ -78,7 +78,7 @@ void FForwardRenderer::RenderSkybox()
 	{
 		Projection = FCamera::MakePerspectiveProjection(Frustum);
 	}
-	SkyboxPipeline->SetMatrix4D(FUniformNames::ProjectionMatrix, Projection);
+	SkyboxPipeline.SetMatrix4D(FUniformNames::ProjectionMatrix, Projection);
 
 	Skybox->GetCubemap().Bind();
 
@@ -98,20 +98,22 @@ void FForwardRenderer::RenderSkybox()
 	FRHI::EnableDepthBufferWriting();
 }
 
-void FForwardRenderer::RenderModel(const TSharedPtr<FModel>& InModel)
+void FForwardRenderer::RenderModel(const FRenderFrame& InFrame, const FModelRenderInfo& InModel)
 {
-	FRHI::SetDrawingMode(InModel->GetDrawingMode());
+	FRHI::SetDrawingMode(InModel.DrawingMode);
 
-	for (FMesh& Mesh : InModel->GetMeshes())
+	// Meshes, materials and pipelines are reached through their handles, without any lookups by name.
+	for (const FModelMesh& ModelMesh : InModel.Model->GetMeshes())
 	{
-		FMaterial& Material = Mesh.GetMaterial();
-		TSharedPtr<FPipeline> Pipeline = Material.GetPipeline();
-		Pipeline->Bind();
+		FMesh& Mesh = *ModelMesh.Mesh;
+		FMaterial& Material = *ModelMesh.Material;
+		FPipeline& Pipeline = Material.GetPipeline();
+		Pipeline.Bind();
 
 		UpdateMaterialUniforms(Material);
-		UpdateMatrixUniforms(Pipeline, InModel, Camera);
-		UpdateCameraUniforms(Pipeline, Camera);
-		UpdateLightUniforms(Pipeline, Scene);
+		UpdateMatrixUniforms(Pipeline, InModel, InFrame.Camera);
+		UpdateCameraUniforms(Pipeline, InFrame.Camera);
+		UpdateLightUniforms(Pipeline, InFrame);
 
 		Mesh.GetVertexArray()->Bind();
 
@@ -127,88 +129,86 @@ void FForwardRenderer::RenderModel(const TSharedPtr<FModel>& InModel)
 	}
 }
 
-// Returns a string in the form of "Material.PropertyName"
-static std::string GetMaterialUniformMemberName(const ANSICHAR* InPropertyName)
+// Uniform names are short, so building them never leaves the builder's inline storage.
+using FUniformNameBuilder = TANSIStringBuilder<64>;
+
+// Builds a string in the form of "Material.PropertyName"
+static const ANSICHAR* GetMaterialUniformMemberName(FUniformNameBuilder& OutName, const FANSIString& InPropertyName)
 {
-	return std::string(FUniformNames::Material) + "." + InPropertyName;
+	OutName.Reset();
+	OutName.Append(FUniformNames::Material).Append('.').Append(InPropertyName);
+	return OutName.GetData();
 }
 
-// Returns a string in the form of "UniformName[LightIndex].MemberName" (e.g. "PointLight[0].Position").
-static std::string GetLightUniformMemberName(const ANSICHAR* InUniformName, int32 LightIndex, const ANSICHAR* InMemberName)
+// Builds a string in the form of "UniformName[LightIndex].MemberName" (e.g. "PointLight[0].Position").
+static const ANSICHAR* GetLightUniformMemberName(FUniformNameBuilder& OutName, const ANSICHAR* InUniformName, int32 LightIndex, const ANSICHAR* InMemberName)
 {
-	return std::string(InUniformName) + "[" + std::to_string(LightIndex) + "]." + InMemberName;
+	OutName.Reset();
+	OutName.Append(InUniformName).Append('[').Append(LightIndex).Append("].").Append(InMemberName);
+	return OutName.GetData();
 }
 
 static void UpdateMaterialUniforms(FMaterial& InMaterial)
 {
-	TSharedPtr<FPipeline> Pipeline = InMaterial.GetPipeline();
+	FPipeline& Pipeline = InMaterial.GetPipeline();
+	FUniformNameBuilder Name;
 
 	for (const FMaterialProperty<float>& FloatProperty : InMaterial.GetFloatProperties())
 	{
-		std::string FloatPropertyName = GetMaterialUniformMemberName(FloatProperty.Name.GetString().GetData());
-		Pipeline->SetFloat(FloatPropertyName.c_str(), FloatProperty.Property);
+		Pipeline.SetFloat(GetMaterialUniformMemberName(Name, FloatProperty.Name.GetString()), FloatProperty.Property);
 	}
 
 	for (const FMaterialProperty<FColor>& ColorProperty : InMaterial.GetColorProperties())
 	{
-		std::string ColorPropertyName = GetMaterialUniformMemberName(ColorProperty.Name.GetString().GetData());
-		Pipeline->SetVector3D(ColorPropertyName.c_str(), ColorProperty.Property);
+		Pipeline.SetVector3D(GetMaterialUniformMemberName(Name, ColorProperty.Name.GetString()), ColorProperty.Property);
 	}
 
-	for (const FMaterialProperty<FTexture2D>& TextureProperty : InMaterial.GetTextureProperties())
+	for (const FMaterialProperty<FMaterialTexture>& TextureProperty : InMaterial.GetTextureProperties())
 	{
-		TextureProperty.Property.Bind();
-		std::string TexturePropertyName = GetMaterialUniformMemberName(TextureProperty.Name.GetString().GetData());
-		int32 TextureUnit = static_cast<int32>(TextureProperty.Property.GetTextureUnit());
-		Pipeline->SetInt(TexturePropertyName.c_str(), TextureUnit);
+		TextureProperty.Property.Texture->Bind(TextureProperty.Property.TextureUnit);
+		int32 TextureUnit = static_cast<int32>(TextureProperty.Property.TextureUnit);
+		Pipeline.SetInt(GetMaterialUniformMemberName(Name, TextureProperty.Name.GetString()), TextureUnit);
 	}
 }
 
-static void UpdateMatrixUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FModel>& InModel, const TSharedPtr<FCamera>& InCamera)
+static void UpdateMatrixUniforms(FPipeline& InPipeline, const FModelRenderInfo& InModel, const FCamera& InCamera)
 {
-	InPipeline->SetMatrix4D(FUniformNames::ModelMatrix, InModel->GetWorldTransform().ToMatrix());
-	InPipeline->SetMatrix4D(FUniformNames::ViewMatrix, InCamera->GetLookAt().ToMatrix());
-	InPipeline->SetMatrix4D(FUniformNames::ProjectionMatrix, InCamera->GetProjection());
+	InPipeline.SetMatrix4D(FUniformNames::ModelMatrix, InModel.WorldMatrix);
+	InPipeline.SetMatrix4D(FUniformNames::ViewMatrix, InCamera.GetLookAt().ToMatrix());
+	InPipeline.SetMatrix4D(FUniformNames::ProjectionMatrix, InCamera.GetProjection());
 }
 
-static void UpdateCameraUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FCamera>& InCamera)
+static void UpdateCameraUniforms(FPipeline& InPipeline, const FCamera& InCamera)
 {
-	InPipeline->SetVector3D(FUniformNames::CameraPosition, InCamera->GetPosition());
+	InPipeline.SetVector3D(FUniformNames::CameraPosition, InCamera.GetPosition());
 }
 
-static void UpdateLightUniforms(const TSharedPtr<FPipeline>& InPipeline, const TSharedPtr<FScene>& InScene)
+static void UpdateLightUniforms(FPipeline& InPipeline, const FRenderFrame& InFrame)
 {
-	const TArray<TSharedPtr<FDirectionalLight> >& DirectionalLights = InScene->GetVisibleDirectionalLights();
+	FUniformNameBuilder Name;
+
+	const TArray<FDirectionalLightRenderInfo>& DirectionalLights = InFrame.DirectionalLights;
 	for (int32 Index = 0; Index < DirectionalLights.GetSize(); ++Index)
 	{
-		std::string Direction = GetLightUniformMemberName(FUniformNames::DirectionalLights, Index, "Direction");
-		std::string Color = GetLightUniformMemberName(FUniformNames::DirectionalLights, Index, "Color");
-		std::string Intensity = GetLightUniformMemberName(FUniformNames::DirectionalLights, Index, "Intensity");
-
-		InPipeline->SetVector3D(Direction.c_str(), DirectionalLights[Index]->GetDirection());
-		InPipeline->SetVector3D(Color.c_str(), (FVector3D)DirectionalLights[Index]->GetColor());
-		InPipeline->SetFloat(Intensity.c_str(), DirectionalLights[Index]->GetIntensity());
+		const ANSICHAR* Uniform = FUniformNames::DirectionalLights;
+		InPipeline.SetVector3D(GetLightUniformMemberName(Name, Uniform, Index, "Direction"), DirectionalLights[Index].Direction);
+		InPipeline.SetVector3D(GetLightUniformMemberName(Name, Uniform, Index, "Color"), (FVector3D)DirectionalLights[Index].Color);
+		InPipeline.SetFloat(GetLightUniformMemberName(Name, Uniform, Index, "Intensity"), DirectionalLights[Index].Intensity);
 	}
 
-	InPipeline->SetInt(FUniformNames::NumDirectionalLights, DirectionalLights.GetSize());
+	InPipeline.SetInt(FUniformNames::NumDirectionalLights, DirectionalLights.GetSize());
 
-	const TArray<TSharedPtr<FPointLight> >& PointLights = InScene->GetVisiblePointLights();
+	const TArray<FPointLightRenderInfo>& PointLights = InFrame.PointLights;
 	for (int32 Index = 0; Index < PointLights.GetSize(); ++Index)
 	{
-		std::string Position = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Position");
-		std::string Color = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Color");
-		std::string ConstantAttenuationFactor = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Attenuation.Constant");
-		std::string LinearAttenuationFactor = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Attenuation.Linear");
-		std::string QuadraticAttenuationFactor = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Attenuation.Quadratic");
-		std::string Intensity = GetLightUniformMemberName(FUniformNames::PointLights, Index, "Intensity");
-
-		InPipeline->SetVector3D(Position.c_str(), PointLights[Index]->GetPosition());
-		InPipeline->SetVector3D(Color.c_str(), (FVector3D)PointLights[Index]->GetColor());
-		InPipeline->SetFloat(ConstantAttenuationFactor.c_str(), PointLights[Index]->GetAttenuation().Constant);
-		InPipeline->SetFloat(LinearAttenuationFactor.c_str(), PointLights[Index]->GetAttenuation().Linear);
-		InPipeline->SetFloat(QuadraticAttenuationFactor.c_str(), PointLights[Index]->GetAttenuation().Quadratic);
-		InPipeline->SetFloat(Intensity.c_str(), PointLights[Index]->GetIntensity());
+		const ANSICHAR* Uniform = FUniformNames::PointLights;
+		InPipeline.SetVector3D(GetLightUniformMemberName(Name, Uniform, Index, "Position"), PointLights[Index].Position);
+		InPipeline.SetVector3D(GetLightUniformMemberName(Name, Uniform, Index, "Color"), (FVector3D)PointLights[Index].Color);
+		InPipeline.SetFloat(GetLightUniformMemberName(Name, Uniform, Index, "Attenuation.Constant"), PointLights[Index].Attenuation.Constant);
+		InPipeline.SetFloat(GetLightUniformMemberName(Name, Uniform, Index, "Attenuation.Linear"), PointLights[Index].Attenuation.Linear);
+		InPipeline.SetFloat(GetLightUniformMemberName(Name, Uniform, Index, "Attenuation.Quadratic"), PointLights[Index].Attenuation.Quadratic);
+		InPipeline.SetFloat(GetLightUniformMemberName(Name, Uniform, Index, "Intensity"), PointLights[Index].Intensity);
 	}
 
-	InPipeline->SetInt(FUniformNames::NumPointLights, PointLights.GetSize());
+	InPipeline.SetInt(FUniformNames::NumPointLights, PointLights.GetSize());
 }
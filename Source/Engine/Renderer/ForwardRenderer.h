@@ -12,9 +12,9 @@ public:
 
 private:
 	// Begin FRenderer interface.
-	virtual void Render() override;
+	virtual void Render(const FRenderFrame& InFrame) override;
 	// End FRenderer interface.
 
-	void RenderSkybox();
-	void RenderModel(const TSharedPtr<FModel>& InModel);
+	void RenderSkybox(const FRenderFrame& InFrame);
+	void RenderModel(const FRenderFrame& InFrame, const FModelRenderInfo& InModel);
 };
@@ -1,22 +1,22 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Materials/Material.h"
 #include "RHI/VertexFormats.h"
 #include "RHI/VertexArray.h"
 
 /**
- * A mesh consists of two things: a vertex array and a material.
- * 
- * The vertex array contains the vertex data that describes the mesh's geometry,
- * while the material specifies how to render the vertex data. A mesh's material 
- * can be swapped or modified at runtime, which can decrease iteration times as
- * well as allows for interesting runtime effects.
+ * A mesh is the geometry loaded from a mesh file, stored in a vertex array.
+ *
+ * Meshes are owned by FResourceManager and shared by every model that uses the
+ * same mesh file. The material a mesh is rendered with is chosen per model
+ * (see FModelMesh), so it can be swapped or modified at runtime without affecting
+ * other models, which can decrease iteration times as well as allows for
+ * interesting runtime effects.
  */
 class FMesh
 {
 public:
-	explicit FMesh(const FStringId& InMeshFileName, const FStringId& InMaterialFileName);
+	explicit FMesh(const FStringId& InMeshFileName);
 	~FMesh() = default;
 
 	FMesh(const FMesh&) = default;
@@ -25,9 +25,6 @@ public:
 	FMesh& operator=(FMesh&&) = default;
 
 	// Getters.
-	FMaterial& GetMaterial();
-	const FMaterial& GetMaterial() const;
-
 	const FStringId& GetName() const 
 	{
 		return MeshFileName; 
@@ -41,11 +38,7 @@ public:
 		return VertexArray; 
 	};
 
-	// Setters.
-	void SetMaterial(const FStringId& InMaterialFileName);
-
 private:
 	FStringId MeshFileName;
-	FStringId MaterialFileName;
 	TSharedPtr<TVertexArray<FVertex1P1N1UV> > VertexArray;
 };
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Mesh.h"
+#include "ResourceHandle.h"
 #include "RHI/RHIDefinitions.h"
 
 class FScene;
@@ -9,6 +9,16 @@ class FScene;
 template <typename ObjectType>
 class FSetScene;
 
+/**
+ * A mesh of a model and the material it is rendered with. The mesh and the material are
+ * shared with other models, but each model chooses the material of each of its meshes.
+ */
+struct FModelMesh
+{
+	TResourceRef<FMesh> Mesh;
+	TResourceRef<FMaterial> Material;
+};
+
 /**
  * A model consists of a collection of meshes, as well as data that applies to 
  * all meshes, such as the transform (position, rotation, scale), drawing mode,
@@ -36,44 +46,52 @@ public:
 	{ 
 		return DrawingMode; 
 	}
-	TArray<FMesh>& GetMeshes() 
+	TArray<FModelMesh>& GetMeshes() 
 	{ 
 		return Meshes;
 	}
-	const TArray<FMesh>& GetMeshes() const
+	const TArray<FModelMesh>& GetMeshes() const
 	{
 		return Meshes; 
 	};
+	const FTransformTRS& GetTransform() const
+	{
+		return Transform;
+	}
 	const FVector3D& GetPosition() const
 	{ 
-		return Position;
+		return Transform.Translation;
 	};
-	const FVector3D& GetRotation() const 
+	const FQuat& GetRotation() const 
 	{
-		return Rotation;
+		return Transform.Rotation;
 	};
 	const FVector3D& GetScale() const 
 	{
-		return Scale;
+		return Transform.Scale;
 	};
-	FTransform4D GetWorldTransform();
+	FTransform4D GetWorldTransform() const;
 
 	// Setters.
 	void SetDrawingMode(EDrawingMode InDrawingMode) 
 	{ 
 		DrawingMode = InDrawingMode;
 	}
+	void SetTransform(const FTransformTRS& InTransform)
+	{
+		Transform = InTransform;
+	}
 	void SetPosition(const FVector3D& InPosition) 
 	{ 
-		Position = InPosition;
+		Transform.Translation = InPosition;
 	}
-	void SetRotation(const FVector3D& InRotation) 
+	void SetRotation(const FQuat& InRotation) 
 	{ 
-		Rotation = InRotation; 
+		Transform.Rotation = InRotation; 
 	}
 	void SetScale(const FVector3D& InScale) 
 	{ 
-		Scale = InScale; 
+		Transform.Scale = InScale; 
 	}
 	void SetVisible();
 	void SetInvisible();
@@ -84,14 +102,12 @@ private:
 	FStringId Name;
 	FScene* Scene;
 
-	TArray<FMesh> Meshes;
+	TArray<FModelMesh> Meshes;
 	
 	EDrawingMode DrawingMode;
 	
-	// Transform.
-	FVector3D Position;
-	FVector3D Rotation;
-	FVector3D Scale;
+	// Transform (position, rotation, scale).
+	FTransformTRS Transform;
 	
 	friend class FSetScene<FModel>;
 };
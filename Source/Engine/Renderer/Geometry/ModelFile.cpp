@@ -17,6 +17,8 @@ namespace
 	};
 }
 
+static FStringId ParseStringId(const nlohmann::json& InJsonString);
+
 FModelFile::FModelFile(const FStringId& InModelFileName)
 {
 	FStringId ModelFilePath = FRendererFileSystem::GetModelFilePath(InModelFileName);
@@ -33,13 +35,17 @@ FModelFile::FModelFile(const FStringId& InModelFileName)
 		ensure(Mesh.contains(FModelFileKeys::Material) && !Mesh[FModelFileKeys::Material].is_null());
 
 		// Parse mesh file name.
-		std::string MeshFile = Mesh[FModelFileKeys::Geometry];
-		FStringId MeshFileName = FStringId(MeshFile.c_str());
+		FStringId MeshFileName = ParseStringId(Mesh[FModelFileKeys::Geometry]);
 		MeshFileNames.Add(MeshFileName);
 
 		// Parse material file name.
-		std::string MaterialFile = Mesh[FModelFileKeys::Material];
-		FStringId MaterialFileName = FStringId(MaterialFile.c_str());
+		FStringId MaterialFileName = ParseStringId(Mesh[FModelFileKeys::Material]);
 		MaterialFileNames.Add(MaterialFileName);
 	}
 }
+
+static FStringId ParseStringId(const nlohmann::json& InJsonString)
+{
+	const std::string& String = InJsonString.get_ref<const std::string&>();
+	return FStringId(FANSIStringView(String.data(), static_cast<int32>(String.size())));
+}
@@ -1,9 +1,13 @@
 #include "WavefrontObj.h"
 #include "RendererFileSystem.h"
+#include "Containers/InlineArray.h"
+#include "Containers/Map.h"
+#include "Hash/Crc64.h"
+#include "Memory/VirtualArenaAllocator.h"
 
 #include <fstream>
 #include <string>
-#include <sstream>
+#include <cstdlib>
 
 namespace
 {
@@ -14,12 +18,32 @@ namespace
 		static constexpr const ANSICHAR* TextureCoordinates = "vt";
 		static constexpr const ANSICHAR* Face = "f";
 	};
+
+	// The attribute indices of a face vertex. Face vertices with the same indices are the same vertex.
+	struct FFaceVertexKey
+	{
+		int32 Position;
+		int32 TextureCoordinate;
+		int32 Normal;
+
+		bool operator==(const FFaceVertexKey& InOther) const
+		{
+			return Position == InOther.Position && TextureCoordinate == InOther.TextureCoordinate && Normal == InOther.Normal;
+		}
+	};
+
+	uint64 GetTypeHash(const FFaceVertexKey& InKey)
+	{
+		return FCrc64::GetTypeHash(&InKey, sizeof(FFaceVertexKey));
+	}
 }
 
-static TArray<std::string> GetElementComponents(const std::string& InLine);
-static FVector2D ParseVector2D(const std::string& InX, const std::string& InY);
-static FVector3D ParseVector3D(const std::string& InX, const std::string& InY, const std::string& InZ);
-static TArray<int32> ParseFaceIndices(const std::string& InFace);
+static void GetElementComponents(const std::string& InLine, TArray<FANSIStringView>& OutElementComponents);
+static FVector2D ParseVector2D(const FANSIStringView& InX, const FANSIStringView& InY);
+static FVector3D ParseVector3D(const FANSIStringView& InX, const FANSIStringView& InY, const FANSIStringView& InZ);
+static void ParseFaceIndices(const FANSIStringView& InFace, int32 (&OutFaceIndices)[3]);
+static float ParseFloat(const FANSIStringView& InComponent);
+static int32 ParseInt(const FANSIStringView& InComponent);
 
 FWavefrontObj::FWavefrontObj(const FStringId& InWavefrontObjFileName)
 	: Vertices()
@@ -38,11 +62,18 @@ FWavefrontObj::FWavefrontObj(const FStringId& InWavefrontObjFileName)
 	TArray<int32> TextureCoordinateIndices;
 	TArray<int32> NormalIndices;
 
+	// The line buffer and the component views into it are reused across lines to avoid per-line allocations.
 	std::string CurrentElement;
+	TInlineArray<FANSIStringView, 16> ElementComponents;
 	while (std::getline(WavefrontObjInputStream, CurrentElement))
 	{
-		TArray<std::string> ElementComponents = GetElementComponents(CurrentElement);
-		std::string ElementName = ElementComponents[0];
+		GetElementComponents(CurrentElement, ElementComponents);
+		if (ElementComponents.IsEmpty())
+		{
+			continue;
+		}
+
+		const FANSIStringView& ElementName = ElementComponents[0];
 		if (ElementName == FWavefrontObjElements::Position)
 		{
 			FVector3D Position = ParseVector3D(ElementComponents[1], ElementComponents[2], ElementComponents[3]);
@@ -62,7 +93,8 @@ FWavefrontObj::FWavefrontObj(const FStringId& InWavefrontObjFileName)
 		{
 			for (int Index = 1; Index < ElementComponents.GetSize(); ++Index)
 			{
-				TArray<int32> FaceIndices = ParseFaceIndices(ElementComponents[Index]);
+				int32 FaceIndices[3];
+				ParseFaceIndices(ElementComponents[Index], FaceIndices);
 				PositionIndices.Add(FaceIndices[0]);
 				TextureCoordinateIndices.Add(FaceIndices[1]);
 				NormalIndices.Add(FaceIndices[2]);
@@ -70,69 +102,123 @@ FWavefrontObj::FWavefrontObj(const FStringId& InWavefrontObjFileName)
 		}
 	}
 
+	// The lookup of vertices we have already created only lives while the mesh loads, so it is allocated
+	// from an arena and freed all at once at the end of this scope. It has room for every face vertex to be
+	// unique without going over the rehash load factor, so it never rehashes.
+	// Large meshes need more than the engine arena holds, so the arena is one of its own that reserves
+	// address space for the lookup's worst case and only commits what it uses. The capacity is rounded up to
+	// a power of two, so each face vertex needs at most 4 slots of a pair and a metadata byte. The extra
+	// 64 KB covers the minimum set size and alignment. If the address space can't be reserved, the lookup
+	// comes from the default allocator instead.
 	int32 NumIndices = PositionIndices.GetSize();
+	const uint64 LookupSlotSize = sizeof(TPair<FFaceVertexKey, int32>) + 1;
+	FVirtualArenaAllocator LookupArena(static_cast<uint64>(NumIndices) * 4 * LookupSlotSize + 64 * 1024);
+	IAllocator& LookupAllocator = LookupArena.IsValid() ? static_cast<IAllocator&>(LookupArena) : FDefaultSetAllocator::GetDefaultAllocator();
+	TMap<FFaceVertexKey, int32> VertexIndices(NumIndices + NumIndices / 4, LookupAllocator);
 	for (int32 Index = 0; Index < NumIndices; ++Index)
 	{
 		// Create vertex using indices specified per face.
-		int32 PositionIndex = PositionIndices[Index];
-		int32 NormalIndex = NormalIndices[Index];
-		int32 TextureCoordinateIndex = TextureCoordinateIndices[Index];
-		FVertex1P1N1UV Vertex(Positions[PositionIndex], Normals[NormalIndex], TextureCoordinates[TextureCoordinateIndex]);
+		FFaceVertexKey VertexKey = { PositionIndices[Index], TextureCoordinateIndices[Index], NormalIndices[Index] };
 
 		// Store the vertex if we haven't encountered it already.
-		int32 VertexIndex = Vertices.GetIndexOf(Vertex);
-		if (VertexIndex == InvalidIndex)
+		int32 VertexIndex;
+		if (const int32* FoundVertexIndex = VertexIndices.Find(VertexKey))
 		{
-			Vertices.Add(Vertex);
+			VertexIndex = *FoundVertexIndex;
+		}
+		else
+		{
+			Vertices.Add(FVertex1P1N1UV(Positions[VertexKey.Position], Normals[VertexKey.Normal], TextureCoordinates[VertexKey.TextureCoordinate]));
 			VertexIndex = Vertices.GetSize() - 1;
+			VertexIndices.Add(VertexKey, VertexIndex);
 		}
-	
+
 		Indices.Add(VertexIndex);
 	}
 }
 
-static TArray<std::string> GetElementComponents(const std::string& InLine)
+static void GetElementComponents(const std::string& InLine, TArray<FANSIStringView>& OutElementComponents)
 {
-	TArray<std::string> ElementComponents;
-	std::string Component;
-	std::stringstream LineStream(InLine);
+	OutElementComponents.Empty();
+	FANSIStringView Line(InLine.data(), static_cast<int32>(InLine.size()));
 
-	// Element components are split using spaces.
-	while (std::getline(LineStream, Component, ' '))
+	// Element components are split using whitespace. Repeated separators don't produce empty components.
+	int32 ComponentStart = 0;
+	for (int32 Index = 0; Index <= Line.GetSize(); ++Index)
 	{
-		ElementComponents.Add(Component);
+		bool bIsSeparator = (Index == Line.GetSize()) || Line[Index] == ' ' || Line[Index] == '\t' || Line[Index] == '\r';
+		if (bIsSeparator)
+		{
+			if (Index > ComponentStart)
+			{
+				OutElementComponents.Add(Line.Substring(ComponentStart, Index));
+			}
+			ComponentStart = Index + 1;
+		}
 	}
-	return ElementComponents;
 }
 
-static FVector2D ParseVector2D(const std::string& InX, const std::string& InY)
+static FVector2D ParseVector2D(const FANSIStringView& InX, const FANSIStringView& InY)
 {
-	float X = std::atof(InX.c_str());
-	float Y = std::atof(InY.c_str());
+	float X = ParseFloat(InX);
+	float Y = ParseFloat(InY);
 	return FVector2D(X, Y);
 }
 
-static FVector3D ParseVector3D(const std::string& InX, const std::string& InY, const std::string& InZ)
+static FVector3D ParseVector3D(const FANSIStringView& InX, const FANSIStringView& InY, const FANSIStringView& InZ)
 {
-	float X = std::atof(InX.c_str());
-	float Y = std::atof(InY.c_str());
-	float Z = std::atof(InZ.c_str());
+	float X = ParseFloat(InX);
+	float Y = ParseFloat(InY);
+	float Z = ParseFloat(InZ);
 	return FVector3D(X, Y, Z);
 }
 
-static TArray<int32> ParseFaceIndices(const std::string& InFace)
+static void ParseFaceIndices(const FANSIStringView& InFace, int32 (&OutFaceIndices)[3])
 {
-	TArray<int32> FaceIndices;
-	std::string IndexString;
-	std::stringstream FaceStream(InFace);
-
-	while (std::getline(FaceStream, IndexString, '/'))
+	int32 NumFaceIndices = 0;
+	int32 IndexStart = 0;
+	while (NumFaceIndices < 3)
 	{
+		int32 IndexEnd = InFace.Find('/', IndexStart);
+		if (IndexEnd == InvalidIndex)
+		{
+			IndexEnd = InFace.GetSize();
+		}
+
 		// Index numbers in Wavefront OBJ files start from 1.
-		int32 Index = std::atoi(IndexString.c_str()) - 1;
-		FaceIndices.Add(Index);
+		OutFaceIndices[NumFaceIndices++] = ParseInt(InFace.Substring(IndexStart, IndexEnd)) - 1;
+
+		if (IndexEnd == InFace.GetSize())
+		{
+			break;
+		}
+		IndexStart = IndexEnd + 1;
 	}
 
-	ensure(FaceIndices.GetSize() == 3);
-	return FaceIndices;
+	ensure(NumFaceIndices == 3);
+}
+
+static float ParseFloat(const FANSIStringView& InComponent)
+{
+	// Components always point into the null-terminated line buffer, and strtof stops at the first
+	// character that can't be part of a number, so the view's characters can be parsed in place.
+	return std::strtof(InComponent.GetData(), nullptr);
+}
+
+static int32 ParseInt(const FANSIStringView& InComponent)
+{
+	int32 Value = 0;
+	bool bIsNegative = false;
+	for (ANSICHAR Character : InComponent)
+	{
+		if (Character == '-')
+		{
+			bIsNegative = true;
+		}
+		else if ('0' <= Character && Character <= '9')
+		{
+			Value = Value * 10 + (Character - '0');
+		}
+	}
+	return bIsNegative ? -Value : Value;
 }
@@ -1,5 +1,6 @@
 #include "Material.h"
 #include "MaterialFile.h"
+#include "ResourceManager.h"
 
 FMaterial::FMaterial(const FStringId& InMaterialFileName)
 	: MaterialFileName(InMaterialFileName)
@@ -7,26 +8,9 @@ FMaterial::FMaterial(const FStringId& InMaterialFileName)
 	// Parse .mat file.
 	FMaterialFile MaterialFile(InMaterialFileName);
 
-	// Create shader pipeline.
-	const ANSICHAR* VertexShaderFileName = MaterialFile.VertexShaderFileName.GetString().GetData();
-	const ANSICHAR* FragmentShaderFileName = MaterialFile.FragmentShaderFileName.GetString().GetData();
-	const ANSICHAR* GeometryShaderFileName = nullptr;
-	if (MaterialFile.GeometryShaderFileName != FStringId::Null())
-	{
-		GeometryShaderFileName = MaterialFile.GeometryShaderFileName.GetString().GetData();
-	}
-
-	FShader VertexShader(VertexShaderFileName, EShaderType::Vertex);
-	FShader FragmentShader(FragmentShaderFileName, EShaderType::Fragment);
-	if (!GeometryShaderFileName)
-	{
-		Pipeline = MakeShared<FPipeline>(VertexShader, FragmentShader);
-	}
-	else
-	{
-		FShader GeometryShader(GeometryShaderFileName, EShaderType::Geometry);
-		Pipeline = MakeShared<FPipeline>(VertexShader, FragmentShader, GeometryShader);
-	}
+	// Get the shader pipeline, which is shared by materials using the same shaders.
+	FResourceManager& ResourceManager = FResourceManager::Get();
+	Pipeline = ResourceManager.LoadPipeline(MaterialFile.VertexShaderFileName, MaterialFile.FragmentShaderFileName, MaterialFile.GeometryShaderFileName);
 
 	// Store material properties.
 	for (int32 Index = 0; Index < MaterialFile.FloatPropertyKeys.GetSize(); ++Index)
@@ -48,21 +32,16 @@ FMaterial::FMaterial(const FStringId& InMaterialFileName)
 	{
 		FStringId TexturePropertyName = MaterialFile.TexturePropertyKeys[Index];
 		FStringId TextureFileName = MaterialFile.TexturePropertyValues[Index];
-		
-		FTexture2D Texture;
-		if (TextureFileName != FStringId::Null())
-		{
-			FTexture2D Texture = FTexture2D(TextureFileName.GetString().GetData(), CurrentTextureUnit);
-			TextureProperties.Emplace(TexturePropertyName, Texture);
-		}
-		else
+
+		// Use default texture as a fallback if a texture wasn't specified in the material file.
+		if (TextureFileName == FStringId::Null())
 		{
-			// Use default texture as a fallback if a texture wasn't specified in the material file.
-			FTexture2D Texture = FTexture2D::Default();
-			Texture.SetTextureUnit(CurrentTextureUnit);
-			TextureProperties.Emplace(TexturePropertyName, Texture);
+			TextureFileName = FTexture2D::DefaultFileName;
 		}
 
+		FMaterialTexture Texture = { ResourceManager.LoadTexture(TextureFileName), CurrentTextureUnit };
+		TextureProperties.Emplace(TexturePropertyName, Texture);
+
 		++CurrentTextureUnit;
 	}
 }
@@ -91,15 +70,14 @@ void FMaterial::SetColor(const FStringId& InPropertyName, const FColor& InColor)
 	}
 }
 
-void FMaterial::SetTexture(const FStringId& InPropertyName, const FTexture2D& InTexture)
+void FMaterial::SetTexture(const FStringId& InPropertyName, const TResourceRef<FTexture2D>& InTexture)
 {
-	for (FMaterialProperty<FTexture2D>& TextureProperty : TextureProperties)
+	for (FMaterialProperty<FMaterialTexture>& TextureProperty : TextureProperties)
 	{
 		if (TextureProperty.Name == InPropertyName)
 		{
-			ETextureUnit TextureUnit = TextureProperty.Property.GetTextureUnit();
-			TextureProperty.Property = InTexture;
-			TextureProperty.Property.SetTextureUnit(TextureUnit);
+			// The texture unit stays the same.
+			TextureProperty.Property.Texture = InTexture;
 			return;
 		}
 	}
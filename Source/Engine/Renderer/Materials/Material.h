@@ -1,9 +1,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/InlineArray.h"
 #include "Math/Vector4D.h"
-#include "RHI/Pipeline.h"
-#include "RHI/Texture2D.h"
+#include "ResourceHandle.h"
+#include "RHI/RHIDefinitions.h"
 
 template <typename PropertyType>
 struct FMaterialProperty
@@ -18,18 +19,25 @@ struct FMaterialProperty
 	PropertyType Property;
 };
 
+// A texture and the texture unit it is bound to when the material is rendered.
+struct FMaterialTexture
+{
+	TResourceRef<FTexture2D> Texture;
+	ETextureUnit TextureUnit;
+};
+
 /**
  * A material consists of a shader pipeline and uniform data that is used in shader pipeline.
  * These uniform data are called material properties and can take the form of floats, colors,
  * or textures. The shader pipeline specifies how a mesh should be renderer, and the material
  * properties specify what data should be used when rendering the mesh.
+ *
+ * Materials, and the pipelines and textures they reference, are owned by FResourceManager.
  */
 class FMaterial
 {
 public:
 	explicit FMaterial(const FStringId& InMaterialFileName);
-	// Default constructor necessary for using in container classes like TMap.
-	FMaterial() = default;
 	~FMaterial() = default;
 
 	FMaterial(const FMaterial&) = default;
@@ -43,13 +51,9 @@ public:
 		return MaterialFileName;
 	}
 
-	TSharedPtr<FPipeline> GetPipeline() 
-	{ 
-		return Pipeline; 
-	}
-	TSharedPtr<const FPipeline> GetPipeline() const 
+	FPipeline& GetPipeline() const
 	{ 
-		return Pipeline; 
+		return *Pipeline; 
 	}
 	TArray<FMaterialProperty<float> >& GetFloatProperties() 
 	{
@@ -67,11 +71,11 @@ public:
 	{ 
 		return ColorProperties; 
 	};
-	TArray<FMaterialProperty<FTexture2D> >& GetTextureProperties()
+	TArray<FMaterialProperty<FMaterialTexture> >& GetTextureProperties()
 	{ 
 		return TextureProperties; 
 	};
-	const TArray<FMaterialProperty<FTexture2D> >& GetTextureProperties() const 
+	const TArray<FMaterialProperty<FMaterialTexture> >& GetTextureProperties() const 
 	{
 		return TextureProperties; 
 	};
@@ -79,14 +83,15 @@ public:
 	// Setters.
 	void SetFloat(const FStringId& InPropertyName, float InFloat);
 	void SetColor(const FStringId& InPropertyName, const FColor& InColor);
-	void SetTexture(const FStringId& InPropertyName, const FTexture2D& InTexture);
+	void SetTexture(const FStringId& InPropertyName, const TResourceRef<FTexture2D>& InTexture);
 
 private:
 	FStringId MaterialFileName;
 
-	TSharedPtr<FPipeline> Pipeline;
+	TResourceRef<FPipeline> Pipeline;
 	
-	TArray<FMaterialProperty<float> > FloatProperties;
-	TArray<FMaterialProperty<FColor> > ColorProperties;
-	TArray<FMaterialProperty<FTexture2D> > TextureProperties;
+	// Materials have a handful of properties of each type, which are stored inline.
+	TInlineArray<FMaterialProperty<float>, 4> FloatProperties;
+	TInlineArray<FMaterialProperty<FColor>, 4> ColorProperties;
+	TInlineArray<FMaterialProperty<FMaterialTexture>, 4> TextureProperties;
 };
@@ -32,6 +32,8 @@ namespace
 }
 
 static FColor ParseColor(const nlohmann::json& InJsonArray);
+static FStringId ParseStringId(const nlohmann::json& InJsonString);
+static FStringId MakeStringId(const std::string& InString);
 
 FMaterialFile::FMaterialFile(const FStringId& InMaterialFileName)
 {
@@ -48,15 +50,12 @@ FMaterialFile::FMaterialFile(const FStringId& InMaterialFileName)
 	ensure(Pipeline.contains(FMaterialFileKeys::VertexShader) && !Pipeline[FMaterialFileKeys::VertexShader].is_null()); 
 	ensure(Pipeline.contains(FMaterialFileKeys::FragmentShader) && !Pipeline[FMaterialFileKeys::FragmentShader].is_null());
 	
-	std::string VertexShader = Pipeline[FMaterialFileKeys::VertexShader];
-	std::string FragmentShader = Pipeline[FMaterialFileKeys::FragmentShader];
-	VertexShaderFileName = FStringId(VertexShader.c_str());
-	FragmentShaderFileName = FStringId(FragmentShader.c_str());
+	VertexShaderFileName = ParseStringId(Pipeline[FMaterialFileKeys::VertexShader]);
+	FragmentShaderFileName = ParseStringId(Pipeline[FMaterialFileKeys::FragmentShader]);
 	
 	if (Pipeline.contains(FMaterialFileKeys::GeometryShader) && !Pipeline[FMaterialFileKeys::GeometryShader].is_null())
 	{
-		std::string GeometryShader = Pipeline[FMaterialFileKeys::GeometryShader];
-		GeometryShaderFileName = FStringId(GeometryShader.c_str());
+		GeometryShaderFileName = ParseStringId(Pipeline[FMaterialFileKeys::GeometryShader]);
 	}
 
 	const auto& Properties = MaterialFileJson[FMaterialFileKeys::Properties];
@@ -67,7 +66,7 @@ FMaterialFile::FMaterialFile(const FStringId& InMaterialFileName)
 	{
 		for (const auto& FloatProperty : Properties[FMaterialFileKeys::Floats].items())
 		{
-			FStringId Key = FloatProperty.key().c_str();
+			FStringId Key = MakeStringId(FloatProperty.key());
 			FloatPropertyKeys.Add(Key);
 
 			if (!FloatProperty.value().is_null())
@@ -88,7 +87,7 @@ FMaterialFile::FMaterialFile(const FStringId& InMaterialFileName)
 	{
 		for (const auto& ColorProperty : Properties[FMaterialFileKeys::Colors].items())
 		{
-			FStringId Key = ColorProperty.key().c_str();
+			FStringId Key = MakeStringId(ColorProperty.key());
 			ColorPropertyKeys.Add(Key);
 
 			if (!ColorProperty.value().is_null())
@@ -110,12 +109,12 @@ FMaterialFile::FMaterialFile(const FStringId& InMaterialFileName)
 	{
 		for (const auto& TextureProperty : Properties[FMaterialFileKeys::Textures].items())
 		{
-			FStringId Key = TextureProperty.key().c_str();
+			FStringId Key = MakeStringId(TextureProperty.key());
 			TexturePropertyKeys.Add(Key);
 
 			if (!TextureProperty.value().is_null())
 			{
-				FStringId Value = TextureProperty.value().get<std::string>().c_str();
+				FStringId Value = ParseStringId(TextureProperty.value());
 				TexturePropertyValues.Add(Value);
 			}
 			else
@@ -134,3 +133,14 @@ static FColor ParseColor(const nlohmann::json& InJsonArray)
 	ensure(InJsonArray[2].is_number());
 	return FColor(InJsonArray[0], InJsonArray[1], InJsonArray[2]);
 }
+
+static FStringId ParseStringId(const nlohmann::json& InJsonString)
+{
+	return MakeStringId(InJsonString.get_ref<const std::string&>());
+}
+
+static FStringId MakeStringId(const std::string& InString)
+{
+	// Hash the characters in place rather than going through a temporary copy.
+	return FStringId(FANSIStringView(InString.data(), static_cast<int32>(InString.size())));
+}
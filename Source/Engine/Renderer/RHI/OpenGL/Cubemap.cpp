@@ -1,8 +1,8 @@
 #include "Cubemap.h"
 
 #include "RendererFileSystem.h"
-#include "RHI/TextureRegistry.h"
 #include "OpenGLApi.h"
+#include "RHI.h"
 
 #include "stb/stb_image.h"
 
@@ -38,6 +38,7 @@ FCubemap::FCubemap(
 
 void FCubemap::Bind() const
 {
+	ensureRenderingThread();
 	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_CUBE_MAP, Id);
 }
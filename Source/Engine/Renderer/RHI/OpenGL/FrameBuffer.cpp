@@ -1,5 +1,6 @@
 #include "FrameBuffer.h"
 #include "OpenGLApi.h"
+#include "RHI.h"
 
 const uint32 FFrameBuffer::DefaultFrameBufferId = 0;
 
@@ -7,6 +8,7 @@ FFrameBuffer::FFrameBuffer(int32 InWidth, int32 InHeight)
 	: Width(InWidth)
 	, Height(InHeight)
 {
+	ensureRenderingThread();
 	glGenFramebuffers(1, &FrameBufferId);
 	glBindFramebuffer(GL_FRAMEBUFFER, FrameBufferId);
 
@@ -42,21 +44,25 @@ FFrameBuffer::FFrameBuffer()
 
 FFrameBuffer::~FFrameBuffer()
 {
+	ensureRenderingThread();
 	glDeleteFramebuffers(1, &FrameBufferId);
 }
 
 void FFrameBuffer::Bind() const
 {
+	ensureRenderingThread();
 	glBindFramebuffer(GL_FRAMEBUFFER, FrameBufferId);
 }
 
 void FFrameBuffer::Unbind() const
 {
+	ensureRenderingThread();
 	glBindFramebuffer(GL_FRAMEBUFFER, DefaultFrameBufferId);
 }
 
 void FFrameBuffer::Resize(int32 InWidth, int32 InHeight)
 {
+	ensureRenderingThread();
 	// You cannot resize the default frame buffer through OpenGL.
 	if (FrameBufferId == DefaultFrameBufferId)
 	{
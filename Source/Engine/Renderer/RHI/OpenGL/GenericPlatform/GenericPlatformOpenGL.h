@@ -5,5 +5,7 @@ class FGenericPlatformOpenGL
 	// Empty default implementations.
 	static void Init(void* InNativeWindowHandle) {};
 	static void Shutdown() {};
+	static void MakeCurrent() {};
+	static void ReleaseCurrent() {};
 	static void SwapBuffers() {};
 };
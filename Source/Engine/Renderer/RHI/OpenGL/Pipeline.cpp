@@ -1,4 +1,5 @@
 #include "Pipeline.h"
+#include "RHI.h"
 
 #include "Math/Vector2D.h"
 #include "Math/Vector3D.h"
@@ -8,6 +9,7 @@
 FPipeline::FPipeline(const FShader& InVertexShader, const FShader& InFragmentShader)
 	: Id(glCreateProgram())
 {
+	ensureRenderingThread();
 	glAttachShader(Id, InVertexShader.GetId());
 	glAttachShader(Id, InFragmentShader.GetId());
 	glLinkProgram(Id);
@@ -19,6 +21,7 @@ FPipeline::FPipeline(const FShader& InVertexShader, const FShader& InFragmentSha
 
 FPipeline::FPipeline(const FShader& InVertexShader, const FShader& InFragmentShader, const FShader& InGeometryShader)
 {
+	ensureRenderingThread();
 	Id = glCreateProgram();
 	glAttachShader(Id, InVertexShader.GetId());
 	glAttachShader(Id, InFragmentShader.GetId());
@@ -32,46 +35,79 @@ FPipeline::FPipeline(const FShader& InVertexShader, const FShader& InFragmentSha
 
 FPipeline::~FPipeline()
 {
-	glDeleteProgram(Id);
+	if (Id != 0)
+	{
+		ensureRenderingThread();
+		glDeleteProgram(Id);
+	}
+}
+
+FPipeline::FPipeline(FPipeline&& InPipeline)
+	: Id(InPipeline.Id)
+{
+	InPipeline.Id = 0;
+}
+
+FPipeline& FPipeline::operator=(FPipeline&& InPipeline)
+{
+	ensureRenderingThread();
+	if (this != &InPipeline)
+	{
+		if (Id != 0)
+		{
+			glDeleteProgram(Id);
+		}
+		Id = InPipeline.Id;
+		InPipeline.Id = 0;
+	}
+	return *this;
 }
 
 void FPipeline::Bind() const
 {
+	ensureRenderingThread();
 	glUseProgram(Id);
 }
 
 void FPipeline::SetBool(const FStringId& InUniformName, bool InBool)
 {
+	ensureRenderingThread();
 	glUniform1i(glGetUniformLocation(Id, InUniformName.GetString().GetData()), (int32)InBool);
 }
 
 void FPipeline::SetInt(const FStringId& InUniformName, int32 InInt)
 {
+	ensureRenderingThread();
 	glUniform1i(glGetUniformLocation(Id, InUniformName.GetString().GetData()), InInt);
 }
 
 void FPipeline::SetFloat(const FStringId& InUniformName, float InFloat)
 {
+	ensureRenderingThread();
 	glUniform1f(glGetUniformLocation(Id, InUniformName.GetString().GetData()), InFloat);
 }
 
 void FPipeline::SetVector2D(const FStringId& InUniformName, const FVector2D& InVector2D)
 {
+	ensureRenderingThread();
 	glUniform2fv(glGetUniformLocation(Id, InUniformName.GetString().GetData()), 1, &InVector2D[0]);
 }
 
 void FPipeline::SetVector3D(const FStringId& InUniformName, const FVector3D& InVector3D)
 {
+	ensureRenderingThread();
 	uint32 Location = glGetUniformLocation(Id, InUniformName.GetString().GetData());
 	glUniform3fv(glGetUniformLocation(Id, InUniformName.GetString().GetData()), 1, &InVector3D[0]);
 }
 
 void FPipeline::SetVector4D(const FStringId& InUniformName, const FVector4D& InVector4D)
 {
+	ensureRenderingThread();
 	glUniform4fv(glGetUniformLocation(Id, InUniformName.GetString().GetData()), 1, &InVector4D[0]);
 }
 
 void FPipeline::SetMatrix4D(const FStringId& InUniformName, const FMatrix4D& InMatrix4D)
 {
+	ensureRenderingThread();
 	glUniformMatrix4fv(glGetUniformLocation(Id, InUniformName.GetString().GetData()), 1, GL_FALSE, InMatrix4D.GetData());
 }
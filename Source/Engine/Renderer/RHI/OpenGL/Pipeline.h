@@ -26,9 +26,9 @@ public:
 	FPipeline(const FPipeline&) = delete;
 	FPipeline& operator=(const FPipeline&) = delete;
 
-	// Non-movable.
-	FPipeline(const FPipeline&&) = delete;
-	FPipeline& operator=(const FPipeline&&) = delete;
+	// Movable, so that pipelines can be stored in containers. The moved-from pipeline no longer owns the program.
+	FPipeline(FPipeline&& InPipeline);
+	FPipeline& operator=(FPipeline&& InPipeline);
 
 	void Bind() const;
 
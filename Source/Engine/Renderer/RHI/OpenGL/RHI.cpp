@@ -3,76 +3,118 @@
 #include "OpenGLApi.h"
 #include "HAL/PlatformOpenGL.h"
 
+// System includes for tracking the thread the context is current on.
+#include <atomic>
+#include <thread>
+
+// Thread the OpenGL context is current on, or no thread while the context is handed over.
+static std::atomic<std::thread::id> RenderingThreadId;
+
 void FRHI::Init(void* InNativeWindowHandle)
 {
+	// The context is created current on the calling thread.
 	FPlatformOpenGL::Init(InNativeWindowHandle);
+	RenderingThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
 }
 
 void FRHI::Shutdown()
 {
+	ensureRenderingThread();
 	FPlatformOpenGL::Shutdown();
 }
 
+void FRHI::AcquireContext()
+{
+	// Only one thread can own the context at a time.
+	ensure(RenderingThreadId.load(std::memory_order_relaxed) == std::thread::id());
+	FPlatformOpenGL::MakeCurrent();
+	RenderingThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+}
+
+void FRHI::ReleaseContext()
+{
+	ensureRenderingThread();
+	FPlatformOpenGL::ReleaseCurrent();
+	RenderingThreadId.store(std::thread::id(), std::memory_order_relaxed);
+}
+
+bool FRHI::IsInRenderingThread()
+{
+	return RenderingThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
+
 void FRHI::SwapBuffers()
 {
+	ensureRenderingThread();
 	FPlatformOpenGL::SwapBuffers();
 }
 
 void FRHI::SetViewport(const FViewport& InViewport)
 {
+	ensureRenderingThread();
 	glViewport(InViewport.X, InViewport.Y, InViewport.Width, InViewport.Height);
 }
 
 void FRHI::SetDrawingMode(EDrawingMode InDrawingMode)
 {
+	ensureRenderingThread();
 	GLenum PolygonMode = static_cast<GLenum>(InDrawingMode);
 	glPolygonMode(GL_FRONT_AND_BACK, PolygonMode);
 }
 
 void FRHI::SetPointSize(float InPointSize /* = 1.0f */)
 {
+	ensureRenderingThread();
 	glPointSize(InPointSize);
 }
 
 void FRHI::EnableDepthTesting()
 {
+	ensureRenderingThread();
 	glEnable(GL_DEPTH_TEST);
 }
 
 void FRHI::DisableDepthTesting()
 {
+	ensureRenderingThread();
 	glDisable(GL_DEPTH_TEST);
 }
 
 void FRHI::EnableDepthBufferWriting()
 {
+	ensureRenderingThread();
 	glDepthMask(GL_TRUE);
 }
 
 void FRHI::DisableDepthBufferWriting()
 {
+	ensureRenderingThread();
 	glDepthMask(GL_FALSE);
 }
 
 void FRHI::ClearColorBuffer(const FColor& InColor /* = FColor::Black */)
 {
+	ensureRenderingThread();
 	glClearColor(InColor.R, InColor.G, InColor.B, InColor.A);
 	glClear(GL_COLOR_BUFFER_BIT);
 }
 
 void FRHI::ClearDepthBuffer(float InDepth /* = 1.0f */)
 {
+	ensureRenderingThread();
 	glClearDepth(InDepth);
 	glClear(GL_DEPTH_BUFFER_BIT);
 }
 
 void FRHI::Draw(int32 InNumVertices)
 {
+	ensureRenderingThread();
 	glDrawArrays(GL_TRIANGLES, 0, InNumVertices);
 }
 
 void FRHI::DrawIndexed(int32 InNumIndices)
 {
+	ensureRenderingThread();
 	glDrawElements(GL_TRIANGLES, InNumIndices, GL_UNSIGNED_INT, 0);
 }
 
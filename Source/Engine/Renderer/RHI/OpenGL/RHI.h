@@ -5,6 +5,9 @@
 
 enum class EDrawingMode : uint16;
 
+// Checks that the calling thread owns the graphics context, since GL calls from any other thread go to no context at all.
+#define ensureRenderingThread() ensure(FRHI::IsInRenderingThread())
+
 /**
  * The RHI (Render Hardware Interface) is an abstraction layer to allow for graphics API-independent rendering code.
  */
@@ -13,6 +16,12 @@ class FRHI
 public:
 	static void Init(void* InNativeWindowHandle);
 	static void Shutdown();
+	// Makes the graphics context current on the calling thread, which becomes the rendering thread.
+	static void AcquireContext();
+	// Releases the graphics context from the rendering thread, so that another thread can acquire it.
+	static void ReleaseContext();
+	// Whether the calling thread owns the graphics context.
+	static bool IsInRenderingThread();
 	static void SwapBuffers();
 	static void SetViewport(const FViewport& InViewport);
 	static void SetDrawingMode(EDrawingMode InDrawingMode);
@@ -1,5 +1,6 @@
 #include "Shader.h"
 #include "RendererFileSystem.h"
+#include "RHI.h"
 
 #include <string>
 #include <fstream>
@@ -7,6 +8,7 @@
 
 FShader::FShader(const FStringId& InShaderFileName, EShaderType InShaderType)
 {
+	ensureRenderingThread();
 	FStringId ShaderFilePath = FRendererFileSystem::GetShaderFilePath(InShaderFileName);
 	
 	// Open shader file.
@@ -30,5 +32,6 @@ FShader::FShader(const FStringId& InShaderFileName, EShaderType InShaderType)
 
 FShader::~FShader()
 {
+	ensureRenderingThread();
 	glDeleteShader(Id);
 }
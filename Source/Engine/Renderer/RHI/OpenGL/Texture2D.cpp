@@ -1,12 +1,10 @@
 #include "Texture2D.h"
 #include "RendererFileSystem.h"
 #include "OpenGLApi.h"
-#include "RHI/TextureRegistry.h"
+#include "RHI.h"
 
 #include "stb/stb_image.h"
 
-static constexpr const ANSICHAR* DefaultTextureFileName = "Black.png";
-
 FTexture2D::FTexture2D()
 	: TextureFileName(FStringId::Null())
 	// "The value zero is reserved to represent the default texture for each texture target."
@@ -14,26 +12,13 @@ FTexture2D::FTexture2D()
 	, Id(0)
 	, Width(0)
 	, Height(0)
-	, TextureUnit(ETextureUnit::Zero)
 {
 }
 
-FTexture2D::FTexture2D(const FStringId& InTextureFileName, ETextureUnit InTextureUnit /* = ETextureUnit::Zero */)
+FTexture2D::FTexture2D(const FStringId& InTextureFileName)
 	: TextureFileName(InTextureFileName)
-	, TextureUnit(InTextureUnit)
 {
-	// Fetch the texture if it has been loaded previously.
-	TMap<FStringId, FTexture2D>& Textures = FTextureRegistry::Get().Textures;
-	if (Textures.IsKeyContained(TextureFileName))
-	{
-		const FTexture2D& Texture = *Textures.Find(TextureFileName);
-		Id = Texture.GetId();
-		Width = Texture.GetWidth();
-		Height = Texture.GetHeight();
-		return;
-	}
-
-	// Load the texture if this is the first time encountering it.
+	ensureRenderingThread();
 	glGenTextures(1, &Id);
 	glBindTexture(GL_TEXTURE_2D, Id);
 
@@ -72,24 +57,50 @@ FTexture2D::FTexture2D(const FStringId& InTextureFileName, ETextureUnit InTextur
 	glTexImage2D(GL_TEXTURE_2D, 0, TextureFormat, Width, Height, 0, TextureFormat, GL_UNSIGNED_BYTE, Data);
 	glGenerateMipmap(GL_TEXTURE_2D);
 
-	Textures.Add(TextureFileName, *this);
-
 	// Release the image data once we've created the texture.
 	stbi_image_free(Data);
 }
 
 FTexture2D::~FTexture2D()
 {
-	// glDeleteTextures(1, &Id);
+	if (Id != 0)
+	{
+		ensureRenderingThread();
+		glDeleteTextures(1, &Id);
+	}
+}
+
+FTexture2D::FTexture2D(FTexture2D&& InTexture)
+	: TextureFileName(InTexture.TextureFileName)
+	, Id(InTexture.Id)
+	, Width(InTexture.Width)
+	, Height(InTexture.Height)
+{
+	// The moved-from texture no longer owns the GPU object.
+	InTexture.Id = 0;
 }
 
-void FTexture2D::Bind() const
+FTexture2D& FTexture2D::operator=(FTexture2D&& InTexture)
 {
-	glActiveTexture(static_cast<GLenum>(TextureUnit));
-	glBindTexture(GL_TEXTURE_2D, Id);
+	ensureRenderingThread();
+	if (this != &InTexture)
+	{
+		if (Id != 0)
+		{
+			glDeleteTextures(1, &Id);
+		}
+		TextureFileName = InTexture.TextureFileName;
+		Id = InTexture.Id;
+		Width = InTexture.Width;
+		Height = InTexture.Height;
+		InTexture.Id = 0;
+	}
+	return *this;
 }
 
-/*static*/ FTexture2D FTexture2D::Default()
+void FTexture2D::Bind(ETextureUnit InTextureUnit /* = ETextureUnit::Zero */) const
 {
-	return FTexture2D(DefaultTextureFileName);
+	ensureRenderingThread();
+	glActiveTexture(static_cast<GLenum>(InTextureUnit));
+	glBindTexture(GL_TEXTURE_2D, Id);
 }
@@ -6,21 +6,28 @@
 /**
  * A 2D image used as a lookup table. Conventionally used
  * to add detail to an object (e.g. diffuse maps, normal maps).
+ * Textures loaded from files are owned and shared by FResourceManager.
+ * A texture owns its GPU object, so it can be moved but not copied.
  */
 class FTexture2D
 {
 public:
-	// Default constructor to allow for usage with container classes.
+	// Texture used by materials that don't specify one.
+	static constexpr const ANSICHAR* DefaultFileName = "Black.png";
+
+	// Default constructor. Creates an empty texture without a GPU object.
 	FTexture2D();
-	explicit FTexture2D(const FStringId& InTextureFileName, ETextureUnit InTextureUnit = ETextureUnit::Zero);
+	explicit FTexture2D(const FStringId& InTextureFileName);
 	~FTexture2D();
 
-	FTexture2D(const FTexture2D&) = default;
-	FTexture2D& operator=(const FTexture2D&) = default;
-	FTexture2D(FTexture2D&&) = default;
-	FTexture2D& operator=(FTexture2D&&) = default;
+	// Non-copyable.
+	FTexture2D(const FTexture2D&) = delete;
+	FTexture2D& operator=(const FTexture2D&) = delete;
+
+	FTexture2D(FTexture2D&& InTexture);
+	FTexture2D& operator=(FTexture2D&& InTexture);
 
-	void Bind() const;
+	void Bind(ETextureUnit InTextureUnit = ETextureUnit::Zero) const;
 
 	// Getters.
 	const FStringId& GetName() const 
@@ -39,23 +46,10 @@ public:
 	{
 		return Height; 
 	}
-	ETextureUnit GetTextureUnit() const
-	{
-		return TextureUnit; 
-	}
-
-	// Setters.
-	void SetTextureUnit(ETextureUnit InTextureUnit) 
-	{
-		TextureUnit = InTextureUnit;
-	}
-
-	static FTexture2D Default();
 
 private:
 	FStringId TextureFileName;
 	uint32 Id;
 	int32 Width;
 	int32 Height;
-	ETextureUnit TextureUnit;
 };
@@ -4,6 +4,7 @@
 #include "RHI/VertexFormats.h"
 #include "RHIDefinitions.h"
 #include "OpenGLApi.h"
+#include "RHI.h"
 
 /**
  * A vertex array consists of a vertex buffer and an optional index buffer.
@@ -62,6 +63,7 @@ TVertexArray<VertexFormat>::TVertexArray(const TArray<VertexFormat>& InVertices,
 	: NumVertices(InVertices.GetSize())
 	, NumIndices(0)
 {
+	ensureRenderingThread();
 	glGenVertexArrays(1, &VertexArrayId);
 	glGenBuffers(1, &VertexBufferId);
 
@@ -75,6 +77,7 @@ TVertexArray<VertexFormat>::TVertexArray(const TArray<VertexFormat>& InVertices,
 	: NumVertices(InVertices.GetSize())
 	, NumIndices(InIndices.GetSize())
 {
+	ensureRenderingThread();
 	glGenVertexArrays(1, &VertexArrayId);
 	glGenBuffers(1, &VertexBufferId);
 	glGenBuffers(1, &IndexBufferId);
@@ -88,6 +91,7 @@ TVertexArray<VertexFormat>::TVertexArray(const TArray<VertexFormat>& InVertices,
 template <typename VertexFormat>
 TVertexArray<VertexFormat>::~TVertexArray()
 {
+	ensureRenderingThread();
 	glDeleteVertexArrays(1, &VertexArrayId);
 	glDeleteBuffers(1, &VertexBufferId);
 	glDeleteBuffers(1, &IndexBufferId);
@@ -96,6 +100,7 @@ TVertexArray<VertexFormat>::~TVertexArray()
 template <typename VertexFormat>
 void TVertexArray<VertexFormat>::Bind() const
 {
+	ensureRenderingThread();
 	glBindVertexArray(VertexArrayId);
 }
 
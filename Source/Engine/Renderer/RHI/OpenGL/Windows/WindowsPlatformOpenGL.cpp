@@ -328,6 +328,18 @@ static void LoadOpenGLExtensions()
 	ReleaseDC(WindowHandle, DeviceContext);
 }
 
+/*static*/ void FWindowsPlatformOpenGL::MakeCurrent()
+{
+	// A context can be current on one thread at a time, and the window's device context can be used from any thread.
+	bool bIsCurrent = wglMakeCurrent(DeviceContext, RenderingContext);
+	ensure(bIsCurrent);
+}
+
+/*static*/ void FWindowsPlatformOpenGL::ReleaseCurrent()
+{
+	wglMakeCurrent(nullptr, nullptr);
+}
+
 /*static*/ void FWindowsPlatformOpenGL::SwapBuffers()
 {
 	::SwapBuffers(DeviceContext);
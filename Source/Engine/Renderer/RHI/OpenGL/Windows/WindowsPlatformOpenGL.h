@@ -8,6 +8,8 @@ public:
 	// Begin FGenericPlatformOpenGL interface.
 	static void Init(void* InNativeWindowHandle);
 	static void Shutdown();
+	static void MakeCurrent();
+	static void ReleaseCurrent();
 	static void SwapBuffers();
 	// End FGenericPlatformOpenGL interface.
 };
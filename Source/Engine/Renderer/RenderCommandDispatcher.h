@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Runs render commands on the render thread while one is running, and right away on the calling thread otherwise.
+ * Rendering stays on the game thread until a render thread is set, so by default commands run inline and
+ * flushing has nothing to wait for.
+ *
+ * FRenderManager dispatches to an FRenderThread. The render thread type is a parameter so that the dispatching
+ * can be tested without a graphics context.
+ */
+template<typename RenderThreadType>
+class TRenderCommandDispatcher
+{
+public:
+	TRenderCommandDispatcher() = default;
+
+	// Non-copyable.
+	TRenderCommandDispatcher(const TRenderCommandDispatcher&) = delete;
+	TRenderCommandDispatcher& operator=(const TRenderCommandDispatcher&) = delete;
+
+	// Dispatches to a started render thread from now on, or runs commands inline again if nullptr.
+	void SetRenderThread(TUniquePtr<RenderThreadType>&& InRenderThread)
+	{
+		RenderThread = MoveTemp(InRenderThread);
+	}
+
+	RenderThreadType* GetRenderThread() const
+	{
+		return RenderThread.Get();
+	}
+
+	bool IsRenderThreadRunning() const
+	{
+		return RenderThread.IsValid();
+	}
+
+	// Executes a command on the render thread after the commands enqueued before it, or right away without a render thread.
+	template<typename LambdaType>
+	void EnqueueCommand(LambdaType&& InLambda)
+	{
+		if (RenderThread)
+		{
+			RenderThread->EnqueueCommand(Forward<LambdaType>(InLambda));
+		}
+		else
+		{
+			InLambda();
+		}
+	}
+
+	// Waits until the render thread has executed every command enqueued so far.
+	void Flush()
+	{
+		if (RenderThread)
+		{
+			RenderThread->Flush();
+		}
+	}
+
+	// Executes a command on the render thread once the commands enqueued before it are executed, and waits for it.
+	template<typename LambdaType>
+	void Execute(LambdaType&& InLambda)
+	{
+		EnqueueCommand(Forward<LambdaType>(InLambda));
+		Flush();
+	}
+
+	// Hands an object that owns GPU resources to the render thread to destroy. Without a render thread, the caller's last reference destroys it.
+	template<typename ObjectType>
+	void BeginRelease(TSharedPtr<ObjectType> InObject)
+	{
+		if (RenderThread && InObject)
+		{
+			RenderThread->BeginRelease(MoveTemp(InObject));
+		}
+	}
+
+private:
+	TUniquePtr<RenderThreadType> RenderThread;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/Camera.h"
+#include "Lights/PointLight.h"
+#include "RHI/RHIDefinitions.h"
+
+class FModel;
+class FSkybox;
+class FFrameBuffer;
+
+// A model to draw, with the state the game thread changes copied out of it.
+struct FModelRenderInfo
+{
+	// Read for its meshes and materials, which the game thread only changes on the render thread.
+	const FModel* Model;
+	FMatrix4D WorldMatrix;
+	EDrawingMode DrawingMode;
+};
+
+struct FDirectionalLightRenderInfo
+{
+	FVector3D Direction;
+	FColor Color;
+	float Intensity;
+};
+
+struct FPointLightRenderInfo
+{
+	FVector3D Position;
+	FColor Color;
+	FAttenuation Attenuation;
+	float Intensity;
+};
+
+/**
+ * Everything the renderer reads from the scene and the camera to render a frame, copied on the game thread
+ * by FRenderer::BuildFrame, so that the render thread can render the frame while the game thread changes
+ * the scene. GPU resources are referenced rather than copied, so scene objects must not be destroyed while a
+ * frame that references them is in flight (see FRenderManager::ExecuteOnRenderThread).
+ */
+struct FRenderFrame
+{
+	// Whether there is a scene to render at all.
+	bool bHasScene = false;
+	FCamera Camera;
+	FFrameBuffer* RenderTarget = nullptr;
+	// Null if the scene has no visible skybox.
+	const FSkybox* Skybox = nullptr;
+	TArray<FModelRenderInfo> Models;
+	TArray<FDirectionalLightRenderInfo> DirectionalLights;
+	TArray<FPointLightRenderInfo> PointLights;
+};
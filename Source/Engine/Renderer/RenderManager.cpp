@@ -1,7 +1,12 @@
 #include "RenderManager.h"
 #include "ForwardRenderer.h"
+#include "HAL/PlatformTime.h"
+#include "Memory/MemoryTracker.h"
 
 /*static*/ TSharedPtr<FRenderer> FRenderManager::Renderer = nullptr;
+/*static*/ TRenderCommandDispatcher<FRenderThread> FRenderManager::RenderCommands;
+/*static*/ FFrameTimings FRenderManager::FrameTimings;
+/*static*/ double FRenderManager::FrameStartTime = 0.0;
 
 /*static*/ void FRenderManager::Init(void* InNativeWindowHandle, const FViewport& InViewport, ERenderingPath InRenderingPath /* = ERenderingPath::Forward */)
 {
@@ -10,6 +15,8 @@
 		return;
 	}
 
+	MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+
 	if (InRenderingPath == ERenderingPath::Forward)
 	{
 		Renderer = TSharedPtr<FForwardRenderer>(new FForwardRenderer);
@@ -30,12 +37,81 @@
 
 /*static*/ void FRenderManager::Shutdown()
 {
+	StopRenderThread();
 	GetRenderer()->Shutdown();
+	Renderer.Reset();
+}
+
+/*static*/ void FRenderManager::BeginFrame()
+{
+	if (FRenderThread* RenderThread = RenderCommands.GetRenderThread())
+	{
+		RenderThread->BeginFrame();
+	}
+	else
+	{
+		FrameStartTime = FPlatformTime::CurrentTimeMilliseconds();
+	}
 }
 
 /*static*/ void FRenderManager::Update(double InDeltaTimeMilliseconds)
 {
-	GetRenderer()->Update(InDeltaTimeMilliseconds);
+	MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+
+	FRenderThread* RenderThread = RenderCommands.GetRenderThread();
+	if (!RenderThread)
+	{
+		const double RenderStartTime = FPlatformTime::CurrentTimeMilliseconds();
+		GetRenderer()->Update(InDeltaTimeMilliseconds);
+		FrameTimings.GameThread = RenderStartTime - FrameStartTime;
+		FrameTimings.RenderThread = FPlatformTime::CurrentTimeMilliseconds() - RenderStartTime;
+		return;
+	}
+
+	// The render thread renders a copy of the scene state, so that the game thread can go on to change the scene.
+	TUniquePtr<FRenderFrame> Frame = MakeUnique<FRenderFrame>();
+	Renderer->BuildFrame(*Frame);
+
+	RenderThread->ReleaseUnreferencedObjects();
+
+	// Captures the renderer by raw pointer, since TSharedPtr's reference count must not be changed from two threads.
+	FRenderer* FrameRenderer = Renderer.Get();
+	RenderThread->EnqueueCommand([FrameRenderer, Frame = MoveTemp(Frame)]()
+	{
+		FrameRenderer->RenderFrame(*Frame);
+	});
+	RenderThread->SubmitFrame();
+}
+
+/*static*/ void FRenderManager::StartRenderThread(int32 InMaxFramesInFlight /* = 1 */)
+{
+	if (RenderCommands.IsRenderThreadRunning())
+	{
+		return;
+	}
+
+	MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+	TUniquePtr<FRenderThread> RenderThread = MakeUnique<FRenderThread>(InMaxFramesInFlight);
+	RenderThread->Start();
+	RenderCommands.SetRenderThread(MoveTemp(RenderThread));
+}
+
+/*static*/ void FRenderManager::StopRenderThread()
+{
+	FRenderThread* RenderThread = RenderCommands.GetRenderThread();
+	if (!RenderThread)
+	{
+		return;
+	}
+
+	RenderThread->Stop();
+	RenderCommands.SetRenderThread(nullptr);
+}
+
+/*static*/ FFrameTimings FRenderManager::GetFrameTimings()
+{
+	FRenderThread* RenderThread = RenderCommands.GetRenderThread();
+	return RenderThread ? RenderThread->GetFrameTimings() : FrameTimings;
 }
 
 /*static*/ TSharedPtr<FRenderer> FRenderManager::GetRenderer()
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Renderer.h"
+#include "RenderCommandDispatcher.h"
+#include "RenderThread.h"
 
 enum class ERenderingPath : uint8
 {
@@ -11,6 +13,10 @@ enum class ERenderingPath : uint8
 
 /**
  * Singleton class that maintains and provides access to the engine renderer.
+ *
+ * Frames are rendered on the game thread, or on a render thread once StartRenderThread is called. Code that
+ * touches GPU resources or state the renderer reads while rendering, from outside of FRenderer::BuildFrame,
+ * goes through EnqueueRenderCommand or ExecuteOnRenderThread, which run right away without a render thread.
  */
 class FRenderManager
 {
@@ -19,9 +25,73 @@ public:
 
 	static void Init(void* InNativeWindowHandle, const FViewport& InViewport, ERenderingPath InRenderingPath = ERenderingPath::Forward);
 	static void Shutdown();
+	// Marks the start of the game thread's frame, for the frame timings.
+	static void BeginFrame();
+	// Renders the frame, or submits it to the render thread.
 	static void Update(double InDeltaTimeMilliseconds);
 	static TSharedPtr<FRenderer> GetRenderer();
 
+	/**
+	 * Moves rendering to a render thread, which renders each frame while the game thread builds the next one.
+	 * Called from the thread the renderer was initialized on.
+	 *
+	 * @param InMaxFramesInFlight: Number of submitted frames the render thread can be behind the game thread.
+	 */
+	static void StartRenderThread(int32 InMaxFramesInFlight = 1);
+	// Renders the frames in flight and moves rendering back to the calling thread.
+	static void StopRenderThread();
+	static bool IsRenderThreadRunning()
+	{
+		return RenderCommands.IsRenderThreadRunning();
+	}
+	// Number of frames the render thread can be behind the game thread, or 0 without a render thread.
+	static int32 GetMaxFramesInFlight()
+	{
+		return RenderCommands.IsRenderThreadRunning() ? RenderCommands.GetRenderThread()->GetMaxFramesInFlight() : 0;
+	}
+
+	// Executes a command on the render thread after the commands enqueued before it, or right away without a render thread.
+	template<typename LambdaType>
+	static void EnqueueRenderCommand(LambdaType&& InLambda)
+	{
+		RenderCommands.EnqueueCommand(Forward<LambdaType>(InLambda));
+	}
+
+	// Waits until the render thread has executed every command enqueued so far.
+	static void FlushRenderingCommands()
+	{
+		RenderCommands.Flush();
+	}
+
+	/**
+	 * Executes a command on the render thread once the frames in flight are rendered, and waits for it. For loading
+	 * and destroying GPU resources, and for changing anything a frame in flight may read, such as the scene's models.
+	 */
+	template<typename LambdaType>
+	static void ExecuteOnRenderThread(LambdaType&& InLambda)
+	{
+		RenderCommands.Execute(Forward<LambdaType>(InLambda));
+	}
+
+	/**
+	 * Destroys an object that owns GPU resources, such as a model or a scene, on the render thread once the game
+	 * thread has dropped every other reference to it and the frames in flight that may draw it are rendered.
+	 */
+	template<typename ObjectType>
+	static void BeginRelease(TSharedPtr<ObjectType> InObject)
+	{
+		RenderCommands.BeginRelease(MoveTemp(InObject));
+	}
+
+	// Time the game and render threads spent on the last frame.
+	static FFrameTimings GetFrameTimings();
+
 private:
 	static TSharedPtr<FRenderer> Renderer;
+	// Owns the render thread while one is running.
+	static TRenderCommandDispatcher<FRenderThread> RenderCommands;
+
+	// Frame timings when rendering on the game thread.
+	static FFrameTimings FrameTimings;
+	static double FrameStartTime;
 };
@@ -0,0 +1,163 @@
+#include "RenderThread.h"
+#include "HAL/PlatformTime.h"
+#include "RHI/RHI.h"
+
+FRenderThread::FRenderThread(int32 InMaxFramesInFlight)
+	: MaxFramesInFlight(InMaxFramesInFlight)
+	, NumFrames(InMaxFramesInFlight + 1)
+{
+	ensure(MaxFramesInFlight >= 1 && MaxFramesInFlight <= MaxFramesInFlightLimit);
+}
+
+FRenderThread::~FRenderThread()
+{
+	// The thread must be stopped, so that the context is handed back.
+	ensure(!Thread.joinable());
+}
+
+void FRenderThread::Start()
+{
+	ensure(!Thread.joinable());
+	bIsStopRequested = false;
+	FRHI::ReleaseContext();
+	Thread = std::thread(&FRenderThread::Run, this);
+}
+
+void FRenderThread::Stop()
+{
+	Flush();
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bIsStopRequested = true;
+	}
+	FrameSubmitted.notify_one();
+	Thread.join();
+
+	FRHI::AcquireContext();
+}
+
+void FRenderThread::ReleaseUnreferencedObjects()
+{
+	TArray<TUniquePtr<FPendingRelease>> Unreferenced;
+	for (int32 Index = PendingReleases.GetSize() - 1; Index >= 0; --Index)
+	{
+		if (PendingReleases[Index]->IsLastReference())
+		{
+			Unreferenced.Add(MoveTemp(PendingReleases[Index]));
+			PendingReleases.RemoveAt(Index);
+		}
+	}
+
+	if (Unreferenced.IsEmpty())
+	{
+		return;
+	}
+
+	// Objects are rarely released, so waiting for the frames in flight is simpler than tracking which frames draw them.
+	EnqueueCommand([&Unreferenced]()
+	{
+		Unreferenced.Empty();
+	});
+	Flush();
+}
+
+void FRenderThread::BeginFrame()
+{
+	GameThreadFrameStart = FPlatformTime::CurrentTimeMilliseconds();
+	GameThreadWait = 0.0;
+}
+
+void FRenderThread::SubmitFrame()
+{
+	const double SubmitTime = FPlatformTime::CurrentTimeMilliseconds();
+	const double SubmitWait = Submit(true);
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FrameTimings.GameThread = SubmitTime - GameThreadFrameStart - GameThreadWait;
+	FrameTimings.GameThreadWait = GameThreadWait + SubmitWait;
+}
+
+void FRenderThread::Flush()
+{
+	const double WaitStart = FPlatformTime::CurrentTimeMilliseconds();
+	Submit(false);
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		FrameCompleted.wait(Lock, [this]() { return NumCompletedFrames == NumSubmittedFrames; });
+	}
+	GameThreadWait += FPlatformTime::CurrentTimeMilliseconds() - WaitStart;
+}
+
+FFrameTimings FRenderThread::GetFrameTimings() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return FrameTimings;
+}
+
+void FRenderThread::Run()
+{
+	FRHI::AcquireContext();
+
+	// A game thread frame can be split into several submitted frames by flushes.
+	double RenderThreadTime = 0.0;
+	double RenderThreadWait = 0.0;
+
+	std::unique_lock<std::mutex> Lock(Mutex);
+	while (true)
+	{
+		const double WaitStart = FPlatformTime::CurrentTimeMilliseconds();
+		FrameSubmitted.wait(Lock, [this]() { return NumCompletedFrames < NumSubmittedFrames || bIsStopRequested; });
+		if (NumCompletedFrames == NumSubmittedFrames)
+		{
+			break;
+		}
+
+		// The game thread doesn't touch a submitted frame until it's completed.
+		FFrame& Frame = Frames[static_cast<int32>(NumCompletedFrames % NumFrames)];
+		Lock.unlock();
+
+		const double ExecuteStart = FPlatformTime::CurrentTimeMilliseconds();
+		for (const TUniquePtr<FRenderCommand>& Command : Frame.Commands)
+		{
+			Command->Execute();
+		}
+		const double ExecuteEnd = FPlatformTime::CurrentTimeMilliseconds();
+		RenderThreadWait += ExecuteStart - WaitStart;
+		RenderThreadTime += ExecuteEnd - ExecuteStart;
+
+		Lock.lock();
+		if (Frame.bIsEndOfFrame)
+		{
+			FrameTimings.RenderThread = RenderThreadTime;
+			FrameTimings.RenderThreadWait = RenderThreadWait;
+			RenderThreadTime = 0.0;
+			RenderThreadWait = 0.0;
+		}
+		++NumCompletedFrames;
+		FrameCompleted.notify_one();
+	}
+	Lock.unlock();
+
+	FRHI::ReleaseContext();
+}
+
+double FRenderThread::Submit(bool bIsEndOfFrame)
+{
+	ensure(std::this_thread::get_id() != Thread.get_id());
+	Frames[GameThreadFrameIndex].bIsEndOfFrame = bIsEndOfFrame;
+
+	const double WaitStart = FPlatformTime::CurrentTimeMilliseconds();
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		++NumSubmittedFrames;
+		FrameSubmitted.notify_one();
+
+		// The next frame was last submitted MaxFramesInFlight + 1 frames ago, so it's free once at most MaxFramesInFlight are in flight.
+		FrameCompleted.wait(Lock, [this]() { return NumSubmittedFrames - NumCompletedFrames <= MaxFramesInFlight; });
+	}
+	const double WaitTime = FPlatformTime::CurrentTimeMilliseconds() - WaitStart;
+
+	GameThreadFrameIndex = (GameThreadFrameIndex + 1) % NumFrames;
+	Frames[GameThreadFrameIndex].Commands.Empty();
+	return WaitTime;
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/TypeTraits/RemoveReference.h"
+
+// System includes for the render thread and the handoff of frames between it and the game thread.
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Time the game and render threads spent on the last frame, in milliseconds.
+struct FFrameTimings
+{
+	// Time the game thread spent building the frame, and waiting for the render thread to catch up.
+	double GameThread = 0.0;
+	double GameThreadWait = 0.0;
+	// Time the render thread spent executing the frame's commands, and waiting for the game thread to submit them.
+	double RenderThread = 0.0;
+	double RenderThreadWait = 0.0;
+};
+
+// Work enqueued by the game thread for the render thread, see FRenderThread::EnqueueCommand.
+class FRenderCommand
+{
+public:
+	virtual ~FRenderCommand() = default;
+	virtual void Execute() = 0;
+};
+
+template<typename LambdaType>
+class TRenderCommand : public FRenderCommand
+{
+public:
+	explicit TRenderCommand(LambdaType&& InLambda)
+		: Lambda(MoveTemp(InLambda))
+	{
+	}
+
+	virtual void Execute() override
+	{
+		Lambda();
+	}
+
+private:
+	LambdaType Lambda;
+};
+
+// Reference to an object that FRenderThread::BeginRelease destroys on the render thread.
+class FPendingRelease
+{
+public:
+	virtual ~FPendingRelease() = default;
+	// Whether the game thread has dropped every other reference to the object.
+	virtual bool IsLastReference() const = 0;
+};
+
+template<typename ObjectType>
+class TPendingRelease : public FPendingRelease
+{
+public:
+	explicit TPendingRelease(TSharedPtr<ObjectType>&& InObject)
+		: Object(MoveTemp(InObject))
+	{
+	}
+
+	virtual bool IsLastReference() const override
+	{
+		return Object.GetStrongRefCount() == 1;
+	}
+
+private:
+	TSharedPtr<ObjectType> Object;
+};
+
+/**
+ * Thread that owns the graphics context and executes the commands the game thread records, so that the
+ * game thread can build frame N+1 while the render thread submits frame N.
+ *
+ * The game thread records commands into a frame until it submits it. Up to MaxFramesInFlight submitted frames
+ * can be waiting or executing at once, after which submitting waits for the oldest one to finish. A frame's
+ * commands are destroyed on the game thread once it reuses the frame, so commands may hold objects that
+ * aren't thread-safe to copy or destroy, such as TSharedPtrs, as long as the render thread only reads them.
+ */
+class FRenderThread
+{
+public:
+	// Each frame in flight adds a frame of latency between input and the screen.
+	static constexpr int32 MaxFramesInFlightLimit = 4;
+
+	/**
+	 * Constructor. Doesn't start the thread.
+	 *
+	 * @param InMaxFramesInFlight: Number of submitted frames the render thread can be behind the game thread.
+	 */
+	explicit FRenderThread(int32 InMaxFramesInFlight);
+	~FRenderThread();
+
+	// Non-copyable.
+	FRenderThread(const FRenderThread&) = delete;
+	FRenderThread& operator=(const FRenderThread&) = delete;
+
+	// Starts the thread and hands the graphics context over to it. Called from the thread that owns the context.
+	void Start();
+	// Executes the commands left, stops the thread and hands the graphics context back to the calling thread.
+	void Stop();
+
+	// Records a command into the frame being built. Called from the game thread.
+	template<typename LambdaType>
+	void EnqueueCommand(LambdaType&& InLambda)
+	{
+		using FCommand = TRenderCommand<typename TRemoveReference<LambdaType>::Type>;
+		Frames[GameThreadFrameIndex].Commands.Add(TUniquePtr<FRenderCommand>(new FCommand(MoveTemp(InLambda))));
+	}
+
+	// Keeps an object that owns GPU resources alive until the game thread drops every other reference to it.
+	template<typename ObjectType>
+	void BeginRelease(TSharedPtr<ObjectType>&& InObject)
+	{
+		PendingReleases.Add(TUniquePtr<FPendingRelease>(new TPendingRelease<ObjectType>(MoveTemp(InObject))));
+	}
+
+	// Destroys the objects passed to BeginRelease that are no longer referenced, on the render thread. Called from the game thread.
+	void ReleaseUnreferencedObjects();
+
+	// Marks the start of the game thread's frame, for the frame timings.
+	void BeginFrame();
+	// Submits the frame being built, first waiting for the render thread if MaxFramesInFlight frames are in flight.
+	void SubmitFrame();
+	// Submits the commands recorded so far and waits until the render thread has executed every command.
+	void Flush();
+
+	int32 GetMaxFramesInFlight() const
+	{
+		return MaxFramesInFlight;
+	}
+
+	// Timings of the last frame both threads are done with.
+	FFrameTimings GetFrameTimings() const;
+
+private:
+	struct FFrame
+	{
+		TArray<TUniquePtr<FRenderCommand>> Commands;
+		// Whether the game thread submitted the frame at the end of its frame, rather than in a flush.
+		bool bIsEndOfFrame = false;
+	};
+
+	void Run();
+	// Submits the frame being built and starts the next one once its commands are executed, returning the time waited for that.
+	double Submit(bool bIsEndOfFrame);
+
+	int32 MaxFramesInFlight;
+	// A frame for each frame in flight, and one for the game thread to build.
+	FFrame Frames[MaxFramesInFlightLimit + 1];
+	int32 NumFrames;
+	// Frame the game thread records into. Only accessed by the game thread.
+	int32 GameThreadFrameIndex = 0;
+
+	std::thread Thread;
+
+	mutable std::mutex Mutex;
+	std::condition_variable FrameSubmitted;
+	std::condition_variable FrameCompleted;
+	// Guarded by Mutex. The render thread executes frames in submission order, so these index the frames.
+	int64 NumSubmittedFrames = 0;
+	int64 NumCompletedFrames = 0;
+	bool bIsStopRequested = false;
+	FFrameTimings FrameTimings;
+
+	// Objects to destroy on the render thread. Only accessed by the game thread.
+	TArray<TUniquePtr<FPendingRelease>> PendingReleases;
+
+	// Game thread timings of the frame being built. Only accessed by the game thread.
+	double GameThreadFrameStart = 0.0;
+	double GameThreadWait = 0.0;
+};
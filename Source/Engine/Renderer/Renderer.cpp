@@ -21,7 +21,46 @@ void FRenderer::Shutdown()
 
 void FRenderer::Update(double InDeltaTimeMilliseconds)
 {
-	Render();
+	BuildFrame(ImmediateFrame);
+	Render(ImmediateFrame);
+}
+
+void FRenderer::BuildFrame(FRenderFrame& OutFrame) const
+{
+	OutFrame.Models.Empty();
+	OutFrame.DirectionalLights.Empty();
+	OutFrame.PointLights.Empty();
+	OutFrame.Skybox = nullptr;
+
+	OutFrame.bHasScene = Scene.IsValid();
+	if (!OutFrame.bHasScene)
+	{
+		return;
+	}
+
+	OutFrame.Camera = *Camera;
+	OutFrame.RenderTarget = RenderTarget.Get();
+
+	TSharedPtr<FSkybox> Skybox = Scene->GetSkybox();
+	if (Skybox && Skybox->IsVisible())
+	{
+		OutFrame.Skybox = Skybox.Get();
+	}
+
+	for (const TSharedPtr<FModel>& Model : Scene->GetVisibleModels())
+	{
+		OutFrame.Models.Add({ Model.Get(), Model->GetWorldTransform().ToMatrix(), Model->GetDrawingMode() });
+	}
+
+	for (const TSharedPtr<FDirectionalLight>& DirectionalLight : Scene->GetVisibleDirectionalLights())
+	{
+		OutFrame.DirectionalLights.Add({ DirectionalLight->GetDirection(), DirectionalLight->GetColor(), DirectionalLight->GetIntensity() });
+	}
+
+	for (const TSharedPtr<FPointLight>& PointLight : Scene->GetVisiblePointLights())
+	{
+		OutFrame.PointLights.Add({ PointLight->GetPosition(), PointLight->GetColor(), PointLight->GetAttenuation(), PointLight->GetIntensity() });
+	}
 }
 
 void FRenderer::SetViewport(const FViewport& InViewport)
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Memory/MemoryTracker.h"
 #include "Scene/Scene.h"
 #include "Camera/Camera.h"
 #include "Viewport.h"
+#include "RenderFrame.h"
 #include "RHI/FrameBuffer.h"
 
 /**
@@ -11,6 +13,9 @@
  * Rendering occurs every Update() call. The render target can
  * be configured in order to render into a frame buffer other 
  * than the default frame buffer (see FFrameBuffer).
+ *
+ * A frame is rendered from a copy of the scene state it reads (see FRenderFrame),
+ * so that a render thread can render it while the game thread builds the next one.
  */
 class FRenderer
 {
@@ -28,8 +33,17 @@ public:
 
 	void Init(void* InNativeWindowHandle, const FViewport& InViewport);
 	void Shutdown();
+	// Builds a frame and renders it right away.
 	void Update(double InDeltaTimeMilliseconds);
 
+	// Copies the scene state a frame is rendered from. Called from the game thread.
+	void BuildFrame(FRenderFrame& OutFrame) const;
+	// Renders a frame built by BuildFrame. Called from the thread that owns the graphics context.
+	void RenderFrame(const FRenderFrame& InFrame)
+	{
+		Render(InFrame);
+	}
+
 	// Getters.
 	void* GetNativeWindowHandle() 
 	{ 
@@ -68,6 +82,7 @@ public:
 	void SetViewport(const FViewport& InViewport);
 	void SetScene(const FStringId& InSceneFile)
 	{
+		MEMORY_TAG_SCOPE(EMemoryTag::Scene);
 		Scene = MakeShared<FScene>(InSceneFile);
 	}
 	void SetScene(const TSharedPtr<FScene>& InScene)
@@ -92,9 +107,12 @@ protected:
 	TSharedPtr<FFrameBuffer> RenderTarget;
 
 private:
+	// Frame built and rendered by Update, kept so that its arrays are reused.
+	FRenderFrame ImmediateFrame;
+
 	/**
 	 * Template method called within FRenderer::Update() to allow for derived class specialization 
 	 * of rendering behavior (e.g. FForwardRenderer::Render() vs. FDeferredRenderer::Render()).
 	 */
-	virtual void Render() = 0;
+	virtual void Render(const FRenderFrame& InFrame) = 0;
 };
@@ -3,7 +3,6 @@
 #include "HAL/PreprocessorHelpers.h"
 #include "HAL/PlatformFileSystem.h"
 
-#include <string>
 #include <fstream>
 
 namespace
@@ -21,48 +20,59 @@ namespace
 	};
 }
 
+// Paths are built on the stack; FPathBuilder only allocates for paths longer than its inline capacity.
+using FPathBuilder = TANSIStringBuilder<256>;
+
+static void AppendDirectoryPath(FPathBuilder& OutPath, const ANSICHAR* InDirectoryName)
+{
+	OutPath.Append(FDirectoryNames::Root).Append('/').Append(FDirectoryNames::Assets).Append('/').Append(InDirectoryName);
+}
+
 static FStringId GetDirectoryPath(const ANSICHAR* InDirectoryName)
 {
-	std::string DirectoryPath = std::string(FDirectoryNames::Root) + "/" + FDirectoryNames::Assets + "/" + InDirectoryName;
-	ensure(FPlatformFileSystem::IsValidPath(DirectoryPath.c_str()));
-	return FStringId(DirectoryPath.c_str());
+	FPathBuilder DirectoryPath;
+	AppendDirectoryPath(DirectoryPath, InDirectoryName);
+	ensure(FPlatformFileSystem::IsValidPath(DirectoryPath.GetData()));
+	return FStringId(DirectoryPath.ToView());
 }
 
-static FStringId GetFilePath(const ANSICHAR* InDirectoryName, const ANSICHAR* InFileName)
+static FStringId GetFilePath(const ANSICHAR* InDirectoryName, const FStringId& InFileName)
 {
-	std::string FilePath = std::string(FDirectoryNames::Root) + "/" + FDirectoryNames::Assets + "/" + InDirectoryName + "/" + InFileName;
-	ensure(FPlatformFileSystem::IsValidPath(FilePath.c_str()));
-	return FStringId(FilePath.c_str());
+	FPathBuilder FilePath;
+	AppendDirectoryPath(FilePath, InDirectoryName);
+	FilePath.Append('/').Append(InFileName.GetString());
+	ensure(FPlatformFileSystem::IsValidPath(FilePath.GetData()));
+	return FStringId(FilePath.ToView());
 }
 
 FStringId FRendererFileSystem::GetSceneFilePath(const FStringId& InSceneFileName)
 {
-	return GetFilePath(FDirectoryNames::Scenes, InSceneFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Scenes, InSceneFileName);
 }
 
 FStringId FRendererFileSystem::GetMaterialFilePath(const FStringId& InMaterialFileName)
 {
-	return GetFilePath(FDirectoryNames::Materials, InMaterialFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Materials, InMaterialFileName);
 }
 
 FStringId FRendererFileSystem::GetModelFilePath(const FStringId& InModelFileName)
 {
-	return GetFilePath(FDirectoryNames::Models, InModelFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Models, InModelFileName);
 }
 
 FStringId FRendererFileSystem::GetMeshFilePath(const FStringId& InMeshFileName)
 {
-	return GetFilePath(FDirectoryNames::Meshes, InMeshFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Meshes, InMeshFileName);
 }
 
 FStringId FRendererFileSystem::GetTextureFilePath(const FStringId& InTextureFileName)
 {
-	return GetFilePath(FDirectoryNames::Textures, InTextureFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Textures, InTextureFileName);
 }
 
 FStringId FRendererFileSystem::GetShaderFilePath(const FStringId& InShaderFileName)
 {
-	return GetFilePath(FDirectoryNames::Shaders, InShaderFileName.GetString().GetData());
+	return GetFilePath(FDirectoryNames::Shaders, InShaderFileName);
 }
 
 TArray<FStringId> FRendererFileSystem::GetAllSceneFileNames()
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SlotMap.h"
+
+class FMesh;
+class FMaterial;
+class FTexture2D;
+class FPipeline;
+
+// Handle to a resource owned by FResourceManager. Stays valid while the resource is referenced.
+template<typename ResourceType>
+using TResourceHandle = TSlotMapHandle<ResourceType>;
+
+using FMeshHandle = TResourceHandle<FMesh>;
+using FMaterialHandle = TResourceHandle<FMaterial>;
+using FTextureHandle = TResourceHandle<FTexture2D>;
+using FPipelineHandle = TResourceHandle<FPipeline>;
+
+// Reference counting and lookup of resources, implemented by FResourceManager.
+// Declared here so that resources can reference each other without including the manager.
+void AddResourceRef(FMeshHandle InHandle);
+void AddResourceRef(FMaterialHandle InHandle);
+void AddResourceRef(FTextureHandle InHandle);
+void AddResourceRef(FPipelineHandle InHandle);
+
+void ReleaseResourceRef(FMeshHandle InHandle);
+void ReleaseResourceRef(FMaterialHandle InHandle);
+void ReleaseResourceRef(FTextureHandle InHandle);
+void ReleaseResourceRef(FPipelineHandle InHandle);
+
+FMesh* FindResource(FMeshHandle InHandle);
+FMaterial* FindResource(FMaterialHandle InHandle);
+FTexture2D* FindResource(FTextureHandle InHandle);
+FPipeline* FindResource(FPipelineHandle InHandle);
+
+/**
+ * Counted reference to a resource owned by FResourceManager. The resource is destroyed when its last
+ * reference is. References are obtained by name from FResourceManager when loading, and copied from
+ * there on, so that names are never looked up while rendering. Dereferencing is a slot lookup.
+ */
+template<typename ResourceType>
+class TResourceRef
+{
+public:
+	// Null reference.
+	TResourceRef() = default;
+
+	// Takes over a reference that has already been counted, such as one added by FResourceManager.
+	explicit TResourceRef(TResourceHandle<ResourceType> InHandle)
+		: Handle(InHandle)
+	{
+	}
+
+	~TResourceRef()
+	{
+		Reset();
+	}
+
+	TResourceRef(const TResourceRef& InOther)
+		: Handle(InOther.Handle)
+	{
+		if (!Handle.IsNull())
+		{
+			AddResourceRef(Handle);
+		}
+	}
+
+	TResourceRef& operator=(const TResourceRef& InOther)
+	{
+		// Reference the new resource before releasing the old one, in case they are the same. The handle is
+		// copied first, since Reset clears InOther's handle when it is this reference.
+		const TResourceHandle<ResourceType> NewHandle = InOther.Handle;
+		if (!NewHandle.IsNull())
+		{
+			AddResourceRef(NewHandle);
+		}
+		Reset();
+		Handle = NewHandle;
+		return *this;
+	}
+
+	TResourceRef(TResourceRef&& InOther)
+		: Handle(InOther.Handle)
+	{
+		InOther.Handle = TResourceHandle<ResourceType>();
+	}
+
+	TResourceRef& operator=(TResourceRef&& InOther)
+	{
+		if (this != &InOther)
+		{
+			Reset();
+			Handle = InOther.Handle;
+			InOther.Handle = TResourceHandle<ResourceType>();
+		}
+		return *this;
+	}
+
+	// Releases the reference, leaving a null reference.
+	void Reset()
+	{
+		if (!Handle.IsNull())
+		{
+			ReleaseResourceRef(Handle);
+			Handle = TResourceHandle<ResourceType>();
+		}
+	}
+
+	// Returns the resource, or nullptr for null references.
+	ResourceType* Get() const
+	{
+		return Handle.IsNull() ? nullptr : FindResource(Handle);
+	}
+
+	ResourceType* operator->() const
+	{
+		ResourceType* Resource = Get();
+		ensure(Resource);
+		return Resource;
+	}
+
+	ResourceType& operator*() const
+	{
+		return *operator->();
+	}
+
+	bool IsNull() const
+	{
+		return Handle.IsNull();
+	}
+
+	TResourceHandle<ResourceType> GetHandle() const
+	{
+		return Handle;
+	}
+
+private:
+	TResourceHandle<ResourceType> Handle;
+};
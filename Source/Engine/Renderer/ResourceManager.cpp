@@ -0,0 +1,119 @@
+#include "ResourceManager.h"
+#include "Memory/MemoryTracker.h"
+
+// Returns a reference to the resource with the given name, constructing it from InArgs if it hasn't been loaded yet.
+template<typename ResourceType, typename... ArgTypes>
+static TResourceRef<ResourceType> LoadResource(TResourcePool<ResourceType>& InPool, const FStringId& InName, ArgTypes&&... InArgs)
+{
+	TResourceHandle<ResourceType> Handle = InPool.AddRefByName(InName);
+	if (Handle.IsNull())
+	{
+		MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+		Handle = InPool.Add(InName, Forward<ArgTypes>(InArgs)...);
+	}
+	return TResourceRef<ResourceType>(Handle);
+}
+
+TResourceRef<FMesh> FResourceManager::LoadMesh(const FStringId& InMeshFileName)
+{
+	return LoadResource(Meshes, InMeshFileName, InMeshFileName);
+}
+
+TResourceRef<FMaterial> FResourceManager::LoadMaterial(const FStringId& InMaterialFileName)
+{
+	return LoadResource(Materials, InMaterialFileName, InMaterialFileName);
+}
+
+TResourceRef<FTexture2D> FResourceManager::LoadTexture(const FStringId& InTextureFileName)
+{
+	return LoadResource(Textures, InTextureFileName, InTextureFileName);
+}
+
+TResourceRef<FPipeline> FResourceManager::LoadPipeline(const FStringId& InVertexShaderFileName, const FStringId& InFragmentShaderFileName, const FStringId& InGeometryShaderFileName /* = FStringId::Null() */)
+{
+	// Pipelines are named after their shaders, so that materials using the same shaders share a pipeline.
+	TANSIStringBuilder<256> PipelineName;
+	PipelineName.Append(InVertexShaderFileName.GetString()).Append('|').Append(InFragmentShaderFileName.GetString());
+	if (InGeometryShaderFileName != FStringId::Null())
+	{
+		PipelineName.Append('|').Append(InGeometryShaderFileName.GetString());
+	}
+
+	FPipelineHandle Handle = Pipelines.AddRefByName(PipelineName.GetData());
+	if (Handle.IsNull())
+	{
+		MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+		FShader VertexShader(InVertexShaderFileName, EShaderType::Vertex);
+		FShader FragmentShader(InFragmentShaderFileName, EShaderType::Fragment);
+		if (InGeometryShaderFileName == FStringId::Null())
+		{
+			Handle = Pipelines.Add(PipelineName.GetData(), VertexShader, FragmentShader);
+		}
+		else
+		{
+			FShader GeometryShader(InGeometryShaderFileName, EShaderType::Geometry);
+			Handle = Pipelines.Add(PipelineName.GetData(), VertexShader, FragmentShader, GeometryShader);
+		}
+	}
+	return TResourceRef<FPipeline>(Handle);
+}
+
+void AddResourceRef(FMeshHandle InHandle)
+{
+	FResourceManager::Get().AddRef(InHandle);
+}
+
+void AddResourceRef(FMaterialHandle InHandle)
+{
+	FResourceManager::Get().AddRef(InHandle);
+}
+
+void AddResourceRef(FTextureHandle InHandle)
+{
+	FResourceManager::Get().AddRef(InHandle);
+}
+
+void AddResourceRef(FPipelineHandle InHandle)
+{
+	FResourceManager::Get().AddRef(InHandle);
+}
+
+void ReleaseResourceRef(FMeshHandle InHandle)
+{
+	FResourceManager::Get().Release(InHandle);
+}
+
+void ReleaseResourceRef(FMaterialHandle InHandle)
+{
+	FResourceManager::Get().Release(InHandle);
+}
+
+void ReleaseResourceRef(FTextureHandle InHandle)
+{
+	FResourceManager::Get().Release(InHandle);
+}
+
+void ReleaseResourceRef(FPipelineHandle InHandle)
+{
+	FResourceManager::Get().Release(InHandle);
+}
+
+FMesh* FindResource(FMeshHandle InHandle)
+{
+	return FResourceManager::Get().Find(InHandle);
+}
+
+FMaterial* FindResource(FMaterialHandle InHandle)
+{
+	return FResourceManager::Get().Find(InHandle);
+}
+
+FTexture2D* FindResource(FTextureHandle InHandle)
+{
+	return FResourceManager::Get().Find(InHandle);
+}
+
+FPipeline* FindResource(FPipelineHandle InHandle)
+{
+	return FResourceManager::Get().Find(InHandle);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SlotMap.h"
+#include "ResourceHandle.h"
+#include "ResourcePool.h"
+#include "Geometry/Mesh.h"
+#include "Materials/Material.h"
+#include "RHI/Texture2D.h"
+#include "RHI/Pipeline.h"
+
+/**
+ * Singleton that owns the renderer's meshes, materials, textures and pipelines.
+ *
+ * Resources are loaded by name once, and shared by everything that loads the same name. Loading returns
+ * a TResourceRef, which keeps the resource alive and dereferences it through its handle in O(1),
+ * so nothing looks resources up by name while rendering.
+ *
+ * The manager lives until the program exits, so the pools' storage comes from the persistent pool, which the
+ * leak report leaves out. Resources that are never released still report the memory they allocated.
+ */
+class FResourceManager
+{
+public:
+	static FResourceManager& Get()
+	{
+		static FResourceManager ResourceManager;
+		return ResourceManager;
+	}
+
+	/**
+	 * Loads a resource from its file, or adds a reference to it if it has already been loaded.
+	 *
+	 * @param InFileName: Name of the resource's file.
+	 * @returns: Reference to the resource.
+	 */
+	TResourceRef<FMesh> LoadMesh(const FStringId& InMeshFileName);
+	TResourceRef<FMaterial> LoadMaterial(const FStringId& InMaterialFileName);
+	TResourceRef<FTexture2D> LoadTexture(const FStringId& InTextureFileName);
+
+	/**
+	 * Compiles a pipeline from its shader files, or adds a reference to it if a pipeline
+	 * has already been compiled from the same files.
+	 *
+	 * @param InGeometryShaderFileName: Optional geometry shader, or FStringId::Null().
+	 * @returns: Reference to the pipeline.
+	 */
+	TResourceRef<FPipeline> LoadPipeline(const FStringId& InVertexShaderFileName, const FStringId& InFragmentShaderFileName, const FStringId& InGeometryShaderFileName = FStringId::Null());
+
+	// Returns a resource from its handle, or nullptr if the resource has been destroyed.
+	FMesh* Find(FMeshHandle InHandle)
+	{
+		return Meshes.Find(InHandle);
+	}
+	FMaterial* Find(FMaterialHandle InHandle)
+	{
+		return Materials.Find(InHandle);
+	}
+	FTexture2D* Find(FTextureHandle InHandle)
+	{
+		return Textures.Find(InHandle);
+	}
+	FPipeline* Find(FPipelineHandle InHandle)
+	{
+		return Pipelines.Find(InHandle);
+	}
+
+	// Reference counting, used by TResourceRef.
+	void AddRef(FMeshHandle InHandle)
+	{
+		Meshes.AddRef(InHandle);
+	}
+	void AddRef(FMaterialHandle InHandle)
+	{
+		Materials.AddRef(InHandle);
+	}
+	void AddRef(FTextureHandle InHandle)
+	{
+		Textures.AddRef(InHandle);
+	}
+	void AddRef(FPipelineHandle InHandle)
+	{
+		Pipelines.AddRef(InHandle);
+	}
+	void Release(FMeshHandle InHandle)
+	{
+		Meshes.Release(InHandle);
+	}
+	void Release(FMaterialHandle InHandle)
+	{
+		Materials.Release(InHandle);
+	}
+	void Release(FTextureHandle InHandle)
+	{
+		Textures.Release(InHandle);
+	}
+	void Release(FPipelineHandle InHandle)
+	{
+		Pipelines.Release(InHandle);
+	}
+
+private:
+	FResourceManager()
+		: Pipelines(FPoolAllocator::GetPersistentAllocator())
+		, Textures(FPoolAllocator::GetPersistentAllocator())
+		, Materials(FPoolAllocator::GetPersistentAllocator())
+		, Meshes(FPoolAllocator::GetPersistentAllocator())
+	{
+	}
+
+	~FResourceManager() = default;
+
+	// Materials reference textures and pipelines, so they are declared after them and destroyed before them.
+	TResourcePool<FPipeline> Pipelines;
+	TResourcePool<FTexture2D> Textures;
+	TResourcePool<FMaterial> Materials;
+	TResourcePool<FMesh> Meshes;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SlotMap.h"
+#include "ResourceHandle.h"
+
+/**
+ * Resources of one type, stored densely in a slot map and reached through handles.
+ * Each resource has a name, used to find it when it's loaded again, and a reference count.
+ */
+template<typename ResourceType>
+class TResourcePool
+{
+public:
+	using FHandle = TResourceHandle<ResourceType>;
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InAllocator: Allocator of the pool's slot map and name map, not of the resources' own data.
+	 */
+	explicit TResourcePool(IAllocator& InAllocator = FDefaultArrayAllocator::GetDefaultAllocator())
+		: Entries(InAllocator)
+		, NameToHandle(InAllocator)
+	{
+	}
+
+	/**
+	 * Adds a reference to the resource with the given name.
+	 *
+	 * @param InName: Name of the resource.
+	 * @returns: Handle to the resource, or a null handle if no resource has that name.
+	 */
+	FHandle AddRefByName(const FStringId& InName)
+	{
+		const FHandle* Handle = NameToHandle.Find(InName);
+		if (!Handle)
+		{
+			return FHandle();
+		}
+		AddRef(*Handle);
+		return *Handle;
+	}
+
+	/**
+	 * Constructs a resource with a single reference.
+	 *
+	 * @param InName: Name of the resource, which must not be used by another resource.
+	 * @param InArgs: Arguments forwarded to ResourceType's constructor.
+	 * @returns: Handle to the resource.
+	 */
+	template<typename... ArgTypes>
+	FHandle Add(const FStringId& InName, ArgTypes&&... InArgs)
+	{
+		ensure(!NameToHandle.IsKeyContained(InName));
+		typename TSlotMap<FEntry>::FHandle EntryHandle = Entries.Emplace(InName, Forward<ArgTypes>(InArgs)...);
+		FHandle Handle = { EntryHandle.Index, EntryHandle.Generation };
+		NameToHandle.Add(InName, Handle);
+		return Handle;
+	}
+
+	ResourceType* Find(FHandle InHandle)
+	{
+		FEntry* Entry = Entries.Find(ToEntryHandle(InHandle));
+		return Entry ? &Entry->Resource : nullptr;
+	}
+
+	void AddRef(FHandle InHandle)
+	{
+		FEntry* Entry = Entries.Find(ToEntryHandle(InHandle));
+		ensure(Entry);
+		++Entry->RefCount;
+	}
+
+	// Removes a reference to a resource, destroying the resource if it was the last one.
+	void Release(FHandle InHandle)
+	{
+		FEntry* Entry = Entries.Find(ToEntryHandle(InHandle));
+		ensure(Entry && Entry->RefCount > 0);
+		if (--Entry->RefCount == 0)
+		{
+			NameToHandle.Remove(Entry->Name);
+			Entries.Remove(ToEntryHandle(InHandle));
+		}
+	}
+
+	int32 GetRefCount(FHandle InHandle) const
+	{
+		const FEntry* Entry = Entries.Find(ToEntryHandle(InHandle));
+		return Entry ? Entry->RefCount : 0;
+	}
+
+	int32 GetSize() const
+	{
+		return Entries.GetSize();
+	}
+
+private:
+	struct FEntry
+	{
+		template<typename... ArgTypes>
+		explicit FEntry(const FStringId& InName, ArgTypes&&... InArgs)
+			: Resource(Forward<ArgTypes>(InArgs)...)
+			, Name(InName)
+			, RefCount(1)
+		{
+		}
+
+		ResourceType Resource;
+		FStringId Name;
+		int32 RefCount;
+	};
+
+	static typename TSlotMap<FEntry>::FHandle ToEntryHandle(FHandle InHandle)
+	{
+		return { InHandle.Index, InHandle.Generation };
+	}
+
+	TSlotMap<FEntry> Entries;
+	// Only used when loading resources, never when rendering.
+	TMap<FStringId, FHandle> NameToHandle;
+};
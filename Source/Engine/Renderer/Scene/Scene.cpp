@@ -64,7 +64,7 @@ FScene::FScene(const FStringId& InSceneFileName)
 		
 		TSharedPtr<FModel> Model = MakeShared<FModel>(ModelInfo.Name.GetString().GetData(), ModelInfo.FileName.GetString().GetData());
 		Model->SetPosition(ModelInfo.Transform.Position);
-		Model->SetRotation(Rotation);
+		Model->SetRotation(FQuat::MakeFromEuler(Rotation));
 		Model->SetScale(ModelInfo.Transform.Scale);
 		AddModel(Model);
 	}
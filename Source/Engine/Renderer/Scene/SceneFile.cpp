@@ -47,7 +47,7 @@ static FTransformInfo ParseTransform(const nlohmann::json& InJsonObject);
 static FAttenuationInfo ParseAttenuation(const nlohmann::json& InJsonObject);
 static FVector3D ParseVector3D(const nlohmann::json& InJsonArray);
 static float ParseFloat(const nlohmann::json& InJsonNumber);
-static std::string ParseString(const nlohmann::json& InJsonString);
+static FStringId ParseStringId(const nlohmann::json& InJsonString);
 
 FSceneFile::FSceneFile(const FStringId& InSceneFileName)
 {
@@ -74,13 +74,13 @@ FSceneFile::FSceneFile(const FStringId& InSceneFileName)
 		ensure(Textures.contains(FSceneFileKeys::Front) && Textures[FSceneFileKeys::Front].is_string());
 
 		FSkyboxInfo SkyboxInfo;
-		SkyboxInfo.Name = ParseString(SkyboxJson[FSceneFileKeys::Name]).c_str();
-		SkyboxInfo.RightTextureFileName = ParseString(Textures[FSceneFileKeys::Right]).c_str();
-		SkyboxInfo.LeftTextureFileName = ParseString(Textures[FSceneFileKeys::Left]).c_str();
-		SkyboxInfo.TopTextureFileName = ParseString(Textures[FSceneFileKeys::Top]).c_str();
-		SkyboxInfo.BottomTextureFileName = ParseString(Textures[FSceneFileKeys::Bottom]).c_str();
-		SkyboxInfo.BackTextureFileName = ParseString(Textures[FSceneFileKeys::Back]).c_str();
-		SkyboxInfo.FrontTextureFileName = ParseString(Textures[FSceneFileKeys::Front]).c_str();
+		SkyboxInfo.Name = ParseStringId(SkyboxJson[FSceneFileKeys::Name]);
+		SkyboxInfo.RightTextureFileName = ParseStringId(Textures[FSceneFileKeys::Right]);
+		SkyboxInfo.LeftTextureFileName = ParseStringId(Textures[FSceneFileKeys::Left]);
+		SkyboxInfo.TopTextureFileName = ParseStringId(Textures[FSceneFileKeys::Top]);
+		SkyboxInfo.BottomTextureFileName = ParseStringId(Textures[FSceneFileKeys::Bottom]);
+		SkyboxInfo.BackTextureFileName = ParseStringId(Textures[FSceneFileKeys::Back]);
+		SkyboxInfo.FrontTextureFileName = ParseStringId(Textures[FSceneFileKeys::Front]);
 
 		Skybox = SkyboxInfo;
 		bHasSkybox = true;
@@ -105,7 +105,7 @@ FSceneFile::FSceneFile(const FStringId& InSceneFileName)
 				ensure(DirectionalLight.contains(FSceneFileKeys::Intensity) && DirectionalLight[FSceneFileKeys::Intensity].is_number());
 
 				FDirectionalLightInfo DirectionalLightInfo;
-				DirectionalLightInfo.Name = ParseString(DirectionalLight[FSceneFileKeys::Name]).c_str();
+				DirectionalLightInfo.Name = ParseStringId(DirectionalLight[FSceneFileKeys::Name]);
 				DirectionalLightInfo.Direction = ParseVector3D(DirectionalLight[FSceneFileKeys::Direction]);
 				DirectionalLightInfo.Color = ParseVector3D(DirectionalLight[FSceneFileKeys::Color]);
 				DirectionalLightInfo.Intensity = ParseFloat(DirectionalLight[FSceneFileKeys::Intensity]);
@@ -125,7 +125,7 @@ FSceneFile::FSceneFile(const FStringId& InSceneFileName)
 				ensure(PointLight.contains(FSceneFileKeys::Intensity) && PointLight[FSceneFileKeys::Intensity].is_number());
 
 				FPointLightInfo PointLightInfo;
-				PointLightInfo.Name = ParseString(PointLight[FSceneFileKeys::Name]).c_str();
+				PointLightInfo.Name = ParseStringId(PointLight[FSceneFileKeys::Name]);
 				PointLightInfo.Position = ParseVector3D(PointLight[FSceneFileKeys::Position]);
 				PointLightInfo.Color = ParseVector3D(PointLight[FSceneFileKeys::Color]);
 				PointLightInfo.Attenuation = ParseAttenuation(PointLight[FSceneFileKeys::Attenuation]);
@@ -145,8 +145,8 @@ FSceneFile::FSceneFile(const FStringId& InSceneFileName)
 			ensure(Model.contains(FSceneFileKeys::Transform) && Model[FSceneFileKeys::Transform].is_object());
 
 			FModelInfo ModelInfo;
-			ModelInfo.Name = ParseString(Model[FSceneFileKeys::Name]).c_str();
-			ModelInfo.FileName = ParseString(Model[FSceneFileKeys::Model]).c_str();
+			ModelInfo.Name = ParseStringId(Model[FSceneFileKeys::Name]);
+			ModelInfo.FileName = ParseStringId(Model[FSceneFileKeys::Model]);
 			ModelInfo.Transform = ParseTransform(Model[FSceneFileKeys::Transform]);
 			Models.Add(ModelInfo);
 		}
@@ -192,7 +192,9 @@ static float ParseFloat(const nlohmann::json& InJsonNumber)
 	return InJsonNumber.get<float>();
 }
 
-static std::string ParseString(const nlohmann::json& InJsonString)
+static FStringId ParseStringId(const nlohmann::json& InJsonString)
 {
-	return InJsonString.get<std::string>();
+	// Reference the JSON string's characters directly instead of copying them into a temporary.
+	const std::string& String = InJsonString.get_ref<const std::string&>();
+	return FStringId(FANSIStringView(String.data(), static_cast<int32>(String.size())));
 }
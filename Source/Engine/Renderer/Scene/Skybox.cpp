@@ -1,10 +1,12 @@
 #include "Skybox.h"
+#include "ResourceManager.h"
 
 FSkybox::FSkybox(const FStringId& InName, const FCubemap& InCubemap)
 	: Name(InName)
 	, Scene(nullptr)
 	// Create cube mesh with default mesh and material files.
-	, CubeMesh("Cube.obj", "Skybox.mat")
+	, CubeMesh(FResourceManager::Get().LoadMesh("Cube.obj"))
+	, CubeMaterial(FResourceManager::Get().LoadMaterial("Skybox.mat"))
 	, Cubemap(InCubemap)
 	, bIsVisible(true)
 {
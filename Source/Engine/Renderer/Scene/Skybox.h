@@ -1,7 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Geometry/Mesh.h"
+#include "ResourceHandle.h"
 #include "RHI/Cubemap.h"
 
 class FScene;
@@ -30,13 +30,13 @@ public:
 	{ 
 		return Name; 
 	}
-	FMesh& GetMesh() 
+	FMesh& GetMesh() const
 	{ 
-		return CubeMesh;
+		return *CubeMesh;
 	}
-	const FMesh& GetMesh() const
-	{ 
-		return CubeMesh; 
+	FMaterial& GetMaterial() const
+	{
+		return *CubeMaterial;
 	}
 	FCubemap& GetCubemap() 
 	{ 
@@ -56,7 +56,8 @@ public:
 private:
 	FStringId Name;
 	FScene* Scene;
-	FMesh CubeMesh;
+	TResourceRef<FMesh> CubeMesh;
+	TResourceRef<FMaterial> CubeMaterial;
 	FCubemap Cubemap;
 	bool bIsVisible;
 
@@ -7,8 +7,19 @@ static constexpr float MaxCameraToTargetLength = 2.0f;
 static constexpr float TranslationSpeed = 0.0005f;
 static constexpr float ZoomSpeed = 0.0005f;
 
+// Makes the rotation of a camera looking along a direction with no roll, so that its local Y axis stays in the plane of the world Y axis.
+static FQuat MakeCameraRotation(const FVector3D& InForward)
+{
+	FVector3D ZAxis = FVector3D::Normalize(-InForward);
+	FVector3D XAxis = FVector3D::Normalize(FVector3D::CrossProduct(FVector3D::YAxis, ZAxis));
+	FVector3D YAxis = FVector3D::CrossProduct(ZAxis, XAxis);
+	return FQuat::MakeFromTransform(FTransform4D(XAxis, YAxis, ZAxis, FVector3D::Zero));
+}
+
 FCameraController::FCameraController(const TSharedPtr<FCamera>& InCamera)
 	: Camera(InCamera)
+	, CameraTransform(InCamera->GetPosition(), MakeCameraRotation(InCamera->GetForward()))
+	, TargetDistance(FVector3D::Length(InCamera->GetPosition(), InCamera->GetTarget()))
 	, PressedButton(EKeys::None)
 	, PreviousMousePosition(FVector2D::Zero)
 	, CurrentMousePosition(FVector2D::Zero)
@@ -73,15 +84,20 @@ void FCameraController::Rotate()
 	float VerticalRotation = FMath::Pi * (MousePositionDelta.Y / WindowHeight);
 
 	// Rotate by negative horizontal and vertical rotation so that controls are inverted.
-	FVector3D RotatedForward = FTransform4D::MakeRotation(-VerticalRotation, Camera->GetRight()) * FTransform4D::MakeRotationY(-HorizontalRotation) * Camera->GetForward();
-	
-	// Don't rotate if the camera is looking straight upward or downward.
-	float ForwardDotUp = FVector3D::DotProduct(RotatedForward, FVector3D::YAxis);
-	if (!FMath::IsApproximatelyZero(ForwardDotUp))
+	// The vertical rotation is around the camera's own X axis and the horizontal one around the world Y axis, which keeps the camera from rolling.
+	FQuat HorizontalQuat = FQuat::MakeFromAxisAngle(FVector3D::YAxis, -HorizontalRotation);
+	FQuat VerticalQuat = FQuat::MakeFromAxisAngle(FVector3D::XAxis, -VerticalRotation);
+	FQuat RotatedRotation = FQuat::Normalize(HorizontalQuat * CameraTransform.Rotation * VerticalQuat);
+
+	// Don't rotate past looking straight upward or downward, where the camera would turn upside down.
+	FVector3D RotatedUp = RotatedRotation.RotateVector(FVector3D::YAxis);
+	if (FVector3D::DotProduct(RotatedUp, FVector3D::YAxis) > 0.0f)
 	{
-		float Distance = FVector3D::Length(Camera->GetPosition(), Camera->GetTarget());
-		FVector3D RotatedCameraPosition = Camera->GetTarget() + (-RotatedForward * Distance);
-		Camera->SetPosition(RotatedCameraPosition);
+		// Orbit around the target.
+		FVector3D Target = CameraTransform.TransformPoint(FVector3D(0.0f, 0.0f, -TargetDistance));
+		CameraTransform.Rotation = RotatedRotation;
+		CameraTransform.Translation = Target - CameraTransform.TransformVector(FVector3D(0.0f, 0.0f, -TargetDistance));
+		UpdateCamera();
 	}
 }
 
@@ -89,26 +105,32 @@ void FCameraController::Translate(float InDeltaTimeMilliseconds)
 {
 	FVector2D MousePositionDelta = CurrentMousePosition - PreviousMousePosition;
 
-	float DistanceToOrigin = FVector3D::Length({ 0.0f, 0.0f, 0.0f }, Camera->GetPosition());
+	float DistanceToOrigin = FVector3D::Length({ 0.0f, 0.0f, 0.0f }, CameraTransform.Translation);
 	DistanceToOrigin /= 10.0f;
 
+	// Mouse coordinates grow downward, so the vertical mouse movement is along the camera's -Y axis.
 	float TranslationDistance = TranslationSpeed * DistanceToOrigin * InDeltaTimeMilliseconds;
-	FVector3D TranslationUp = Camera->GetUp() * MousePositionDelta.Y;
-	FVector3D TranslationRight = Camera->GetRight() * MousePositionDelta.X;
-	FVector3D Translation = (TranslationUp + TranslationRight) * TranslationDistance;
+	FVector3D Translation = CameraTransform.TransformVector(FVector3D(MousePositionDelta.X, -MousePositionDelta.Y, 0.0f)) * TranslationDistance;
 
-	// Subtract translation from camera position and target so that controls are inverted.
-	Camera->SetPosition(Camera->GetPosition() - Translation);
-	Camera->SetTarget(Camera->GetTarget() - Translation);
+	// Subtract translation from camera position, which moves the target along, so that controls are inverted.
+	CameraTransform.Translation -= Translation;
+	UpdateCamera();
 }
 
 void FCameraController::Zoom(float InDeltaTimeMilliseconds)
 {
 	float ZoomDistance = ZoomSpeed * InDeltaTimeMilliseconds;
-	FVector3D CameraPosition = Camera->GetPosition() + (Camera->GetForward() * ScrollDelta * ZoomDistance);
-	float CameraToTargetLength = FVector3D::Length(CameraPosition, Camera->GetTarget());
-	if (CameraToTargetLength >= MaxCameraToTargetLength)
+	float ZoomedTargetDistance = TargetDistance - ScrollDelta * ZoomDistance;
+	if (ZoomedTargetDistance >= MaxCameraToTargetLength)
 	{
-		Camera->SetPosition(CameraPosition);
+		CameraTransform.Translation = CameraTransform.TransformPoint(FVector3D(0.0f, 0.0f, ZoomedTargetDistance - TargetDistance));
+		TargetDistance = ZoomedTargetDistance;
+		UpdateCamera();
 	}
 }
+
+void FCameraController::UpdateCamera()
+{
+	Camera->SetPosition(CameraTransform.Translation);
+	Camera->SetTarget(CameraTransform.TransformPoint(FVector3D(0.0f, 0.0f, -TargetDistance)));
+}
@@ -37,8 +37,15 @@ private:
 	void Translate(float InDeltaTimeMilliseconds);
 	void Zoom(float InDeltaTimeMilliseconds);
 
+	// Sets the camera's position and target from CameraTransform and TargetDistance.
+	void UpdateCamera();
+
 	// Camera being controlled.
 	TSharedPtr<FCamera> Camera;
+	// Camera to world transform. The camera looks down its local -Z axis, with its local Y axis up, as in FCamera::MakeLookAt.
+	FTransformTRS CameraTransform;
+	// Distance from the camera to the target it orbits around.
+	float TargetDistance;
 	// Mouse button currently pressed (if any).
 	FKey PressedButton;
 	// Mouse position of the previous frame.
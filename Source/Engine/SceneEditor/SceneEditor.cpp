@@ -3,6 +3,7 @@
 #include "Scene/Scene.h"
 #include "Camera/CameraController.h"
 #include "RHI/RHI.h"
+#include "Memory/MemoryTracker.h"
 
 #include "UI/ImGui/ImGuiUtilities.h"
 #include "UI/ImGui/HAL/PlatformImGui.h"
@@ -13,6 +14,8 @@
 
 void FSceneEditor::Init()
 {
+	MEMORY_TAG_SCOPE(EMemoryTag::SceneEditor);
+
 	// Create render target.
 	FViewport Viewport = FRenderManager::GetRenderer()->GetViewport();
 	TSharedPtr<FFrameBuffer> RenderTarget = MakeShared<FFrameBuffer>(Viewport.Width, Viewport.Height);
@@ -60,11 +63,14 @@ void FSceneEditor::Shutdown()
 
 	FImGuiRHI::Shutdown();
 	FPlatformImGui::Shutdown();
+	ImGuiDrawDataCopies.Empty();
 	ImGui::DestroyContext();
 }
 
 void FSceneEditor::Update(float InDeltaTimeMilliseconds)
 {
+	MEMORY_TAG_SCOPE(EMemoryTag::SceneEditor);
+
 	CameraController->Update(InDeltaTimeMilliseconds);
 
 	FImGuiRHI::NewFrame();
@@ -80,12 +86,8 @@ void FSceneEditor::Update(float InDeltaTimeMilliseconds)
 
 	EndDockspace();
 
-	FRHI::EnableDepthTesting();
-	FRHI::ClearColorBuffer();
-	FRHI::ClearDepthBuffer();
-
 	ImGui::Render();
-	FImGuiRHI::RenderDrawData(ImGui::GetDrawData());
+	RenderImGui();
 }
 
 void FSceneEditor::OnKeyDown(const FKeyEvent& InKeyEvent)
@@ -132,6 +134,39 @@ void FSceneEditor::OnMouseScroll(const FMouseScrollEvent& InMouseScrollEvent)
 	}
 }
 
+void FSceneEditor::RenderImGui()
+{
+	ImDrawData* DrawData = ImGui::GetDrawData();
+
+	// ImGui reuses its draw lists on the next frame, so the render thread draws a copy.
+	if (FRenderManager::IsRenderThreadRunning())
+	{
+		const int32 NumCopies = FRenderManager::GetMaxFramesInFlight() + 1;
+		if (ImGuiDrawDataCopies.GetSize() != NumCopies)
+		{
+			ImGuiDrawDataCopies.Empty();
+			for (int32 Index = 0; Index < NumCopies; ++Index)
+			{
+				ImGuiDrawDataCopies.Add(MakeUnique<FImGuiDrawDataCopy>());
+			}
+		}
+
+		ImGuiDrawDataCopyIndex = (ImGuiDrawDataCopyIndex + 1) % NumCopies;
+		FImGuiDrawDataCopy& DrawDataCopy = *ImGuiDrawDataCopies[ImGuiDrawDataCopyIndex];
+		DrawDataCopy.CopyFrom(*DrawData);
+		DrawData = DrawDataCopy.GetDrawData();
+	}
+
+	FRenderManager::EnqueueRenderCommand([DrawData]()
+	{
+		FRHI::EnableDepthTesting();
+		FRHI::ClearColorBuffer();
+		FRHI::ClearDepthBuffer();
+
+		FImGuiRHI::RenderDrawData(DrawData);
+	});
+}
+
 void FSceneEditor::UpdateSelectedSceneObject()
 {
 	if (TSharedPtr<FCamera> Camera = OutlinerUI.GetSelectedCamera())
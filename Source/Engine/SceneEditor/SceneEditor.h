@@ -5,6 +5,7 @@
 #include "UI/SceneUI.h"
 #include "UI/OutlinerUI.h"
 #include "UI/InspectorUI.h"
+#include "UI/ImGui/ImGuiDrawDataCopy.h"
 
 class FScene;
 class FCameraController;
@@ -49,6 +50,13 @@ private:
 	// Mouse look camera controller.
 	TUniquePtr<FCameraController> CameraController;
 
+	// Copies of the UI draw data of the frames the render thread may be drawing, and the one being built.
+	TArray<TUniquePtr<FImGuiDrawDataCopy>> ImGuiDrawDataCopies;
+	int32 ImGuiDrawDataCopyIndex = 0;
+
+	// Draws the UI, on the render thread if it's running.
+	void RenderImGui();
+
 	void UpdateSelectedSceneObject();
 
 	static void SetDarkMode();
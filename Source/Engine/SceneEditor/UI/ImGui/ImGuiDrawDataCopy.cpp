@@ -0,0 +1,44 @@
+#include "ImGuiDrawDataCopy.h"
+
+// System include for copying draw list buffers.
+#include <cstring>
+
+template<typename ElementType>
+static void CopyVector(ImVector<ElementType>& OutVector, const ImVector<ElementType>& InVector)
+{
+	// ImVector's assignment frees the buffer first, resizing keeps it.
+	OutVector.resize(InVector.Size);
+	if (InVector.Size > 0)
+	{
+		memcpy(OutVector.Data, InVector.Data, InVector.Size * sizeof(ElementType));
+	}
+}
+
+FImGuiDrawDataCopy::~FImGuiDrawDataCopy()
+{
+	for (ImDrawList* DrawList : DrawLists)
+	{
+		IM_DELETE(DrawList);
+	}
+}
+
+void FImGuiDrawDataCopy::CopyFrom(const ImDrawData& InDrawData)
+{
+	while (DrawLists.GetSize() < InDrawData.CmdListsCount)
+	{
+		DrawLists.Add(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+	}
+
+	for (int32 Index = 0; Index < InDrawData.CmdListsCount; ++Index)
+	{
+		const ImDrawList& Source = *InDrawData.CmdLists[Index];
+		ImDrawList& Destination = *DrawLists[Index];
+		CopyVector(Destination.CmdBuffer, Source.CmdBuffer);
+		CopyVector(Destination.IdxBuffer, Source.IdxBuffer);
+		CopyVector(Destination.VtxBuffer, Source.VtxBuffer);
+		Destination.Flags = Source.Flags;
+	}
+
+	DrawData = InDrawData;
+	DrawData.CmdLists = DrawLists.GetData();
+}
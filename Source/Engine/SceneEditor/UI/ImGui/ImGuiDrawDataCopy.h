@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "imgui/imgui.h"
+
+/**
+ * Copy of the draw data ImGui outputs for a frame. ImGui reuses its draw lists on the next frame, so the
+ * render thread draws a copy, while the game thread builds the next frame's UI. The draw lists are kept
+ * from one copy to the next, so that copying only allocates when the UI grows.
+ */
+class FImGuiDrawDataCopy
+{
+public:
+	FImGuiDrawDataCopy() = default;
+	~FImGuiDrawDataCopy();
+
+	// Non-copyable.
+	FImGuiDrawDataCopy(const FImGuiDrawDataCopy&) = delete;
+	FImGuiDrawDataCopy& operator=(const FImGuiDrawDataCopy&) = delete;
+
+	void CopyFrom(const ImDrawData& InDrawData);
+
+	ImDrawData* GetDrawData()
+	{
+		return &DrawData;
+	}
+
+private:
+	ImDrawData DrawData;
+	TArray<ImDrawList*> DrawLists;
+};
@@ -1,18 +1,27 @@
 #include "ImGuiRHI.h"
 
-// Renderer include for GLSL version.
+// Renderer includes for GLSL version and the rendering thread checks.
 #include "RHI/RHIDefinitions.h"
+#include "RHI/RHI.h"
 
 #include "imgui/backends/imgui_impl_opengl3.h"
 
 bool FImGuiRHI::Init()
 {
+	ensureRenderingThread();
 	const ANSICHAR* GlslVersion = FShaderFiles::LanguageVersion;
-	return ImGui_ImplOpenGL3_Init(GlslVersion);
+	if (!ImGui_ImplOpenGL3_Init(GlslVersion))
+	{
+		return false;
+	}
+
+	// Create the shaders and the font texture now rather than in the first NewFrame, so that NewFrame makes no GL calls.
+	return ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
 void FImGuiRHI::Shutdown()
 {
+	ensureRenderingThread();
 	ImGui_ImplOpenGL3_Shutdown();
 }
 
@@ -23,5 +32,6 @@ void FImGuiRHI::NewFrame()
 
 void FImGuiRHI::RenderDrawData(ImDrawData* InDrawData)
 {
+	ensureRenderingThread();
 	ImGui_ImplOpenGL3_RenderDrawData(InDrawData);
 }
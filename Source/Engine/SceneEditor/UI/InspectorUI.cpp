@@ -1,11 +1,11 @@
 #include "InspectorUI.h"
+#include "RenderManager.h"
 #include "RendererFileSystem.h"
 #include "Camera/Camera.h"
 #include "Lights/DirectionalLight.h"
 #include "Lights/PointLight.h"
 #include "Geometry/Model.h"
-#include "Geometry/Mesh.h"
-#include "Materials/Material.h"
+#include "ResourceManager.h"
 
 #include "imgui/imgui.h"
 #include "ImGui/ImGuiUtilities.h"
@@ -130,7 +130,9 @@ void FInspectorUI::RenderModelInfo()
 {
 	// Render transform info.
 	FVector3D Position = Model->GetPosition();
-	FVector3D Rotation = Model->GetRotation();
+	// Rotations are edited as Euler angles, and only converted back when the user changes them.
+	FVector3D ModelRotation = Model->GetRotation().ToEuler();
+	FVector3D Rotation = ModelRotation;
 	FVector3D Scale = Model->GetScale();
 	ImGui::Transform(Position, Rotation, Scale);
 
@@ -139,9 +141,9 @@ void FInspectorUI::RenderModelInfo()
 	{
 		Model->SetPosition(Position);
 	}
-	if (Rotation != Model->GetRotation())
+	if (Rotation != ModelRotation)
 	{
-		Model->SetRotation(Rotation);
+		Model->SetRotation(FQuat::MakeFromEuler(Rotation));
 	}
 	if (Scale != Model->GetScale())
 	{
@@ -188,25 +190,26 @@ void FInspectorUI::RenderModelInfo()
 	ImGui::Separator();
 
 	// Show material info per mesh.
-	TArray<FMesh>& Meshes = Model->GetMeshes();
+	TArray<FModelMesh>& Meshes = Model->GetMeshes();
 	for (int32 Index = 0; Index < Meshes.GetSize(); ++Index)
 	{
-		FMesh& Mesh = Meshes[Index];
-		if (ImGui::TreeNode(Mesh.GetName().GetString().GetData()))
+		FModelMesh& ModelMesh = Meshes[Index];
+		if (ImGui::TreeNode(ModelMesh.Mesh->GetName().GetString().GetData()))
 		{
-			RenderMaterialInfo(Mesh);
+			RenderMaterialInfo(ModelMesh);
 			ImGui::TreePop();
 		}
 	}
 }
 
-void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
+void FInspectorUI::RenderMaterialInfo(FModelMesh& InModelMesh)
 {
 	ImGui::Text("Material");
 	ImGui::SameLine();
 
 	// Display material file combo menu.
-	const FStringId& MaterialFileName = InMesh.GetMaterial().GetName();
+	const FMesh& Mesh = *InModelMesh.Mesh;
+	const FStringId MaterialFileName = InModelMesh.Material->GetName();
 	int32 MaterialIndex = MaterialFileNames.GetIndexOfByPredicate(
 		[&MaterialFileName](const FStringId& InMaterialFileName)
 		{
@@ -218,13 +221,17 @@ void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
 	ImGui::Combo(MaterialLabel.c_str(), &MaterialIndex, MaterialFileNames.GetData(), MaterialFileNames.GetSize());
 
 	// Update the mesh's material if a different material was chosen.
+	// Materials are loaded, read by the frames in flight and destroyed on the render thread.
 	if (MaterialIndex != PrevMaterialIndex)
 	{
-		InMesh.SetMaterial(MaterialFileNames[MaterialIndex]);
+		FRenderManager::ExecuteOnRenderThread([this, &InModelMesh, MaterialIndex]()
+		{
+			InModelMesh.Material = FResourceManager::Get().LoadMaterial(MaterialFileNames[MaterialIndex]);
+		});
 	}
 
 	// Display the material's float properties.
-	FMaterial& Material = InMesh.GetMaterial();
+	FMaterial& Material = *InModelMesh.Material;
 	if (!Material.GetFloatProperties().IsEmpty())
 	{
 		if (ImGui::TreeNode("Float Properties"))
@@ -239,13 +246,16 @@ void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
 				ImGui::Text(PropertyName);
 				ImGui::SameLine();
 
-				std::string FloatLabel = std::string("##Float") + PropertyName + InMesh.GetName().GetString().GetData();
+				std::string FloatLabel = std::string("##Float") + PropertyName + Mesh.GetName().GetString().GetData();
 				ImGui::DragFloat(FloatLabel.c_str(), &PropertyValue, 0.01f);
 
 				// Update the float property if it was changed.
 				if (PropertyValue != PrevPropertyValue)
 				{
-					Material.SetFloat(PropertyName, PropertyValue);
+					FRenderManager::ExecuteOnRenderThread([&Material, PropertyName, PropertyValue]()
+					{
+						Material.SetFloat(PropertyName, PropertyValue);
+					});
 				}
 			}
 			ImGui::TreePop();
@@ -267,13 +277,16 @@ void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
 				ImGui::Text(PropertyName);
 				ImGui::SameLine();
 
-				std::string ColorLabel = std::string("##Color") + PropertyName + InMesh.GetName().GetString().GetData();
+				std::string ColorLabel = std::string("##Color") + PropertyName + Mesh.GetName().GetString().GetData();
 				ImGui::ColorEdit3(ColorLabel.c_str(), (float*)&PropertyValue);
 
 				// Update the color property if it was changed.
 				if (PropertyValue != PrevPropertyValue)
 				{
-					Material.SetColor(PropertyName, PropertyValue);
+					FRenderManager::ExecuteOnRenderThread([&Material, PropertyName, PropertyValue]()
+					{
+						Material.SetColor(PropertyName, PropertyValue);
+					});
 				}
 			}
 			ImGui::TreePop();
@@ -285,17 +298,16 @@ void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
 	{
 		if (ImGui::TreeNode("Texture Properties"))
 		{
-			const TArray<FMaterialProperty<FTexture2D> >& TextureProperties = Material.GetTextureProperties();
+			const TArray<FMaterialProperty<FMaterialTexture> >& TextureProperties = Material.GetTextureProperties();
 			for (int32 Index = 0; Index < TextureProperties.GetSize(); ++Index)
 			{
 				const ANSICHAR* PropertyName = TextureProperties[Index].Name.GetString().GetData();
-				FTexture2D PropertyValue = TextureProperties[Index].Property;
 
 				ImGui::Text(PropertyName);
 				ImGui::SameLine();
 
 				// Display texture file combo menu.
-				const FStringId& TextureFileName = TextureProperties[Index].Property.GetName();
+				const FStringId TextureFileName = TextureProperties[Index].Property.Texture->GetName();
 				int32 TextureIndex = TextureFileNames.GetIndexOfByPredicate(
 					[&TextureFileName](const FStringId& InTextureFileName)
 					{
@@ -303,14 +315,16 @@ void FInspectorUI::RenderMaterialInfo(FMesh& InMesh)
 					}
 				);
 				int32 PrevTextureIndex = TextureIndex;
-				std::string TextureLabel = std::string("##Texture") + PropertyName + InMesh.GetName().GetString().GetData();
+				std::string TextureLabel = std::string("##Texture") + PropertyName + Mesh.GetName().GetString().GetData();
 				ImGui::Combo(TextureLabel.c_str(), &TextureIndex, TextureFileNames.GetData(), TextureFileNames.GetSize());
 
 				// Update the texture property if it was changed.
 				if (TextureIndex != PrevTextureIndex)
 				{
-					FTexture2D Texture(TextureFileNames[TextureIndex]);
-					Material.SetTexture(PropertyName, Texture);
+					FRenderManager::ExecuteOnRenderThread([this, &Material, PropertyName, TextureIndex]()
+					{
+						Material.SetTexture(PropertyName, FResourceManager::Get().LoadTexture(TextureFileNames[TextureIndex]));
+					});
 				}
 			}
 			ImGui::TreePop();
@@ -5,7 +5,7 @@
 class FCamera;
 class FSkybox;
 class FModel;
-class FMesh;
+struct FModelMesh;
 class FDirectionalLight;
 class FPointLight;
 
@@ -72,7 +72,7 @@ private:
 
 	void RenderCameraInfo();
 	void RenderModelInfo();
-	void RenderMaterialInfo(FMesh& InMesh);
+	void RenderMaterialInfo(FModelMesh& InModelMesh);
 	void RenderDirectionalLightInfo();
 	void RenderPointLightInfo();
 	
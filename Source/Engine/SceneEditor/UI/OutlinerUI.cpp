@@ -260,7 +260,12 @@ void FOutlinerUI::RenderLoadSceneButton()
 
 		if (ImGui::Button("OK", ImVec2(120, 0)))
 		{
-			FRenderManager::GetRenderer()->SetScene(SceneFileNames[SelectedSceneIndex].GetString().GetData());
+			// Loading creates GPU resources, and the old scene's are destroyed once the editor lets go of it.
+			FRenderManager::BeginRelease(FRenderManager::GetRenderer()->GetScene());
+			FRenderManager::ExecuteOnRenderThread([this, &SceneFileNames]()
+			{
+				FRenderManager::GetRenderer()->SetScene(SceneFileNames[SelectedSceneIndex].GetString().GetData());
+			});
 			Init();
 			ImGui::CloseCurrentPopup();
 		}
@@ -346,8 +351,12 @@ void FOutlinerUI::RenderAddButton()
 
 			if (bIsModelSelected)
 			{
-				// Add selected model to scene.
-				TSharedPtr<FModel> Model = MakeShared<FModel>(ObjectName, ModelFileNames[SelectedAddIndex].GetString().GetData());
+				// Add selected model to scene. Loading the model creates GPU resources.
+				TSharedPtr<FModel> Model;
+				FRenderManager::ExecuteOnRenderThread([this, &Model, &ModelFileNames]()
+				{
+					Model = MakeShared<FModel>(ObjectName, ModelFileNames[SelectedAddIndex].GetString().GetData());
+				});
 				Scene->AddModel(Model);
 				Models.Add(Model);
 			}
@@ -420,12 +429,15 @@ void FOutlinerUI::RenderRemoveButton()
 	}
 	else if (ImGui::Button("Remove"))
 	{
-		if (GetSelectedSkybox())
+		// Objects with GPU resources are destroyed on the render thread.
+		if (TSharedPtr<FSkybox> SelectedSkybox = GetSelectedSkybox())
 		{
+			FRenderManager::BeginRelease(SelectedSkybox);
 			Scene->SetSkybox(nullptr);
 		}
 		else if (TSharedPtr<FModel> Model = GetSelectedModel())
 		{
+			FRenderManager::BeginRelease(Model);
 			Scene->RemoveModel(Model);
 			Models.RemoveFirst(Model);
 		}
@@ -1,6 +1,7 @@
 #include "SceneUI.h"
 #include "RenderManager.h"
 #include "HAL/PlatformTime.h"
+#include "Memory/MemoryManager.h"
 
 #include "imgui/imgui.h"
 
@@ -44,7 +45,12 @@ void FSceneUI::RenderScene()
 	{
 		Viewport.Width = SceneWindowDimensions.X;
 		Viewport.Height = SceneWindowDimensions.Y;
-		FRenderManager::GetRenderer()->SetViewport(Viewport);
+
+		// Resizing the viewport resizes the render target, which the frames in flight draw to.
+		FRenderManager::ExecuteOnRenderThread([&Viewport]()
+		{
+			FRenderManager::GetRenderer()->SetViewport(Viewport);
+		});
 	}
 
 	// Draw the output of the Renderer as an image in the Scene window.
@@ -89,8 +95,87 @@ void FSceneUI::RenderDebugInfo()
 	ImGui::Begin("Debug Info:", (bool*)true, ImGuiWindowFlags_AlwaysAutoResize);
 	ImGui::Text("FPS: %.1f", FramesPerSecond);
 
+	// Time each thread spent on the last frame, and waiting for the other thread.
+	FFrameTimings FrameTimings = FRenderManager::GetFrameTimings();
+	ImGui::Text("Game Thread: %.2f ms (waiting %.2f ms)", FrameTimings.GameThread, FrameTimings.GameThreadWait);
+	ImGui::Text("Render Thread: %.2f ms (waiting %.2f ms)", FrameTimings.RenderThread, FrameTimings.RenderThreadWait);
+	if (FRenderManager::IsRenderThreadRunning())
+	{
+		ImGui::Text("Frames In Flight: %d", FRenderManager::GetMaxFramesInFlight());
+	}
+
 	TSharedPtr<FCamera> Camera = FRenderManager::GetRenderer()->GetCamera();
 	ImGui::Text("Camera Position: (%.1f, %.1f, %.1f)", Camera->GetPosition().X, Camera->GetPosition().Y, Camera->GetPosition().Z);
 
+	// Frame memory high-water marks, in KB.
+	FFrameAllocator& FrameAllocator = FMemoryManager::Get().GetFrameAllocator();
+	ImGui::Text("Frame Memory: %.1f KB (peak %.1f KB of %.1f KB)",
+		FrameAllocator.GetLastFrameHighWaterMark() / 1024.0f,
+		FrameAllocator.GetPeakHighWaterMark() / 1024.0f,
+		FrameAllocator.GetFrameCapacity() / 1024.0f);
+
+#if MEMORY_TRACKING
+	RenderMemoryStats();
+#endif
+
 	ImGui::End();
 }
+
+#if MEMORY_TRACKING
+void FSceneUI::RenderMemoryStats()
+{
+	if (!ImGui::CollapsingHeader("Memory"))
+	{
+		return;
+	}
+
+	// Live, peak and total bytes in KB, and the number of live allocations.
+	auto StatsRow = [](const ANSICHAR* InName, const FMemoryStats& InStats)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(InName);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.1f", InStats.LiveBytes / 1024.0f);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.1f", InStats.PeakBytes / 1024.0f);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.1f", InStats.TotalBytes / 1024.0f);
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", InStats.NumLiveAllocations);
+	};
+	auto BeginStatsTable = [](const ANSICHAR* InId, const ANSICHAR* InNameHeader)
+	{
+		if (!ImGui::BeginTable(InId, 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+		{
+			return false;
+		}
+		ImGui::TableSetupColumn(InNameHeader);
+		ImGui::TableSetupColumn("Live KB");
+		ImGui::TableSetupColumn("Peak KB");
+		ImGui::TableSetupColumn("Total KB");
+		ImGui::TableSetupColumn("Allocations");
+		ImGui::TableHeadersRow();
+		return true;
+	};
+
+	FMemoryTracker& MemoryTracker = FMemoryTracker::Get();
+	if (BeginStatsTable("MemoryTags", "Tag"))
+	{
+		for (int32 Tag = 0; Tag < static_cast<int32>(EMemoryTag::Count); ++Tag)
+		{
+			StatsRow(GetMemoryTagName(static_cast<EMemoryTag>(Tag)), MemoryTracker.GetTagStats(static_cast<EMemoryTag>(Tag)));
+		}
+		ImGui::EndTable();
+	}
+
+	if (BeginStatsTable("MemoryAllocators", "Allocator"))
+	{
+		for (const FAllocatorMemoryStats& AllocatorStats : MemoryTracker.GetAllocatorStats())
+		{
+			StatsRow(AllocatorStats.Name, AllocatorStats.Stats);
+		}
+		ImGui::EndTable();
+	}
+}
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Memory/MemoryTracker.h"
 
 /**
  * The scene UI draws the current scene inside a window and draws debug information
@@ -39,4 +40,8 @@ private:
 
 	void RenderScene();
 	void RenderDebugInfo();
+#if MEMORY_TRACKING
+	// Draws the memory counters per tag and per allocator.
+	void RenderMemoryStats();
+#endif
 };
@@ -0,0 +1,98 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/AABB.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return FMath::IsApproximatelyEqual(InA.X, InB.X, 1.e-4f)
+		&& FMath::IsApproximatelyEqual(InA.Y, InB.Y, 1.e-4f)
+		&& FMath::IsApproximatelyEqual(InA.Z, InB.Z, 1.e-4f);
+}
+
+TEST_CASE("FAABB construction.")
+{
+	SECTION("Default boxes are empty")
+	{
+		FAABB Box;
+		REQUIRE(!Box.IsValid());
+		REQUIRE(!Box.Contains(FVector3D::Zero));
+
+		Box.ExpandToInclude(FVector3D(1.0f, 2.0f, 3.0f));
+		REQUIRE(Box.IsValid());
+		REQUIRE(Box.Min == FVector3D(1.0f, 2.0f, 3.0f));
+		REQUIRE(Box.Max == FVector3D(1.0f, 2.0f, 3.0f));
+	}
+
+	SECTION("From points")
+	{
+		FVector3D Points[] = { FVector3D(1.0f, -1.0f, 0.0f), FVector3D(-2.0f, 3.0f, 1.0f), FVector3D(0.0f, 0.0f, -4.0f) };
+		FAABB Box = FAABB::MakeFromPoints(Points, 3);
+		REQUIRE(Box.Min == FVector3D(-2.0f, -1.0f, -4.0f));
+		REQUIRE(Box.Max == FVector3D(1.0f, 3.0f, 1.0f));
+		REQUIRE(!FAABB::MakeFromPoints(Points, 0).IsValid());
+	}
+
+	SECTION("From center and extent")
+	{
+		FAABB Box = FAABB::MakeFromCenterAndExtent(FVector3D(1.0f, 2.0f, 3.0f), FVector3D(1.0f, 2.0f, 0.5f));
+		REQUIRE(Box == FAABB(FVector3D(0.0f, 0.0f, 2.5f), FVector3D(2.0f, 4.0f, 3.5f)));
+		REQUIRE(Box.GetCenter() == FVector3D(1.0f, 2.0f, 3.0f));
+		REQUIRE(Box.GetExtent() == FVector3D(1.0f, 2.0f, 0.5f));
+		REQUIRE(Box.GetSize() == FVector3D(2.0f, 4.0f, 1.0f));
+		REQUIRE(Box.GetSurfaceArea() == 2.0f * (8.0f + 4.0f + 2.0f));
+	}
+}
+
+TEST_CASE("FAABB queries.")
+{
+	FAABB Box(FVector3D(-1.0f, -1.0f, -1.0f), FVector3D(1.0f, 1.0f, 1.0f));
+
+	REQUIRE(Box.Contains(FVector3D::Zero));
+	REQUIRE(Box.Contains(FVector3D(1.0f, -1.0f, 1.0f)));
+	REQUIRE(!Box.Contains(FVector3D(1.1f, 0.0f, 0.0f)));
+	REQUIRE(Box.Contains(FAABB(FVector3D(0.0f, 0.0f, 0.0f), FVector3D(1.0f, 1.0f, 1.0f))));
+	REQUIRE(!Box.Contains(FAABB(FVector3D(0.0f, 0.0f, 0.0f), FVector3D(2.0f, 1.0f, 1.0f))));
+
+	REQUIRE(Box.Intersects(FAABB(FVector3D(0.5f, 0.5f, 0.5f), FVector3D(3.0f, 3.0f, 3.0f))));
+	REQUIRE(Box.Intersects(FAABB(FVector3D(1.0f, -5.0f, -5.0f), FVector3D(2.0f, 5.0f, 5.0f))));
+	REQUIRE(!Box.Intersects(FAABB(FVector3D(1.5f, 0.0f, 0.0f), FVector3D(2.0f, 1.0f, 1.0f))));
+
+	REQUIRE(Box.GetClosestPoint(FVector3D(3.0f, 0.5f, -2.0f)) == FVector3D(1.0f, 0.5f, -1.0f));
+	REQUIRE(Box.GetDistanceSquared(FVector3D(3.0f, 0.5f, -2.0f)) == 5.0f);
+	REQUIRE(Box.GetDistanceSquared(FVector3D(0.5f, 0.5f, 0.5f)) == 0.0f);
+}
+
+TEST_CASE("FAABB transform.")
+{
+	FAABB Box(FVector3D(0.0f, 0.0f, 0.0f), FVector3D(2.0f, 1.0f, 1.0f));
+
+	SECTION("Translation and scale are exact")
+	{
+		FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(1.0f, 2.0f, 3.0f)) * FTransform4D::MakeScale(FVector3D(2.0f, -1.0f, 1.0f));
+		FAABB Result = Box.GetTransformed(Transform);
+		REQUIRE(IsNearlyEqual(Result.Min, FVector3D(1.0f, 1.0f, 3.0f)));
+		REQUIRE(IsNearlyEqual(Result.Max, FVector3D(5.0f, 2.0f, 4.0f)));
+	}
+
+	SECTION("Rotations give the bounds of the rotated corners")
+	{
+		FTransform4D Transform = FTransform4D::MakeRotation(0.7f, FVector3D::Normalize(FVector3D(1.0f, 2.0f, 3.0f)));
+		FAABB Expected;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			FVector3D Point((Corner & 1) ? Box.Max.X : Box.Min.X, (Corner & 2) ? Box.Max.Y : Box.Min.Y, (Corner & 4) ? Box.Max.Z : Box.Min.Z);
+			Expected.ExpandToInclude(Transform * Point);
+		}
+
+		FAABB Result = Box.GetTransformed(Transform);
+		REQUIRE(IsNearlyEqual(Result.Min, Expected.Min));
+		REQUIRE(IsNearlyEqual(Result.Max, Expected.Max));
+	}
+
+	SECTION("Empty boxes stay empty")
+	{
+		REQUIRE(!FAABB().GetTransformed(FTransform4D::MakeTranslation(FVector3D::One)).IsValid());
+	}
+}
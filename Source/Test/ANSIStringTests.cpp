@@ -40,7 +40,7 @@ TEST_CASE("FANSIString constructor taking a C-style string.")
 		FANSIString String = "Hello";
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(String == "Hello");
 	}
 }
@@ -69,17 +69,38 @@ TEST_CASE("FANSIString copy constructor.")
 
 TEST_CASE("FANSIString move constructor.")
 {
-	FANSIString String1 = "Hello";
-	char* Data = String1.GetData();
-	int32 Size = String1.GetSize();
-	int32 Capacity = String1.GetCapacity();
-	IAllocator* Allocator = String1.GetAllocator();
-
-	FANSIString String2 = MoveTemp(String1);
-	REQUIRE(String2.GetData() == Data);
-	REQUIRE(String2.GetSize() == Size);
-	REQUIRE(String2.GetCapacity() == Capacity);
-	REQUIRE(String2.GetAllocator() == Allocator);
+	SECTION("Moving a heap-allocated string steals its data.")
+	{
+		FANSIString String1 = "The quick brown fox jumps over the lazy dog";
+		char* Data = String1.GetData();
+		int32 Size = String1.GetSize();
+		int32 Capacity = String1.GetCapacity();
+		IAllocator* Allocator = String1.GetAllocator();
+
+		FANSIString String2 = MoveTemp(String1);
+		REQUIRE(String2.GetData() == Data);
+		REQUIRE(String2.GetSize() == Size);
+		REQUIRE(String2.GetCapacity() == Capacity);
+		REQUIRE(String2.GetAllocator() == Allocator);
+
+		REQUIRE(String1.GetData() == nullptr);
+		REQUIRE(String1.GetSize() == 0);
+		REQUIRE(String1.GetCapacity() == 0);
+		REQUIRE(String1.GetAllocator() == nullptr);
+	}
+
+	SECTION("Moving an inline string copies its characters.")
+	{
+		FANSIString String1 = "Hello";
+		FANSIString String2 = MoveTemp(String1);
+		REQUIRE(String2.IsInline());
+		REQUIRE(String2.GetSize() == 5);
+		REQUIRE(String2 == "Hello");
+
+		REQUIRE(String1.GetData() == nullptr);
+		REQUIRE(String1.GetSize() == 0);
+		REQUIRE(String1.GetCapacity() == 0);
+	}
 }
 
 TEST_CASE("FANSIString copy assignment operator.")
@@ -90,7 +111,7 @@ TEST_CASE("FANSIString copy assignment operator.")
 		String = String;
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 	}
 
 	SECTION("Assigning to an empty string.")
@@ -100,7 +121,7 @@ TEST_CASE("FANSIString copy assignment operator.")
 		String1 = String2;
 		REQUIRE(String1.GetData() != nullptr);
 		REQUIRE(String1.GetSize() == 5);
-		REQUIRE(String1.GetCapacity() == 6);
+		REQUIRE(String1.GetCapacity() == FANSIString::InlineCapacity);
 	}
 
 	SECTION("Assigning to a non-empty string.")
@@ -112,14 +133,14 @@ TEST_CASE("FANSIString copy assignment operator.")
 		String1 = String2;
 		REQUIRE(String1.GetData() != nullptr);
 		REQUIRE(String1.GetSize() == 2);
-		REQUIRE(String1.GetCapacity() == 6);
+		REQUIRE(String1.GetCapacity() == FANSIString::InlineCapacity);
 
 		// Allocate more space if the Data array isn't large enough to store the input String1.
-		FANSIString String3 = "Hello, world!";
+		FANSIString String3 = "The quick brown fox jumps over the lazy dog";
 		String1 = String3;
 		REQUIRE(String1.GetData() != nullptr);
-		REQUIRE(String1.GetSize() == 13);
-		REQUIRE(String1.GetCapacity() == 14);
+		REQUIRE(String1.GetSize() == 43);
+		REQUIRE(String1.GetCapacity() == 44);
 	}
 }
 
@@ -131,7 +152,7 @@ TEST_CASE("FANSIString assignment operator taking a C-style string.")
 		String = "Hello";
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 	}
 
 	SECTION("Assigning to a non-empty string.")
@@ -142,13 +163,13 @@ TEST_CASE("FANSIString assignment operator taking a C-style string.")
 		String = "Hi";
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 2);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 
 		// Allocate more space if the Data array isn't large enough to store the input string.
-		String = "Hello, world!";
+		String = "The quick brown fox jumps over the lazy dog";
 		REQUIRE(String.GetData() != nullptr);
-		REQUIRE(String.GetSize() == 13);
-		REQUIRE(String.GetCapacity() == 14);
+		REQUIRE(String.GetSize() == 43);
+		REQUIRE(String.GetCapacity() == 44);
 	}
 }
 
@@ -160,13 +181,13 @@ TEST_CASE("FANSIString move assignment operator.")
 		String = MoveTemp(String);
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(String.GetAllocator() != nullptr);
 	}
 
 	SECTION("Assigning to an empty string.")
 	{
-		FANSIString String1 = "Hello";
+		FANSIString String1 = "The quick brown fox jumps over the lazy dog";
 		char* Data = String1.GetData();
 		int32 Size = String1.GetSize();
 		int32 Capacity = String1.GetCapacity();
@@ -188,7 +209,7 @@ TEST_CASE("FANSIString move assignment operator.")
 
 	SECTION("Assigning to a non-empty string.")
 	{
-		FANSIString String1 = "Hello";
+		FANSIString String1 = "The quick brown fox jumps over the lazy dog";
 		char* Data = String1.GetData();
 		int32 Size = String1.GetSize();
 		int32 Capacity = String1.GetCapacity();
@@ -217,7 +238,7 @@ TEST_CASE("FANSIString::Substring")
 		FANSIString Substring = String.Substring(-1, 5);
 		REQUIRE(Substring.GetData() != nullptr);
 		REQUIRE(Substring.GetSize() == 5);
-		REQUIRE(Substring.GetCapacity() == 6);
+		REQUIRE(Substring.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(Substring == String);
 	}
 
@@ -226,7 +247,7 @@ TEST_CASE("FANSIString::Substring")
 		FANSIString Substring = String.Substring(0, 6);
 		REQUIRE(Substring.GetData() != nullptr);
 		REQUIRE(Substring.GetSize() == 5);
-		REQUIRE(Substring.GetCapacity() == 6);
+		REQUIRE(Substring.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(Substring == String);
 	}
 
@@ -243,7 +264,7 @@ TEST_CASE("FANSIString::Substring")
 		FANSIString Substring = String.Substring(-1, 6);
 		REQUIRE(Substring.GetData() != nullptr);
 		REQUIRE(Substring.GetSize() == 5);
-		REQUIRE(Substring.GetCapacity() == 6);
+		REQUIRE(Substring.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(Substring == String);
 	}
 
@@ -260,7 +281,7 @@ TEST_CASE("FANSIString::Substring")
 		FANSIString Substring = String.Substring(1, 3);
 		REQUIRE(Substring.GetData() != nullptr);
 		REQUIRE(Substring.GetSize() == 2);
-		REQUIRE(Substring.GetCapacity() == 3);
+		REQUIRE(Substring.GetCapacity() == FANSIString::InlineCapacity);
 		REQUIRE(Substring == "el");
 	}
 }
@@ -290,7 +311,7 @@ TEST_CASE("FANSIString::Reserve")
 		String.Reserve(5);
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 0);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 	}
 
 	SECTION("Reserving space for a non-empty string.")
@@ -298,18 +319,63 @@ TEST_CASE("FANSIString::Reserve")
 		FANSIString String = "Hello";
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 
 		// Requested capacity (InCharacterCount + 1) is less than the current capacity: no-op.
 		String.Reserve(4);
 		REQUIRE(String.GetData() != nullptr);
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 6);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
 
-		// Requested capacity (InCharacterCount + 1) is greater than the current capacity: reserve additional space.
+		// Requested capacity (InCharacterCount + 1) still fits in the inline buffer: no-op.
 		String.Reserve(6);
-		REQUIRE(String.GetData() != nullptr);
+		REQUIRE(String.IsInline());
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity);
+
+		// Requested capacity (InCharacterCount + 1) is greater than the current capacity: reserve additional space.
+		String.Reserve(FANSIString::InlineCapacity);
+		REQUIRE(!String.IsInline());
 		REQUIRE(String.GetSize() == 5);
-		REQUIRE(String.GetCapacity() == 7);
+		REQUIRE(String.GetCapacity() == FANSIString::InlineCapacity + 1);
+		REQUIRE(String == "Hello");
+	}
+}
+
+TEST_CASE("FANSIString small-string storage.")
+{
+	SECTION("Strings that fit in the inline buffer don't allocate.")
+	{
+		FANSIString String = "Hello, world!";
+		const char* StringBegin = reinterpret_cast<const char*>(&String);
+		const char* StringEnd = StringBegin + sizeof(FANSIString);
+		REQUIRE(String.IsInline());
+		REQUIRE(String.GetData() >= StringBegin);
+		REQUIRE(String.GetData() < StringEnd);
 	}
+
+	SECTION("Strings that don't fit in the inline buffer are heap-allocated.")
+	{
+		FANSIString String = "The quick brown fox jumps over the lazy dog";
+		REQUIRE(!String.IsInline());
+		REQUIRE(String.GetCapacity() == 44);
+	}
+
+	SECTION("Copying an inline string keeps the copy inline.")
+	{
+		FANSIString String1 = "Hello";
+		FANSIString String2 = String1;
+		REQUIRE(String2.IsInline());
+		REQUIRE(String2.GetData() != String1.GetData());
+		REQUIRE(String2 == String1);
+	}
+}
+
+TEST_CASE("FANSIString constructor taking a string view.")
+{
+	const char* Text = "Hello, world!";
+	FANSIString String(FANSIStringView(Text, 5));
+	REQUIRE(String.GetSize() == 5);
+	REQUIRE(String == "Hello");
+	REQUIRE(String.GetData()[5] == '\0');
+	REQUIRE(String.GetView() == FANSIStringView("Hello"));
 }
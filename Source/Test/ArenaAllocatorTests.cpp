@@ -68,3 +68,62 @@ TEST_CASE("FArenaAllocator::Clear")
         REQUIRE(TestAllocator.Allocate(8) == MemoryStart);
     }
 }
+
+TEST_CASE("FArenaAllocator::RewindToMarker")
+{
+    const int32 BufferSize = 1024;
+    uint8 Buffer[BufferSize];
+    FArenaAllocator TestAllocator(&Buffer[0], BufferSize);
+
+    SECTION("Rewinding frees allocations made after the marker")
+    {
+        TestAllocator.Allocate(8);
+        FArenaAllocator::FMarker Marker = TestAllocator.GetMarker();
+        void* Temporary = TestAllocator.Allocate(16);
+        TestAllocator.Allocate(16);
+
+        TestAllocator.RewindToMarker(Marker);
+        REQUIRE(TestAllocator.GetNumBytesUsed() == 8);
+        REQUIRE(TestAllocator.Allocate(16) == Temporary);
+    }
+
+    SECTION("Scoped marks rewind when they go out of scope")
+    {
+        void* First = TestAllocator.Allocate(8);
+        {
+            FScopedArenaMark Mark(TestAllocator);
+            TestAllocator.Allocate(64);
+            {
+                FScopedArenaMark InnerMark(TestAllocator);
+                TestAllocator.Allocate(64);
+            }
+            REQUIRE(TestAllocator.GetNumBytesUsed() == 72);
+        }
+        REQUIRE(TestAllocator.GetNumBytesUsed() == 8);
+        REQUIRE(TestAllocator.Allocate(8) == (int8*)First + 8);
+    }
+
+#if ARENA_ALLOCATOR_POISON
+    SECTION("Rewound memory is poisoned")
+    {
+        FArenaAllocator::FMarker Marker = TestAllocator.GetMarker();
+        int32* Temporary = static_cast<int32*>(TestAllocator.Allocate(sizeof(int32)));
+        *Temporary = 0;
+        TestAllocator.RewindToMarker(Marker);
+        REQUIRE(reinterpret_cast<uint8*>(Temporary)[0] == FArenaAllocator::PoisonValue);
+    }
+#endif
+
+    SECTION("The high-water mark keeps the largest usage")
+    {
+        {
+            FScopedArenaMark Mark(TestAllocator);
+            TestAllocator.Allocate(512);
+        }
+        TestAllocator.Allocate(8);
+        REQUIRE(TestAllocator.GetHighWaterMark() == 512);
+
+        TestAllocator.ResetHighWaterMark();
+        REQUIRE(TestAllocator.GetHighWaterMark() == 8);
+    }
+}
@@ -1,5 +1,48 @@
 #include "catch/catch.hpp"
 #include "Containers/Array.h"
+#include "SmartPointers/SharedPtr.h"
+#include "Strings/StringId.h"
+#include "Strings/String.h"
+
+namespace
+{
+	// Counts how its instances are copied and moved.
+	struct FCopyCounter
+	{
+		FCopyCounter() = default;
+		FCopyCounter(const FCopyCounter& InOther)
+			: NumCopies(InOther.NumCopies + 1)
+			, NumMoves(InOther.NumMoves)
+		{
+		}
+		FCopyCounter(FCopyCounter&& InOther)
+			: NumCopies(InOther.NumCopies)
+			, NumMoves(InOther.NumMoves + 1)
+		{
+		}
+
+		int32 NumCopies = 0;
+		int32 NumMoves = 0;
+	};
+
+	// Points into itself, so it must be moved with its move constructor.
+	struct FSelfPointer
+	{
+		explicit FSelfPointer(int32 InValue)
+			: Value(InValue)
+			, Self(this)
+		{
+		}
+		FSelfPointer(const FSelfPointer& InOther)
+			: Value(InOther.Value)
+			, Self(this)
+		{
+		}
+
+		int32 Value;
+		FSelfPointer* Self;
+	};
+}
 
 TEST_CASE("TArray default constructor.")
 {
@@ -108,6 +151,91 @@ TEST_CASE("TArray::Emplace")
 	}
 }
 
+TEST_CASE("TArray::Emplace forwarding")
+{
+	SECTION("Arguments are forwarded to the constructor.")
+	{
+		TArray<FCopyCounter> Array;
+		Array.Reserve(4);
+
+		FCopyCounter Counter;
+		Array.Emplace(Counter);
+		Array.Emplace(MoveTemp(Counter));
+		Array.Add(FCopyCounter());
+
+		REQUIRE(Array[0].NumCopies == 1);
+		REQUIRE(Array[0].NumMoves == 0);
+		REQUIRE(Array[1].NumCopies == 0);
+		REQUIRE(Array[1].NumMoves == 1);
+		REQUIRE(Array[2].NumCopies == 0);
+		REQUIRE(Array[2].NumMoves == 1);
+	}
+
+	SECTION("Growing moves elements rather than copying them.")
+	{
+		TArray<FCopyCounter> Array;
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Array.Emplace();
+		}
+		for (const FCopyCounter& Counter : Array)
+		{
+			REQUIRE(Counter.NumCopies == 0);
+		}
+	}
+
+	SECTION("Arguments can refer to elements of the array while it grows.")
+	{
+		TArray<FANSIString> Array;
+		Array.Add("A string that doesn't fit inline");
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Array.Emplace(Array[0]);
+		}
+		for (const FANSIString& String : Array)
+		{
+			REQUIRE(String == "A string that doesn't fit inline");
+		}
+	}
+}
+
+TEST_CASE("TArray relocation")
+{
+	static_assert(TIsTriviallyRelocatable<int32>::Value, "Trivially copyable types are relocatable.");
+	static_assert(TIsTriviallyRelocatable<FStringId>::Value, "String IDs are relocatable.");
+	static_assert(TIsTriviallyRelocatable<TSharedPtr<int32>>::Value, "Shared pointers are relocatable.");
+	static_assert(TIsTriviallyRelocatable<TArray<int32>>::Value, "Arrays are relocatable.");
+	static_assert(!TIsTriviallyRelocatable<FSelfPointer>::Value, "Types with copy constructors aren't relocatable by default.");
+
+	SECTION("Relocatable elements keep their values.")
+	{
+		TArray<TSharedPtr<int32>> Array;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Array.Add(MakeShared<int32>(Index));
+		}
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			REQUIRE(*Array[Index] == Index);
+			REQUIRE(Array[Index].GetStrongRefCount() == 1);
+		}
+	}
+
+	SECTION("Other elements are moved with their constructors.")
+	{
+		TArray<FSelfPointer> Array;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Array.Emplace(Index);
+		}
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			REQUIRE(Array[Index].Value == Index);
+			REQUIRE(Array[Index].Self == &Array[Index]);
+		}
+	}
+}
+
 TEST_CASE("TArray::RemoveAt")
 {
 	TArray<int32> Array;
@@ -0,0 +1,58 @@
+#include "catch/catch.hpp"
+
+#include "Algorithms/BinarySearch.h"
+#include "Containers/Array.h"
+#include "Templates/Less.h"
+
+TEST_CASE("Algo binary searches")
+{
+	// 0, 2, 2, 2, 4, 6, ..., 98: every even number, with 2 three times.
+	TArray<int32> Array;
+	for (int32 Value = 0; Value < 100; Value += 2)
+	{
+		Array.Add(Value);
+		if (Value == 2)
+		{
+			Array.Add(2);
+			Array.Add(2);
+		}
+	}
+
+	SECTION("Lower and upper bounds.")
+	{
+		REQUIRE(Algo::LowerBound(Array, 2) == 1);
+		REQUIRE(Algo::UpperBound(Array, 2) == 4);
+		REQUIRE(Algo::LowerBound(Array, 3) == 4);
+		REQUIRE(Algo::UpperBound(Array, 3) == 4);
+		REQUIRE(Algo::LowerBound(Array, -1) == 0);
+		REQUIRE(Algo::UpperBound(Array, 98) == Array.GetSize());
+		REQUIRE(Algo::LowerBound(Array, 1000) == Array.GetSize());
+	}
+
+	SECTION("Binary search.")
+	{
+		REQUIRE(Algo::BinarySearch(Array, 0) == 0);
+		REQUIRE(Algo::BinarySearch(Array, 2) == 1);
+		REQUIRE(Algo::BinarySearch(Array, 50) == 27);
+		REQUIRE(Algo::BinarySearch(Array, 98) == Array.GetSize() - 1);
+		REQUIRE(Algo::BinarySearch(Array, 51) == InvalidIndex);
+		REQUIRE(Algo::BinarySearch(Array, -2) == InvalidIndex);
+		REQUIRE(Algo::BinarySearch(Array, 100) == InvalidIndex);
+
+		TArray<int32> Empty;
+		REQUIRE(Algo::BinarySearch(Empty, 0) == InvalidIndex);
+		REQUIRE(Algo::LowerBound(Empty, 0) == 0);
+	}
+
+	SECTION("Predicates.")
+	{
+		TArray<int32> Descending;
+		for (int32 Value = 10; Value > 0; --Value)
+		{
+			Descending.Add(Value);
+		}
+		REQUIRE(Algo::LowerBound(Descending, 7, TGreater<>()) == 3);
+		REQUIRE(Algo::BinarySearch(Descending, 1, TGreater<>()) == 9);
+		REQUIRE(Algo::BinarySearch(Descending, 11, TGreater<>()) == InvalidIndex);
+	}
+}
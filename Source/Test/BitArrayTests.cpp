@@ -0,0 +1,229 @@
+#include "catch/catch.hpp"
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Memory/ArenaAllocator.h"
+
+// System includes for memset.
+#include <cstring>
+
+namespace
+{
+	// Collects the indices visited by iterating over the set bits.
+	template<typename BitArrayType>
+	TArray<int32> GetSetBitIndices(const BitArrayType& InBitArray)
+	{
+		TArray<int32> Indices;
+		for (int32 BitIndex : InBitArray.GetSetBits())
+		{
+			Indices.Add(BitIndex);
+		}
+		return Indices;
+	}
+}
+
+TEST_CASE("FBitArray")
+{
+	FBitArray TestBitArray;
+
+	REQUIRE(TestBitArray.IsEmpty());
+	REQUIRE(TestBitArray.GetSize() == 0);
+	REQUIRE(TestBitArray.CountSetBits() == 0);
+	REQUIRE(TestBitArray.FindFirstSetBit() == InvalidIndex);
+	REQUIRE(GetSetBitIndices(TestBitArray).GetSize() == 0);
+
+	SECTION("Add, set and clear bits.")
+	{
+		for (int32 Index = 0; Index < 200; ++Index)
+		{
+			REQUIRE(TestBitArray.Add(Index % 3 == 0) == Index);
+		}
+
+		REQUIRE(TestBitArray.GetSize() == 200);
+		REQUIRE(TestBitArray.GetNumWords() == 4);
+		for (int32 Index = 0; Index < 200; ++Index)
+		{
+			REQUIRE(TestBitArray[Index] == (Index % 3 == 0));
+		}
+		REQUIRE(TestBitArray.CountSetBits() == 67);
+
+		TestBitArray.SetBit(1);
+		TestBitArray.ClearBit(0);
+		TestBitArray.SetBitValue(199, true);
+		REQUIRE(TestBitArray[1]);
+		REQUIRE(!TestBitArray[0]);
+		REQUIRE(TestBitArray[199]);
+		REQUIRE(TestBitArray.CountSetBits() == 68);
+	}
+
+	SECTION("Set ranges within and across words.")
+	{
+		TestBitArray.SetNum(300);
+		REQUIRE(TestBitArray.CountSetBits() == 0);
+
+		TestBitArray.SetRange(3, 10, true);
+		REQUIRE(TestBitArray.CountSetBits() == 10);
+		REQUIRE(TestBitArray.FindFirstSetBit() == 3);
+		REQUIRE(TestBitArray.FindFirstClearBit(3) == 13);
+
+		TestBitArray.SetRange(60, 200, true);
+		REQUIRE(TestBitArray.CountSetBits() == 210);
+		REQUIRE(!TestBitArray[59]);
+		REQUIRE(TestBitArray[60]);
+		REQUIRE(TestBitArray[259]);
+		REQUIRE(!TestBitArray[260]);
+
+		TestBitArray.SetRange(64, 128, false);
+		REQUIRE(TestBitArray.CountSetBits() == 82);
+		REQUIRE(TestBitArray.FindFirstSetBit(64) == 192);
+
+		TestBitArray.SetAll(true);
+		REQUIRE(TestBitArray.CountSetBits() == 300);
+		REQUIRE(TestBitArray.FindFirstClearBit() == InvalidIndex);
+	}
+
+	SECTION("Find and iterate over set bits.")
+	{
+		TestBitArray.SetNum(1000);
+		const int32 SetBits[] = { 0, 63, 64, 65, 500, 999 };
+		for (int32 BitIndex : SetBits)
+		{
+			TestBitArray.SetBit(BitIndex);
+		}
+
+		TArray<int32> Indices = GetSetBitIndices(TestBitArray);
+		REQUIRE(Indices.GetSize() == 6);
+		for (int32 Index = 0; Index < 6; ++Index)
+		{
+			REQUIRE(Indices[Index] == SetBits[Index]);
+		}
+
+		REQUIRE(TestBitArray.FindFirstSetBit(1) == 63);
+		REQUIRE(TestBitArray.FindFirstSetBit(66) == 500);
+		REQUIRE(TestBitArray.FindFirstSetBit(1000) == InvalidIndex);
+		REQUIRE(TestBitArray.FindFirstClearBit(63) == 66);
+	}
+
+	SECTION("Clear bits past the end are never found.")
+	{
+		TestBitArray.SetNum(70, true);
+		REQUIRE(TestBitArray.CountSetBits() == 70);
+		REQUIRE(TestBitArray.FindFirstClearBit() == InvalidIndex);
+
+		// Shrinking clears the removed bits, so growing again doesn't bring them back.
+		TestBitArray.SetNum(10);
+		TestBitArray.SetNum(100);
+		REQUIRE(TestBitArray.CountSetBits() == 10);
+		REQUIRE(TestBitArray.FindFirstSetBit(10) == InvalidIndex);
+		REQUIRE(TestBitArray.FindFirstClearBit() == 10);
+	}
+
+	SECTION("Bitwise operations.")
+	{
+		// Enough bits to go through SIMD registers and the scalar tail.
+		constexpr int32 NumBits = 1000;
+		FBitArray Multiples2(NumBits, false);
+		FBitArray Multiples3(NumBits, false);
+		for (int32 Index = 0; Index < NumBits; ++Index)
+		{
+			Multiples2.SetBitValue(Index, Index % 2 == 0);
+			Multiples3.SetBitValue(Index, Index % 3 == 0);
+		}
+
+		FBitArray And(Multiples2);
+		And.BitwiseAnd(Multiples3);
+		FBitArray Or(Multiples2);
+		Or.BitwiseOr(Multiples3);
+		FBitArray AndNot(Multiples2);
+		AndNot.BitwiseAndNot(Multiples3);
+
+		for (int32 Index = 0; Index < NumBits; ++Index)
+		{
+			REQUIRE(And[Index] == (Index % 6 == 0));
+			REQUIRE(Or[Index] == (Index % 2 == 0 || Index % 3 == 0));
+			REQUIRE(AndNot[Index] == (Index % 2 == 0 && Index % 3 != 0));
+		}
+	}
+
+	SECTION("Copy and move.")
+	{
+		TestBitArray.SetNum(130);
+		TestBitArray.SetBit(129);
+
+		FBitArray Copy(TestBitArray);
+		REQUIRE(Copy == TestBitArray);
+		Copy.ClearBit(129);
+		REQUIRE(Copy != TestBitArray);
+
+		FBitArray Moved(MoveTemp(Copy));
+		REQUIRE(Copy.IsEmpty());
+		REQUIRE(Moved.GetSize() == 130);
+
+		Moved = TestBitArray;
+		REQUIRE(Moved == TestBitArray);
+	}
+}
+
+TEST_CASE("FBitArray allocators")
+{
+	const int32 BufferSize = 1024;
+	uint8 Buffer[BufferSize];
+	FArenaAllocator ArenaAllocator(&Buffer[0], BufferSize);
+
+	SECTION("Bits are allocated from the given allocator.")
+	{
+		FBitArray ArenaBitArray(256, true, ArenaAllocator);
+		REQUIRE(ArenaAllocator.GetNumBytesUsed() >= 4 * sizeof(uint64));
+		REQUIRE(ArenaBitArray.CountSetBits() == 256);
+	}
+
+	SECTION("Moving between allocators copies the bits.")
+	{
+		FBitArray PoolBitArray;
+		{
+			FBitArray ArenaBitArray(100, true, ArenaAllocator);
+			PoolBitArray = MoveTemp(ArenaBitArray);
+			REQUIRE(ArenaBitArray.IsEmpty());
+		}
+		// Scribble over the arena, which must not hold the moved bits anymore.
+		ArenaAllocator.Clear();
+		memset(Buffer, 0, BufferSize);
+
+		REQUIRE(PoolBitArray.GetSize() == 100);
+		REQUIRE(PoolBitArray.CountSetBits() == 100);
+	}
+}
+
+TEST_CASE("TStaticBitArray")
+{
+	TStaticBitArray<100> TestBitArray;
+
+	static_assert(TStaticBitArray<100>::NumWords == 2, "100 bits should fit in 2 words.");
+	static_assert(TStaticBitArray<100>::GetSize() == 100, "The size should be known at compile time.");
+	REQUIRE(TestBitArray.CountSetBits() == 0);
+
+	TestBitArray.SetBit(5);
+	TestBitArray.SetRange(60, 10, true);
+	REQUIRE(TestBitArray.CountSetBits() == 11);
+	REQUIRE(TestBitArray.FindFirstSetBit(6) == 60);
+	REQUIRE(TestBitArray.FindFirstClearBit(60) == 70);
+
+	TArray<int32> Indices = GetSetBitIndices(TestBitArray);
+	REQUIRE(Indices.GetSize() == 11);
+	REQUIRE(Indices[0] == 5);
+	REQUIRE(Indices[10] == 69);
+
+	TStaticBitArray<100> Other;
+	Other.SetRange(0, 64, true);
+	TStaticBitArray<100> And = TestBitArray;
+	And.BitwiseAnd(Other);
+	REQUIRE(And.CountSetBits() == 5);
+	TestBitArray.BitwiseAndNot(Other);
+	REQUIRE(TestBitArray.CountSetBits() == 6);
+	TestBitArray.BitwiseOr(Other);
+	REQUIRE(TestBitArray.CountSetBits() == 70);
+
+	TestBitArray.SetAll(true);
+	REQUIRE(TestBitArray.CountSetBits() == 100);
+	REQUIRE(TestBitArray.FindFirstClearBit() == InvalidIndex);
+}
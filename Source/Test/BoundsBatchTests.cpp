@@ -0,0 +1,167 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/BoundsBatch.h"
+#include "Math/Matrix4D.h"
+#include "Math/Vector4D.h"
+#include "Math/MathUtilities.h"
+#include "Containers/Array.h"
+
+#include <random>
+
+// Not a multiple of the lane count, so that the remainder loops are covered as well.
+static constexpr int32 NumBatchShapes = 37;
+
+static bool IsNearlyEqual(float InA, float InB)
+{
+	float Tolerance = 1.e-4f * FMath::Max(1.0f, FMath::Max(FMath::Abs(InA), FMath::Abs(InB)));
+	return FMath::Abs(InA - InB) <= Tolerance;
+}
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return IsNearlyEqual(InA.X, InB.X) && IsNearlyEqual(InA.Y, InB.Y) && IsNearlyEqual(InA.Z, InB.Z);
+}
+
+// Random boxes and spheres around a frustum looking down -Z, so that some are inside, some outside, and some straddle it.
+struct FBatchShapes
+{
+	FBatchShapes()
+	{
+		std::mt19937 Generator(12345);
+		std::uniform_real_distribution<float> Position(-40.0f, 40.0f);
+		std::uniform_real_distribution<float> Depth(-120.0f, 20.0f);
+		std::uniform_real_distribution<float> Size(0.1f, 8.0f);
+		for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+		{
+			FVector3D Center(Position(Generator), Position(Generator), Depth(Generator));
+			Boxes.Add(FAABB::MakeFromCenterAndExtent(Center, FVector3D(Size(Generator), Size(Generator), Size(Generator))));
+			Spheres.Add(FSphere(Center, Size(Generator)));
+		}
+		// Empty boxes must be handled too.
+		Boxes[5] = FAABB();
+
+		// 90 degree field of view, near and far planes at 1 and 100.
+		FMatrix4D Projection;
+		Projection[0][0] = 1.0f;
+		Projection[1][1] = 1.0f;
+		Projection[2][2] = -101.0f / 99.0f;
+		Projection[2][3] = -1.0f;
+		Projection[3][2] = -200.0f / 99.0f;
+		Frustum = FFrustumPlanes::MakeFromViewProjection(Projection);
+	}
+
+	TArray<FAABB> Boxes;
+	TArray<FSphere> Spheres;
+	FFrustumPlanes Frustum;
+};
+
+TEST_CASE("FBoundsBatch culling.")
+{
+	FBatchShapes Shapes;
+	bool Visible[NumBatchShapes];
+
+	SECTION("Boxes")
+	{
+		int32 NumVisible = FBoundsBatch::CullAABBs(Shapes.Frustum, Shapes.Boxes.GetData(), Visible, NumBatchShapes);
+		int32 ExpectedNumVisible = 0;
+		for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+		{
+			bool bExpected = Shapes.Frustum.Intersects(Shapes.Boxes[Index]);
+			REQUIRE(Visible[Index] == bExpected);
+			ExpectedNumVisible += bExpected ? 1 : 0;
+		}
+		REQUIRE(NumVisible == ExpectedNumVisible);
+		// The shapes should cover both outcomes for the test to mean anything.
+		REQUIRE(NumVisible > 0);
+		REQUIRE(NumVisible < NumBatchShapes);
+	}
+
+	SECTION("Spheres")
+	{
+		int32 NumVisible = FBoundsBatch::CullSpheres(Shapes.Frustum, Shapes.Spheres.GetData(), Visible, NumBatchShapes);
+		int32 ExpectedNumVisible = 0;
+		for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+		{
+			bool bExpected = Shapes.Frustum.Intersects(Shapes.Spheres[Index]);
+			REQUIRE(Visible[Index] == bExpected);
+			ExpectedNumVisible += bExpected ? 1 : 0;
+		}
+		REQUIRE(NumVisible == ExpectedNumVisible);
+		REQUIRE(NumVisible > 0);
+		REQUIRE(NumVisible < NumBatchShapes);
+	}
+}
+
+TEST_CASE("FBoundsBatch raycasts.")
+{
+	FBatchShapes Shapes;
+	float Distances[NumBatchShapes];
+	const float Miss = FMath::MaxFloat;
+
+	// Rays from the camera into the scene, including ones along an axis (with zero direction components).
+	const FVector3D Directions[] = {
+		-FVector3D::ZAxis,
+		FVector3D::Normalize(FVector3D(0.2f, -0.1f, -1.0f)),
+		FVector3D::Normalize(FVector3D(-0.3f, 0.3f, -1.0f)),
+		FVector3D::XAxis,
+	};
+	for (const FVector3D& Direction : Directions)
+	{
+		FRay Ray(FVector3D(0.5f, 0.25f, 0.0f), Direction);
+		int32 ClosestIndex = FBoundsBatch::RaycastAABBs(Ray, Shapes.Boxes.GetData(), Distances, NumBatchShapes);
+
+		int32 ExpectedClosestIndex = InvalidIndex;
+		float ClosestDistance = FMath::MaxFloat;
+		for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+		{
+			float Distance;
+			if (Ray.Intersects(Shapes.Boxes[Index], Distance))
+			{
+				REQUIRE(IsNearlyEqual(Distances[Index], Distance));
+				if (Distance < ClosestDistance)
+				{
+					ExpectedClosestIndex = Index;
+					ClosestDistance = Distance;
+				}
+			}
+			else
+			{
+				REQUIRE(Distances[Index] == Miss);
+			}
+		}
+		REQUIRE(ClosestIndex == ExpectedClosestIndex);
+	}
+
+	// Nothing behind the camera.
+	FRay Backwards(FVector3D(0.0f, 0.0f, 1000.0f), FVector3D::ZAxis);
+	REQUIRE(FBoundsBatch::RaycastAABBs(Backwards, Shapes.Boxes.GetData(), Distances, NumBatchShapes) == InvalidIndex);
+}
+
+TEST_CASE("FBoundsBatch box transforms.")
+{
+	FBatchShapes Shapes;
+	FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(1.0f, -2.0f, 3.0f)) * FTransform4D::MakeRotation(0.8f, FVector3D::Normalize(FVector3D(1.0f, 1.0f, 0.5f))) * FTransform4D::MakeScale(FVector3D(1.0f, 2.0f, 0.5f));
+
+	FAABB Results[NumBatchShapes];
+	FBoundsBatch::TransformAABBs(Transform, Shapes.Boxes.GetData(), Results, NumBatchShapes);
+	for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+	{
+		FAABB Expected = Shapes.Boxes[Index].GetTransformed(Transform);
+		if (Expected.IsValid())
+		{
+			REQUIRE(IsNearlyEqual(Results[Index].Min, Expected.Min));
+			REQUIRE(IsNearlyEqual(Results[Index].Max, Expected.Max));
+		}
+		else
+		{
+			REQUIRE(Results[Index] == Expected);
+		}
+	}
+
+	// In place.
+	FBoundsBatch::TransformAABBs(Transform, Shapes.Boxes.GetData(), Shapes.Boxes.GetData(), NumBatchShapes);
+	for (int32 Index = 0; Index < NumBatchShapes; ++Index)
+	{
+		REQUIRE(Shapes.Boxes[Index] == Results[Index]);
+	}
+}
@@ -0,0 +1,206 @@
+#include "catch/catch.hpp"
+
+#include "Containers/ConcurrentMap.h"
+#include "SmartPointers/SharedPtr.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("TConcurrentMap")
+{
+	TConcurrentMap<int32, int32> Map;
+	REQUIRE(Map.IsEmpty());
+
+	SECTION("Add keeps the first value.")
+	{
+		REQUIRE(Map.Add(1, 10));
+		REQUIRE(!Map.Add(1, 11));
+		int32 Value = 0;
+		REQUIRE(Map.Find(1, Value));
+		REQUIRE(Value == 10);
+		REQUIRE(Map.GetSize() == 1);
+		REQUIRE(!Map.Find(2, Value));
+	}
+
+	SECTION("AddOrReplace replaces the value.")
+	{
+		REQUIRE(Map.AddOrReplace(1, 10));
+		REQUIRE(!Map.AddOrReplace(1, 11));
+		int32 Value = 0;
+		REQUIRE(Map.Find(1, Value));
+		REQUIRE(Value == 11);
+		REQUIRE(Map.GetSize() == 1);
+	}
+
+	SECTION("Remove.")
+	{
+		Map.Add(1, 10);
+		Map.Add(2, 20);
+		REQUIRE(Map.Remove(1));
+		REQUIRE(!Map.Remove(1));
+		REQUIRE(!Map.IsKeyContained(1));
+		REQUIRE(Map.IsKeyContained(2));
+		REQUIRE(Map.GetSize() == 1);
+	}
+
+	SECTION("Shards grow as pairs are added.")
+	{
+		const int32 NumPairs = 10000;
+		for (int32 Key = 0; Key < NumPairs; ++Key)
+		{
+			REQUIRE(Map.Add(Key, Key * 3));
+		}
+		REQUIRE(Map.GetSize() == NumPairs);
+
+		int32 NumMismatches = 0;
+		for (int32 Key = 0; Key < NumPairs; ++Key)
+		{
+			int32 Value = -1;
+			NumMismatches += Map.Find(Key, Value) && Value == Key * 3 ? 0 : 1;
+		}
+		REQUIRE(NumMismatches == 0);
+
+		for (int32 Key = 0; Key < NumPairs; Key += 2)
+		{
+			REQUIRE(Map.Remove(Key));
+		}
+		REQUIRE(Map.GetSize() == NumPairs / 2);
+		for (int32 Key = 0; Key < NumPairs; ++Key)
+		{
+			NumMismatches += Map.IsKeyContained(Key) == (Key % 2 == 1) ? 0 : 1;
+		}
+		REQUIRE(NumMismatches == 0);
+
+		Map.Empty();
+		REQUIRE(Map.IsEmpty());
+		REQUIRE(!Map.IsKeyContained(1));
+		REQUIRE(Map.Add(1, 1));
+	}
+
+	SECTION("Slots of removed pairs are reused.")
+	{
+		// Adding and removing keeps filling slots with removed pair markers, which rebuilding the tables drops.
+		const int32 NumPairs = 100;
+		for (int32 Key = 0; Key < NumPairs; ++Key)
+		{
+			Map.Add(Key, Key);
+		}
+		int32 NumMismatches = 0;
+		for (int32 Round = 0; Round < 100; ++Round)
+		{
+			for (int32 Key = NumPairs; Key < NumPairs * 2; ++Key)
+			{
+				NumMismatches += Map.Add(Key, Round) ? 0 : 1;
+			}
+			for (int32 Key = NumPairs; Key < NumPairs * 2; ++Key)
+			{
+				NumMismatches += Map.Remove(Key) ? 0 : 1;
+			}
+			for (int32 Key = 0; Key < NumPairs; ++Key)
+			{
+				int32 Value = -1;
+				NumMismatches += Map.Find(Key, Value) && Value == Key ? 0 : 1;
+			}
+		}
+		REQUIRE(NumMismatches == 0);
+		REQUIRE(Map.GetSize() == NumPairs);
+		REQUIRE(!Map.IsKeyContained(NumPairs));
+	}
+}
+
+TEST_CASE("TConcurrentMap value lifetime")
+{
+	TSharedPtr<int32> Shared = MakeShared<int32>(7);
+	{
+		TConcurrentMap<int32, TSharedPtr<int32>> Map;
+		for (int32 Key = 0; Key < 100; ++Key)
+		{
+			Map.Add(Key, Shared);
+		}
+		Map.AddOrReplace(0, TSharedPtr<int32>());
+		Map.Remove(1);
+
+		TSharedPtr<int32> Value;
+		REQUIRE(Map.Find(2, Value));
+		REQUIRE(*Value == 7);
+	}
+	// The map and the epoch manager destroyed every copy, including those of replaced, removed and regrown pairs.
+	REQUIRE(Shared.GetStrongRefCount() == 1);
+}
+
+TEST_CASE("TConcurrentMap concurrent readers and writers")
+{
+	// Readers look up pairs while writers add, replace and remove others, and force the shards to grow.
+	const int32 NumStablePairs = 1000;
+	const int32 NumWriters = 2;
+	const int32 NumReaders = 4;
+	const int32 NumWritesPerWriter = 20000;
+	TConcurrentMap<int32, int64> Map;
+	for (int32 Key = 0; Key < NumStablePairs; ++Key)
+	{
+		Map.Add(Key, static_cast<int64>(Key) * 2);
+	}
+
+	std::atomic<int32> NumWritersDone{ 0 };
+	std::vector<std::thread> Threads;
+	for (int32 WriterIndex = 0; WriterIndex < NumWriters; ++WriterIndex)
+	{
+		Threads.emplace_back([&, WriterIndex]()
+		{
+			// Each writer owns its own range of keys, and values are always the key times 2 plus 0 or 1.
+			const int32 FirstKey = NumStablePairs + WriterIndex * NumWritesPerWriter;
+			for (int32 Index = 0; Index < NumWritesPerWriter; ++Index)
+			{
+				const int32 Key = FirstKey + Index;
+				Map.Add(Key, static_cast<int64>(Key) * 2);
+				Map.AddOrReplace(Key, static_cast<int64>(Key) * 2 + 1);
+				if (Index % 3 == 0)
+				{
+					Map.Remove(Key);
+				}
+				// Replacing stable pairs keeps readers of them walking over retired nodes.
+				Map.AddOrReplace(Index % NumStablePairs, static_cast<int64>(Index % NumStablePairs) * 2 + (Index & 1));
+			}
+			NumWritersDone.fetch_add(1);
+		});
+	}
+
+	std::vector<int32> NumErrors(NumReaders, 0);
+	for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ++ReaderIndex)
+	{
+		Threads.emplace_back([&, ReaderIndex]()
+		{
+			uint32 Random = ReaderIndex + 1;
+			while (NumWritersDone.load() < NumWriters)
+			{
+				Random = Random * 1664525u + 1013904223u;
+				const int32 Key = static_cast<int32>(Random % (NumStablePairs + NumWriters * NumWritesPerWriter));
+				int64 Value = -1;
+				const bool bFound = Map.Find(Key, Value);
+				if ((Key < NumStablePairs && !bFound) || (bFound && Value / 2 != Key))
+				{
+					++NumErrors[ReaderIndex];
+				}
+			}
+		});
+	}
+
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ++ReaderIndex)
+	{
+		REQUIRE(NumErrors[ReaderIndex] == 0);
+	}
+	// Every third written key was removed.
+	const int32 NumRemovedPerWriter = (NumWritesPerWriter + 2) / 3;
+	REQUIRE(Map.GetSize() == NumStablePairs + NumWriters * (NumWritesPerWriter - NumRemovedPerWriter));
+	for (int32 Key = NumStablePairs; Key < NumStablePairs + 10; ++Key)
+	{
+		int64 Value = -1;
+		REQUIRE(Map.Find(Key, Value) == ((Key - NumStablePairs) % 3 != 0));
+	}
+}
@@ -0,0 +1,625 @@
+#include "catch/catch.hpp"
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/ConcurrentMap.h"
+#include "Containers/InlineArray.h"
+#include "Containers/Map.h"
+#include "Containers/MPMCQueue.h"
+#include "Containers/SlotMap.h"
+#include "Containers/SortedMap.h"
+#include "Containers/SPSCQueue.h"
+#include "Algorithms/BinarySearch.h"
+#include "Algorithms/Sort.h"
+#include "SmartPointers/SharedPtr.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector2D.h"
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Throughput of the engine containers compared to the standard library.
+ * Benchmarks are hidden from the default test run; run them with: Test "[Benchmark]"
+ *
+ * The push benchmarks grow arrays one element at a time without reserving, like loaders that don't know
+ * how many elements they will read, so that growth dominates. The small array benchmarks build many
+ * arrays of a few elements, like the faces of a mesh. The lookup benchmarks find resources by handle and by
+ * key, like the renderer's registries. The bit array benchmarks visit the few set flags of a large set of flags,
+ * like the visible objects of a scene.
+ * The sorted map benchmarks add, find and iterate random keys, like timelines or spatial indices keyed by position.
+ * The queue benchmarks pass integers between threads, like workers handing results to the main thread.
+ * The concurrent map benchmarks look up keys from several threads while another thread adds and removes keys,
+ * like the render path reading registries while loaders publish assets.
+ */
+
+namespace
+{
+	// Number of elements pushed per benchmark.
+	constexpr int32 NumPushedElements = 1000000;
+	// Number of small arrays built per benchmark, and elements per array.
+	constexpr int32 NumSmallArrays = 100000;
+	constexpr int32 SmallArraySize = 3;
+	// Number of elements looked up per benchmark.
+	constexpr int32 NumLookedUpElements = 100000;
+	// Number of bits per bit array benchmark, and distance between set bits.
+	constexpr int32 NumBenchmarkBits = 1 << 20;
+	constexpr int32 SetBitStride = 1000;
+	// Number of keys per sorted map benchmark.
+	constexpr int32 NumSortedKeys = 100000;
+	// Number of elements passed through the queues per benchmark, and queue capacity.
+	constexpr int32 NumQueuedElements = 1000000;
+	constexpr int32 BenchmarkQueueCapacity = 1024;
+	// Number of keys in the concurrent map benchmarks, and lookups per reader thread.
+	constexpr int32 NumSharedMapKeys = 10000;
+	constexpr int32 NumSharedMapLookups = 1000000;
+
+	// Queue protected by a lock, as the baseline for the lock-free queues.
+	class FLockedBenchmarkQueue
+	{
+	public:
+		bool Enqueue(int32 InElement)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (static_cast<int32>(Elements.size()) == BenchmarkQueueCapacity)
+			{
+				return false;
+			}
+			Elements.push_back(InElement);
+			return true;
+		}
+
+		bool Dequeue(int32& OutElement)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (Elements.empty())
+			{
+				return false;
+			}
+			OutElement = Elements.front();
+			Elements.pop_front();
+			return true;
+		}
+
+	private:
+		std::mutex Mutex;
+		std::deque<int32> Elements;
+	};
+
+	/**
+	 * Passes NumQueuedElements through a queue, split between producer and consumer threads.
+	 * Returns the sum of the dequeued elements.
+	 */
+	template<typename QueueType>
+	int64 PassThroughQueue(QueueType& InQueue, int32 InNumProducers, int32 InNumConsumers)
+	{
+		const int32 NumElementsPerProducer = NumQueuedElements / InNumProducers;
+		std::atomic<int32> NumRemaining{ NumElementsPerProducer * InNumProducers };
+		std::atomic<int64> Sum{ 0 };
+
+		std::vector<std::thread> Threads;
+		for (int32 ProducerIndex = 0; ProducerIndex < InNumProducers; ++ProducerIndex)
+		{
+			Threads.emplace_back([&InQueue, NumElementsPerProducer]()
+			{
+				for (int32 Index = 0; Index < NumElementsPerProducer; ++Index)
+				{
+					while (!InQueue.Enqueue(Index))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+		for (int32 ConsumerIndex = 0; ConsumerIndex < InNumConsumers; ++ConsumerIndex)
+		{
+			Threads.emplace_back([&InQueue, &NumRemaining, &Sum]()
+			{
+				int64 ConsumerSum = 0;
+				while (NumRemaining.load(std::memory_order_relaxed) > 0)
+				{
+					int32 Element;
+					if (InQueue.Dequeue(Element))
+					{
+						ConsumerSum += Element;
+						NumRemaining.fetch_sub(1, std::memory_order_relaxed);
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+				Sum += ConsumerSum;
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return Sum.load();
+	}
+
+	// Map protected by a readers-writer lock, as the baseline for the concurrent map.
+	class FLockedBenchmarkMap
+	{
+	public:
+		bool Find(int32 InKey, int32& OutValue) const
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			if (const int32* Value = Map.Find(InKey))
+			{
+				OutValue = *Value;
+				return true;
+			}
+			return false;
+		}
+
+		void AddOrReplace(int32 InKey, int32 InValue)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Mutex);
+			Map.Remove(InKey);
+			Map.Add(InKey, InValue);
+		}
+
+		void Remove(int32 InKey)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Mutex);
+			Map.Remove(InKey);
+		}
+
+	private:
+		mutable std::shared_mutex Mutex;
+		TMap<int32, int32> Map;
+	};
+
+	/**
+	 * Looks up NumSharedMapLookups random keys from each reader thread, optionally while a writer thread keeps
+	 * adding and removing keys of its own. Returns the sum of the values found.
+	 */
+	template<typename MapType>
+	int64 ReadSharedMap(MapType& InMap, int32 InNumReaders, bool bWithWriter)
+	{
+		std::atomic<int32> NumReadersDone{ 0 };
+		std::atomic<int64> Sum{ 0 };
+
+		std::vector<std::thread> Threads;
+		if (bWithWriter)
+		{
+			Threads.emplace_back([&InMap, &NumReadersDone, InNumReaders]()
+			{
+				for (int32 Index = 0; NumReadersDone.load(std::memory_order_relaxed) < InNumReaders; ++Index)
+				{
+					const int32 Key = NumSharedMapKeys + Index % NumSharedMapKeys;
+					InMap.AddOrReplace(Key, Index);
+					if (Index % 2 == 0)
+					{
+						InMap.Remove(Key);
+					}
+				}
+			});
+		}
+		for (int32 ReaderIndex = 0; ReaderIndex < InNumReaders; ++ReaderIndex)
+		{
+			Threads.emplace_back([&InMap, &NumReadersDone, &Sum, ReaderIndex]()
+			{
+				std::mt19937 Generator(ReaderIndex);
+				std::uniform_int_distribution<int32> Distribution(0, NumSharedMapKeys - 1);
+				int64 ReaderSum = 0;
+				for (int32 Index = 0; Index < NumSharedMapLookups; ++Index)
+				{
+					int32 Value = 0;
+					if (InMap.Find(Distribution(Generator), Value))
+					{
+						ReaderSum += Value;
+					}
+				}
+				Sum += ReaderSum;
+				NumReadersDone.fetch_add(1, std::memory_order_relaxed);
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return Sum.load();
+	}
+
+	template<typename MapType>
+	void FillSharedMap(MapType& InMap)
+	{
+		for (int32 Key = 0; Key < NumSharedMapKeys; ++Key)
+		{
+			InMap.AddOrReplace(Key, Key);
+		}
+	}
+
+	// Same layout as the renderer's vertices, without depending on the renderer.
+	struct FBenchmarkVertex
+	{
+		FVector3D Position;
+		FVector3D Normal;
+		FVector2D TextureCoordinates;
+	};
+
+	FBenchmarkVertex MakeBenchmarkVertex(int32 InIndex)
+	{
+		float Value = static_cast<float>(InIndex);
+		return { FVector3D(Value, 1.0f, 2.0f), FVector3D(0.0f, 1.0f, 0.0f), FVector2D(Value, 0.5f) };
+	}
+}
+
+TEST_CASE("Array push benchmarks.", "[.][Benchmark]")
+{
+	const TSharedPtr<int32> SharedObject = MakeShared<int32>(1);
+
+	BENCHMARK("TArray<int32>::Add")
+	{
+		TArray<int32> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.Add(Index);
+		}
+	}
+
+	BENCHMARK("std::vector<int32>::push_back")
+	{
+		std::vector<int32> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.push_back(Index);
+		}
+	}
+
+	BENCHMARK("TArray<FBenchmarkVertex>::Add")
+	{
+		TArray<FBenchmarkVertex> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.Add(MakeBenchmarkVertex(Index));
+		}
+	}
+
+	BENCHMARK("std::vector<FBenchmarkVertex>::push_back")
+	{
+		std::vector<FBenchmarkVertex> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.push_back(MakeBenchmarkVertex(Index));
+		}
+	}
+
+	// Shared pointers are relocated with a memcpy, where std::vector copies or moves them one by one.
+	BENCHMARK("TArray<TSharedPtr<int32>>::Add")
+	{
+		TArray<TSharedPtr<int32>> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.Add(SharedObject);
+		}
+	}
+
+	BENCHMARK("std::vector<TSharedPtr<int32>>::push_back")
+	{
+		std::vector<TSharedPtr<int32>> Array;
+		for (int32 Index = 0; Index < NumPushedElements; ++Index)
+		{
+			Array.push_back(SharedObject);
+		}
+	}
+}
+
+TEST_CASE("Small array benchmarks.", "[.][Benchmark]")
+{
+	int32 Sum = 0;
+
+	BENCHMARK("TArray<int32>, 3 elements")
+	{
+		for (int32 ArrayIndex = 0; ArrayIndex < NumSmallArrays; ++ArrayIndex)
+		{
+			TArray<int32> Array;
+			for (int32 Index = 0; Index < SmallArraySize; ++Index)
+			{
+				Array.Add(ArrayIndex + Index);
+			}
+			Sum += Array[SmallArraySize - 1];
+		}
+	}
+
+	BENCHMARK("TInlineArray<int32, 4>, 3 elements")
+	{
+		for (int32 ArrayIndex = 0; ArrayIndex < NumSmallArrays; ++ArrayIndex)
+		{
+			TInlineArray<int32, 4> Array;
+			for (int32 Index = 0; Index < SmallArraySize; ++Index)
+			{
+				Array.Add(ArrayIndex + Index);
+			}
+			Sum += Array[SmallArraySize - 1];
+		}
+	}
+
+	BENCHMARK("std::vector<int32>, 3 elements")
+	{
+		for (int32 ArrayIndex = 0; ArrayIndex < NumSmallArrays; ++ArrayIndex)
+		{
+			std::vector<int32> Array;
+			for (int32 Index = 0; Index < SmallArraySize; ++Index)
+			{
+				Array.push_back(ArrayIndex + Index);
+			}
+			Sum += Array[SmallArraySize - 1];
+		}
+	}
+
+	// Keeps the arrays from being optimized away.
+	REQUIRE(Sum != 0);
+}
+
+TEST_CASE("Lookup benchmarks.", "[.][Benchmark]")
+{
+	TSlotMap<int32> SlotMap;
+	TArray<TSlotMapHandle<int32>> Handles;
+	TMap<int32, int32> Map;
+	for (int32 Index = 0; Index < NumLookedUpElements; ++Index)
+	{
+		Handles.Add(SlotMap.Add(Index));
+		Map.Add(Index, Index);
+	}
+
+	int64 Sum = 0;
+
+	BENCHMARK("TSlotMap<int32>::Find")
+	{
+		for (const TSlotMapHandle<int32>& Handle : Handles)
+		{
+			Sum += *SlotMap.Find(Handle);
+		}
+	}
+
+	BENCHMARK("TMap<int32, int32>::Find")
+	{
+		for (int32 Index = 0; Index < NumLookedUpElements; ++Index)
+		{
+			Sum += *Map.Find(Index);
+		}
+	}
+
+	// Keeps the lookups from being optimized away.
+	REQUIRE(Sum != 0);
+}
+
+TEST_CASE("Bit array benchmarks.", "[.][Benchmark]")
+{
+	FBitArray BitArray(NumBenchmarkBits, false);
+	TArray<bool> BoolArray(NumBenchmarkBits);
+	for (int32 Index = 0; Index < NumBenchmarkBits; ++Index)
+	{
+		BoolArray.Add(false);
+	}
+	for (int32 Index = 0; Index < NumBenchmarkBits; Index += SetBitStride)
+	{
+		BitArray.SetBit(Index);
+		BoolArray[Index] = true;
+	}
+
+	int64 Sum = 0;
+
+	BENCHMARK("TArray<bool> iteration")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkBits; ++Index)
+		{
+			if (BoolArray[Index])
+			{
+				Sum += Index;
+			}
+		}
+	}
+
+	BENCHMARK("FBitArray iteration by bit")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkBits; ++Index)
+		{
+			if (BitArray[Index])
+			{
+				Sum += Index;
+			}
+		}
+	}
+
+	BENCHMARK("FBitArray iteration by set bit")
+	{
+		for (int32 Index : BitArray.GetSetBits())
+		{
+			Sum += Index;
+		}
+	}
+
+	BENCHMARK("FBitArray::CountSetBits")
+	{
+		Sum += BitArray.CountSetBits();
+	}
+
+	// Keeps the iterations from being optimized away.
+	REQUIRE(Sum != 0);
+}
+
+TEST_CASE("Sorted map benchmarks.", "[.][Benchmark]")
+{
+	std::mt19937 Generator(1234);
+	TArray<int32> Keys(NumSortedKeys);
+	for (int32 Index = 0; Index < NumSortedKeys; ++Index)
+	{
+		Keys.Add(static_cast<int32>(Generator() >> 1));
+	}
+
+	TArray<int32> SortedKeys(Keys);
+	Algo::Sort(SortedKeys);
+	TArray<TPair<int32, int32>> SortedPairs(NumSortedKeys);
+	for (int32 Index = 0; Index < NumSortedKeys; ++Index)
+	{
+		if (Index == 0 || SortedKeys[Index] != SortedKeys[Index - 1])
+		{
+			SortedPairs.Add(TPair<int32, int32>(SortedKeys[Index], Index));
+		}
+	}
+
+	TSortedMap<int32, int32> SortedMap;
+	SortedMap.BuildFromSorted(SortedPairs);
+	std::map<int32, int32> StdMap;
+	for (const TPair<int32, int32>& Pair : SortedPairs)
+	{
+		StdMap.insert({ Pair.Key, Pair.Value });
+	}
+
+	int64 Sum = 0;
+
+	BENCHMARK("TSortedMap<int32, int32>::Add")
+	{
+		TSortedMap<int32, int32> Map;
+		for (int32 Index = 0; Index < NumSortedKeys; ++Index)
+		{
+			Map.Add(Keys[Index], Index);
+		}
+	}
+
+	BENCHMARK("std::map<int32, int32>::insert")
+	{
+		std::map<int32, int32> Map;
+		for (int32 Index = 0; Index < NumSortedKeys; ++Index)
+		{
+			Map.insert({ Keys[Index], Index });
+		}
+	}
+
+	BENCHMARK("TSortedMap<int32, int32>::BuildFromSorted")
+	{
+		TSortedMap<int32, int32> Map;
+		Map.BuildFromSorted(SortedPairs);
+	}
+
+	BENCHMARK("TSortedMap<int32, int32>::Find")
+	{
+		for (int32 Key : Keys)
+		{
+			Sum += *SortedMap.Find(Key);
+		}
+	}
+
+	BENCHMARK("std::map<int32, int32>::find")
+	{
+		for (int32 Key : Keys)
+		{
+			Sum += StdMap.find(Key)->second;
+		}
+	}
+
+	BENCHMARK("Sorted TArray<int32> Algo::LowerBound")
+	{
+		for (int32 Key : Keys)
+		{
+			Sum += Algo::LowerBound(SortedKeys, Key);
+		}
+	}
+
+	BENCHMARK("TSortedMap<int32, int32> iteration")
+	{
+		for (const TPair<int32, int32>& Pair : SortedMap)
+		{
+			Sum += Pair.Value;
+		}
+	}
+
+	BENCHMARK("std::map<int32, int32> iteration")
+	{
+		for (const std::pair<const int32, int32>& Pair : StdMap)
+		{
+			Sum += Pair.second;
+		}
+	}
+
+	BENCHMARK("Sorted TArray<int32> iteration")
+	{
+		for (int32 Key : SortedKeys)
+		{
+			Sum += Key;
+		}
+	}
+
+	// Keeps the lookups from being optimized away.
+	REQUIRE(Sum != 0);
+}
+
+TEST_CASE("Queue benchmarks.", "[.][Benchmark]")
+{
+	int64 Sum = 0;
+
+	BENCHMARK("Locked queue, 1 producer 1 consumer")
+	{
+		FLockedBenchmarkQueue Queue;
+		Sum += PassThroughQueue(Queue, 1, 1);
+	}
+
+	BENCHMARK("TSPSCQueue, 1 producer 1 consumer")
+	{
+		TSPSCQueue<int32> Queue(BenchmarkQueueCapacity);
+		Sum += PassThroughQueue(Queue, 1, 1);
+	}
+
+	BENCHMARK("TMPMCQueue, 1 producer 1 consumer")
+	{
+		TMPMCQueue<int32> Queue(BenchmarkQueueCapacity);
+		Sum += PassThroughQueue(Queue, 1, 1);
+	}
+
+	BENCHMARK("Locked queue, 4 producers 4 consumers")
+	{
+		FLockedBenchmarkQueue Queue;
+		Sum += PassThroughQueue(Queue, 4, 4);
+	}
+
+	BENCHMARK("TMPMCQueue, 4 producers 4 consumers")
+	{
+		TMPMCQueue<int32> Queue(BenchmarkQueueCapacity);
+		Sum += PassThroughQueue(Queue, 4, 4);
+	}
+
+	// Keeps the queues from being optimized away.
+	REQUIRE(Sum != 0);
+}
+
+TEST_CASE("Concurrent map benchmarks.", "[.][Benchmark]")
+{
+	FLockedBenchmarkMap LockedMap;
+	TConcurrentMap<int32, int32> ConcurrentMap;
+	FillSharedMap(LockedMap);
+	FillSharedMap(ConcurrentMap);
+	int64 Sum = 0;
+
+	BENCHMARK("Locked TMap, 4 readers")
+	{
+		Sum += ReadSharedMap(LockedMap, 4, false);
+	}
+
+	BENCHMARK("TConcurrentMap, 4 readers")
+	{
+		Sum += ReadSharedMap(ConcurrentMap, 4, false);
+	}
+
+	BENCHMARK("Locked TMap, 4 readers 1 writer")
+	{
+		Sum += ReadSharedMap(LockedMap, 4, true);
+	}
+
+	BENCHMARK("TConcurrentMap, 4 readers 1 writer")
+	{
+		Sum += ReadSharedMap(ConcurrentMap, 4, true);
+	}
+
+	// Keeps the lookups from being optimized away.
+	REQUIRE(Sum != 0);
+}
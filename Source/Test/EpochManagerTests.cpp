@@ -0,0 +1,110 @@
+#include "catch/catch.hpp"
+
+#include "Memory/EpochManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+	void CountDeletion(void* InObject, void* InContext)
+	{
+		delete static_cast<int32*>(InObject);
+		++*static_cast<int32*>(InContext);
+	}
+}
+
+TEST_CASE("FEpochManager")
+{
+	FEpochManager& EpochManager = FEpochManager::Get();
+	EpochManager.Synchronize();
+	int32 NumDeleted = 0;
+
+	SECTION("Objects retired outside of read scopes are freed by the next collection.")
+	{
+		EpochManager.Retire(new int32(1), &CountDeletion, &NumDeleted);
+		EpochManager.Retire(new int32(2), &CountDeletion, &NumDeleted);
+		REQUIRE(EpochManager.GetNumRetired() == 2);
+
+		EpochManager.Collect();
+		REQUIRE(NumDeleted == 2);
+		REQUIRE(EpochManager.GetNumRetired() == 0);
+	}
+
+	SECTION("Read scopes nest.")
+	{
+		REQUIRE(!EpochManager.IsInReadScope());
+		{
+			FEpochReadScope OuterScope;
+			{
+				FEpochReadScope InnerScope;
+				REQUIRE(EpochManager.IsInReadScope());
+			}
+			REQUIRE(EpochManager.IsInReadScope());
+		}
+		REQUIRE(!EpochManager.IsInReadScope());
+	}
+
+	SECTION("A reader holds up objects retired after it entered, but not before.")
+	{
+		EpochManager.Retire(new int32(1), &CountDeletion, &NumDeleted);
+
+		std::atomic<bool> bReaderEntered{ false };
+		std::atomic<bool> bReaderShouldExit{ false };
+		std::thread Reader([&]()
+		{
+			FEpochReadScope ReadScope;
+			bReaderEntered.store(true);
+			while (!bReaderShouldExit.load())
+			{
+				std::this_thread::yield();
+			}
+		});
+		while (!bReaderEntered.load())
+		{
+			std::this_thread::yield();
+		}
+
+		EpochManager.Retire(new int32(2), &CountDeletion, &NumDeleted);
+		EpochManager.Collect();
+		REQUIRE(NumDeleted == 1);
+		REQUIRE(EpochManager.GetNumRetired() == 1);
+
+		bReaderShouldExit.store(true);
+		Reader.join();
+		EpochManager.Collect();
+		REQUIRE(NumDeleted == 2);
+	}
+
+	SECTION("Synchronize waits for readers and frees everything retired before it.")
+	{
+		std::atomic<bool> bReaderEntered{ false };
+		std::thread Reader([&]()
+		{
+			FEpochReadScope ReadScope;
+			bReaderEntered.store(true);
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		});
+		while (!bReaderEntered.load())
+		{
+			std::this_thread::yield();
+		}
+
+		EpochManager.Retire(new int32(1), &CountDeletion, &NumDeleted);
+		EpochManager.Synchronize();
+		REQUIRE(NumDeleted == 1);
+		Reader.join();
+	}
+
+	SECTION("Retiring many objects collects them without explicit calls.")
+	{
+		for (int32 Index = 0; Index < FEpochManager::CollectThreshold; ++Index)
+		{
+			EpochManager.Retire(new int32(Index), &CountDeletion, &NumDeleted);
+		}
+		REQUIRE(NumDeleted == FEpochManager::CollectThreshold);
+	}
+
+	EpochManager.Synchronize();
+}
@@ -0,0 +1,60 @@
+#include "catch/catch.hpp"
+
+#include "Memory/FrameAllocator.h"
+
+TEST_CASE("FFrameAllocator")
+{
+	const int32 BufferSize = 1024;
+	uint8 Buffer[BufferSize];
+	FFrameAllocator TestAllocator(&Buffer[0], BufferSize);
+
+	REQUIRE(TestAllocator.GetFrameCapacity() == BufferSize / 2);
+
+	SECTION("Allocations stay valid until the end of the next frame")
+	{
+		int32* FirstFrameValue = static_cast<int32*>(TestAllocator.Allocate(sizeof(int32)));
+		*FirstFrameValue = 42;
+		TestAllocator.EndFrame();
+
+		int32* SecondFrameValue = static_cast<int32*>(TestAllocator.Allocate(sizeof(int32)));
+		*SecondFrameValue = 7;
+		REQUIRE(*FirstFrameValue == 42);
+		REQUIRE(SecondFrameValue != FirstFrameValue);
+		TestAllocator.EndFrame();
+
+		// The first frame's arena was cleared and is reused.
+		REQUIRE(TestAllocator.Allocate(sizeof(int32)) == FirstFrameValue);
+		REQUIRE(*SecondFrameValue == 7);
+	}
+
+	SECTION("High-water marks are recorded per frame")
+	{
+		TestAllocator.Allocate(96);
+		TestAllocator.Allocate(32);
+		TestAllocator.EndFrame();
+		REQUIRE(TestAllocator.GetLastFrameHighWaterMark() == 128);
+
+		TestAllocator.Allocate(8);
+		TestAllocator.EndFrame();
+		REQUIRE(TestAllocator.GetLastFrameHighWaterMark() == 8);
+		REQUIRE(TestAllocator.GetPeakHighWaterMark() == 128);
+	}
+
+	SECTION("Scoped marks work on the current frame's arena")
+	{
+		{
+			FScopedArenaMark Mark(TestAllocator.GetCurrentArena());
+			TestAllocator.Allocate(256);
+		}
+		REQUIRE(TestAllocator.GetCurrentArena().GetNumBytesUsed() == 0);
+		TestAllocator.EndFrame();
+		REQUIRE(TestAllocator.GetLastFrameHighWaterMark() == 256);
+	}
+
+	SECTION("Deallocation is a no-op")
+	{
+		void* Memory = TestAllocator.Allocate(8);
+		TestAllocator.Deallocate(Memory);
+		REQUIRE(TestAllocator.Allocate(8) == (int8*)Memory + 8);
+	}
+}
@@ -0,0 +1,88 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/FrustumPlanes.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Geometry/Sphere.h"
+#include "Math/Geometry/OBB.h"
+#include "Math/Matrix4D.h"
+#include "Math/Vector4D.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+// A perspective projection looking down -Z, with a 90 degree field of view and near and far planes at 1 and 100
+// (built the same way as FCamera::MakePerspectiveProjection).
+static FMatrix4D MakeTestProjection()
+{
+	const float Near = 1.0f;
+	const float Far = 100.0f;
+	FMatrix4D Perspective;
+	Perspective[0][0] = 1.0f;
+	Perspective[1][1] = 1.0f;
+	Perspective[2][2] = -(Far + Near) / (Far - Near);
+	Perspective[2][3] = -1.0f;
+	Perspective[3][2] = -(2.0f * Far * Near) / (Far - Near);
+	return Perspective;
+}
+
+TEST_CASE("FFrustumPlanes extraction.")
+{
+	SECTION("The identity matrix gives the clip volume")
+	{
+		FFrustumPlanes Frustum = FFrustumPlanes::MakeFromViewProjection(FMatrix4D::Identity);
+		REQUIRE(Frustum[EFrustumPlane::Left] == FPlane(FVector3D::XAxis, 1.0f));
+		REQUIRE(Frustum[EFrustumPlane::Right] == FPlane(-FVector3D::XAxis, 1.0f));
+		REQUIRE(Frustum[EFrustumPlane::Bottom] == FPlane(FVector3D::YAxis, 1.0f));
+		REQUIRE(Frustum[EFrustumPlane::Top] == FPlane(-FVector3D::YAxis, 1.0f));
+		REQUIRE(Frustum[EFrustumPlane::Near] == FPlane(FVector3D::ZAxis, 1.0f));
+		REQUIRE(Frustum[EFrustumPlane::Far] == FPlane(-FVector3D::ZAxis, 1.0f));
+	}
+
+	SECTION("Perspective planes")
+	{
+		FFrustumPlanes Frustum = FFrustumPlanes::MakeFromViewProjection(MakeTestProjection());
+		REQUIRE(FMath::IsApproximatelyEqual(Frustum[EFrustumPlane::Near].GetSignedDistance(FVector3D(0.0f, 0.0f, -1.0f)), 0.0f, 1.e-5f));
+		REQUIRE(FMath::IsApproximatelyEqual(Frustum[EFrustumPlane::Far].GetSignedDistance(FVector3D(0.0f, 0.0f, -100.0f)), 0.0f, 1.e-3f));
+		REQUIRE(FMath::IsApproximatelyEqual(Frustum[EFrustumPlane::Left].GetSignedDistance(FVector3D(-10.0f, 0.0f, -10.0f)), 0.0f, 1.e-5f));
+		REQUIRE(FMath::IsApproximatelyEqual(Frustum[EFrustumPlane::Top].GetSignedDistance(FVector3D(0.0f, 10.0f, -10.0f)), 0.0f, 1.e-5f));
+
+		REQUIRE(Frustum.Contains(FVector3D(0.0f, 0.0f, -50.0f)));
+		REQUIRE(Frustum.Contains(FVector3D(4.0f, -4.0f, -5.0f)));
+		REQUIRE(!Frustum.Contains(FVector3D(6.0f, 0.0f, -5.0f)));
+		REQUIRE(!Frustum.Contains(FVector3D(0.0f, 0.0f, -0.5f)));
+		REQUIRE(!Frustum.Contains(FVector3D(0.0f, 0.0f, -101.0f)));
+		REQUIRE(!Frustum.Contains(FVector3D(0.0f, 0.0f, 5.0f)));
+	}
+}
+
+TEST_CASE("FFrustumPlanes intersection tests.")
+{
+	FFrustumPlanes Frustum = FFrustumPlanes::MakeFromViewProjection(MakeTestProjection());
+
+	SECTION("Boxes")
+	{
+		REQUIRE(Frustum.Intersects(FAABB::MakeFromCenterAndExtent(FVector3D(0.0f, 0.0f, -10.0f), FVector3D::One)));
+		// Straddling the left plane.
+		REQUIRE(Frustum.Intersects(FAABB::MakeFromCenterAndExtent(FVector3D(-10.5f, 0.0f, -10.0f), FVector3D::One)));
+		REQUIRE(!Frustum.Intersects(FAABB::MakeFromCenterAndExtent(FVector3D(-13.0f, 0.0f, -10.0f), FVector3D::One)));
+		REQUIRE(!Frustum.Intersects(FAABB::MakeFromCenterAndExtent(FVector3D(0.0f, 0.0f, 10.0f), FVector3D::One)));
+		REQUIRE(!Frustum.Intersects(FAABB::MakeFromCenterAndExtent(FVector3D(0.0f, 0.0f, -110.0f), FVector3D::One)));
+	}
+
+	SECTION("Spheres")
+	{
+		REQUIRE(Frustum.Intersects(FSphere(FVector3D(0.0f, 0.0f, -10.0f), 1.0f)));
+		// Straddling the near plane.
+		REQUIRE(Frustum.Intersects(FSphere(FVector3D(0.0f, 0.0f, -0.5f), 1.0f)));
+		REQUIRE(!Frustum.Intersects(FSphere(FVector3D(0.0f, 0.0f, 1.0f), 1.0f)));
+		REQUIRE(!Frustum.Intersects(FSphere(FVector3D(0.0f, 13.0f, -10.0f), 2.0f)));
+	}
+
+	SECTION("Oriented boxes")
+	{
+		// A long thin box outside the left plane, which only reaches into the frustum once it is rotated.
+		FAABB Box = FAABB::MakeFromCenterAndExtent(FVector3D::Zero, FVector3D(0.1f, 4.0f, 0.1f));
+		FTransform4D Translation = FTransform4D::MakeTranslation(FVector3D(-13.0f, 0.0f, -10.0f));
+		REQUIRE(!Frustum.Intersects(FOBB::MakeFromAABB(Box, Translation)));
+		REQUIRE(Frustum.Intersects(FOBB::MakeFromAABB(Box, Translation * FTransform4D::MakeRotationZ(FMath::PiOverTwo))));
+	}
+}
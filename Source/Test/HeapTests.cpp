@@ -0,0 +1,79 @@
+#include "catch/catch.hpp"
+
+#include "Algorithms/Heap.h"
+#include "Algorithms/Sort.h"
+#include "Containers/Array.h"
+
+#include <random>
+
+TEST_CASE("Algo heaps")
+{
+	std::mt19937 Generator(7);
+	std::uniform_int_distribution<int32> Distribution(-1000, 1000);
+	TArray<int32> Elements;
+	for (int32 Index = 0; Index < 500; ++Index)
+	{
+		Elements.Add(Distribution(Generator));
+	}
+
+	SECTION("Heapify.")
+	{
+		REQUIRE(!Algo::IsHeap(Elements));
+		Algo::Heapify(Elements);
+		REQUIRE(Algo::IsHeap(Elements));
+		REQUIRE(Elements.GetSize() == 500);
+
+		// The top is the smallest element.
+		for (int32 Element : Elements)
+		{
+			REQUIRE(Elements[0] <= Element);
+		}
+	}
+
+	SECTION("Push and pop in order.")
+	{
+		TArray<int32> Heap;
+		for (int32 Element : Elements)
+		{
+			Algo::HeapPush(Heap, Element);
+			REQUIRE(Algo::IsHeap(Heap));
+		}
+
+		int32 Previous = -1001;
+		while (!Heap.IsEmpty())
+		{
+			int32 Top;
+			Algo::HeapPop(Heap, Top);
+			REQUIRE(Algo::IsHeap(Heap));
+			REQUIRE(Previous <= Top);
+			Previous = Top;
+		}
+	}
+
+	SECTION("Predicates.")
+	{
+		TArray<int32> Heap;
+		for (int32 Element : Elements)
+		{
+			Algo::HeapPush(Heap, Element, TGreater<>());
+		}
+		REQUIRE(Algo::IsHeap(Heap, TGreater<>()));
+
+		// The top is the largest element.
+		int32 Top;
+		Algo::HeapPop(Heap, Top, TGreater<>());
+		for (int32 Element : Heap)
+		{
+			REQUIRE(Top >= Element);
+		}
+	}
+
+	SECTION("Heap sort.")
+	{
+		Algo::HeapSort(Elements);
+		REQUIRE(Algo::IsSorted(Elements));
+
+		Algo::HeapSort(Elements, TGreater<>());
+		REQUIRE(Algo::IsSorted(Elements, TGreater<>()));
+	}
+}
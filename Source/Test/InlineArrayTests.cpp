@@ -0,0 +1,98 @@
+#include "catch/catch.hpp"
+#include "Containers/InlineArray.h"
+#include "Memory/PoolAllocator.h"
+#include "Strings/String.h"
+
+namespace
+{
+	// Returns whether an address is within an object.
+	template<typename ObjectType>
+	bool IsWithin(const void* InAddress, const ObjectType& InObject)
+	{
+		const int8* Address = static_cast<const int8*>(InAddress);
+		const int8* Object = reinterpret_cast<const int8*>(&InObject);
+		return Object <= Address && Address < Object + sizeof(ObjectType);
+	}
+}
+
+TEST_CASE("TInlineArray storage")
+{
+	FPoolAllocator TestAllocator;
+
+	SECTION("Elements that fit are stored inline.")
+	{
+		TInlineArray<int32, 4> Array(TestAllocator);
+		REQUIRE(Array.GetCapacity() == 4);
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			Array.Add(Index);
+		}
+		REQUIRE(IsWithin(Array.GetData(), Array));
+		REQUIRE(TestAllocator.GetNumPages() == 0);
+	}
+
+	SECTION("The array moves to the allocator when it outgrows its storage.")
+	{
+		TInlineArray<int32, 4> Array(TestAllocator);
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			Array.Add(Index);
+		}
+		REQUIRE(!IsWithin(Array.GetData(), Array));
+		REQUIRE(Array.GetCapacity() == 8);
+		REQUIRE(TestAllocator.GetNumPages() == 1);
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			REQUIRE(Array[Index] == Index);
+		}
+	}
+
+	SECTION("Elements with destructors are destroyed.")
+	{
+		TInlineArray<FANSIString, 2> Array;
+		Array.Add("A string that doesn't fit inline");
+		Array.Add("Another string that doesn't fit inline");
+		Array.Add("A third string that doesn't fit inline");
+		Array.RemoveAt(0);
+		REQUIRE(Array.GetSize() == 2);
+		REQUIRE(Array[0] == "Another string that doesn't fit inline");
+		REQUIRE(Array[1] == "A third string that doesn't fit inline");
+	}
+}
+
+TEST_CASE("TInlineArray copying")
+{
+	TInlineArray<int32, 4> Array;
+	Array.Add(1);
+	Array.Add(2);
+
+	SECTION("Copies use their own storage.")
+	{
+		TInlineArray<int32, 4> Copy = Array;
+		REQUIRE(IsWithin(Copy.GetData(), Copy));
+		REQUIRE(Copy.GetSize() == 2);
+		REQUIRE(Copy[0] == 1);
+		REQUIRE(Copy[1] == 2);
+	}
+
+	SECTION("Copying to a TArray allocates.")
+	{
+		TArray<int32> Copy = Array;
+		REQUIRE(Copy.GetSize() == 2);
+		REQUIRE(Copy[1] == 2);
+
+		TInlineArray<int32, 4> InlineCopy = Copy;
+		REQUIRE(IsWithin(InlineCopy.GetData(), InlineCopy));
+		REQUIRE(InlineCopy[1] == 2);
+	}
+
+	SECTION("Assignment")
+	{
+		TInlineArray<int32, 4> Other;
+		Other.Add(3);
+		Other = Array;
+		REQUIRE(IsWithin(Other.GetData(), Other));
+		REQUIRE(Other.GetSize() == 2);
+		REQUIRE(Other[0] == 1);
+	}
+}
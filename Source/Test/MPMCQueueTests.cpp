@@ -0,0 +1,168 @@
+#include "catch/catch.hpp"
+
+#include "Containers/MPMCQueue.h"
+#include "SmartPointers/SharedPtr.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("TMPMCQueue")
+{
+	TMPMCQueue<int32> Queue(8);
+
+	REQUIRE(Queue.IsEmpty());
+	REQUIRE(Queue.GetCapacity() == 8);
+
+	SECTION("Elements come out in the order they went in.")
+	{
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			REQUIRE(Queue.Enqueue(Index));
+		}
+		REQUIRE(Queue.GetSize() == 5);
+
+		int32 Element = -1;
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			REQUIRE(Queue.Dequeue(Element));
+			REQUIRE(Element == Index);
+		}
+		REQUIRE(!Queue.Dequeue(Element));
+		REQUIRE(Queue.IsEmpty());
+	}
+
+	SECTION("Full queue wraps around.")
+	{
+		int32 Element = -1;
+		for (int32 Lap = 0; Lap < 3; ++Lap)
+		{
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				REQUIRE(Queue.Enqueue(Lap * 8 + Index));
+			}
+			REQUIRE(!Queue.Enqueue(-1));
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				REQUIRE(Queue.Dequeue(Element));
+				REQUIRE(Element == Lap * 8 + Index);
+			}
+			REQUIRE(!Queue.Dequeue(Element));
+		}
+	}
+
+	SECTION("Smallest queue.")
+	{
+		TMPMCQueue<int32> SmallQueue(1);
+		REQUIRE(SmallQueue.GetCapacity() == 2);
+		REQUIRE(SmallQueue.Enqueue(1));
+		REQUIRE(SmallQueue.Enqueue(2));
+		REQUIRE(!SmallQueue.Enqueue(3));
+	}
+}
+
+TEST_CASE("TMPMCQueue element lifetime")
+{
+	TSharedPtr<int32> Shared = MakeShared<int32>(7);
+	{
+		TMPMCQueue<TSharedPtr<int32>> Queue(4);
+		REQUIRE(Queue.Enqueue(Shared));
+		REQUIRE(Queue.Emplace(Shared));
+		REQUIRE(Shared.GetStrongRefCount() == 3);
+
+		TSharedPtr<int32> Element;
+		REQUIRE(Queue.Dequeue(Element));
+		REQUIRE(*Element == 7);
+		REQUIRE(Shared.GetStrongRefCount() == 3);
+	}
+	// The queue destroyed the element left in it.
+	REQUIRE(Shared.GetStrongRefCount() == 1);
+}
+
+TEST_CASE("TMPMCQueue stress")
+{
+	// A small queue shared by more threads than cores, so that every slot is contended.
+	const int32 NumProducers = 4;
+	const int32 NumConsumers = 4;
+	const int32 NumElementsPerProducer = 100000;
+	TMPMCQueue<int32> Queue(64);
+
+	// Each element is its producer index in the high bits and its sequence number in the low bits.
+	auto MakeElement = [](int32 InProducerIndex, int32 InSequence)
+	{
+		return (InProducerIndex << 24) | InSequence;
+	};
+
+	std::vector<std::thread> Threads;
+	for (int32 ProducerIndex = 0; ProducerIndex < NumProducers; ++ProducerIndex)
+	{
+		Threads.emplace_back([&Queue, &MakeElement, ProducerIndex, NumElementsPerProducer]()
+		{
+			for (int32 Sequence = 0; Sequence < NumElementsPerProducer; ++Sequence)
+			{
+				while (!Queue.Enqueue(MakeElement(ProducerIndex, Sequence)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	std::atomic<int32> NumConsumed{ 0 };
+	std::vector<int64> Sums(NumConsumers, 0);
+	std::vector<int32> NumErrors(NumConsumers, 0);
+	for (int32 ConsumerIndex = 0; ConsumerIndex < NumConsumers; ++ConsumerIndex)
+	{
+		Threads.emplace_back([&, ConsumerIndex]()
+		{
+			// Elements of a producer are dequeued in order, so each consumer sees every producer's sequence increase.
+			int32 LastSequences[NumProducers] = { -1, -1, -1, -1 };
+			while (NumConsumed.load(std::memory_order_relaxed) < NumProducers * NumElementsPerProducer)
+			{
+				int32 Element;
+				if (!Queue.Dequeue(Element))
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				NumConsumed.fetch_add(1, std::memory_order_relaxed);
+
+				const int32 ProducerIndex = Element >> 24;
+				const int32 Sequence = Element & 0xFFFFFF;
+				if (ProducerIndex >= NumProducers || Sequence <= LastSequences[ProducerIndex])
+				{
+					++NumErrors[ConsumerIndex];
+				}
+				else
+				{
+					LastSequences[ProducerIndex] = Sequence;
+				}
+				Sums[ConsumerIndex] += Element;
+			}
+		});
+	}
+
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	// Every element was dequeued exactly once.
+	int64 ExpectedSum = 0;
+	for (int32 ProducerIndex = 0; ProducerIndex < NumProducers; ++ProducerIndex)
+	{
+		for (int32 Sequence = 0; Sequence < NumElementsPerProducer; ++Sequence)
+		{
+			ExpectedSum += MakeElement(ProducerIndex, Sequence);
+		}
+	}
+	int64 Sum = 0;
+	for (int32 ConsumerIndex = 0; ConsumerIndex < NumConsumers; ++ConsumerIndex)
+	{
+		REQUIRE(NumErrors[ConsumerIndex] == 0);
+		Sum += Sums[ConsumerIndex];
+	}
+	REQUIRE(NumConsumed.load() == NumProducers * NumElementsPerProducer);
+	REQUIRE(Sum == ExpectedSum);
+	REQUIRE(Queue.IsEmpty());
+}
@@ -2,6 +2,10 @@
 
 #include "Containers/Map.h"
 #include "Math/MathUtilities.h"
+#include "Memory/ArenaAllocator.h"
+#include "Memory/PoolAllocator.h"
+
+#include <cstring>
 
 TEST_CASE("TMap")
 {
@@ -61,6 +65,16 @@ TEST_CASE("TMap")
 		REQUIRE(*TestMap.Find(1) == -1);
 	}
 
+	SECTION("Look up keys by hash.")
+	{
+		TestMap.Add(1, -1);
+		TestMap.Add(2, -2);
+
+		REQUIRE(TestMap.IsHashContained(GetTypeHash(1)));
+		REQUIRE(TestMap.IsHashContained(GetTypeHash(2)));
+		REQUIRE(!TestMap.IsHashContained(GetTypeHash(3)));
+	}
+
 	SECTION("Add enough elements to trigger a rehash.")
 	{
 		REQUIRE(TestMap.GetCapacity() == 8);
@@ -82,3 +96,89 @@ TEST_CASE("TMap")
 		}
 	}
 }
+
+namespace
+{
+	// Counts live instances, to check that the map constructs and destroys its values.
+	struct FLiveCounter
+	{
+		explicit FLiveCounter(int32& InNumLive)
+			: NumLive(&InNumLive)
+		{
+			++*NumLive;
+		}
+		FLiveCounter(const FLiveCounter& InOther)
+			: NumLive(InOther.NumLive)
+		{
+			++*NumLive;
+		}
+		~FLiveCounter()
+		{
+			--*NumLive;
+		}
+		FLiveCounter& operator=(const FLiveCounter& InOther) = delete;
+
+		int32* NumLive;
+	};
+}
+
+TEST_CASE("TMap element lifetime")
+{
+	int32 NumLive = 0;
+	{
+		TMap<int32, FLiveCounter> TestMap;
+		for (int32 Index = 0; Index < 20; ++Index)
+		{
+			TestMap.Add(Index, FLiveCounter(NumLive));
+		}
+		REQUIRE(NumLive == 20);
+
+		TestMap.Remove(3);
+		REQUIRE(NumLive == 19);
+
+		TMap<int32, FLiveCounter> Copy(TestMap);
+		REQUIRE(NumLive == 38);
+
+		TMap<int32, FLiveCounter> Moved(MoveTemp(Copy));
+		REQUIRE(NumLive == 38);
+
+		TestMap.Empty();
+		REQUIRE(NumLive == 19);
+	}
+	REQUIRE(NumLive == 0);
+}
+
+TEST_CASE("TMap allocators")
+{
+	const int32 BufferSize = 4096;
+	uint8 Buffer[BufferSize];
+	FArenaAllocator ArenaAllocator(&Buffer[0], BufferSize);
+
+	FPoolAllocator PoolAllocator;
+	TMap<int32, int32> PoolMap(PoolAllocator);
+	{
+		TMap<int32, int32> ArenaMap(64, ArenaAllocator);
+		REQUIRE(ArenaMap.GetCapacity() == 64);
+		REQUIRE(ArenaMap.GetAllocator() == &ArenaAllocator);
+		for (int32 Index = 0; Index < 40; ++Index)
+		{
+			ArenaMap.Add(Index, -Index);
+		}
+		REQUIRE(ArenaMap.GetCapacity() == 64);
+
+		// Keep a copy of the map outside of the arena.
+		TMap<int32, int32> Copy(ArenaMap, PoolAllocator);
+		PoolMap = MoveTemp(Copy);
+	}
+	ArenaAllocator.Clear();
+	memset(Buffer, 0xff, BufferSize);
+
+	REQUIRE(PoolMap.GetAllocator() == &PoolAllocator);
+	REQUIRE(PoolMap.GetSize() == 40);
+	for (int32 Index = 0; Index < 40; ++Index)
+	{
+		const int32* Value = PoolMap.Find(Index);
+		REQUIRE(Value != nullptr);
+		REQUIRE(*Value == -Index);
+	}
+}
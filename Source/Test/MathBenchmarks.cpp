@@ -0,0 +1,476 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/SimdMatrix.h"
+#include "Math/Simd/TransformBatch.h"
+#include "Math/Simd/VectorMath.h"
+#include "Math/Simd/BoundsBatch.h"
+#include "Containers/Array.h"
+
+#include <cmath>
+
+/**
+ * Throughput comparisons between the scalar math classes and their vectorized counterparts.
+ * Benchmarks are hidden from the default test run; run them with: Test "[Benchmark]"
+ *
+ * Each benchmark applies one operation to every element of an array, which is how batched engine
+ * code uses these functions, so that timings reflect throughput rather than latency.
+ */
+
+namespace
+{
+	// Number of elements processed per benchmark.
+	constexpr int32 NumBenchmarkElements = 100000;
+
+	FMatrix4D MakeBenchmarkMatrix(int32 InIndex)
+	{
+		float Offset = static_cast<float>(InIndex % 17) * 0.01f;
+		return FMatrix4D(
+			2.0f + Offset, 0.1f, 0.2f, 1.0f,
+			0.3f, 2.0f, 0.4f + Offset, 2.0f,
+			0.5f, 0.6f, 2.0f, 3.0f,
+			0.0f, Offset, 0.1f, 1.0f
+		);
+	}
+
+	FTransform4D MakeBenchmarkTransform(int32 InIndex)
+	{
+		float Offset = static_cast<float>(InIndex % 17) * 0.01f;
+		return FTransform4D::MakeTranslation(FVector3D(1.0f, 2.0f, 3.0f + Offset)) * FTransform4D::MakeRotation(0.5f + Offset, FVector3D(0.0f, 0.6f, 0.8f));
+	}
+
+	// Inputs shared by all benchmarks, built once.
+	struct FBenchmarkData
+	{
+		FBenchmarkData()
+		{
+			for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+			{
+				Matrices.Add(MakeBenchmarkMatrix(Index));
+				Transforms.Add(MakeBenchmarkTransform(Index));
+				Points.Add(FVector3D(static_cast<float>(Index), 1.0f, -2.0f));
+
+				MatrixResults.Add(FMatrix4D());
+				TransformResults.Add(FTransform4D());
+				PointResults.Add(FVector3D());
+			}
+		}
+
+		TArray<FMatrix4D> Matrices;
+		TArray<FTransform4D> Transforms;
+		TArray<FVector3D> Points;
+
+		TArray<FMatrix4D> MatrixResults;
+		TArray<FTransform4D> TransformResults;
+		TArray<FVector3D> PointResults;
+	};
+}
+
+TEST_CASE("4x4 matrix benchmarks.", "[.][Benchmark]")
+{
+	FBenchmarkData Data;
+	const FMatrix4D Matrix = MakeBenchmarkMatrix(0);
+
+	BENCHMARK("FMatrix4D multiply (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = Matrix * Data.Matrices[Index];
+		}
+	}
+
+	BENCHMARK("FMatrix4D multiply (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = FSimdMatrix::Multiply(Matrix, Data.Matrices[Index]);
+		}
+	}
+
+	BENCHMARK("FMatrix4D inverse (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = Data.Matrices[Index].GetInverted();
+		}
+	}
+
+	BENCHMARK("FMatrix4D inverse (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = FSimdMatrix::Inverse(Data.Matrices[Index]);
+		}
+	}
+
+	BENCHMARK("FMatrix4D transpose (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = Data.Matrices[Index].GetTransposed();
+		}
+	}
+
+	BENCHMARK("FMatrix4D transpose (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.MatrixResults[Index] = FSimdMatrix::Transpose(Data.Matrices[Index]);
+		}
+	}
+}
+
+TEST_CASE("3x4 transform benchmarks.", "[.][Benchmark]")
+{
+	FBenchmarkData Data;
+	const FTransform4D Transform = MakeBenchmarkTransform(0);
+
+	BENCHMARK("FTransform4D multiply (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.TransformResults[Index] = Transform * Data.Transforms[Index];
+		}
+	}
+
+	BENCHMARK("FTransform4D multiply (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.TransformResults[Index] = FSimdMatrix::Multiply(Transform, Data.Transforms[Index]);
+		}
+	}
+
+	BENCHMARK("FTransform4D inverse (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.TransformResults[Index] = Data.Transforms[Index].GetInverted();
+		}
+	}
+
+	BENCHMARK("FTransform4D inverse (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.TransformResults[Index] = FSimdMatrix::Inverse(Data.Transforms[Index]);
+		}
+	}
+
+	BENCHMARK("FTransform4D transform point (scalar)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			FVector4D Result = Transform * FVector4D(Data.Points[Index], 1.0f);
+			Data.PointResults[Index] = FVector3D(Result.X, Result.Y, Result.Z);
+		}
+	}
+
+	BENCHMARK("FTransform4D transform point (SIMD)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.PointResults[Index] = FSimdMatrix::TransformPoint(Transform, Data.Points[Index]);
+		}
+	}
+}
+
+TEST_CASE("Batch transform benchmarks.", "[.][Benchmark]")
+{
+	FBenchmarkData Data;
+	const FTransform4D Transform = MakeBenchmarkTransform(0);
+
+	TArray<float> Streams[3];
+	TArray<float> StreamResults[3];
+	for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Streams[Axis].Add((&Data.Points[Index].X)[Axis]);
+			StreamResults[Axis].Add(0.0f);
+		}
+	}
+	FConstVector3DStreams InputStreams(Streams[0].GetData(), Streams[1].GetData(), Streams[2].GetData());
+	FVector3DStreams OutputStreams(StreamResults[0].GetData(), StreamResults[1].GetData(), StreamResults[2].GetData());
+
+	BENCHMARK("Transform points (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			FVector4D Result = Transform * FVector4D(Data.Points[Index], 1.0f);
+			Data.PointResults[Index] = FVector3D(Result.X, Result.Y, Result.Z);
+		}
+	}
+
+	BENCHMARK("Transform points (batch, array)")
+	{
+		FTransformBatch::TransformPoints(Transform, Data.Points.GetData(), Data.PointResults.GetData(), NumBenchmarkElements);
+	}
+
+	BENCHMARK("Transform points (batch, streams)")
+	{
+		FTransformBatch::TransformPoints(Transform, InputStreams, OutputStreams, NumBenchmarkElements);
+	}
+
+	BENCHMARK("Transform vectors (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.PointResults[Index] = Transform * Data.Points[Index];
+		}
+	}
+
+	BENCHMARK("Transform vectors (batch, array)")
+	{
+		FTransformBatch::TransformVectors(Transform, Data.Points.GetData(), Data.PointResults.GetData(), NumBenchmarkElements);
+	}
+
+	BENCHMARK("Transform vectors (batch, streams)")
+	{
+		FTransformBatch::TransformVectors(Transform, InputStreams, OutputStreams, NumBenchmarkElements);
+	}
+
+	BENCHMARK("Multiply transforms (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Data.TransformResults[Index] = Transform * Data.Transforms[Index];
+		}
+	}
+
+	BENCHMARK("Multiply transforms (batch)")
+	{
+		FTransformBatch::MultiplyTransforms(Transform, Data.Transforms.GetData(), Data.TransformResults.GetData(), NumBenchmarkElements);
+	}
+
+	// The points double as translations, rotations, and scales.
+	BENCHMARK("Compose transforms (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			const FVector3D& Components = Data.Points[Index];
+			FTransform4D T = FTransform4D::MakeTranslation(Components);
+			FTransform4D RX = FTransform4D::MakeRotationX(Components.X);
+			FTransform4D RY = FTransform4D::MakeRotationY(Components.Y);
+			FTransform4D RZ = FTransform4D::MakeRotationZ(Components.Z);
+			FTransform4D S = FTransform4D::MakeScale(Components);
+			Data.TransformResults[Index] = T * RZ * RY * RX * S;
+		}
+	}
+
+	BENCHMARK("Compose transforms (batch)")
+	{
+		FTransformBatch::ComposeTransforms(InputStreams, InputStreams, InputStreams, Data.TransformResults.GetData(), NumBenchmarkElements);
+	}
+}
+
+namespace
+{
+	// Applies a vector function to every element of InValues, 4 or 8 lanes at a time.
+	template<typename FunctionType>
+	void BenchmarkVector4(const TArray<float>& InValues, TArray<float>& OutResults, FunctionType InFunction)
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; Index += VectorRegister4Lanes)
+		{
+			VectorStore(InFunction(VectorLoad(InValues.GetData() + Index)), OutResults.GetData() + Index);
+		}
+	}
+
+	template<typename FunctionType>
+	void BenchmarkVector8(const TArray<float>& InValues, TArray<float>& OutResults, FunctionType InFunction)
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; Index += VectorRegister8Lanes)
+		{
+			Vector8Store(InFunction(Vector8Load(InValues.GetData() + Index)), OutResults.GetData() + Index);
+		}
+	}
+}
+
+TEST_CASE("Transcendental benchmarks.", "[.][Benchmark]")
+{
+	static_assert(NumBenchmarkElements % VectorRegister8Lanes == 0, "The vector benchmarks don't handle remainders.");
+
+	// Positive values, so every function is in its domain.
+	TArray<float> Values;
+	TArray<float> Results;
+	for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+	{
+		Values.Add(0.1f + static_cast<float>(Index % 1000) * 0.01f);
+		Results.Add(0.0f);
+	}
+
+	BENCHMARK("Sin (std)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = FMath::Sin(Values[Index]);
+		}
+	}
+
+	BENCHMARK("Sin (4-wide)")
+	{
+		BenchmarkVector4(Values, Results, [](FVectorRegister4 InX) { return VectorSin(InX); });
+	}
+
+	BENCHMARK("Sin (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InX) { return VectorSin(InX); });
+	}
+
+	BENCHMARK("Atan2 (std)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = FMath::Atan2(Values[Index], 1.0f);
+		}
+	}
+
+	BENCHMARK("Atan2 (FMath::FastAtan2)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = FMath::FastAtan2(Values[Index], 1.0f);
+		}
+	}
+
+	BENCHMARK("Atan2 (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InY) { return VectorAtan2(InY, Vector8Splat(1.0f)); });
+	}
+
+	BENCHMARK("Exp (std)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = std::exp(Values[Index]);
+		}
+	}
+
+	BENCHMARK("Exp (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InX) { return VectorExp(InX); });
+	}
+
+	BENCHMARK("Log (std)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = std::log(Values[Index]);
+		}
+	}
+
+	BENCHMARK("Log (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InX) { return VectorLog(InX); });
+	}
+
+	BENCHMARK("Pow (std)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = FMath::Pow(Values[Index], 2.2f);
+		}
+	}
+
+	BENCHMARK("Pow (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InX) { return VectorPow(InX, Vector8Splat(2.2f)); });
+	}
+
+	BENCHMARK("Inverse square root (FMath::InvSqrt)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Results[Index] = FMath::InvSqrt(Values[Index]);
+		}
+	}
+
+	BENCHMARK("Inverse square root (8-wide)")
+	{
+		BenchmarkVector8(Values, Results, [](FVectorRegister8 InX) { return VectorReciprocalSqrtFast(InX); });
+	}
+}
+
+TEST_CASE("Bounding volume benchmarks.", "[.][Benchmark]")
+{
+	// A grid of boxes and spheres in front of a camera looking down -Z, roughly half of which are visible.
+	TArray<FAABB> Boxes;
+	TArray<FSphere> Spheres;
+	TArray<FAABB> BoxResults;
+	for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+	{
+		FVector3D Center(static_cast<float>(Index % 100) - 50.0f, static_cast<float>((Index / 100) % 100) - 50.0f, -static_cast<float>(Index / 10000) * 10.0f);
+		Boxes.Add(FAABB::MakeFromCenterAndExtent(Center, FVector3D(0.5f, 0.5f, 0.5f)));
+		Spheres.Add(FSphere(Center, 0.5f));
+		BoxResults.Add(FAABB());
+	}
+	TArray<bool> Visible;
+	TArray<float> Distances;
+	for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+	{
+		Visible.Add(false);
+		Distances.Add(0.0f);
+	}
+
+	FMatrix4D Projection;
+	Projection[0][0] = 1.0f;
+	Projection[1][1] = 1.0f;
+	Projection[2][2] = -101.0f / 99.0f;
+	Projection[2][3] = -1.0f;
+	Projection[3][2] = -200.0f / 99.0f;
+	const FFrustumPlanes Frustum = FFrustumPlanes::MakeFromViewProjection(Projection);
+	const FRay Ray(FVector3D(0.1f, 0.2f, 10.0f), FVector3D::Normalize(FVector3D(0.1f, -0.2f, -1.0f)));
+	const FTransform4D Transform = MakeBenchmarkTransform(0);
+
+	BENCHMARK("Frustum vs. AABB (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Visible[Index] = Frustum.Intersects(Boxes[Index]);
+		}
+	}
+
+	BENCHMARK("Frustum vs. AABB (batch)")
+	{
+		FBoundsBatch::CullAABBs(Frustum, Boxes.GetData(), Visible.GetData(), NumBenchmarkElements);
+	}
+
+	BENCHMARK("Frustum vs. sphere (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			Visible[Index] = Frustum.Intersects(Spheres[Index]);
+		}
+	}
+
+	BENCHMARK("Frustum vs. sphere (batch)")
+	{
+		FBoundsBatch::CullSpheres(Frustum, Spheres.GetData(), Visible.GetData(), NumBenchmarkElements);
+	}
+
+	BENCHMARK("Ray vs. AABB (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			float Distance;
+			Distances[Index] = Ray.Intersects(Boxes[Index], Distance) ? Distance : FMath::MaxFloat;
+		}
+	}
+
+	BENCHMARK("Ray vs. AABB (batch)")
+	{
+		FBoundsBatch::RaycastAABBs(Ray, Boxes.GetData(), Distances.GetData(), NumBenchmarkElements);
+	}
+
+	BENCHMARK("Transform AABBs (scalar, per element)")
+	{
+		for (int32 Index = 0; Index < NumBenchmarkElements; ++Index)
+		{
+			BoxResults[Index] = Boxes[Index].GetTransformed(Transform);
+		}
+	}
+
+	BENCHMARK("Transform AABBs (batch)")
+	{
+		FBoundsBatch::TransformAABBs(Transform, Boxes.GetData(), BoxResults.GetData(), NumBenchmarkElements);
+	}
+}
@@ -227,3 +227,40 @@ TEST_CASE("FMath::IsPowerOfTwo")
 	REQUIRE(!FMath::IsPowerOfTwo(3));
 	REQUIRE(!FMath::IsPowerOfTwo(-2));
 }
+
+TEST_CASE("FMath::FloorLog2")
+{
+	REQUIRE(FMath::FloorLog2(1) == 0);
+	REQUIRE(FMath::FloorLog2(255) == 7);
+	REQUIRE(FMath::FloorLog2(256) == 8);
+	REQUIRE(FMath::FloorLog2(1ull << 40) == 40);
+	REQUIRE(FMath::FloorLog2(~0ull) == 63);
+}
+
+TEST_CASE("FMath::CountTrailingZeros")
+{
+	REQUIRE(FMath::CountTrailingZeros(1) == 0);
+	REQUIRE(FMath::CountTrailingZeros(12) == 2);
+	REQUIRE(FMath::CountTrailingZeros(1ull << 40) == 40);
+	REQUIRE(FMath::CountTrailingZeros(1ull << 63) == 63);
+}
+
+TEST_CASE("FMath::CountSetBits")
+{
+	REQUIRE(FMath::CountSetBits(0) == 0);
+	REQUIRE(FMath::CountSetBits(1) == 1);
+	REQUIRE(FMath::CountSetBits(0xF0F0) == 8);
+	REQUIRE(FMath::CountSetBits((1ull << 63) | 1) == 2);
+	REQUIRE(FMath::CountSetBits(~0ull) == 64);
+}
+
+TEST_CASE("FMath compile-time evaluation.")
+{
+	static_assert(FMath::Clamp(2.0f, 0.0f, 1.0f) == 1.0f, "FMath::Clamp should be usable in constant expressions.");
+	static_assert(FMath::Max(1, 2) == 2 && FMath::Min(1, 2) == 1, "FMath::Max and Min should be usable in constant expressions.");
+	static_assert(FMath::IsPowerOfTwo(64) && !FMath::IsPowerOfTwo(65), "FMath::IsPowerOfTwo should be usable in constant expressions.");
+	static_assert(FMath::RoundUpToNearestPowerOfTwo(33) == 64, "FMath::RoundUpToNearestPowerOfTwo should be usable in constant expressions.");
+
+	constexpr float Radians = FMath::DegreesToRadians(180.0f);
+	REQUIRE(FMath::IsApproximatelyEqual(Radians, FMath::Pi));
+}
@@ -0,0 +1,561 @@
+#include "catch/catch.hpp"
+
+#include "Memory/PoolAllocator.h"
+#include "Memory/TLSFAllocator.h"
+#include "Memory/NewDeleteAllocator.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Allocate and free throughput of the engine allocators compared to malloc.
+ * Benchmarks are hidden from the default test run; run them with: Test "[Benchmark]"
+ *
+ * Each benchmark keeps a window of live small blocks of mixed sizes and replaces the oldest one on every
+ * iteration, which resembles the churn of short-lived engine objects such as control blocks and events.
+ * The producer/consumer benchmarks free every block on another thread than the one that allocated it, like
+ * work items passed between job threads.
+ *
+ * The general-purpose heap benchmarks replay a recorded trace of container and block allocations with mixed
+ * sizes and lifetimes, and report the latency of each operation and how fragmented the heap gets.
+ *
+ * The default allocator benchmarks compare the engine's default container allocator to operator new on the
+ * container allocations of loading a scene and of running frames.
+ */
+
+namespace
+{
+	// Number of allocate/free pairs per thread and benchmark.
+	constexpr int32 NumBenchmarkAllocations = 1000000;
+	// Number of blocks kept alive at once.
+	constexpr int32 LiveBlockWindow = 256;
+	constexpr int32 NumBenchmarkThreads = 4;
+
+	template<typename AllocateFunctionType, typename DeallocateFunctionType>
+	void ChurnBlocks(AllocateFunctionType InAllocate, DeallocateFunctionType InDeallocate)
+	{
+		void* Window[LiveBlockWindow] = {};
+		for (int32 Index = 0; Index < NumBenchmarkAllocations; ++Index)
+		{
+			int32 Slot = Index % LiveBlockWindow;
+			InDeallocate(Window[Slot]);
+			// Sizes from 16 to 256 bytes.
+			Window[Slot] = InAllocate(16 + (Index * 37) % 241);
+			*static_cast<int32*>(Window[Slot]) = Index;
+		}
+		for (void* Block : Window)
+		{
+			InDeallocate(Block);
+		}
+	}
+
+	void ChurnMalloc()
+	{
+		ChurnBlocks([](int32 InSizeBytes) { return std::malloc(InSizeBytes); }, [](void* InAddress) { std::free(InAddress); });
+	}
+
+	void ChurnPool(FPoolAllocator& InAllocator)
+	{
+		ChurnBlocks([&InAllocator](int32 InSizeBytes) { return InAllocator.Allocate(InSizeBytes); }, [&InAllocator](void* InAddress) { InAllocator.Deallocate(InAddress); });
+	}
+
+	// One allocation or deallocation of a recorded trace. Allocations are numbered in order.
+	struct FTraceEvent
+	{
+		int32 Id;
+		int32 SizeBytes;
+		bool bIsAllocation;
+	};
+
+	// Allocator that forwards to malloc and records every allocation and deallocation.
+	class FRecordingAllocator : public IAllocator
+	{
+	public:
+		// Begin IAllocator interface.
+		virtual void* Allocate(int32 InSizeBytes, EMemoryAlignment /* InAlignment */ = EMemoryAlignment::Default) override
+		{
+			// malloc aligns to at least 8 bytes, which covers every EMemoryAlignment.
+			void* Address = std::malloc(InSizeBytes);
+			LiveIds[Address] = NumAllocations;
+			Trace.push_back({ NumAllocations++, InSizeBytes, true });
+			return Address;
+		}
+
+		virtual void Deallocate(void* InAddress) override
+		{
+			if (!InAddress)
+			{
+				return;
+			}
+			auto Iterator = LiveIds.find(InAddress);
+			Trace.push_back({ Iterator->second, 0, false });
+			LiveIds.erase(Iterator);
+			std::free(InAddress);
+		}
+		// End IAllocator interface.
+
+		std::vector<FTraceEvent> Trace;
+		int32 NumAllocations = 0;
+
+	private:
+		std::unordered_map<void*, int32> LiveIds;
+	};
+
+	// Number of simulated frames in the recorded trace, and objects created per frame.
+	constexpr int32 NumTraceFrames = 1000;
+	constexpr int32 NumTraceObjectsPerFrame = 20;
+
+	// Records a trace of growing arrays, maps and raw blocks. Most live for a single frame, some for a few
+	// dozen frames, and a few for a large part of the trace, so long-lived blocks end up between freed ones.
+	FRecordingAllocator RecordTrace()
+	{
+		struct FTraceObject
+		{
+			int32 LastFrame;
+			std::unique_ptr<TArray<int32>> Array;
+			std::unique_ptr<TMap<int32, int32>> Map;
+			void* Block;
+		};
+
+		FRecordingAllocator Recorder;
+		std::mt19937 Random(42);
+		std::vector<FTraceObject> Objects;
+		auto ReleaseObject = [&Recorder](FTraceObject& InObject)
+		{
+			InObject.Array.reset();
+			InObject.Map.reset();
+			Recorder.Deallocate(InObject.Block);
+		};
+
+		for (int32 Frame = 0; Frame < NumTraceFrames; ++Frame)
+		{
+			for (int32 Index = 0; Index < NumTraceObjectsPerFrame; ++Index)
+			{
+				uint32 Lifetime = Random() % 10;
+				FTraceObject Object = { Frame + static_cast<int32>(Lifetime < 7 ? 0 : Lifetime < 9 ? Random() % 30 : Random() % 300), nullptr, nullptr, nullptr };
+				switch (Random() % 3)
+				{
+				case 0:
+				{
+					Object.Array = std::make_unique<TArray<int32>>(Recorder);
+					int32 NumElements = static_cast<int32>(Random() % 2000);
+					for (int32 Element = 0; Element < NumElements; ++Element)
+					{
+						Object.Array->Add(Element);
+					}
+					break;
+				}
+				case 1:
+				{
+					Object.Map = std::make_unique<TMap<int32, int32>>(Recorder);
+					int32 NumElements = static_cast<int32>(Random() % 200);
+					for (int32 Element = 0; Element < NumElements; ++Element)
+					{
+						Object.Map->Add(Element, Element);
+					}
+					break;
+				}
+				default:
+					Object.Block = Recorder.Allocate(16 + static_cast<int32>(Random() % (Random() % 16 == 0 ? 65536 : 512)));
+					break;
+				}
+				Objects.push_back(std::move(Object));
+			}
+
+			for (size_t Index = 0; Index < Objects.size();)
+			{
+				if (Objects[Index].LastFrame <= Frame)
+				{
+					ReleaseObject(Objects[Index]);
+					Objects[Index] = std::move(Objects.back());
+					Objects.pop_back();
+				}
+				else
+				{
+					++Index;
+				}
+			}
+		}
+
+		for (FTraceObject& Object : Objects)
+		{
+			ReleaseObject(Object);
+		}
+		return Recorder;
+	}
+
+	/**
+	 * Replays a trace with the given allocate and deallocate functions, calling InOnEvent after each event.
+	 * Returns the duration of each event in nanoseconds, or nothing if bInMeasureEvents is false.
+	 */
+	template<typename AllocateFunctionType, typename DeallocateFunctionType, typename EventFunctionType>
+	std::vector<int64> ReplayTrace(const FRecordingAllocator& InRecording, bool bInMeasureEvents, AllocateFunctionType InAllocate, DeallocateFunctionType InDeallocate, EventFunctionType InOnEvent)
+	{
+		using FClock = std::chrono::steady_clock;
+
+		std::vector<void*> Blocks(InRecording.NumAllocations, nullptr);
+		std::vector<int64> EventDurations;
+		EventDurations.reserve(bInMeasureEvents ? InRecording.Trace.size() : 0);
+		for (const FTraceEvent& Event : InRecording.Trace)
+		{
+			FClock::time_point StartTime = bInMeasureEvents ? FClock::now() : FClock::time_point();
+			if (Event.bIsAllocation)
+			{
+				Blocks[Event.Id] = InAllocate(Event.SizeBytes);
+			}
+			else
+			{
+				InDeallocate(Blocks[Event.Id]);
+			}
+			if (bInMeasureEvents)
+			{
+				EventDurations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(FClock::now() - StartTime).count());
+			}
+			InOnEvent();
+		}
+		return EventDurations;
+	}
+
+	// Average, 99th percentile and worst event durations.
+	struct FLatencySummary
+	{
+		double Average;
+		int64 Percentile99;
+		int64 Max;
+	};
+
+	FLatencySummary SummarizeLatency(std::vector<int64> InEventDurations)
+	{
+		std::sort(InEventDurations.begin(), InEventDurations.end());
+		int64 Total = 0;
+		for (int64 Duration : InEventDurations)
+		{
+			Total += Duration;
+		}
+		return { static_cast<double>(Total) / InEventDurations.size(), InEventDurations[InEventDurations.size() * 99 / 100], InEventDurations.back() };
+	}
+
+	template<typename FunctionType>
+	void RunOnThreads(FunctionType InFunction)
+	{
+		std::vector<std::thread> Threads;
+		for (int32 ThreadIndex = 0; ThreadIndex < NumBenchmarkThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back(InFunction);
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
+	// Number of meshes in the loaded scene, and frames run per benchmark.
+	constexpr int32 NumSceneMeshes = 2000;
+	constexpr int32 NumBenchmarkFrames = 100;
+
+	/**
+	 * Makes the container allocations of loading a scene: per mesh, a vertex and an index array of model sizes and
+	 * a few small arrays of sections, plus a map of meshes by id. Everything is kept until the scene is unloaded.
+	 */
+	void LoadScene(IAllocator& InAllocator)
+	{
+		struct FMeshData
+		{
+			explicit FMeshData(IAllocator& InMeshAllocator)
+				: Vertices(InMeshAllocator)
+				, Indices(InMeshAllocator)
+				, Sections(InMeshAllocator)
+			{
+			}
+
+			TArray<float> Vertices;
+			TArray<int32> Indices;
+			TArray<int32> Sections;
+		};
+
+		std::mt19937 Random(7);
+		std::vector<std::unique_ptr<FMeshData>> Meshes;
+		TMap<int32, int32> MeshIds(InAllocator);
+		for (int32 MeshIndex = 0; MeshIndex < NumSceneMeshes; ++MeshIndex)
+		{
+			// Most meshes are props of up to a thousand vertices of 8 floats, and a few are much larger.
+			int32 NumVertices = 50 + static_cast<int32>(Random() % (Random() % 8 == 0 ? 20000 : 1000));
+			std::unique_ptr<FMeshData> Mesh = std::make_unique<FMeshData>(InAllocator);
+			Mesh->Vertices.Reserve(NumVertices * 8);
+			for (int32 Index = 0; Index < NumVertices * 8; ++Index)
+			{
+				Mesh->Vertices.Add(static_cast<float>(Index));
+			}
+			Mesh->Indices.Reserve(NumVertices * 3);
+			for (int32 Index = 0; Index < NumVertices * 3; ++Index)
+			{
+				Mesh->Indices.Add(Index % NumVertices);
+			}
+			int32 NumSections = 1 + static_cast<int32>(Random() % 8);
+			for (int32 Index = 0; Index < NumSections; ++Index)
+			{
+				Mesh->Sections.Add(Index * NumVertices / NumSections);
+			}
+
+			MeshIds.Add(MeshIndex, static_cast<int32>(Meshes.size()));
+			Meshes.push_back(std::move(Mesh));
+		}
+	}
+
+	/**
+	 * Makes the container allocations of running frames: per frame, a growing list of visible objects, a set of
+	 * objects touched by the simulation and small arrays of draw commands, all freed at the end of the frame.
+	 */
+	void RunFrames(IAllocator& InAllocator)
+	{
+		for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+		{
+			TArray<int32> VisibleObjects(InAllocator);
+			for (int32 Index = 0; Index < 2000 + Frame; ++Index)
+			{
+				VisibleObjects.Add(Index);
+			}
+
+			TSet<int32> TouchedObjects(InAllocator);
+			for (int32 Index = 0; Index < 200; ++Index)
+			{
+				TouchedObjects.Add((Index * 7919 + Frame) % 4096);
+			}
+
+			for (int32 Batch = 0; Batch < 32; ++Batch)
+			{
+				TArray<int32> DrawCommands(InAllocator);
+				int32 NumCommands = 16 + (Frame * 37 + Batch * 101) % 200;
+				for (int32 Index = 0; Index < NumCommands; ++Index)
+				{
+					DrawCommands.Add(VisibleObjects[Index]);
+				}
+			}
+		}
+	}
+
+	// Number of blocks in flight between a producer and its consumer.
+	constexpr int32 HandoffQueueSize = 1024;
+
+	/**
+	 * Runs pairs of threads where the producer allocates blocks and passes them to the consumer, which frees them,
+	 * so every block is freed by a different thread than the one that allocated it.
+	 */
+	template<typename AllocateFunctionType, typename DeallocateFunctionType>
+	void PassBlocks(AllocateFunctionType InAllocate, DeallocateFunctionType InDeallocate)
+	{
+		// Single-producer single-consumer ring of blocks.
+		struct FHandoffQueue
+		{
+			void* Blocks[HandoffQueueSize];
+			std::atomic<int32> Head{ 0 };
+			std::atomic<int32> Tail{ 0 };
+		};
+
+		auto Produce = [&InAllocate](FHandoffQueue& InQueue)
+		{
+			for (int32 Index = 0; Index < NumBenchmarkAllocations; ++Index)
+			{
+				void* Block = InAllocate(16 + (Index * 37) % 241);
+				*static_cast<int32*>(Block) = Index;
+
+				int32 Tail = InQueue.Tail.load(std::memory_order_relaxed);
+				while (Tail - InQueue.Head.load(std::memory_order_acquire) == HandoffQueueSize)
+				{
+					std::this_thread::yield();
+				}
+				InQueue.Blocks[Tail % HandoffQueueSize] = Block;
+				InQueue.Tail.store(Tail + 1, std::memory_order_release);
+			}
+		};
+
+		auto Consume = [&InDeallocate](FHandoffQueue& InQueue)
+		{
+			for (int32 Index = 0; Index < NumBenchmarkAllocations; ++Index)
+			{
+				int32 Head = InQueue.Head.load(std::memory_order_relaxed);
+				while (InQueue.Tail.load(std::memory_order_acquire) == Head)
+				{
+					std::this_thread::yield();
+				}
+				InDeallocate(InQueue.Blocks[Head % HandoffQueueSize]);
+				InQueue.Head.store(Head + 1, std::memory_order_release);
+			}
+		};
+
+		std::vector<std::unique_ptr<FHandoffQueue>> Queues;
+		std::vector<std::thread> Threads;
+		for (int32 PairIndex = 0; PairIndex < NumBenchmarkThreads / 2; ++PairIndex)
+		{
+			Queues.push_back(std::make_unique<FHandoffQueue>());
+			Threads.emplace_back(Produce, std::ref(*Queues.back()));
+			Threads.emplace_back(Consume, std::ref(*Queues.back()));
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+}
+
+TEST_CASE("Small allocation benchmarks.", "[.][Benchmark]")
+{
+	FPoolAllocator SingleThreadedAllocator(EPoolThreading::SingleThreaded);
+	FPoolAllocator LockedAllocator(EPoolThreading::Locked);
+	FPoolAllocator ThreadCachedAllocator(EPoolThreading::ThreadCached);
+
+	BENCHMARK("malloc, 1 thread")
+	{
+		ChurnMalloc();
+	}
+
+	BENCHMARK("FPoolAllocator (single-threaded), 1 thread")
+	{
+		ChurnPool(SingleThreadedAllocator);
+	}
+
+	BENCHMARK("FPoolAllocator (locked), 1 thread")
+	{
+		ChurnPool(LockedAllocator);
+	}
+
+	BENCHMARK("FPoolAllocator (thread-cached), 1 thread")
+	{
+		ChurnPool(ThreadCachedAllocator);
+	}
+
+	BENCHMARK("malloc, 4 threads")
+	{
+		RunOnThreads([]() { ChurnMalloc(); });
+	}
+
+	BENCHMARK("FPoolAllocator (locked), 4 threads")
+	{
+		RunOnThreads([&]() { ChurnPool(LockedAllocator); });
+	}
+
+	BENCHMARK("FPoolAllocator (thread-cached), 4 threads")
+	{
+		RunOnThreads([&]() { ChurnPool(ThreadCachedAllocator); });
+	}
+}
+
+TEST_CASE("Producer/consumer allocation benchmarks.", "[.][Benchmark]")
+{
+	FPoolAllocator LockedAllocator(EPoolThreading::Locked);
+	FPoolAllocator ThreadCachedAllocator(EPoolThreading::ThreadCached);
+
+	BENCHMARK("malloc, 2 producers and 2 consumers")
+	{
+		PassBlocks([](int32 InSizeBytes) { return std::malloc(InSizeBytes); }, [](void* InAddress) { std::free(InAddress); });
+	}
+
+	BENCHMARK("FPoolAllocator (locked), 2 producers and 2 consumers")
+	{
+		PassBlocks([&](int32 InSizeBytes) { return LockedAllocator.Allocate(InSizeBytes); }, [&](void* InAddress) { LockedAllocator.Deallocate(InAddress); });
+	}
+
+	BENCHMARK("FPoolAllocator (thread-cached), 2 producers and 2 consumers")
+	{
+		PassBlocks([&](int32 InSizeBytes) { return ThreadCachedAllocator.Allocate(InSizeBytes); }, [&](void* InAddress) { ThreadCachedAllocator.Deallocate(InAddress); });
+	}
+}
+
+TEST_CASE("General-purpose heap benchmarks.", "[.][Benchmark]")
+{
+	const FRecordingAllocator Recording = RecordTrace();
+	// A few times the trace's peak usage, so that fragmentation decides how well the trace fits.
+	const uint64 HeapSize = 4 * 1024 * 1024;
+	std::vector<int8> HeapMemory(HeapSize);
+
+	auto MallocAllocate = [](int32 InSizeBytes) { return std::malloc(InSizeBytes); };
+	auto MallocDeallocate = [](void* InAddress) { std::free(InAddress); };
+	auto NoEvent = []() {};
+
+	BENCHMARK("malloc, recorded trace")
+	{
+		ReplayTrace(Recording, false, MallocAllocate, MallocDeallocate, NoEvent);
+	}
+
+	BENCHMARK("FTLSFAllocator, recorded trace")
+	{
+		FTLSFAllocator Allocator(HeapMemory.data(), HeapSize);
+		ReplayTrace(Recording, false, [&Allocator](int32 InSizeBytes) { return Allocator.Allocate(InSizeBytes); }, [&Allocator](void* InAddress) { Allocator.Deallocate(InAddress); }, NoEvent);
+	}
+
+	// Sample fragmentation while the heap is in use, skipping the nearly empty start and end of the trace.
+	// Failed allocations mean the heap was too fragmented for the trace.
+	FTLSFAllocator Allocator(HeapMemory.data(), HeapSize);
+	int32 NumFailedAllocations = 0;
+	uint64 PeakBytesUsed = 0;
+	double TotalFragmentation = 0.0;
+	float PeakFragmentation = 0.0f;
+	int32 NumSamples = 0;
+	int32 EventIndex = 0;
+	std::vector<int64> TLSFEventDurations = ReplayTrace(Recording, true,
+		[&](int32 InSizeBytes)
+		{
+			void* Address = Allocator.Allocate(InSizeBytes);
+			NumFailedAllocations += Address == nullptr;
+			return Address;
+		},
+		[&Allocator](void* InAddress) { Allocator.Deallocate(InAddress); },
+		[&]()
+		{
+			PeakBytesUsed = std::max(PeakBytesUsed, Allocator.GetNumBytesUsed());
+			if (++EventIndex % 256 == 0 && Allocator.GetNumBytesUsed() > PeakBytesUsed / 2)
+			{
+				float Fragmentation = Allocator.GetFragmentation();
+				TotalFragmentation += Fragmentation;
+				PeakFragmentation = std::max(PeakFragmentation, Fragmentation);
+				++NumSamples;
+			}
+		});
+	std::vector<int64> MallocEventDurations = ReplayTrace(Recording, true, MallocAllocate, MallocDeallocate, NoEvent);
+
+	FLatencySummary TLSFLatency = SummarizeLatency(TLSFEventDurations);
+	FLatencySummary MallocLatency = SummarizeLatency(MallocEventDurations);
+	WARN("Trace: " << Recording.Trace.size() << " events, peak " << PeakBytesUsed / 1024 << " KB in use");
+	WARN("FTLSFAllocator latency (ns): average " << TLSFLatency.Average << ", p99 " << TLSFLatency.Percentile99 << ", max " << TLSFLatency.Max);
+	WARN("malloc latency (ns): average " << MallocLatency.Average << ", p99 " << MallocLatency.Percentile99 << ", max " << MallocLatency.Max);
+	WARN("FTLSFAllocator fragmentation: average " << (NumSamples ? TotalFragmentation / NumSamples : 0.0) << ", peak " << PeakFragmentation << ", " << NumFailedAllocations << " failed allocations in a " << HeapSize / 1024 << " KB heap");
+}
+
+TEST_CASE("Default allocator benchmarks.", "[.][Benchmark]")
+{
+	FNewDeleteAllocator& NewDeleteAllocator = FNewDeleteAllocator::GetDefaultAllocator();
+	FPoolAllocator ThreadCachedAllocator(EPoolThreading::ThreadCached);
+
+	BENCHMARK("FNewDeleteAllocator, scene load")
+	{
+		LoadScene(NewDeleteAllocator);
+	}
+
+	BENCHMARK("FPoolAllocator (thread-cached), scene load")
+	{
+		LoadScene(ThreadCachedAllocator);
+	}
+
+	BENCHMARK("FNewDeleteAllocator, frames")
+	{
+		RunFrames(NewDeleteAllocator);
+	}
+
+	BENCHMARK("FPoolAllocator (thread-cached), frames")
+	{
+		RunFrames(ThreadCachedAllocator);
+	}
+
+	// Pages the pools hold after a scene was loaded and unloaded, not counting blocks larger than MaxBlockSize.
+	WARN("FPoolAllocator pages after a scene load: " << ThreadCachedAllocator.GetNumPages() * (FPoolAllocator::PageSize / 1024) << " KB");
+}
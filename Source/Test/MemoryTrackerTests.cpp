@@ -0,0 +1,191 @@
+#include "catch/catch.hpp"
+
+#include "Memory/MemoryTracker.h"
+#include "Memory/PoolAllocator.h"
+#include "Containers/Array.h"
+#include "Strings/StringId.h"
+
+#include <string>
+
+#if MEMORY_TRACKING
+
+namespace
+{
+	// Returns the counters of an allocator, or empty counters if the tracker doesn't know it.
+	FMemoryStats FindAllocatorStats(const IAllocator* InAllocator)
+	{
+		for (const FAllocatorMemoryStats& AllocatorStats : FMemoryTracker::Get().GetAllocatorStats())
+		{
+			if (AllocatorStats.Allocator == InAllocator)
+			{
+				return AllocatorStats.Stats;
+			}
+		}
+		return FMemoryStats();
+	}
+}
+
+TEST_CASE("FMemoryTracker tags")
+{
+	FMemoryTracker& MemoryTracker = FMemoryTracker::Get();
+	FPoolAllocator TestAllocator;
+
+	SECTION("Tag scopes nest")
+	{
+		REQUIRE(FMemoryTracker::GetCurrentTag() == EMemoryTag::Untagged);
+		{
+			MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+			REQUIRE(FMemoryTracker::GetCurrentTag() == EMemoryTag::Renderer);
+			{
+				MEMORY_TAG_SCOPE(EMemoryTag::Scene);
+				REQUIRE(FMemoryTracker::GetCurrentTag() == EMemoryTag::Scene);
+			}
+			REQUIRE(FMemoryTracker::GetCurrentTag() == EMemoryTag::Renderer);
+		}
+		REQUIRE(FMemoryTracker::GetCurrentTag() == EMemoryTag::Untagged);
+	}
+
+	SECTION("Allocations are attributed to the current tag")
+	{
+		FMemoryStats SceneStatsBefore = MemoryTracker.GetTagStats(EMemoryTag::Scene);
+		FMemoryStats RendererStatsBefore = MemoryTracker.GetTagStats(EMemoryTag::Renderer);
+
+		void* SceneBlock;
+		void* RendererBlock;
+		{
+			MEMORY_TAG_SCOPE(EMemoryTag::Scene);
+			SceneBlock = TestAllocator.Allocate(100);
+			{
+				MEMORY_TAG_SCOPE(EMemoryTag::Renderer);
+				RendererBlock = TestAllocator.Allocate(40);
+			}
+		}
+
+		FMemoryStats SceneStats = MemoryTracker.GetTagStats(EMemoryTag::Scene);
+		FMemoryStats RendererStats = MemoryTracker.GetTagStats(EMemoryTag::Renderer);
+		REQUIRE(SceneStats.LiveBytes - SceneStatsBefore.LiveBytes == 100);
+		REQUIRE(SceneStats.NumLiveAllocations - SceneStatsBefore.NumLiveAllocations == 1);
+		REQUIRE(RendererStats.LiveBytes - RendererStatsBefore.LiveBytes == 40);
+
+		// Deallocating outside of the scope still takes the bytes from the allocation's tag.
+		TestAllocator.Deallocate(SceneBlock);
+		TestAllocator.Deallocate(RendererBlock);
+		SceneStats = MemoryTracker.GetTagStats(EMemoryTag::Scene);
+		REQUIRE(SceneStats.LiveBytes == SceneStatsBefore.LiveBytes);
+		REQUIRE(SceneStats.TotalBytes - SceneStatsBefore.TotalBytes == 100);
+		REQUIRE(SceneStats.NumTotalAllocations - SceneStatsBefore.NumTotalAllocations == 1);
+		REQUIRE(MemoryTracker.GetTagStats(EMemoryTag::Renderer).LiveBytes == RendererStatsBefore.LiveBytes);
+	}
+}
+
+TEST_CASE("FMemoryTracker allocator stats")
+{
+	FPoolAllocator TestAllocator;
+	TRACK_ALLOCATOR_NAME(&TestAllocator, "Test pool");
+
+	SECTION("Live, peak and total counters")
+	{
+		void* First = TestAllocator.Allocate(64);
+		void* Second = TestAllocator.Allocate(1000);
+		TestAllocator.Deallocate(First);
+		void* Third = TestAllocator.Allocate(8);
+
+		FMemoryStats Stats = FindAllocatorStats(&TestAllocator);
+		REQUIRE(Stats.LiveBytes == 1008);
+		REQUIRE(Stats.PeakBytes == 1064);
+		REQUIRE(Stats.TotalBytes == 1072);
+		REQUIRE(Stats.NumLiveAllocations == 2);
+		REQUIRE(Stats.NumTotalAllocations == 3);
+
+		TestAllocator.Deallocate(Second);
+		TestAllocator.Deallocate(Third);
+		REQUIRE(FindAllocatorStats(&TestAllocator).LiveBytes == 0);
+	}
+
+	SECTION("Registered allocators are named")
+	{
+		TestAllocator.Deallocate(TestAllocator.Allocate(8));
+		bool bFoundName = false;
+		for (const FAllocatorMemoryStats& AllocatorStats : FMemoryTracker::Get().GetAllocatorStats())
+		{
+			bFoundName |= AllocatorStats.Allocator == &TestAllocator && std::string(AllocatorStats.Name) == "Test pool";
+		}
+		REQUIRE(bFoundName);
+	}
+
+	SECTION("Containers report through their allocator")
+	{
+		TArray<int32> TestArray(TestAllocator);
+		TestArray.Reserve(16);
+		REQUIRE(FindAllocatorStats(&TestAllocator).LiveBytes == 16 * sizeof(int32));
+	}
+}
+
+TEST_CASE("FMemoryTracker leak report")
+{
+	FMemoryTracker& MemoryTracker = FMemoryTracker::Get();
+
+	SECTION("Only live allocations since the checkpoint are reported")
+	{
+		FPoolAllocator TestAllocator;
+		void* Earlier = TestAllocator.Allocate(16);
+		uint64 Checkpoint = MemoryTracker.GetAllocationCheckpoint();
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 0);
+
+		void* Freed = TestAllocator.Allocate(16);
+		void* Leaked = TestAllocator.Allocate(32);
+		TestAllocator.Deallocate(Freed);
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 1);
+
+		TestAllocator.Deallocate(Leaked);
+		TestAllocator.Deallocate(Earlier);
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 0);
+	}
+
+	SECTION("Destroying an allocator forgets its allocations")
+	{
+		uint64 Checkpoint = MemoryTracker.GetAllocationCheckpoint();
+		{
+			FPoolAllocator TestAllocator;
+			TestAllocator.Allocate(16);
+		}
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 0);
+	}
+
+	SECTION("Allocators registered as persistent aren't reported")
+	{
+		FPoolAllocator TestAllocator;
+		TRACK_PERSISTENT_ALLOCATOR_NAME(&TestAllocator, "Test persistent pool");
+		uint64 Checkpoint = MemoryTracker.GetAllocationCheckpoint();
+		void* Persistent = TestAllocator.Allocate(64);
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 0);
+
+		// The allocations are still counted.
+		REQUIRE(FindAllocatorStats(&TestAllocator).LiveBytes == 64);
+		TestAllocator.Deallocate(Persistent);
+	}
+
+	SECTION("Registered string IDs aren't reported")
+	{
+		const IAllocator* PersistentAllocator = &FPoolAllocator::GetPersistentAllocator();
+		uint64 NumPersistentAllocations = FindAllocatorStats(PersistentAllocator).NumTotalAllocations;
+		uint64 Checkpoint = MemoryTracker.GetAllocationCheckpoint();
+		FStringId MaterialName("Assets/Materials/SomeLongMaterialName.mat");
+		REQUIRE(MaterialName.GetString().GetSize() > FANSIString::InlineCapacity);
+		REQUIRE(FindAllocatorStats(PersistentAllocator).NumTotalAllocations > NumPersistentAllocations);
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 0);
+	}
+
+	SECTION("Call stacks can be captured")
+	{
+		FPoolAllocator TestAllocator;
+		uint64 Checkpoint = MemoryTracker.GetAllocationCheckpoint();
+		MemoryTracker.SetCaptureCallStacks(true);
+		void* Leaked = TestAllocator.Allocate(48);
+		MemoryTracker.SetCaptureCallStacks(false);
+		REQUIRE(MemoryTracker.ReportLeaks(Checkpoint) == 1);
+		TestAllocator.Deallocate(Leaked);
+	}
+}
+
+#endif
@@ -0,0 +1,71 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/OBB.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return FMath::IsApproximatelyEqual(InA.X, InB.X, 1.e-4f)
+		&& FMath::IsApproximatelyEqual(InA.Y, InB.Y, 1.e-4f)
+		&& FMath::IsApproximatelyEqual(InA.Z, InB.Z, 1.e-4f);
+}
+
+// A unit cube rotated 45 degrees around Z, so that its corners point along the X and Y axes.
+static FOBB MakeRotatedCube(const FVector3D& InCenter)
+{
+	FAABB Cube = FAABB::MakeFromCenterAndExtent(FVector3D::Zero, FVector3D::One);
+	return FOBB::MakeFromAABB(Cube, FTransform4D::MakeTranslation(InCenter) * FTransform4D::MakeRotationZ(FMath::PiOverFour));
+}
+
+TEST_CASE("FOBB construction.")
+{
+	FAABB Box(FVector3D(0.0f, 0.0f, 0.0f), FVector3D(2.0f, 2.0f, 2.0f));
+	FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(5.0f, 0.0f, 0.0f)) * FTransform4D::MakeRotationZ(FMath::PiOverTwo) * FTransform4D::MakeScale(FVector3D(2.0f, 1.0f, 3.0f));
+	FOBB Oriented = FOBB::MakeFromAABB(Box, Transform);
+
+	REQUIRE(IsNearlyEqual(Oriented.Center, FVector3D(4.0f, 2.0f, 3.0f)));
+	REQUIRE(IsNearlyEqual(Oriented.Axes[0], FVector3D::YAxis));
+	REQUIRE(IsNearlyEqual(Oriented.Axes[1], -FVector3D::XAxis));
+	REQUIRE(IsNearlyEqual(Oriented.Axes[2], FVector3D::ZAxis));
+	REQUIRE(IsNearlyEqual(Oriented.Extent, FVector3D(2.0f, 1.0f, 3.0f)));
+
+	// Without shear, the bounds of the oriented box match the transformed axis-aligned box.
+	FAABB Bounds = Oriented.GetAABB();
+	FAABB Expected = Box.GetTransformed(Transform);
+	REQUIRE(IsNearlyEqual(Bounds.Min, Expected.Min));
+	REQUIRE(IsNearlyEqual(Bounds.Max, Expected.Max));
+}
+
+TEST_CASE("FOBB queries.")
+{
+	FOBB Cube = MakeRotatedCube(FVector3D::Zero);
+	float Diagonal = FMath::Sqrt(2.0f);
+
+	REQUIRE(Cube.Contains(FVector3D(Diagonal - 0.01f, 0.0f, 0.0f)));
+	REQUIRE(!Cube.Contains(FVector3D(1.0f, 1.0f, 0.0f)));
+	REQUIRE(IsNearlyEqual(Cube.GetClosestPoint(FVector3D(5.0f, 0.0f, 0.0f)), FVector3D(Diagonal, 0.0f, 0.0f)));
+	REQUIRE(FMath::IsApproximatelyEqual(Cube.GetProjectedExtent(FVector3D::XAxis), Diagonal, 1.e-5f));
+	REQUIRE(FMath::IsApproximatelyEqual(Cube.GetProjectedExtent(FVector3D::ZAxis), 1.0f, 1.e-5f));
+}
+
+TEST_CASE("FOBB intersection.")
+{
+	FOBB Cube = MakeRotatedCube(FVector3D::Zero);
+	FOBB AxisAligned(FVector3D(2.2f, 0.0f, 0.0f), FVector3D::XAxis, FVector3D::YAxis, FVector3D::ZAxis, FVector3D::One);
+
+	// The rotated cube's corner reaches X = 1.41, and the other box starts at X = 1.2.
+	REQUIRE(Cube.Intersects(AxisAligned));
+	REQUIRE(AxisAligned.Intersects(Cube));
+
+	AxisAligned.Center.X = 2.5f;
+	REQUIRE(!Cube.Intersects(AxisAligned));
+	REQUIRE(!AxisAligned.Intersects(Cube));
+
+	// A cube tilted around X, whose lowest edge is at Z = Center.Z - 1.41, above and then below the other cube's top face.
+	FOBB Tilted = FOBB::MakeFromAABB(FAABB::MakeFromCenterAndExtent(FVector3D::Zero, FVector3D::One), FTransform4D::MakeTranslation(FVector3D(0.0f, 0.0f, 2.9f)) * FTransform4D::MakeRotationX(FMath::PiOverFour));
+	REQUIRE(!Cube.Intersects(Tilted));
+	Tilted.Center.Z = 2.3f;
+	REQUIRE(Cube.Intersects(Tilted));
+}
@@ -0,0 +1,28 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/Plane.h"
+#include "Math/MathUtilities.h"
+
+TEST_CASE("FPlane construction.")
+{
+	FPlane FromNormal = FPlane::MakeFromPointAndNormal(FVector3D(0.0f, 0.0f, 2.0f), FVector3D::ZAxis);
+	REQUIRE(FromNormal == FPlane(FVector3D::ZAxis, -2.0f));
+
+	// Counter-clockwise when seen from +Z.
+	FPlane FromPoints = FPlane::MakeFromPoints(FVector3D(0.0f, 0.0f, 2.0f), FVector3D(1.0f, 0.0f, 2.0f), FVector3D(0.0f, 1.0f, 2.0f));
+	REQUIRE(FromPoints == FromNormal);
+
+	FPlane Scaled(FVector3D(0.0f, 3.0f, 4.0f), 10.0f);
+	Scaled.Normalize();
+	REQUIRE(FMath::IsApproximatelyEqual(Scaled.Normal.Y, 0.6f));
+	REQUIRE(FMath::IsApproximatelyEqual(Scaled.Normal.Z, 0.8f));
+	REQUIRE(FMath::IsApproximatelyEqual(Scaled.D, 2.0f));
+}
+
+TEST_CASE("FPlane distances.")
+{
+	FPlane Plane(FVector3D::YAxis, -1.0f);
+	REQUIRE(Plane.GetSignedDistance(FVector3D(5.0f, 3.0f, 0.0f)) == 2.0f);
+	REQUIRE(Plane.GetSignedDistance(FVector3D(5.0f, -1.0f, 7.0f)) == -2.0f);
+	REQUIRE(Plane.ProjectPoint(FVector3D(5.0f, 3.0f, 7.0f)) == FVector3D(5.0f, 1.0f, 7.0f));
+}
@@ -0,0 +1,356 @@
+#include "catch/catch.hpp"
+
+#include "Memory/PoolAllocator.h"
+#include "Containers/Set.h"
+#include "Containers/Map.h"
+#include "SmartPointers/SharedPtr.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// Counts live instances, to check that pooled shared objects are destroyed.
+	struct FPooledObject
+	{
+		explicit FPooledObject(int32 InValue)
+			: Value(InValue)
+		{
+			++NumLiveObjects;
+		}
+
+		~FPooledObject()
+		{
+			--NumLiveObjects;
+		}
+
+		int32 Value;
+		static int32 NumLiveObjects;
+	};
+
+	int32 FPooledObject::NumLiveObjects = 0;
+}
+
+TEST_CASE("FPoolAllocator::Allocate")
+{
+	FPoolAllocator TestAllocator;
+
+	SECTION("Cannot allocate 0 bytes")
+	{
+		REQUIRE(TestAllocator.Allocate(0) == nullptr);
+	}
+
+	SECTION("Requests are rounded up to a size class")
+	{
+		REQUIRE(FPoolAllocator::GetBlockSize(1) == 8);
+		REQUIRE(FPoolAllocator::GetBlockSize(8) == 8);
+		REQUIRE(FPoolAllocator::GetBlockSize(9) == 16);
+		REQUIRE(FPoolAllocator::GetBlockSize(40) == 48);
+		REQUIRE(FPoolAllocator::GetBlockSize(200) == 256);
+		REQUIRE(FPoolAllocator::GetBlockSize(513) == 640);
+		REQUIRE(FPoolAllocator::GetBlockSize(1024) == 1024);
+		REQUIRE(FPoolAllocator::GetBlockSize(1025) == 1280);
+		REQUIRE(FPoolAllocator::GetBlockSize(20000) == 20480);
+		REQUIRE(FPoolAllocator::GetBlockSize(FPoolAllocator::MaxBlockSize) == FPoolAllocator::MaxBlockSize);
+		REQUIRE(FPoolAllocator::GetBlockSize(FPoolAllocator::MaxBlockSize + 1) == FPoolAllocator::MaxBlockSize + 1);
+	}
+
+	SECTION("Blocks of a size class are adjacent and aligned")
+	{
+		int8* First = static_cast<int8*>(TestAllocator.Allocate(48));
+		int8* Second = static_cast<int8*>(TestAllocator.Allocate(40));
+		REQUIRE(Second == First + 48);
+		REQUIRE(reinterpret_cast<uint64>(First) % 16 == 0);
+		REQUIRE(reinterpret_cast<uint64>(Second) % 16 == 0);
+
+		int8* Small = static_cast<int8*>(TestAllocator.Allocate(3));
+		REQUIRE(reinterpret_cast<uint64>(Small) % 8 == 0);
+	}
+
+	SECTION("Pages are added when a size class runs out of blocks")
+	{
+		REQUIRE(TestAllocator.GetNumPages() == 0);
+		TestAllocator.Allocate(256);
+		REQUIRE(TestAllocator.GetNumPages() == 1);
+
+		int32 NumBlocksPerPage = FPoolAllocator::PageSize / 256;
+		for (int32 Index = 1; Index < NumBlocksPerPage; ++Index)
+		{
+			TestAllocator.Allocate(256);
+		}
+		REQUIRE(TestAllocator.GetNumPages() == 1);
+		TestAllocator.Allocate(256);
+		REQUIRE(TestAllocator.GetNumPages() == 2);
+	}
+
+	SECTION("Large allocations are usable and don't take pages")
+	{
+		const int32 LargeSize = 3 * FPoolAllocator::PageSize;
+		int8* Large = static_cast<int8*>(TestAllocator.Allocate(LargeSize));
+		REQUIRE(Large != nullptr);
+		std::memset(Large, 0x5A, LargeSize);
+		REQUIRE(Large[LargeSize - 1] == 0x5A);
+		REQUIRE(TestAllocator.GetNumPages() == 0);
+		REQUIRE(reinterpret_cast<uint64>(Large) % 16 == 0);
+		TestAllocator.Deallocate(Large);
+	}
+
+	SECTION("Allocations larger than 512 bytes have little overhead")
+	{
+		// Many allocations of sizes between the small size classes and MaxBlockSize, as container storage would make.
+		const int32 Sizes[] = { 513, 1000, 1024, 3000, 5121, 20000, FPoolAllocator::MaxBlockSize };
+		for (int32 SizeBytes : Sizes)
+		{
+			FPoolAllocator SizeAllocator;
+			const int32 NumAllocations = 16 * 1024 * 1024 / SizeBytes;
+			std::vector<void*> Blocks;
+			for (int32 Index = 0; Index < NumAllocations; ++Index)
+			{
+				Blocks.push_back(SizeAllocator.Allocate(SizeBytes));
+			}
+
+			// Rounding up to a size class and the ends of spans waste less than a third.
+			uint64 NumBytesRequested = static_cast<uint64>(NumAllocations) * SizeBytes;
+			uint64 NumBytesCommitted = static_cast<uint64>(SizeAllocator.GetNumPages()) * FPoolAllocator::PageSize;
+			REQUIRE(NumBytesCommitted < NumBytesRequested * 4 / 3);
+
+			for (void* Block : Blocks)
+			{
+				SizeAllocator.Deallocate(Block);
+			}
+		}
+
+		// 1 KB blocks fill pages exactly.
+		for (int32 Index = 0; Index < 20000; ++Index)
+		{
+			TestAllocator.Allocate(1024);
+		}
+		REQUIRE(TestAllocator.GetNumPages() == (20000 * 1024 + FPoolAllocator::PageSize - 1) / FPoolAllocator::PageSize);
+	}
+
+	SECTION("Requests are served from the system once the reserved range is full")
+	{
+		FPoolAllocator SmallAllocator(EPoolThreading::SingleThreaded, 2 * FPoolAllocator::PageSize);
+		std::vector<int32*> Blocks;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			int32* Block = static_cast<int32*>(SmallAllocator.Allocate(1024));
+			REQUIRE(Block != nullptr);
+			*Block = Index;
+			Blocks.push_back(Block);
+		}
+		REQUIRE(SmallAllocator.GetNumPages() == 2);
+
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			REQUIRE(*Blocks[Index] == Index);
+			SmallAllocator.Deallocate(Blocks[Index]);
+		}
+	}
+}
+
+TEST_CASE("FPoolAllocator::Deallocate")
+{
+	FPoolAllocator TestAllocator;
+
+	SECTION("Freed blocks are reused first")
+	{
+		void* First = TestAllocator.Allocate(24);
+		void* Second = TestAllocator.Allocate(24);
+		TestAllocator.Deallocate(First);
+		REQUIRE(TestAllocator.Allocate(32) == First);
+		TestAllocator.Deallocate(Second);
+		REQUIRE(TestAllocator.Allocate(17) == Second);
+	}
+
+	SECTION("Size classes don't share blocks")
+	{
+		void* Small = TestAllocator.Allocate(8);
+		TestAllocator.Deallocate(Small);
+		REQUIRE(TestAllocator.Allocate(64) != Small);
+	}
+
+	SECTION("Deallocating nullptr does nothing")
+	{
+		TestAllocator.Deallocate(nullptr);
+		REQUIRE(TestAllocator.GetNumPages() == 0);
+	}
+}
+
+TEST_CASE("FPoolAllocator threading")
+{
+	const int32 NumThreads = 4;
+	const int32 NumIterations = 20000;
+
+	auto RunThreads = [&](FPoolAllocator& InAllocator)
+	{
+		std::vector<std::thread> Threads;
+		std::vector<int32> NumErrors(NumThreads, 0);
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back([&InAllocator, &NumErrors, ThreadIndex, NumIterations]()
+			{
+				// Keep a window of live blocks, filled with a per-thread pattern, so that blocks handed to two threads at once are detected.
+				const int32 WindowSize = 64;
+				int32* Window[WindowSize] = {};
+				for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+				{
+					int32 Slot = Iteration % WindowSize;
+					if (Window[Slot])
+					{
+						if (Window[Slot][0] != ThreadIndex || Window[Slot][1] != Iteration - WindowSize)
+						{
+							++NumErrors[ThreadIndex];
+						}
+						InAllocator.Deallocate(Window[Slot]);
+					}
+
+					int32 SizeBytes = 8 + (Iteration % 7) * 24;
+					Window[Slot] = static_cast<int32*>(InAllocator.Allocate(SizeBytes));
+					Window[Slot][0] = ThreadIndex;
+					Window[Slot][1] = Iteration;
+				}
+				for (int32* Block : Window)
+				{
+					InAllocator.Deallocate(Block);
+				}
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		for (int32 Errors : NumErrors)
+		{
+			REQUIRE(Errors == 0);
+		}
+	};
+
+	SECTION("Locked")
+	{
+		FPoolAllocator TestAllocator(EPoolThreading::Locked);
+		RunThreads(TestAllocator);
+	}
+
+	SECTION("Thread-cached")
+	{
+		FPoolAllocator TestAllocator(EPoolThreading::ThreadCached);
+		RunThreads(TestAllocator);
+
+		// The threads returned their cached blocks when they exited, so this thread's allocations reuse them.
+		int32 NumPages = TestAllocator.GetNumPages();
+		std::vector<void*> Blocks;
+		for (int32 Index = 0; Index < NumThreads * 64; ++Index)
+		{
+			Blocks.push_back(TestAllocator.Allocate(8));
+		}
+		REQUIRE(TestAllocator.GetNumPages() == NumPages);
+		for (void* Block : Blocks)
+		{
+			TestAllocator.Deallocate(Block);
+		}
+	}
+
+	SECTION("Blocks can be freed by another thread")
+	{
+		FPoolAllocator TestAllocator(EPoolThreading::ThreadCached);
+		std::vector<void*> Blocks;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Blocks.push_back(TestAllocator.Allocate(32));
+		}
+
+		std::thread FreeingThread([&]()
+		{
+			for (void* Block : Blocks)
+			{
+				TestAllocator.Deallocate(Block);
+			}
+		});
+		FreeingThread.join();
+
+		int32 NumPages = TestAllocator.GetNumPages();
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			TestAllocator.Allocate(32);
+		}
+		REQUIRE(TestAllocator.GetNumPages() == NumPages);
+	}
+
+	SECTION("Blocks freed by a consumer thread go back to the producer")
+	{
+		FPoolAllocator TestAllocator(EPoolThreading::ThreadCached);
+		int32 NumPages = 0;
+		for (int32 Round = 0; Round < 50; ++Round)
+		{
+			std::vector<void*> Blocks;
+			for (int32 Index = 0; Index < 1000; ++Index)
+			{
+				Blocks.push_back(TestAllocator.Allocate(32));
+			}
+
+			// Each consumer is a new thread, which reuses the cache the previous one left behind.
+			std::thread ConsumerThread([&]()
+			{
+				for (void* Block : Blocks)
+				{
+					TestAllocator.Deallocate(Block);
+				}
+			});
+			ConsumerThread.join();
+
+			if (Round == 0)
+			{
+				NumPages = TestAllocator.GetNumPages();
+			}
+			REQUIRE(TestAllocator.GetNumPages() == NumPages);
+		}
+	}
+}
+
+TEST_CASE("FPoolAllocator with shared pointers and containers")
+{
+	FPoolAllocator TestAllocator;
+
+	SECTION("MakeSharedWithAllocator")
+	{
+		{
+			TSharedPtr<FPooledObject> Object = MakeSharedWithAllocator<FPooledObject>(TestAllocator, 7);
+			REQUIRE(Object->Value == 7);
+			REQUIRE(Object.GetStrongRefCount() == 1);
+			REQUIRE(FPooledObject::NumLiveObjects == 1);
+
+			TWeakPtr<FPooledObject> WeakObject = Object;
+			Object.Reset();
+			REQUIRE(FPooledObject::NumLiveObjects == 0);
+			REQUIRE(!WeakObject.IsValid());
+		}
+		REQUIRE(TestAllocator.GetNumPages() > 0);
+
+		// Both the object and control block were returned to the pools.
+		TSharedPtr<FPooledObject> Object = MakeSharedWithAllocator<FPooledObject>(TestAllocator, 1);
+		int32 NumPages = TestAllocator.GetNumPages();
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			MakeSharedWithAllocator<FPooledObject>(TestAllocator, Index);
+		}
+		REQUIRE(TestAllocator.GetNumPages() == NumPages);
+	}
+
+	SECTION("TSet and TMap")
+	{
+		TSet<int32> TestSet(TestAllocator);
+		TMap<int32, int32> TestMap(TestAllocator);
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			TestSet.Add(Index);
+			TestMap.Add(Index, 2 * Index);
+		}
+
+		REQUIRE(TestSet.GetSize() == 100);
+		REQUIRE(*TestSet.Find(42) == 42);
+		REQUIRE(*TestMap.Find(42) == 84);
+		REQUIRE(TestSet.GetAllocator() == &TestAllocator);
+	}
+}
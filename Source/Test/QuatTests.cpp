@@ -0,0 +1,160 @@
+#include "catch/catch.hpp"
+
+#include "Math/Quat.h"
+#include "Math/Vector3D.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+static constexpr float QuatTolerance = 1.e-4f;
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return FMath::IsApproximatelyEqual(InA.X, InB.X, QuatTolerance)
+		&& FMath::IsApproximatelyEqual(InA.Y, InB.Y, QuatTolerance)
+		&& FMath::IsApproximatelyEqual(InA.Z, InB.Z, QuatTolerance);
+}
+
+static bool IsNearlyEqual(const FTransform4D& InA, const FTransform4D& InB)
+{
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		if (!FMath::IsApproximatelyEqual(InA.GetData()[Index], InB.GetData()[Index], QuatTolerance))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Q and -Q are the same rotation.
+static bool IsSameRotation(const FQuat& InA, const FQuat& InB)
+{
+	return FMath::IsApproximatelyEqual(FMath::Abs(FQuat::DotProduct(InA, InB)), 1.0f, QuatTolerance);
+}
+
+// Euler angles covering all octants, avoiding gimbal lock (Y = +-90 degrees).
+static const FVector3D TestEulerAngles[] = {
+	FVector3D(0.0f, 0.0f, 0.0f),
+	FVector3D(0.3f, 0.0f, 0.0f),
+	FVector3D(0.0f, -1.2f, 0.0f),
+	FVector3D(0.0f, 0.0f, 2.5f),
+	FVector3D(0.4f, 0.7f, -1.1f),
+	FVector3D(-2.9f, 1.3f, 0.2f),
+	FVector3D(1.7f, -0.6f, -3.0f),
+};
+
+static FTransform4D MakeEulerTransform(const FVector3D& InRadians)
+{
+	return FTransform4D::MakeRotationZ(InRadians.Z) * FTransform4D::MakeRotationY(InRadians.Y) * FTransform4D::MakeRotationX(InRadians.X);
+}
+
+TEST_CASE("FQuat default constructor is the identity.")
+{
+	FQuat Quat;
+	REQUIRE(Quat == FQuat::Identity);
+	REQUIRE(Quat.RotateVector(FVector3D(1.0f, 2.0f, 3.0f)) == FVector3D(1.0f, 2.0f, 3.0f));
+	REQUIRE(alignof(FQuat) == 16);
+}
+
+TEST_CASE("FQuat axis-angle rotations match FTransform4D.")
+{
+	FVector3D Axis = FVector3D::Normalize(FVector3D(1.0f, -2.0f, 0.5f));
+	FVector3D Vector(0.3f, 1.0f, -2.0f);
+	for (float Radians = -3.0f; Radians <= 3.0f; Radians += 0.5f)
+	{
+		FQuat Quat = FQuat::MakeFromAxisAngle(Axis, Radians);
+		FTransform4D Transform = FTransform4D::MakeRotation(Radians, Axis);
+
+		REQUIRE(FMath::IsApproximatelyEqual(Quat.GetLength(), 1.0f, QuatTolerance));
+		REQUIRE(IsNearlyEqual(Quat.RotateVector(Vector), Transform * Vector));
+		REQUIRE(IsNearlyEqual(Quat.ToTransform(), Transform));
+		REQUIRE(IsNearlyEqual(Quat.UnrotateVector(Quat.RotateVector(Vector)), Vector));
+	}
+}
+
+TEST_CASE("FQuat Euler angle conversions.")
+{
+	for (const FVector3D& Angles : TestEulerAngles)
+	{
+		FQuat Quat = FQuat::MakeFromEuler(Angles);
+		REQUIRE(IsNearlyEqual(Quat.ToTransform(), MakeEulerTransform(Angles)));
+
+		// Euler angles aren't unique, so compare the rotations they produce.
+		FVector3D RoundTrip = Quat.ToEuler();
+		REQUIRE(IsSameRotation(FQuat::MakeFromEuler(RoundTrip), Quat));
+	}
+
+	SECTION("Gimbal lock.")
+	{
+		FQuat Quat = FQuat::MakeFromEuler(FVector3D(0.5f, FMath::PiOverTwo, 0.25f));
+		REQUIRE(IsSameRotation(FQuat::MakeFromEuler(Quat.ToEuler()), Quat));
+	}
+}
+
+TEST_CASE("FQuat conversions from FTransform4D.")
+{
+	for (const FVector3D& Angles : TestEulerAngles)
+	{
+		FQuat Quat = FQuat::MakeFromEuler(Angles);
+		REQUIRE(IsSameRotation(FQuat::MakeFromTransform(Quat.ToTransform()), Quat));
+
+		// Scale and translation are ignored.
+		FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(1.0f, 2.0f, 3.0f)) * Quat.ToTransform() * FTransform4D::MakeScale(FVector3D(2.0f, 0.5f, 3.0f));
+		REQUIRE(IsSameRotation(FQuat::MakeFromTransform(Transform), Quat));
+	}
+}
+
+TEST_CASE("FQuat composition.")
+{
+	FQuat A = FQuat::MakeFromEuler(FVector3D(0.4f, 0.7f, -1.1f));
+	FQuat B = FQuat::MakeFromEuler(FVector3D(-2.9f, 1.3f, 0.2f));
+	FVector3D Vector(1.0f, -1.0f, 2.0f);
+
+	REQUIRE(IsNearlyEqual((A * B).RotateVector(Vector), A.RotateVector(B.RotateVector(Vector))));
+	REQUIRE(IsNearlyEqual((A * B).ToTransform(), A.ToTransform() * B.ToTransform()));
+	REQUIRE(IsSameRotation(A * A.GetConjugate(), FQuat::Identity));
+
+	FQuat Scaled(A.X * 2.0f, A.Y * 2.0f, A.Z * 2.0f, A.W * 2.0f);
+	REQUIRE(IsSameRotation(Scaled * Scaled.GetInverse(), FQuat::Identity));
+	REQUIRE(IsSameRotation(FQuat::Normalize(Scaled), A));
+}
+
+TEST_CASE("FQuat interpolation.")
+{
+	FVector3D Axis = FVector3D::Normalize(FVector3D(0.0f, 1.0f, 1.0f));
+	FQuat Start = FQuat::MakeFromAxisAngle(Axis, 0.2f);
+	FQuat End = FQuat::MakeFromAxisAngle(Axis, 1.8f);
+
+	SECTION("Slerp moves at constant angular velocity.")
+	{
+		REQUIRE(IsSameRotation(FQuat::Slerp(Start, End, 0.0f), Start));
+		REQUIRE(IsSameRotation(FQuat::Slerp(Start, End, 1.0f), End));
+		REQUIRE(IsSameRotation(FQuat::Slerp(Start, End, 0.25f), FQuat::MakeFromAxisAngle(Axis, 0.6f)));
+		REQUIRE(IsSameRotation(FQuat::Slerp(Start, End, 0.5f), FQuat::MakeFromAxisAngle(Axis, 1.0f)));
+	}
+
+	SECTION("Nlerp matches Slerp at the endpoints and midpoint.")
+	{
+		REQUIRE(IsSameRotation(FQuat::Nlerp(Start, End, 0.0f), Start));
+		REQUIRE(IsSameRotation(FQuat::Nlerp(Start, End, 1.0f), End));
+		REQUIRE(IsSameRotation(FQuat::Nlerp(Start, End, 0.5f), FQuat::MakeFromAxisAngle(Axis, 1.0f)));
+		REQUIRE(FMath::IsApproximatelyEqual(FQuat::Nlerp(Start, End, 0.3f).GetLength(), 1.0f, QuatTolerance));
+	}
+
+	SECTION("Interpolation takes the shortest arc.")
+	{
+		FQuat NegatedEnd(-End.X, -End.Y, -End.Z, -End.W);
+		REQUIRE(IsSameRotation(FQuat::Slerp(Start, NegatedEnd, 0.5f), FQuat::MakeFromAxisAngle(Axis, 1.0f)));
+		REQUIRE(IsSameRotation(FQuat::Nlerp(Start, NegatedEnd, 0.5f), FQuat::MakeFromAxisAngle(Axis, 1.0f)));
+	}
+}
+
+TEST_CASE("FQuat compile-time evaluation.")
+{
+	// 180 degrees about Z, composed with its conjugate.
+	constexpr FQuat Rotation(0.0f, 0.0f, 1.0f, 0.0f);
+	constexpr FQuat Product = Rotation * Rotation.GetConjugate() * FQuat::Identity;
+	static_assert(Product.W == 1.0f && Product.Z == 0.0f, "FQuat math should be usable in constant expressions.");
+	static_assert(FQuat::DotProduct(Rotation, FQuat::Identity) == 0.0f, "FQuat::DotProduct should be usable in constant expressions.");
+	REQUIRE(Product == FQuat::Identity);
+}
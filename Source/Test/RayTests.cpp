@@ -0,0 +1,62 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/Ray.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Geometry/Sphere.h"
+#include "Math/Geometry/Plane.h"
+#include "Math/MathUtilities.h"
+
+TEST_CASE("FRay construction.")
+{
+	FRay Ray = FRay::MakeFromPoints(FVector3D(1.0f, 1.0f, 1.0f), FVector3D(1.0f, 4.0f, 1.0f));
+	REQUIRE(Ray.Origin == FVector3D(1.0f, 1.0f, 1.0f));
+	REQUIRE(Ray.Direction == FVector3D::YAxis);
+	REQUIRE(Ray.GetPoint(2.0f) == FVector3D(1.0f, 3.0f, 1.0f));
+}
+
+TEST_CASE("FRay intersection tests.")
+{
+	float Distance = -1.0f;
+
+	SECTION("Boxes")
+	{
+		FAABB Box(FVector3D(2.0f, -1.0f, -1.0f), FVector3D(4.0f, 1.0f, 1.0f));
+		REQUIRE(FRay(FVector3D::Zero, FVector3D::XAxis).Intersects(Box, Distance));
+		REQUIRE(Distance == 2.0f);
+
+		// Starting inside.
+		REQUIRE(FRay(FVector3D(3.0f, 0.0f, 0.0f), FVector3D::YAxis).Intersects(Box, Distance));
+		REQUIRE(Distance == 0.0f);
+
+		REQUIRE(!FRay(FVector3D::Zero, -FVector3D::XAxis).Intersects(Box, Distance));
+		REQUIRE(!FRay(FVector3D(0.0f, 2.0f, 0.0f), FVector3D::XAxis).Intersects(Box, Distance));
+
+		FVector3D Diagonal = FVector3D::Normalize(FVector3D(1.0f, 1.0f, 0.0f));
+		REQUIRE(FRay(FVector3D(0.0f, -2.5f, 0.0f), Diagonal).Intersects(Box, Distance));
+		// Enters through the X = 2 face at (2, -0.5, 0).
+		REQUIRE(FMath::IsApproximatelyEqual(Distance, 2.0f * FMath::Sqrt(2.0f), 1.e-5f));
+		REQUIRE(!FRay(FVector3D(0.0f, -6.0f, 0.0f), Diagonal).Intersects(Box, Distance));
+
+		REQUIRE(!FRay(FVector3D::Zero, FVector3D::XAxis).Intersects(FAABB(), Distance));
+	}
+
+	SECTION("Spheres")
+	{
+		FSphere Sphere(FVector3D(0.0f, 0.0f, -5.0f), 1.0f);
+		REQUIRE(FRay(FVector3D::Zero, -FVector3D::ZAxis).Intersects(Sphere, Distance));
+		REQUIRE(Distance == 4.0f);
+		REQUIRE(FRay(FVector3D(0.0f, 0.0f, -5.0f), FVector3D::XAxis).Intersects(Sphere, Distance));
+		REQUIRE(Distance == 0.0f);
+		REQUIRE(!FRay(FVector3D::Zero, FVector3D::ZAxis).Intersects(Sphere, Distance));
+		REQUIRE(!FRay(FVector3D(0.0f, 1.5f, 0.0f), -FVector3D::ZAxis).Intersects(Sphere, Distance));
+	}
+
+	SECTION("Planes")
+	{
+		FPlane Ground(FVector3D::YAxis, 0.0f);
+		REQUIRE(FRay(FVector3D(0.0f, 3.0f, 0.0f), -FVector3D::YAxis).Intersects(Ground, Distance));
+		REQUIRE(Distance == 3.0f);
+		REQUIRE(!FRay(FVector3D(0.0f, 3.0f, 0.0f), FVector3D::YAxis).Intersects(Ground, Distance));
+		REQUIRE(!FRay(FVector3D(0.0f, 3.0f, 0.0f), FVector3D::XAxis).Intersects(Ground, Distance));
+	}
+}
@@ -0,0 +1,87 @@
+#include "catch/catch.hpp"
+
+#include "RenderCommandDispatcher.h"
+
+namespace
+{
+	// Render thread that only counts what is dispatched to it, in place of FRenderThread.
+	// Enqueued commands never run, so a command that ran was executed inline.
+	class FTestRenderThread
+	{
+	public:
+		template<typename LambdaType>
+		void EnqueueCommand(LambdaType&&)
+		{
+			++NumEnqueued;
+		}
+
+		void Flush()
+		{
+			++NumFlushes;
+		}
+
+		template<typename ObjectType>
+		void BeginRelease(TSharedPtr<ObjectType>&& InObject)
+		{
+			ReleasedObjects.Add(MoveTemp(InObject));
+		}
+
+		int32 NumEnqueued = 0;
+		int32 NumFlushes = 0;
+		TArray<TSharedPtr<int32>> ReleasedObjects;
+	};
+}
+
+TEST_CASE("TRenderCommandDispatcher")
+{
+	TRenderCommandDispatcher<FTestRenderThread> Dispatcher;
+	bool bExecuted = false;
+
+	SECTION("Without a render thread, commands run right away.")
+	{
+		REQUIRE(!Dispatcher.IsRenderThreadRunning());
+		REQUIRE(Dispatcher.GetRenderThread() == nullptr);
+
+		Dispatcher.EnqueueCommand([&bExecuted]() { bExecuted = true; });
+		REQUIRE(bExecuted);
+
+		bExecuted = false;
+		Dispatcher.Execute([&bExecuted]() { bExecuted = true; });
+		REQUIRE(bExecuted);
+
+		// Nothing is waited for.
+		Dispatcher.Flush();
+
+		// The caller keeps the only reference.
+		TSharedPtr<int32> Object = MakeShared<int32>(1);
+		Dispatcher.BeginRelease(Object);
+		REQUIRE(Object.GetStrongRefCount() == 1);
+	}
+
+	SECTION("With a render thread, commands are enqueued.")
+	{
+		Dispatcher.SetRenderThread(MakeUnique<FTestRenderThread>());
+		FTestRenderThread* RenderThread = Dispatcher.GetRenderThread();
+		REQUIRE(Dispatcher.IsRenderThreadRunning());
+
+		Dispatcher.EnqueueCommand([&bExecuted]() { bExecuted = true; });
+		REQUIRE(!bExecuted);
+		REQUIRE(RenderThread->NumEnqueued == 1);
+		REQUIRE(RenderThread->NumFlushes == 0);
+
+		Dispatcher.Execute([&bExecuted]() { bExecuted = true; });
+		REQUIRE(!bExecuted);
+		REQUIRE(RenderThread->NumEnqueued == 2);
+		REQUIRE(RenderThread->NumFlushes == 1);
+
+		TSharedPtr<int32> Object = MakeShared<int32>(1);
+		Dispatcher.BeginRelease(Object);
+		REQUIRE(Object.GetStrongRefCount() == 2);
+
+		// Removing the render thread goes back to running commands inline.
+		Dispatcher.SetRenderThread(nullptr);
+		REQUIRE(!Dispatcher.IsRenderThreadRunning());
+		Dispatcher.EnqueueCommand([&bExecuted]() { bExecuted = true; });
+		REQUIRE(bExecuted);
+	}
+}
@@ -0,0 +1,205 @@
+#include "catch/catch.hpp"
+
+#include "ResourcePool.h"
+#include "ResourceHandle.h"
+
+namespace
+{
+	// Resource that counts how many instances are alive, so that tests can see when the pool destroys it.
+	// The pool's slot map moves resources around as they are removed, so it must be copyable.
+	struct FTestResource
+	{
+		explicit FTestResource(int32 InValue)
+			: Value(InValue)
+		{
+			++NumLive;
+		}
+		FTestResource(const FTestResource& InOther)
+			: Value(InOther.Value)
+		{
+			++NumLive;
+		}
+		~FTestResource()
+		{
+			--NumLive;
+		}
+		FTestResource& operator=(const FTestResource& InOther) = default;
+
+		int32 Value;
+
+		static int32 NumLive;
+	};
+
+	int32 FTestResource::NumLive = 0;
+
+	// Pool behind the test resources' references, in place of FResourceManager.
+	TResourcePool<FTestResource>* TestPool = nullptr;
+
+	// Found by TResourceRef through argument-dependent lookup on the handle's resource type.
+	void AddResourceRef(TResourceHandle<FTestResource> InHandle)
+	{
+		TestPool->AddRef(InHandle);
+	}
+
+	void ReleaseResourceRef(TResourceHandle<FTestResource> InHandle)
+	{
+		TestPool->Release(InHandle);
+	}
+
+	FTestResource* FindResource(TResourceHandle<FTestResource> InHandle)
+	{
+		return TestPool->Find(InHandle);
+	}
+}
+
+TEST_CASE("TResourcePool")
+{
+	TResourcePool<FTestResource> Pool;
+	const FStringId Name("ResourcePoolTests/First");
+	const FStringId OtherName("ResourcePoolTests/Second");
+
+	SECTION("Added resources start with one reference.")
+	{
+		TResourceHandle<FTestResource> Handle = Pool.Add(Name, 1);
+
+		REQUIRE(!Handle.IsNull());
+		REQUIRE(Pool.GetSize() == 1);
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+		REQUIRE(Pool.Find(Handle) != nullptr);
+		REQUIRE(Pool.Find(Handle)->Value == 1);
+		REQUIRE(FTestResource::NumLive == 1);
+
+		Pool.Release(Handle);
+	}
+
+	SECTION("Lookup by name adds a reference.")
+	{
+		TResourceHandle<FTestResource> Handle = Pool.Add(Name, 1);
+		TResourceHandle<FTestResource> OtherHandle = Pool.Add(OtherName, 2);
+
+		REQUIRE(Pool.AddRefByName(Name) == Handle);
+		REQUIRE(Pool.GetRefCount(Handle) == 2);
+		REQUIRE(Pool.AddRefByName(OtherName) == OtherHandle);
+		REQUIRE(Pool.GetRefCount(OtherHandle) == 2);
+		REQUIRE(Pool.AddRefByName(FStringId("ResourcePoolTests/Missing")).IsNull());
+
+		Pool.Release(Handle);
+		Pool.Release(Handle);
+		Pool.Release(OtherHandle);
+		Pool.Release(OtherHandle);
+	}
+
+	SECTION("The last release destroys the resource and frees its name.")
+	{
+		TResourceHandle<FTestResource> Handle = Pool.Add(Name, 1);
+		Pool.AddRef(Handle);
+
+		Pool.Release(Handle);
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+		REQUIRE(FTestResource::NumLive == 1);
+
+		Pool.Release(Handle);
+		REQUIRE(Pool.GetSize() == 0);
+		REQUIRE(FTestResource::NumLive == 0);
+		REQUIRE(Pool.AddRefByName(Name).IsNull());
+	}
+
+	SECTION("Handles to destroyed resources are rejected.")
+	{
+		TResourceHandle<FTestResource> StaleHandle = Pool.Add(Name, 1);
+		Pool.Release(StaleHandle);
+
+		// The new resource reuses the slot with a new generation.
+		TResourceHandle<FTestResource> Handle = Pool.Add(Name, 2);
+		REQUIRE(Handle.Index == StaleHandle.Index);
+		REQUIRE(Handle.Generation != StaleHandle.Generation);
+
+		REQUIRE(Pool.Find(StaleHandle) == nullptr);
+		REQUIRE(Pool.GetRefCount(StaleHandle) == 0);
+		REQUIRE(Pool.Find(Handle)->Value == 2);
+
+		Pool.Release(Handle);
+	}
+
+	REQUIRE(FTestResource::NumLive == 0);
+}
+
+TEST_CASE("TResourceRef")
+{
+	TResourcePool<FTestResource> Pool;
+	TestPool = &Pool;
+	const FStringId Name("ResourceRefTests/Resource");
+
+	SECTION("Null references don't count.")
+	{
+		TResourceRef<FTestResource> Ref;
+		REQUIRE(Ref.IsNull());
+		REQUIRE(Ref.Get() == nullptr);
+
+		TResourceRef<FTestResource> Copy(Ref);
+		REQUIRE(Copy.IsNull());
+	}
+
+	SECTION("Copies add references and destruction releases them.")
+	{
+		TResourceRef<FTestResource> Ref(Pool.Add(Name, 1));
+		TResourceHandle<FTestResource> Handle = Ref.GetHandle();
+		REQUIRE(Ref->Value == 1);
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+
+		{
+			TResourceRef<FTestResource> Copy(Ref);
+			REQUIRE(Pool.GetRefCount(Handle) == 2);
+
+			TResourceRef<FTestResource> AssignedCopy;
+			AssignedCopy = Copy;
+			REQUIRE(Pool.GetRefCount(Handle) == 3);
+			REQUIRE(AssignedCopy.Get() == Ref.Get());
+		}
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+
+		// Assigning a reference to itself keeps its count.
+		TResourceRef<FTestResource>& SameRef = Ref;
+		Ref = SameRef;
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+		REQUIRE(FTestResource::NumLive == 1);
+	}
+
+	SECTION("Moves transfer the reference without counting.")
+	{
+		TResourceRef<FTestResource> Ref(Pool.Add(Name, 1));
+		TResourceHandle<FTestResource> Handle = Ref.GetHandle();
+
+		TResourceRef<FTestResource> Moved(MoveTemp(Ref));
+		REQUIRE(Ref.IsNull());
+		REQUIRE(Moved.GetHandle() == Handle);
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+
+		TResourceRef<FTestResource> MoveAssigned;
+		MoveAssigned = MoveTemp(Moved);
+		REQUIRE(Moved.IsNull());
+		REQUIRE(MoveAssigned->Value == 1);
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+	}
+
+	SECTION("Resetting the last reference destroys the resource.")
+	{
+		TResourceRef<FTestResource> Ref(Pool.Add(Name, 1));
+		TResourceRef<FTestResource> Copy(Ref);
+		TResourceHandle<FTestResource> Handle = Ref.GetHandle();
+
+		Ref.Reset();
+		REQUIRE(Ref.IsNull());
+		REQUIRE(Pool.GetRefCount(Handle) == 1);
+		REQUIRE(FTestResource::NumLive == 1);
+
+		// Assigning over a reference releases what it referenced.
+		Copy = TResourceRef<FTestResource>();
+		REQUIRE(Pool.GetSize() == 0);
+		REQUIRE(FTestResource::NumLive == 0);
+		REQUIRE(Pool.Find(Handle) == nullptr);
+	}
+
+	REQUIRE(FTestResource::NumLive == 0);
+	TestPool = nullptr;
+}
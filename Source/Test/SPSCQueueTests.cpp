@@ -0,0 +1,140 @@
+#include "catch/catch.hpp"
+
+#include "Containers/SPSCQueue.h"
+#include "Memory/PoolAllocator.h"
+
+#include <thread>
+
+TEST_CASE("TSPSCQueue")
+{
+	TSPSCQueue<int32> Queue(6);
+
+	REQUIRE(Queue.IsEmpty());
+	REQUIRE(Queue.GetCapacity() == 8);
+
+	SECTION("Elements come out in the order they went in.")
+	{
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			REQUIRE(Queue.Enqueue(Index));
+		}
+		REQUIRE(Queue.GetSize() == 5);
+
+		int32 Element = -1;
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			REQUIRE(Queue.Dequeue(Element));
+			REQUIRE(Element == Index);
+		}
+		REQUIRE(!Queue.Dequeue(Element));
+		REQUIRE(Queue.IsEmpty());
+	}
+
+	SECTION("Full queue.")
+	{
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			REQUIRE(Queue.Enqueue(Index));
+		}
+		REQUIRE(!Queue.Enqueue(8));
+
+		// Freeing a slot lets the producer wrap around.
+		int32 Element = -1;
+		REQUIRE(Queue.Dequeue(Element));
+		REQUIRE(Queue.Enqueue(8));
+		for (int32 Index = 1; Index <= 8; ++Index)
+		{
+			REQUIRE(Queue.Dequeue(Element));
+			REQUIRE(Element == Index);
+		}
+	}
+}
+
+namespace
+{
+	// Counts live instances, to check that the queue destroys every element it constructs.
+	struct FQueueLiveCounter
+	{
+		FQueueLiveCounter() = default;
+		explicit FQueueLiveCounter(int32& InNumLive)
+			: NumLive(&InNumLive)
+		{
+			++*NumLive;
+		}
+		FQueueLiveCounter(const FQueueLiveCounter& InOther)
+			: NumLive(InOther.NumLive)
+		{
+			++*NumLive;
+		}
+		FQueueLiveCounter& operator=(const FQueueLiveCounter& InOther)
+		{
+			if (!NumLive)
+			{
+				NumLive = InOther.NumLive;
+				++*NumLive;
+			}
+			return *this;
+		}
+		~FQueueLiveCounter()
+		{
+			if (NumLive)
+			{
+				--*NumLive;
+			}
+		}
+
+		int32* NumLive = nullptr;
+	};
+}
+
+TEST_CASE("TSPSCQueue element lifetime")
+{
+	FPoolAllocator Allocator(EPoolThreading::Locked);
+	int32 NumLive = 0;
+	FQueueLiveCounter Element;
+	{
+		TSPSCQueue<FQueueLiveCounter> Queue(4, Allocator);
+		REQUIRE(Queue.Enqueue(FQueueLiveCounter(NumLive)));
+		REQUIRE(Queue.Emplace(NumLive));
+		REQUIRE(Queue.Enqueue(FQueueLiveCounter(NumLive)));
+		REQUIRE(NumLive == 3);
+
+		REQUIRE(Queue.Dequeue(Element));
+		REQUIRE(NumLive == 3);
+	}
+	// The queue destroyed the two elements left in it, leaving the dequeued one.
+	REQUIRE(NumLive == 1);
+}
+
+TEST_CASE("TSPSCQueue stress")
+{
+	// A small queue, so that the producer keeps finding it full and the consumer keeps finding it empty.
+	const int32 NumElements = 1000000;
+	TSPSCQueue<int32> Queue(64);
+
+	std::thread Producer([&Queue, NumElements]()
+	{
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			while (!Queue.Enqueue(Index))
+			{
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	int32 NumOutOfOrder = 0;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		int32 Element = -1;
+		while (!Queue.Dequeue(Element))
+		{
+			std::this_thread::yield();
+		}
+		NumOutOfOrder += Element != Index ? 1 : 0;
+	}
+	Producer.join();
+
+	REQUIRE(NumOutOfOrder == 0);
+	REQUIRE(Queue.IsEmpty());
+}
@@ -2,6 +2,11 @@
 
 #include "Containers/Set.h"
 #include "Math/MathUtilities.h"
+#include "Memory/ArenaAllocator.h"
+#include "Memory/PoolAllocator.h"
+
+#include <random>
+#include <set>
 
 TEST_CASE("TSet") 
 {
@@ -61,6 +66,20 @@ TEST_CASE("TSet")
 		REQUIRE(*TestSet.Find(1) == 1);
 	}
 
+	SECTION("Look up elements by hash.")
+	{
+		for (int32 Index = 0; Index < 20; ++Index)
+		{
+			TestSet.Add(Index);
+		}
+		TestSet.Remove(7);
+
+		REQUIRE(TestSet.IsHashContained(GetTypeHash(3)));
+		REQUIRE(TestSet.IsHashContained(GetTypeHash(19)));
+		REQUIRE(!TestSet.IsHashContained(GetTypeHash(7)));
+		REQUIRE(!TestSet.IsHashContained(GetTypeHash(20)));
+	}
+
 	SECTION("Add enough elements to trigger a rehash.")
 	{
 		REQUIRE(TestSet.GetCapacity() == 8);
@@ -82,3 +101,221 @@ TEST_CASE("TSet")
 		}
 	}
 }
+
+TEST_CASE("TSet allocators")
+{
+	const int32 BufferSize = 4096;
+	uint8 Buffer[BufferSize];
+	FArenaAllocator ArenaAllocator(&Buffer[0], BufferSize);
+	FPoolAllocator PoolAllocator;
+
+	TSet<int32> ArenaSet(ArenaAllocator);
+	for (int32 Index = 0; Index < 20; ++Index)
+	{
+		ArenaSet.Add(Index);
+	}
+
+	SECTION("Memory comes from the given allocator.")
+	{
+		REQUIRE(ArenaSet.GetAllocator() == &ArenaAllocator);
+		REQUIRE(ArenaSet.GetCapacity() == 32);
+		REQUIRE(ArenaAllocator.GetNumBytesUsed() > 0);
+		REQUIRE(PoolAllocator.GetNumPages() == 0);
+	}
+
+	SECTION("Requested capacity is rounded up to a power of two.")
+	{
+		TSet<int32> Set(100, PoolAllocator);
+		REQUIRE(Set.GetCapacity() == 128);
+		REQUIRE(Set.GetAllocator() == &PoolAllocator);
+	}
+
+	SECTION("Copy constructors.")
+	{
+		TSet<int32> Copy(ArenaSet);
+		REQUIRE(Copy.GetAllocator() == &ArenaAllocator);
+		REQUIRE(Copy.GetSize() == 20);
+
+		TSet<int32> PoolCopy(ArenaSet, PoolAllocator);
+		REQUIRE(PoolCopy.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolCopy.GetSize() == 20);
+		for (int32 Index = 0; Index < 20; ++Index)
+		{
+			REQUIRE(PoolCopy.IsKeyContained(Index));
+		}
+	}
+
+	SECTION("Copy assignment keeps the destination's allocator.")
+	{
+		TSet<int32> PoolSet(PoolAllocator);
+		PoolSet.Add(-1);
+		PoolSet = ArenaSet;
+
+		REQUIRE(PoolSet.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolSet.GetSize() == 20);
+		REQUIRE(!PoolSet.IsKeyContained(-1));
+		REQUIRE(PoolSet.IsKeyContained(19));
+		REQUIRE(ArenaSet.GetSize() == 20);
+	}
+
+	SECTION("Move constructor takes the memory and the allocator.")
+	{
+		TSet<int32> Moved(MoveTemp(ArenaSet));
+		REQUIRE(Moved.GetAllocator() == &ArenaAllocator);
+		REQUIRE(Moved.GetSize() == 20);
+		REQUIRE(Moved.GetCapacity() == 32);
+
+		// The moved-from set is empty and can be reused.
+		REQUIRE(ArenaSet.IsEmpty());
+		REQUIRE(ArenaSet.GetCapacity() == 0);
+		REQUIRE(ArenaSet.Find(0) == nullptr);
+		ArenaSet.Add(7);
+		REQUIRE(ArenaSet.IsKeyContained(7));
+		REQUIRE(ArenaSet.GetCapacity() == 8);
+	}
+
+	SECTION("Move assignment between allocators moves the elements.")
+	{
+		TSet<int32> PoolSet(PoolAllocator);
+		PoolSet = MoveTemp(ArenaSet);
+
+		REQUIRE(PoolSet.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolSet.GetSize() == 20);
+		REQUIRE(PoolSet.IsKeyContained(19));
+		REQUIRE(ArenaSet.IsEmpty());
+		REQUIRE(ArenaSet.GetAllocator() == &ArenaAllocator);
+	}
+
+	SECTION("Move assignment with the same allocator takes the memory.")
+	{
+		TSet<int32> OtherArenaSet(ArenaAllocator);
+		OtherArenaSet = MoveTemp(ArenaSet);
+
+		REQUIRE(OtherArenaSet.GetSize() == 20);
+		REQUIRE(OtherArenaSet.GetCapacity() == 32);
+		REQUIRE(ArenaSet.GetCapacity() == 0);
+	}
+}
+
+TEST_CASE("TSet tombstones")
+{
+	TSet<int32> TestSet;
+
+	SECTION("Churn reuses and purges tombstones instead of growing.")
+	{
+		// Few live elements, but many distinct keys over time, like registries during level switches.
+		for (int32 Index = 0; Index < 100000; ++Index)
+		{
+			TestSet.Add(Index);
+			if (Index >= 4)
+			{
+				TestSet.Remove(Index - 4);
+			}
+		}
+
+		// Five elements are live right after each add, which takes 16 slots at most.
+		REQUIRE(TestSet.GetSize() == 4);
+		REQUIRE(TestSet.GetCapacity() <= 16);
+		for (int32 Index = 99996; Index < 100000; ++Index)
+		{
+			REQUIRE(TestSet.IsKeyContained(Index));
+		}
+		REQUIRE(!TestSet.IsKeyContained(99995));
+	}
+
+	SECTION("Random adds and removes.")
+	{
+		std::mt19937 Generator(42);
+		std::uniform_int_distribution<int32> Distribution(0, 2000);
+		std::set<int32> Reference;
+		for (int32 Iteration = 0; Iteration < 100000; ++Iteration)
+		{
+			const int32 Element = Distribution(Generator);
+			if (Generator() % 2 == 0)
+			{
+				TestSet.Add(Element);
+				Reference.insert(Element);
+			}
+			else
+			{
+				TestSet.Remove(Element);
+				Reference.erase(Element);
+			}
+
+			if (Iteration % 10000 == 0)
+			{
+				TestSet.Compact();
+				REQUIRE(TestSet.GetNumDeleted() == 0);
+			}
+		}
+
+		REQUIRE(TestSet.GetSize() == static_cast<int32>(Reference.size()));
+		for (int32 Element = 0; Element <= 2000; ++Element)
+		{
+			REQUIRE(TestSet.IsKeyContained(Element) == (Reference.count(Element) == 1));
+		}
+	}
+
+	SECTION("Compact drops tombstones in place.")
+	{
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			TestSet.Add(Index);
+		}
+		for (int32 Index = 0; Index < 100; Index += 3)
+		{
+			TestSet.Remove(Index);
+		}
+		const int32 Capacity = TestSet.GetCapacity();
+		REQUIRE(TestSet.GetNumDeleted() > 0);
+
+		TestSet.Compact();
+		REQUIRE(TestSet.GetNumDeleted() == 0);
+		REQUIRE(TestSet.GetCapacity() == Capacity);
+		REQUIRE(TestSet.GetSize() == 66);
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			REQUIRE(TestSet.IsKeyContained(Index) == (Index % 3 != 0));
+		}
+	}
+
+	SECTION("Shrink lowers the capacity.")
+	{
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			TestSet.Add(Index);
+		}
+		for (int32 Index = 10; Index < 1000; ++Index)
+		{
+			TestSet.Remove(Index);
+		}
+		REQUIRE(TestSet.GetCapacity() == 2048);
+
+		TestSet.Shrink();
+		REQUIRE(TestSet.GetCapacity() == 16);
+		REQUIRE(TestSet.GetNumDeleted() == 0);
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			REQUIRE(TestSet.IsKeyContained(Index));
+		}
+
+		TestSet.Empty();
+		TestSet.Shrink();
+		REQUIRE(TestSet.GetCapacity() == 8);
+	}
+
+	SECTION("Reserve sizes the set for its elements up front.")
+	{
+		TestSet.Reserve(100);
+		REQUIRE(TestSet.GetCapacity() == 128);
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			TestSet.Add(Index);
+		}
+		REQUIRE(TestSet.GetCapacity() == 128);
+
+		// Reserving less than the capacity does nothing.
+		TestSet.Reserve(10);
+		REQUIRE(TestSet.GetCapacity() == 128);
+	}
+}
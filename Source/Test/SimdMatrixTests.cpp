@@ -0,0 +1,121 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/SimdMatrix.h"
+#include "Math/MathUtilities.h"
+
+#include <random>
+
+// The vectorized code evaluates sums in a different order, so compare with a relative tolerance.
+static bool IsNearlyEqual(float InA, float InB)
+{
+	float Tolerance = 1.e-4f * FMath::Max(1.0f, FMath::Max(FMath::Abs(InA), FMath::Abs(InB)));
+	return FMath::Abs(InA - InB) <= Tolerance;
+}
+
+template<int32 NumValues>
+static bool AreNearlyEqual(const float* InA, const float* InB)
+{
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		if (!IsNearlyEqual(InA[Index], InB[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Generates well-conditioned random matrices so that inverses are numerically stable.
+struct FRandomMatrices
+{
+	FMatrix4D Matrix()
+	{
+		FMatrix4D Result;
+		for (int32 Index = 0; Index < 16; ++Index)
+		{
+			Result.GetData()[Index] = Distribution(Engine);
+		}
+		// Bias the diagonal to keep the matrix far from singular.
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			Result.GetData()[Index * 5] += 4.0f;
+		}
+		return Result;
+	}
+
+	FTransform4D Transform()
+	{
+		FTransform4D Result;
+		for (int32 Index = 0; Index < 12; ++Index)
+		{
+			Result.GetData()[Index] = Distribution(Engine);
+		}
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			Result.GetData()[Index * 4] += 4.0f;
+		}
+		return Result;
+	}
+
+	FVector3D Vector()
+	{
+		return FVector3D(Distribution(Engine), Distribution(Engine), Distribution(Engine));
+	}
+
+	std::mt19937 Engine{ 1234 };
+	std::uniform_real_distribution<float> Distribution{ -2.0f, 2.0f };
+};
+
+TEST_CASE("FSimdMatrix 4x4 operations match FMatrix4D.")
+{
+	FRandomMatrices Random;
+	for (int32 Iteration = 0; Iteration < 100; ++Iteration)
+	{
+		FMatrix4D A = Random.Matrix();
+		FMatrix4D B = Random.Matrix();
+
+		REQUIRE(AreNearlyEqual<16>(FSimdMatrix::Multiply(A, B).GetData(), (A * B).GetData()));
+		REQUIRE(AreNearlyEqual<16>(FSimdMatrix::Transpose(A).GetData(), A.GetTransposed().GetData()));
+		REQUIRE(AreNearlyEqual<16>(FSimdMatrix::Inverse(A).GetData(), A.GetInverted().GetData()));
+
+		FVector4D Vector(Random.Vector(), 1.0f);
+		FVector4D Expected = A * Vector;
+		FVector4D Actual = FSimdMatrix::Transform(A, Vector);
+		REQUIRE(AreNearlyEqual<4>(&Actual.X, &Expected.X));
+	}
+}
+
+TEST_CASE("FSimdMatrix 3x4 operations match FTransform4D.")
+{
+	FRandomMatrices Random;
+	for (int32 Iteration = 0; Iteration < 100; ++Iteration)
+	{
+		FTransform4D A = Random.Transform();
+		FTransform4D B = Random.Transform();
+
+		REQUIRE(AreNearlyEqual<12>(FSimdMatrix::Multiply(A, B).GetData(), (A * B).GetData()));
+		REQUIRE(AreNearlyEqual<12>(FSimdMatrix::Inverse(A).GetData(), A.GetInverted().GetData()));
+
+		FVector3D Vector = Random.Vector();
+		FVector3D ExpectedVector = A * Vector;
+		FVector3D ActualVector = FSimdMatrix::TransformVector(A, Vector);
+		REQUIRE(AreNearlyEqual<3>(&ActualVector.X, &ExpectedVector.X));
+
+		FVector4D ExpectedPoint = A * FVector4D(Vector, 1.0f);
+		FVector3D ActualPoint = FSimdMatrix::TransformPoint(A, Vector);
+		REQUIRE(AreNearlyEqual<3>(&ActualPoint.X, &ExpectedPoint.X));
+	}
+}
+
+TEST_CASE("FSimdMatrix::Inverse produces the identity when multiplied with the input.")
+{
+	FRandomMatrices Random;
+
+	FMatrix4D Matrix = Random.Matrix();
+	FMatrix4D MatrixProduct = FSimdMatrix::Multiply(Matrix, FSimdMatrix::Inverse(Matrix));
+	REQUIRE(AreNearlyEqual<16>(MatrixProduct.GetData(), FMatrix4D::Identity.GetData()));
+
+	FTransform4D Transform = Random.Transform();
+	FTransform4D TransformProduct = FSimdMatrix::Multiply(Transform, FSimdMatrix::Inverse(Transform));
+	REQUIRE(AreNearlyEqual<12>(TransformProduct.GetData(), FTransform4D::Identity.GetData()));
+}
@@ -0,0 +1,136 @@
+#include "catch/catch.hpp"
+
+#include "Containers/SlotMap.h"
+#include "Strings/String.h"
+
+TEST_CASE("TSlotMap")
+{
+	TSlotMap<int32> TestSlotMap;
+
+	REQUIRE(TestSlotMap.IsEmpty());
+	REQUIRE(TestSlotMap.GetSize() == 0);
+
+	SECTION("Add and find elements.")
+	{
+		TSlotMapHandle<int32> Handles[10];
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Handles[Index] = TestSlotMap.Add(Index * 10);
+		}
+
+		REQUIRE(TestSlotMap.GetSize() == 10);
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			REQUIRE(!Handles[Index].IsNull());
+			REQUIRE(TestSlotMap.IsValid(Handles[Index]));
+			REQUIRE(TestSlotMap.Find(Handles[Index]) != nullptr);
+			REQUIRE(TestSlotMap[Handles[Index]] == Index * 10);
+		}
+	}
+
+	SECTION("Null handles never refer to an element.")
+	{
+		TestSlotMap.Add(1);
+
+		TSlotMapHandle<int32> NullHandle;
+		REQUIRE(NullHandle.IsNull());
+		REQUIRE(!TestSlotMap.IsValid(NullHandle));
+		REQUIRE(TestSlotMap.Find(NullHandle) == nullptr);
+		REQUIRE(!TestSlotMap.Remove(NullHandle));
+	}
+
+	SECTION("Removed elements leave stale handles.")
+	{
+		TSlotMapHandle<int32> First = TestSlotMap.Add(1);
+		TSlotMapHandle<int32> Second = TestSlotMap.Add(2);
+		TSlotMapHandle<int32> Third = TestSlotMap.Add(3);
+
+		REQUIRE(TestSlotMap.Remove(First));
+		REQUIRE(!TestSlotMap.Remove(First));
+
+		REQUIRE(TestSlotMap.GetSize() == 2);
+		REQUIRE(!TestSlotMap.IsValid(First));
+		REQUIRE(TestSlotMap.Find(First) == nullptr);
+
+		// The other handles still find their elements after the last element moved.
+		REQUIRE(TestSlotMap[Second] == 2);
+		REQUIRE(TestSlotMap[Third] == 3);
+	}
+
+	SECTION("Slots are reused with a new generation.")
+	{
+		TSlotMapHandle<int32> Removed = TestSlotMap.Add(1);
+		TestSlotMap.Remove(Removed);
+
+		TSlotMapHandle<int32> Added = TestSlotMap.Add(2);
+		REQUIRE(Added.Index == Removed.Index);
+		REQUIRE(Added.Generation != Removed.Generation);
+		REQUIRE(Added != Removed);
+		REQUIRE(TestSlotMap.GetNumSlots() == 1);
+
+		REQUIRE(TestSlotMap.Find(Removed) == nullptr);
+		REQUIRE(TestSlotMap[Added] == 2);
+	}
+
+	SECTION("Elements are dense.")
+	{
+		TSlotMapHandle<int32> Handles[8];
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			Handles[Index] = TestSlotMap.Add(Index);
+		}
+		for (int32 Index = 0; Index < 8; Index += 2)
+		{
+			TestSlotMap.Remove(Handles[Index]);
+		}
+
+		REQUIRE(TestSlotMap.GetSize() == 4);
+		int32 Sum = 0;
+		for (int32 Element : TestSlotMap)
+		{
+			REQUIRE(Element % 2 == 1);
+			Sum += Element;
+		}
+		REQUIRE(Sum == 1 + 3 + 5 + 7);
+
+		// Handles can be recovered from positions in the dense array.
+		for (int32 Index = 0; Index < TestSlotMap.GetSize(); ++Index)
+		{
+			TSlotMapHandle<int32> Handle = TestSlotMap.GetHandleAt(Index);
+			REQUIRE(TestSlotMap.Find(Handle) == &TestSlotMap.GetElements()[Index]);
+		}
+	}
+
+	SECTION("Empty makes every handle stale.")
+	{
+		TSlotMapHandle<int32> First = TestSlotMap.Add(1);
+		TSlotMapHandle<int32> Second = TestSlotMap.Add(2);
+		TestSlotMap.Empty();
+
+		REQUIRE(TestSlotMap.IsEmpty());
+		REQUIRE(!TestSlotMap.IsValid(First));
+		REQUIRE(!TestSlotMap.IsValid(Second));
+
+		TSlotMapHandle<int32> Added = TestSlotMap.Add(3);
+		REQUIRE(TestSlotMap.GetNumSlots() == 2);
+		REQUIRE(TestSlotMap[Added] == 3);
+	}
+}
+
+TEST_CASE("TSlotMap with non-trivial elements")
+{
+	TSlotMap<FANSIString> TestSlotMap;
+
+	TSlotMapHandle<FANSIString> First = TestSlotMap.Emplace("First");
+	TSlotMapHandle<FANSIString> Second = TestSlotMap.Add(FANSIString("Second"));
+	TSlotMapHandle<FANSIString> Third = TestSlotMap.Add(FANSIString("Third"));
+
+	TestSlotMap.Remove(First);
+	REQUIRE(TestSlotMap[Second] == "Second");
+	REQUIRE(TestSlotMap[Third] == "Third");
+
+	TSlotMap<FANSIString> Copy(TestSlotMap);
+	REQUIRE(Copy.GetSize() == 2);
+	REQUIRE(Copy[Third] == "Third");
+	REQUIRE(!Copy.IsValid(First));
+}
@@ -0,0 +1,121 @@
+#include "catch/catch.hpp"
+
+#include "Algorithms/ParallelSort.h"
+#include "Algorithms/RadixSort.h"
+#include "Algorithms/Sort.h"
+#include "Containers/Array.h"
+
+#include <algorithm>
+#include <random>
+
+/**
+ * Sorting algorithms compared to the standard library.
+ * Benchmarks are hidden from the default test run; run them with: Test "[Benchmark]"
+ *
+ * Every benchmark copies the same unsorted input before sorting it, so the copy costs the same in all of them.
+ * The integer benchmarks sort random keys, like render keys. The depth benchmarks sort draws by a float
+ * depth, like the back to front sorting of transparent objects.
+ */
+
+namespace
+{
+	// Number of elements sorted per benchmark.
+	constexpr int32 NumSortedElements = 1000000;
+
+	// Draw sorted by its distance to the camera.
+	struct FBenchmarkDraw
+	{
+		float Depth;
+		uint32 DrawIndex;
+	};
+
+	// A lambda rather than a function, so that every sort can inline it.
+	const auto IsCloser = [](const FBenchmarkDraw& InA, const FBenchmarkDraw& InB)
+	{
+		return InA.Depth < InB.Depth;
+	};
+}
+
+TEST_CASE("Integer sort benchmarks.", "[.][Benchmark]")
+{
+	std::mt19937 Generator(1234);
+	TArray<uint32> Input(NumSortedElements);
+	for (int32 Index = 0; Index < NumSortedElements; ++Index)
+	{
+		Input.Add(Generator());
+	}
+
+	BENCHMARK("std::sort")
+	{
+		TArray<uint32> Array(Input);
+		std::sort(Array.begin(), Array.end());
+	}
+
+	BENCHMARK("Algo::Sort")
+	{
+		TArray<uint32> Array(Input);
+		Algo::Sort(Array);
+	}
+
+	BENCHMARK("std::stable_sort")
+	{
+		TArray<uint32> Array(Input);
+		std::stable_sort(Array.begin(), Array.end());
+	}
+
+	BENCHMARK("Algo::StableSort")
+	{
+		TArray<uint32> Array(Input);
+		Algo::StableSort(Array);
+	}
+
+	BENCHMARK("Algo::RadixSort")
+	{
+		TArray<uint32> Array(Input);
+		Algo::RadixSort(Array);
+	}
+
+	BENCHMARK("Algo::ParallelSort")
+	{
+		TArray<uint32> Array(Input);
+		Algo::ParallelSort(Array);
+	}
+}
+
+TEST_CASE("Depth sort benchmarks.", "[.][Benchmark]")
+{
+	std::mt19937 Generator(1234);
+	std::uniform_real_distribution<float> Distribution(-1000.0f, 1000.0f);
+	TArray<FBenchmarkDraw> Input(NumSortedElements);
+	for (int32 Index = 0; Index < NumSortedElements; ++Index)
+	{
+		Input.Add({ Distribution(Generator), static_cast<uint32>(Index) });
+	}
+
+	BENCHMARK("std::sort")
+	{
+		TArray<FBenchmarkDraw> Draws(Input);
+		std::sort(Draws.begin(), Draws.end(), IsCloser);
+	}
+
+	BENCHMARK("Algo::Sort")
+	{
+		TArray<FBenchmarkDraw> Draws(Input);
+		Algo::Sort(Draws, IsCloser);
+	}
+
+	BENCHMARK("Algo::RadixSort")
+	{
+		TArray<FBenchmarkDraw> Draws(Input);
+		Algo::RadixSort(Draws, [](const FBenchmarkDraw& InDraw)
+		{
+			return InDraw.Depth;
+		});
+	}
+
+	BENCHMARK("Algo::ParallelSort")
+	{
+		TArray<FBenchmarkDraw> Draws(Input);
+		Algo::ParallelSort(Draws, IsCloser);
+	}
+}
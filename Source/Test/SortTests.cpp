@@ -0,0 +1,300 @@
+#include "catch/catch.hpp"
+
+#include "Algorithms/ParallelSort.h"
+#include "Algorithms/RadixSort.h"
+#include "Algorithms/Sort.h"
+#include "Containers/Array.h"
+#include "Containers/InlineArray.h"
+#include "Strings/String.h"
+
+#include <cstring>
+#include <random>
+
+namespace
+{
+	// Element sorted by Key, remembering its original position to check stability.
+	struct FKeyedElement
+	{
+		int32 Key;
+		int32 Order;
+	};
+
+	TArray<int32> MakeRandomArray(int32 InNum, int32 InMaxValue, uint32 InSeed)
+	{
+		std::mt19937 Generator(InSeed);
+		std::uniform_int_distribution<int32> Distribution(-InMaxValue, InMaxValue);
+		TArray<int32> Array(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			Array.Add(Distribution(Generator));
+		}
+		return Array;
+	}
+
+	TArray<FKeyedElement> MakeKeyedElements(int32 InNum, int32 InNumKeys)
+	{
+		std::mt19937 Generator(42);
+		std::uniform_int_distribution<int32> Distribution(0, InNumKeys - 1);
+		TArray<FKeyedElement> Elements(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			Elements.Add({ Distribution(Generator), Index });
+		}
+		return Elements;
+	}
+
+	// Checks that elements with equal keys kept their original order.
+	bool IsStablySorted(const TArray<FKeyedElement>& InElements)
+	{
+		for (int32 Index = 1; Index < InElements.GetSize(); ++Index)
+		{
+			const FKeyedElement& Previous = InElements[Index - 1];
+			const FKeyedElement& Current = InElements[Index];
+			if (Current.Key < Previous.Key || (Current.Key == Previous.Key && Current.Order < Previous.Order))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	int64 GetSum(const TArray<int32>& InArray)
+	{
+		int64 Sum = 0;
+		for (int32 Element : InArray)
+		{
+			Sum += Element;
+		}
+		return Sum;
+	}
+}
+
+TEST_CASE("Algo::Sort")
+{
+	SECTION("Empty and single element ranges.")
+	{
+		TArray<int32> Array;
+		Algo::Sort(Array);
+		REQUIRE(Array.IsEmpty());
+
+		Array.Add(1);
+		Algo::Sort(Array);
+		REQUIRE(Array[0] == 1);
+	}
+
+	SECTION("Random elements.")
+	{
+		// Sizes around the insertion sort threshold, and large enough to go through the quick sort.
+		for (int32 Num : { 2, 15, 16, 17, 100, 10000 })
+		{
+			TArray<int32> Array = MakeRandomArray(Num, 1000, Num);
+			const int64 Sum = GetSum(Array);
+			Algo::Sort(Array);
+			REQUIRE(Array.GetSize() == Num);
+			REQUIRE(Algo::IsSorted(Array));
+			REQUIRE(GetSum(Array) == Sum);
+		}
+	}
+
+	SECTION("Sorted, reversed and equal elements.")
+	{
+		TArray<int32> Sorted;
+		TArray<int32> Reversed;
+		TArray<int32> Equal;
+		TArray<int32> Sawtooth;
+		for (int32 Index = 0; Index < 5000; ++Index)
+		{
+			Sorted.Add(Index);
+			Reversed.Add(5000 - Index);
+			Equal.Add(7);
+			Sawtooth.Add(Index % 10);
+		}
+
+		Algo::Sort(Sorted);
+		Algo::Sort(Reversed);
+		Algo::Sort(Equal);
+		Algo::Sort(Sawtooth);
+		REQUIRE(Algo::IsSorted(Sorted));
+		REQUIRE(Algo::IsSorted(Reversed));
+		REQUIRE(Algo::IsSorted(Equal));
+		REQUIRE(Algo::IsSorted(Sawtooth));
+		REQUIRE(Reversed[0] == 1);
+		REQUIRE(Sawtooth[4999] == 9);
+	}
+
+	SECTION("Predicates.")
+	{
+		TArray<int32> Array = MakeRandomArray(1000, 100, 1);
+		Algo::Sort(Array, TGreater<>());
+		REQUIRE(Algo::IsSorted(Array, TGreater<>()));
+		REQUIRE(!Algo::IsSorted(Array));
+
+		TArray<FKeyedElement> Elements = MakeKeyedElements(1000, 10);
+		Algo::Sort(Elements, [](const FKeyedElement& InA, const FKeyedElement& InB)
+		{
+			return InA.Key < InB.Key;
+		});
+		for (int32 Index = 1; Index < Elements.GetSize(); ++Index)
+		{
+			REQUIRE(Elements[Index - 1].Key <= Elements[Index].Key);
+		}
+	}
+
+	SECTION("Non-trivial elements.")
+	{
+		// Two letter strings, from "aa" to "jj", in a scrambled order.
+		TArray<FANSIString> Strings;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			const int32 Value = (Index * 37) % 100;
+			const char String[] = { static_cast<char>('a' + Value / 10), static_cast<char>('a' + Value % 10), '\0' };
+			Strings.Add(FANSIString(String));
+		}
+		Algo::Sort(Strings, [](const FANSIString& InA, const FANSIString& InB)
+		{
+			return strcmp(InA.GetData(), InB.GetData()) < 0;
+		});
+		REQUIRE(Strings[0] == "aa");
+		REQUIRE(Strings[11] == "bb");
+		REQUIRE(Strings[99] == "jj");
+	}
+
+	SECTION("Inline arrays.")
+	{
+		TInlineArray<int32, 8> Array;
+		for (int32 Element : { 5, 3, 8, 1, 9, 2 })
+		{
+			Array.Add(Element);
+		}
+		Algo::Sort(Array);
+		REQUIRE(Algo::IsSorted(Array));
+		REQUIRE(Array[0] == 1);
+	}
+}
+
+TEST_CASE("Algo::StableSort")
+{
+	auto KeyLess = [](const FKeyedElement& InA, const FKeyedElement& InB)
+	{
+		return InA.Key < InB.Key;
+	};
+
+	for (int32 Num : { 0, 10, 17, 1000, 10000 })
+	{
+		TArray<FKeyedElement> Elements = MakeKeyedElements(Num, 16);
+		Algo::StableSort(Elements, KeyLess);
+		REQUIRE(Elements.GetSize() == Num);
+		REQUIRE(IsStablySorted(Elements));
+	}
+
+	TArray<int32> Array = MakeRandomArray(5000, 1000, 2);
+	Algo::StableSort(Array);
+	REQUIRE(Algo::IsSorted(Array));
+}
+
+TEST_CASE("Algo::RadixSort")
+{
+	SECTION("Integer keys.")
+	{
+		TArray<int32> Array = MakeRandomArray(10000, 1 << 30, 3);
+		const int64 Sum = GetSum(Array);
+		Algo::RadixSort(Array);
+		REQUIRE(Algo::IsSorted(Array));
+		REQUIRE(GetSum(Array) == Sum);
+
+		TArray<uint32> Unsigned;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Unsigned.Add(static_cast<uint32>(Index) * 2654435761u);
+		}
+		Algo::RadixSort(Unsigned);
+		REQUIRE(Algo::IsSorted(Unsigned));
+
+		TArray<uint64> Wide;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Wide.Add(static_cast<uint64>(Index) * 0x9E3779B97F4A7C15ull);
+		}
+		Algo::RadixSort(Wide);
+		REQUIRE(Algo::IsSorted(Wide));
+	}
+
+	SECTION("Float keys.")
+	{
+		TArray<float> Array;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Array.Add(static_cast<float>((Index * 7919) % 1000 - 500) * 0.25f);
+		}
+		Array.Add(-0.0f);
+		Array.Add(1.0e30f);
+		Array.Add(-1.0e30f);
+		Algo::RadixSort(Array);
+		REQUIRE(Algo::IsSorted(Array));
+		REQUIRE(Array[0] == -1.0e30f);
+		REQUIRE(Array[Array.GetSize() - 1] == 1.0e30f);
+	}
+
+	SECTION("Key projections are stable.")
+	{
+		for (int32 Num : { 10, 10000 })
+		{
+			TArray<FKeyedElement> Elements = MakeKeyedElements(Num, 300);
+			Algo::RadixSort(Elements, [](const FKeyedElement& InElement)
+			{
+				return InElement.Key;
+			});
+			REQUIRE(IsStablySorted(Elements));
+		}
+	}
+}
+
+TEST_CASE("Algo::ParallelSort")
+{
+	// Large enough to be split into chunks.
+	TArray<int32> Array = MakeRandomArray(200000, 1 << 20, 4);
+	const int64 Sum = GetSum(Array);
+
+	SECTION("Even number of threads.")
+	{
+		Algo::ParallelSort(Array, TLess<>(), 4);
+	}
+
+	SECTION("Odd number of threads.")
+	{
+		Algo::ParallelSort(Array, TLess<>(), 3);
+	}
+
+	SECTION("Hardware threads.")
+	{
+		Algo::ParallelSort(Array);
+	}
+
+	REQUIRE(Array.GetSize() == 200000);
+	REQUIRE(Algo::IsSorted(Array));
+	REQUIRE(GetSum(Array) == Sum);
+}
+
+TEST_CASE("Algo::Partition")
+{
+	TArray<int32> Array = MakeRandomArray(1000, 100, 5);
+	int32 NumEven = 0;
+	for (int32 Element : Array)
+	{
+		NumEven += (Element % 2 == 0) ? 1 : 0;
+	}
+
+	auto IsEven = [](int32 InElement)
+	{
+		return InElement % 2 == 0;
+	};
+	const int32 PartitionIndex = Algo::Partition(Array, IsEven);
+	REQUIRE(PartitionIndex == NumEven);
+	for (int32 Index = 0; Index < Array.GetSize(); ++Index)
+	{
+		REQUIRE(IsEven(Array[Index]) == (Index < PartitionIndex));
+	}
+
+	TArray<int32> Empty;
+	REQUIRE(Algo::Partition(Empty, IsEven) == 0);
+}
@@ -0,0 +1,201 @@
+#include "catch/catch.hpp"
+
+#include "Containers/Array.h"
+#include "Containers/SortedMap.h"
+#include "Strings/String.h"
+
+#include <cstring>
+#include <map>
+#include <random>
+
+namespace
+{
+	// Orders string keys alphabetically, since strings don't have operator<.
+	struct FStringSortedMapKeyOperations : TDefaultSortedMapKeyOperations<FANSIString, int32>
+	{
+		static bool IsKeyLess(const FANSIString& InKey, const FANSIString& InOtherKey)
+		{
+			return strcmp(InKey.GetData(), InOtherKey.GetData()) < 0;
+		}
+	};
+}
+
+TEST_CASE("TSortedMap")
+{
+	TSortedMap<int32, int32> TestMap;
+
+	REQUIRE(TestMap.IsEmpty());
+	REQUIRE(TestMap.GetSize() == 0);
+
+	SECTION("Add and remove one pair.")
+	{
+		REQUIRE(TestMap.Add(1, 10));
+		REQUIRE(TestMap.GetSize() == 1);
+		REQUIRE(TestMap.Find(1) != nullptr);
+		REQUIRE(*TestMap.Find(1) == 10);
+		REQUIRE(TestMap.Find(2) == nullptr);
+
+		REQUIRE(TestMap.Remove(1));
+		REQUIRE(TestMap.IsEmpty());
+		REQUIRE(!TestMap.IsKeyContained(1));
+	}
+
+	SECTION("Add duplicate key.")
+	{
+		REQUIRE(TestMap.Add(1, 10));
+		// Like TMap, the first value is kept.
+		REQUIRE(!TestMap.Add(1, 20));
+		REQUIRE(TestMap.GetSize() == 1);
+		REQUIRE(*TestMap.Find(1) == 10);
+
+		*TestMap.Find(1) = 30;
+		REQUIRE(*TestMap.Find(1) == 30);
+	}
+
+	SECTION("Random adds and removes.")
+	{
+		std::mt19937 Generator(5678);
+		std::uniform_int_distribution<int32> Distribution(-3000, 3000);
+		std::map<int32, int32> Reference;
+		for (int32 Iteration = 0; Iteration < 40000; ++Iteration)
+		{
+			const int32 Key = Distribution(Generator);
+			if (Generator() % 3 != 0)
+			{
+				REQUIRE(TestMap.Add(Key, Iteration) == Reference.insert({ Key, Iteration }).second);
+			}
+			else
+			{
+				REQUIRE(TestMap.Remove(Key) == (Reference.erase(Key) == 1));
+			}
+		}
+
+		REQUIRE(TestMap.GetSize() == static_cast<int32>(Reference.size()));
+		auto ReferenceIt = Reference.begin();
+		for (const TPair<int32, int32>& Pair : TestMap)
+		{
+			REQUIRE(Pair.Key == ReferenceIt->first);
+			REQUIRE(Pair.Value == ReferenceIt->second);
+			++ReferenceIt;
+		}
+	}
+
+	SECTION("Values are modified through iterators.")
+	{
+		for (int32 Index = 0; Index < 500; ++Index)
+		{
+			TestMap.Add(Index, 0);
+		}
+		for (TPair<int32, int32>& Pair : TestMap.GetRange(100, 199))
+		{
+			Pair.Value = Pair.Key;
+		}
+
+		REQUIRE(*TestMap.Find(99) == 0);
+		REQUIRE(*TestMap.Find(100) == 100);
+		REQUIRE(*TestMap.Find(199) == 199);
+		REQUIRE(*TestMap.Find(200) == 0);
+		REQUIRE(TestMap.LowerBound(150)->Value == 150);
+		REQUIRE(TestMap.UpperBound(150)->Value == 151);
+	}
+
+	SECTION("Build from sorted pairs.")
+	{
+		TArray<TPair<int32, int32>> Pairs;
+		for (int32 Index = 0; Index < 10000; ++Index)
+		{
+			Pairs.Add(TPair<int32, int32>(Index * 2, Index));
+		}
+		TestMap.BuildFromSorted(Pairs);
+
+		REQUIRE(TestMap.GetSize() == 10000);
+		REQUIRE(*TestMap.Find(0) == 0);
+		REQUIRE(*TestMap.Find(19998) == 9999);
+		REQUIRE(TestMap.Find(1) == nullptr);
+		REQUIRE(TestMap.LowerBound(1)->Key == 2);
+	}
+}
+
+TEST_CASE("TSortedMap string keys")
+{
+	// Keys that are larger than pointers and not trivially relocatable.
+	TSortedMap<FANSIString, int32, FStringSortedMapKeyOperations> Map;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		const int32 Value = (Index * 37) % 1000;
+		const char Key[] = { static_cast<char>('a' + Value / 100), static_cast<char>('a' + Value / 10 % 10), static_cast<char>('a' + Value % 10), '\0' };
+		REQUIRE(Map.Add(FANSIString(Key), Value));
+	}
+
+	REQUIRE(Map.GetSize() == 1000);
+	REQUIRE(*Map.Find(FANSIString("bcd")) == 123);
+	REQUIRE(Map.begin()->Key == "aaa");
+
+	int32 Expected = 0;
+	for (const TPair<FANSIString, int32>& Pair : Map)
+	{
+		REQUIRE(Pair.Value == Expected++);
+	}
+
+	for (int32 Index = 0; Index < 1000; Index += 2)
+	{
+		const char Key[] = { static_cast<char>('a' + Index / 100), static_cast<char>('a' + Index / 10 % 10), static_cast<char>('a' + Index % 10), '\0' };
+		REQUIRE(Map.Remove(FANSIString(Key)));
+	}
+	REQUIRE(Map.GetSize() == 500);
+	REQUIRE(Map.begin()->Value == 1);
+}
+
+namespace
+{
+	// Counts live instances, to check that the map destroys every value it constructs.
+	struct FSortedLiveCounter
+	{
+		explicit FSortedLiveCounter(int32& InNumLive)
+			: NumLive(&InNumLive)
+		{
+			++*NumLive;
+		}
+		FSortedLiveCounter(const FSortedLiveCounter& InOther)
+			: NumLive(InOther.NumLive)
+		{
+			++*NumLive;
+		}
+		~FSortedLiveCounter()
+		{
+			--*NumLive;
+		}
+		FSortedLiveCounter& operator=(const FSortedLiveCounter& InOther) = delete;
+
+		int32* NumLive;
+	};
+}
+
+TEST_CASE("TSortedMap element lifetime")
+{
+	int32 NumLive = 0;
+	{
+		TSortedMap<int32, FSortedLiveCounter> TestMap;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			TestMap.Add(Index, FSortedLiveCounter(NumLive));
+		}
+		REQUIRE(NumLive == 1000);
+
+		for (int32 Index = 0; Index < 1000; Index += 3)
+		{
+			TestMap.Remove(Index);
+		}
+		REQUIRE(NumLive == 666);
+
+		TSortedMap<int32, FSortedLiveCounter> Copy(TestMap);
+		REQUIRE(NumLive == 1332);
+
+		TSortedMap<int32, FSortedLiveCounter> Moved(MoveTemp(Copy));
+		REQUIRE(NumLive == 1332);
+
+		TestMap.Empty();
+		REQUIRE(NumLive == 666);
+	}
+	REQUIRE(NumLive == 0);
+}
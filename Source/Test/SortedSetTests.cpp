@@ -0,0 +1,255 @@
+#include "catch/catch.hpp"
+
+#include "Containers/Array.h"
+#include "Containers/SortedSet.h"
+#include "Memory/ArenaAllocator.h"
+#include "Memory/PoolAllocator.h"
+
+#include <random>
+#include <set>
+
+namespace
+{
+	// Checks that the set holds exactly the reference's elements, in the same order.
+	bool IsSameAsReference(const TSortedSet<int32>& InSet, const std::set<int32>& InReference)
+	{
+		if (InSet.GetSize() != static_cast<int32>(InReference.size()))
+		{
+			return false;
+		}
+
+		auto ReferenceIt = InReference.begin();
+		for (int32 Element : InSet)
+		{
+			if (Element != *ReferenceIt++)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+TEST_CASE("TSortedSet")
+{
+	TSortedSet<int32> TestSet;
+
+	REQUIRE(TestSet.IsEmpty());
+	REQUIRE(TestSet.GetSize() == 0);
+	REQUIRE(TestSet.begin() == TestSet.end());
+
+	SECTION("Add and remove one element.")
+	{
+		REQUIRE(TestSet.Add(1));
+		REQUIRE(TestSet.GetSize() == 1);
+		REQUIRE(TestSet.Find(1) != nullptr);
+		REQUIRE(*TestSet.Find(1) == 1);
+		REQUIRE(TestSet.Find(0) == nullptr);
+
+		REQUIRE(TestSet.Remove(1));
+		REQUIRE(TestSet.IsEmpty());
+		REQUIRE(TestSet.Find(1) == nullptr);
+		REQUIRE(!TestSet.Remove(1));
+	}
+
+	SECTION("Add duplicate element.")
+	{
+		REQUIRE(TestSet.Add(1));
+		REQUIRE(!TestSet.Add(1));
+		REQUIRE(TestSet.GetSize() == 1);
+	}
+
+	SECTION("Elements are iterated in order.")
+	{
+		// Enough elements for several levels of inner nodes.
+		for (int32 Index = 0; Index < 20000; ++Index)
+		{
+			TestSet.Add((Index * 7919) % 20000);
+		}
+
+		REQUIRE(TestSet.GetSize() == 20000);
+		int32 Expected = 0;
+		for (int32 Element : TestSet)
+		{
+			REQUIRE(Element == Expected++);
+		}
+		REQUIRE(Expected == 20000);
+	}
+
+	SECTION("Random adds and removes.")
+	{
+		std::mt19937 Generator(1234);
+		std::uniform_int_distribution<int32> Distribution(0, 4999);
+		std::set<int32> Reference;
+		for (int32 Iteration = 0; Iteration < 50000; ++Iteration)
+		{
+			const int32 Element = Distribution(Generator);
+			// Add more than remove at first, then remove more, so that the tree grows then shrinks.
+			const bool bShouldAdd = (Generator() % 100) < (Iteration < 25000 ? 70 : 30);
+			if (bShouldAdd)
+			{
+				REQUIRE(TestSet.Add(Element) == Reference.insert(Element).second);
+			}
+			else
+			{
+				REQUIRE(TestSet.Remove(Element) == (Reference.erase(Element) == 1));
+			}
+		}
+		REQUIRE(IsSameAsReference(TestSet, Reference));
+
+		for (int32 Element = 0; Element < 5000; ++Element)
+		{
+			REQUIRE(TestSet.IsContained(Element) == (Reference.count(Element) == 1));
+			TestSet.Remove(Element);
+		}
+		REQUIRE(TestSet.IsEmpty());
+		REQUIRE(TestSet.begin() == TestSet.end());
+	}
+
+	SECTION("Lower and upper bounds.")
+	{
+		// Even numbers from 0 to 1998.
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			TestSet.Add(Index * 2);
+		}
+
+		REQUIRE(*TestSet.LowerBound(10) == 10);
+		REQUIRE(*TestSet.UpperBound(10) == 12);
+		REQUIRE(*TestSet.LowerBound(11) == 12);
+		REQUIRE(*TestSet.UpperBound(11) == 12);
+		REQUIRE(*TestSet.LowerBound(-5) == 0);
+		REQUIRE(TestSet.LowerBound(1999) == TestSet.end());
+		REQUIRE(TestSet.UpperBound(1998) == TestSet.end());
+	}
+
+	SECTION("Ranges.")
+	{
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			TestSet.Add(Index * 2);
+		}
+
+		int32 Num = 0;
+		int32 Expected = 100;
+		for (int32 Element : TestSet.GetRange(99, 500))
+		{
+			REQUIRE(Element == Expected);
+			Expected += 2;
+			++Num;
+		}
+		REQUIRE(Num == 201);
+
+		auto EmptyRange = TestSet.GetRange(3, 3);
+		REQUIRE(EmptyRange.begin() == EmptyRange.end());
+	}
+
+	SECTION("Build from sorted elements.")
+	{
+		TestSet.Add(-1);
+
+		for (int32 Num : { 0, 1, 59, 60, 61, 1000, 100000 })
+		{
+			TArray<int32> Elements(Num);
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Elements.Add(Index * 3);
+			}
+			TestSet.BuildFromSorted(Elements);
+
+			REQUIRE(TestSet.GetSize() == Num);
+			REQUIRE(!TestSet.IsContained(-1));
+			int32 Expected = 0;
+			for (int32 Element : TestSet)
+			{
+				REQUIRE(Element == Expected);
+				Expected += 3;
+			}
+
+			// The built tree supports adds and removes like any other.
+			for (int32 Index = 0; Index < Num; Index += 2)
+			{
+				REQUIRE(TestSet.Remove(Index * 3));
+				REQUIRE(TestSet.Add(Index * 3 + 1));
+			}
+			REQUIRE(TestSet.GetSize() == Num);
+			REQUIRE((Num == 0 || TestSet.IsContained(1)));
+		}
+	}
+}
+
+TEST_CASE("TSortedSet allocators")
+{
+	const int32 BufferSize = 4096;
+	uint8 Buffer[BufferSize];
+	FArenaAllocator ArenaAllocator(&Buffer[0], BufferSize);
+	FPoolAllocator PoolAllocator;
+
+	TSortedSet<int32> ArenaSet(ArenaAllocator);
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		ArenaSet.Add(Index);
+	}
+
+	SECTION("Memory comes from the given allocator.")
+	{
+		REQUIRE(ArenaSet.GetAllocator() == &ArenaAllocator);
+		REQUIRE(ArenaAllocator.GetNumBytesUsed() > 0);
+		REQUIRE(PoolAllocator.GetNumPages() == 0);
+	}
+
+	SECTION("Copy constructors.")
+	{
+		TSortedSet<int32> Copy(ArenaSet);
+		REQUIRE(Copy.GetAllocator() == &ArenaAllocator);
+		REQUIRE(Copy.GetSize() == 100);
+
+		TSortedSet<int32> PoolCopy(ArenaSet, PoolAllocator);
+		REQUIRE(PoolCopy.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolCopy.GetSize() == 100);
+		int32 Expected = 0;
+		for (int32 Element : PoolCopy)
+		{
+			REQUIRE(Element == Expected++);
+		}
+	}
+
+	SECTION("Copy assignment keeps the destination's allocator.")
+	{
+		TSortedSet<int32> PoolSet(PoolAllocator);
+		PoolSet.Add(-1);
+		PoolSet = ArenaSet;
+
+		REQUIRE(PoolSet.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolSet.GetSize() == 100);
+		REQUIRE(!PoolSet.IsContained(-1));
+		REQUIRE(PoolSet.IsContained(99));
+	}
+
+	SECTION("Move constructor takes the nodes and the allocator.")
+	{
+		const int32 NumBytesUsed = ArenaAllocator.GetNumBytesUsed();
+		TSortedSet<int32> Moved(MoveTemp(ArenaSet));
+		REQUIRE(Moved.GetAllocator() == &ArenaAllocator);
+		REQUIRE(Moved.GetSize() == 100);
+		REQUIRE(ArenaAllocator.GetNumBytesUsed() == NumBytesUsed);
+
+		// The moved-from set is empty and can be reused.
+		REQUIRE(ArenaSet.IsEmpty());
+		REQUIRE(ArenaSet.Find(0) == nullptr);
+		ArenaSet.Add(7);
+		REQUIRE(ArenaSet.IsContained(7));
+	}
+
+	SECTION("Move assignment between allocators moves the elements.")
+	{
+		TSortedSet<int32> PoolSet(PoolAllocator);
+		PoolSet = MoveTemp(ArenaSet);
+
+		REQUIRE(PoolSet.GetAllocator() == &PoolAllocator);
+		REQUIRE(PoolSet.GetSize() == 100);
+		REQUIRE(PoolSet.IsContained(99));
+		REQUIRE(ArenaSet.IsEmpty());
+		REQUIRE(ArenaSet.GetAllocator() == &ArenaAllocator);
+	}
+}
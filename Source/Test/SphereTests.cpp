@@ -0,0 +1,34 @@
+#include "catch/catch.hpp"
+
+#include "Math/Geometry/Sphere.h"
+#include "Math/Geometry/AABB.h"
+#include "Math/Transform4D.h"
+#include "Math/MathUtilities.h"
+
+TEST_CASE("FSphere queries.")
+{
+	FSphere Sphere(FVector3D(1.0f, 0.0f, 0.0f), 2.0f);
+
+	REQUIRE(Sphere.Contains(FVector3D(3.0f, 0.0f, 0.0f)));
+	REQUIRE(!Sphere.Contains(FVector3D(3.0f, 0.1f, 0.0f)));
+
+	REQUIRE(Sphere.Intersects(FSphere(FVector3D(4.0f, 0.0f, 0.0f), 1.0f)));
+	REQUIRE(!Sphere.Intersects(FSphere(FVector3D(4.0f, 0.0f, 0.0f), 0.9f)));
+
+	REQUIRE(Sphere.Intersects(FAABB(FVector3D(2.0f, 1.0f, -1.0f), FVector3D(4.0f, 4.0f, 1.0f))));
+	// The box's corner (3, 2, 0) is outside the sphere although the box overlaps its bounding box.
+	REQUIRE(!Sphere.Intersects(FAABB(FVector3D(3.0f, 2.0f, -1.0f), FVector3D(4.0f, 4.0f, 1.0f))));
+}
+
+TEST_CASE("FSphere construction and transform.")
+{
+	FSphere Bounds = FSphere::MakeFromAABB(FAABB(FVector3D(-1.0f, -2.0f, -2.0f), FVector3D(1.0f, 2.0f, 2.0f)));
+	REQUIRE(Bounds.Center == FVector3D::Zero);
+	REQUIRE(Bounds.Radius == 3.0f);
+
+	FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(0.0f, 5.0f, 0.0f)) * FTransform4D::MakeRotationZ(1.0f) * FTransform4D::MakeScale(FVector3D(1.0f, 3.0f, 2.0f));
+	FSphere Result = FSphere(FVector3D(1.0f, 0.0f, 0.0f), 2.0f).GetTransformed(Transform);
+	REQUIRE(FMath::IsApproximatelyEqual(Result.Center.X, FMath::Cos(1.0f)));
+	REQUIRE(FMath::IsApproximatelyEqual(Result.Center.Y, 5.0f + FMath::Sin(1.0f)));
+	REQUIRE(FMath::IsApproximatelyEqual(Result.Radius, 6.0f, 1.e-5f));
+}
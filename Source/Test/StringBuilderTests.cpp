@@ -0,0 +1,99 @@
+#include "catch/catch.hpp"
+#include "Strings/StringBuilder.h"
+#include "Memory/ArenaAllocator.h"
+
+TEST_CASE("FANSIStringBuilder default constructor.")
+{
+	FANSIStringBuilder Builder;
+	REQUIRE(Builder.GetSize() == 0);
+	REQUIRE(Builder.GetCapacity() == 128);
+	REQUIRE(Builder.IsInline());
+	REQUIRE(Builder.GetData()[0] == '\0');
+}
+
+TEST_CASE("FANSIStringBuilder::Append")
+{
+	FANSIStringBuilder Builder;
+
+	SECTION("Appending text.")
+	{
+		FANSIString String = "Light";
+		Builder.Append(String).Append('[').Append("0").Append(FANSIStringView("].Color", 2));
+		REQUIRE(Builder.ToView() == "Light[0].");
+		REQUIRE(Builder.GetData()[Builder.GetSize()] == '\0');
+	}
+
+	SECTION("Appending integers.")
+	{
+		Builder.Append(0).Append(' ').Append(-42).Append(' ').Append(4000000000u);
+		REQUIRE(Builder.ToView() == "0 -42 4000000000");
+	}
+
+	SECTION("Appending floating-point numbers.")
+	{
+		Builder.Append(0.1f).Append(' ').Append(-2.5).Append(' ').Append(1.0f);
+		REQUIRE(Builder.ToView() == "0.1 -2.5 1");
+	}
+
+	SECTION("Appending a view of the builder itself.")
+	{
+		Builder.Append("Hello");
+		Builder.Append(Builder.ToView());
+		REQUIRE(Builder.ToView() == "HelloHello");
+	}
+}
+
+TEST_CASE("FANSIStringBuilder growth.")
+{
+	TANSIStringBuilder<8> Builder;
+	Builder.Append("1234567");
+	REQUIRE(Builder.IsInline());
+
+	// Exceeding the inline capacity moves the string into allocator memory.
+	Builder.Append("8");
+	REQUIRE(!Builder.IsInline());
+	REQUIRE(Builder.GetCapacity() >= 9);
+	REQUIRE(Builder.ToView() == "12345678");
+}
+
+TEST_CASE("FANSIStringBuilder with an arena allocator.")
+{
+	int8 Memory[256];
+	FArenaAllocator ArenaAllocator(Memory, sizeof(Memory));
+
+	TANSIStringBuilder<4> Builder(ArenaAllocator);
+	Builder.Append("Hello, world!");
+	REQUIRE(Builder.GetData() >= reinterpret_cast<ANSICHAR*>(Memory));
+	REQUIRE(Builder.GetData() < reinterpret_cast<ANSICHAR*>(Memory) + sizeof(Memory));
+	REQUIRE(Builder.ToView() == "Hello, world!");
+}
+
+TEST_CASE("FANSIStringBuilder::Reset")
+{
+	TANSIStringBuilder<4> Builder;
+	Builder.Append("Hello");
+	int32 Capacity = Builder.GetCapacity();
+
+	// Resetting keeps the memory so that the builder can be reused.
+	Builder.Reset();
+	REQUIRE(Builder.GetSize() == 0);
+	REQUIRE(Builder.GetCapacity() == Capacity);
+	REQUIRE(Builder.GetData()[0] == '\0');
+}
+
+TEST_CASE("FANSIStringBuilder::RemoveSuffix")
+{
+	FANSIStringBuilder Builder;
+	Builder.Append("Hello, world!");
+	Builder.RemoveSuffix(8);
+	REQUIRE(Builder.ToView() == "Hello");
+	REQUIRE(Builder.GetData()[5] == '\0');
+}
+
+TEST_CASE("FANSIStringBuilder::ToString")
+{
+	FANSIStringBuilder Builder;
+	Builder.Append("Material.").Append("Shininess");
+	FANSIString String = Builder.ToString();
+	REQUIRE(String == "Material.Shininess");
+}
@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+#include "Strings/StringFormat.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+TEST_CASE("FStringFormat::FormatInteger")
+{
+	ANSICHAR Buffer[FStringFormat::MaxIntegerLength];
+
+	REQUIRE(FStringFormat::FormatInteger(0, Buffer) == 1);
+	REQUIRE(strcmp(Buffer, "0") == 0);
+
+	REQUIRE(FStringFormat::FormatInteger(-123, Buffer) == 4);
+	REQUIRE(strcmp(Buffer, "-123") == 0);
+
+	// The minimum value can't be negated as a signed number.
+	FStringFormat::FormatInteger(std::numeric_limits<int64>::min(), Buffer);
+	REQUIRE(strcmp(Buffer, "-9223372036854775808") == 0);
+
+	FStringFormat::FormatUnsignedInteger(std::numeric_limits<uint64>::max(), Buffer);
+	REQUIRE(strcmp(Buffer, "18446744073709551615") == 0);
+}
+
+TEST_CASE("FStringFormat::FormatFloat")
+{
+	ANSICHAR Buffer[FStringFormat::MaxFloatLength];
+
+	SECTION("Shortest representation is used.")
+	{
+		FStringFormat::FormatFloat(0.1f, Buffer);
+		REQUIRE(strcmp(Buffer, "0.1") == 0);
+
+		FStringFormat::FormatFloat(1.0f, Buffer);
+		REQUIRE(strcmp(Buffer, "1") == 0);
+
+		FStringFormat::FormatFloat(-0.5f, Buffer);
+		REQUIRE(strcmp(Buffer, "-0.5") == 0);
+	}
+
+	SECTION("Formatted values round-trip.")
+	{
+		const float Values[] = { 3.14159265f, 1.0e-20f, 123456789.0f, std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min() };
+		for (float Value : Values)
+		{
+			FStringFormat::FormatFloat(Value, Buffer);
+			REQUIRE(std::strtof(Buffer, nullptr) == Value);
+		}
+	}
+
+	SECTION("Non-finite values.")
+	{
+		FStringFormat::FormatFloat(std::numeric_limits<float>::infinity(), Buffer);
+		REQUIRE(strcmp(Buffer, "inf") == 0);
+
+		FStringFormat::FormatFloat(-std::numeric_limits<float>::infinity(), Buffer);
+		REQUIRE(strcmp(Buffer, "-inf") == 0);
+
+		FStringFormat::FormatFloat(std::numeric_limits<float>::quiet_NaN(), Buffer);
+		REQUIRE(strcmp(Buffer, "nan") == 0);
+	}
+}
+
+TEST_CASE("FStringFormat::FormatDouble")
+{
+	ANSICHAR Buffer[FStringFormat::MaxFloatLength];
+
+	FStringFormat::FormatDouble(0.1, Buffer);
+	REQUIRE(strcmp(Buffer, "0.1") == 0);
+
+	const double Values[] = { 3.141592653589793, 1.0e-300, std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest() };
+	for (double Value : Values)
+	{
+		FStringFormat::FormatDouble(Value, Buffer);
+		REQUIRE(std::strtod(Buffer, nullptr) == Value);
+	}
+}
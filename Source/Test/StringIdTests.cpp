@@ -3,6 +3,11 @@
 #include "Strings/StringId.h"
 #include "Strings/String.h"
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 TEST_CASE("FStringId default constructor.")
 {
 	FStringId StringId;
@@ -18,6 +23,15 @@ TEST_CASE("FStringId taking a C-style string.")
 	REQUIRE(StringId.GetId() == StringHash);
 }
 
+TEST_CASE("FStringId taking a string view.")
+{
+	// Views don't need to be null-terminated.
+	const ANSICHAR* Text = "Hello, world!";
+	FStringId StringId = FStringId(FANSIStringView(Text, 5));
+	REQUIRE(StringId.GetString() == "Hello");
+	REQUIRE(StringId.GetId() == FStringId("Hello").GetId());
+}
+
 TEST_CASE("FStringId Copy Constructor")
 {
 	FStringId StringId1 = FStringId("Hello");
@@ -60,3 +74,39 @@ TEST_CASE("FStringId::operator!=")
 	bool IsNotEqual = (StringId1 != StringId3);
 	REQUIRE(IsNotEqual);
 }
+
+TEST_CASE("FStringId created from several threads.")
+{
+	static constexpr int32 NumThreads = 4;
+	static constexpr int32 NumStrings = 500;
+
+	// Each thread creates the same strings, so that the threads race to register each of them.
+	std::atomic<int32> NumMismatches = 0;
+	std::vector<std::thread> Threads;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Threads.emplace_back([&NumMismatches]()
+		{
+			for (int32 Index = 0; Index < NumStrings; ++Index)
+			{
+				std::string String = "ThreadedStringId" + std::to_string(Index);
+				FStringId StringId(String.c_str());
+				if (!(StringId.GetString() == FANSIString(String.c_str())))
+				{
+					++NumMismatches;
+				}
+			}
+		});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+	REQUIRE(NumMismatches == 0);
+
+	for (int32 Index = 0; Index < NumStrings; ++Index)
+	{
+		std::string String = "ThreadedStringId" + std::to_string(Index);
+		REQUIRE(FStringId(String.c_str()).GetString() == FANSIString(String.c_str()));
+	}
+}
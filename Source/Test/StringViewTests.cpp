@@ -0,0 +1,90 @@
+#include "catch/catch.hpp"
+#include "Strings/StringView.h"
+#include "Strings/String.h"
+
+TEST_CASE("FANSIStringView default constructor.")
+{
+	FANSIStringView View;
+	REQUIRE(View.GetData() == nullptr);
+	REQUIRE(View.GetSize() == 0);
+	REQUIRE(View.IsEmpty());
+}
+
+TEST_CASE("FANSIStringView constructor taking a C-style string.")
+{
+	SECTION("Constructing from a nullptr produces an empty view.")
+	{
+		FANSIStringView View = nullptr;
+		REQUIRE(View.GetData() == nullptr);
+		REQUIRE(View.IsEmpty());
+	}
+
+	SECTION("Constructing from a non-empty string.")
+	{
+		const char* Text = "Hello";
+		FANSIStringView View = Text;
+		REQUIRE(View.GetData() == Text);
+		REQUIRE(View.GetSize() == 5);
+		REQUIRE(View == "Hello");
+	}
+}
+
+TEST_CASE("FANSIStringView constructor taking a string.")
+{
+	FANSIString String = "Hello";
+	FANSIStringView View = String;
+	REQUIRE(View.GetData() == String.GetData());
+	REQUIRE(View.GetSize() == String.GetSize());
+}
+
+TEST_CASE("FANSIStringView comparison.")
+{
+	const char* Text = "Hello, world!";
+	FANSIStringView View(Text, 5);
+	REQUIRE(View == "Hello");
+	REQUIRE(View != "Hello, world!");
+	REQUIRE(View != "Hell");
+	REQUIRE(View == FANSIStringView("Hello"));
+}
+
+TEST_CASE("FANSIStringView::Substring")
+{
+	FANSIStringView View = "Hello";
+
+	SECTION("Start and end indices are out of bounds.")
+	{
+		FANSIStringView Substring = View.Substring(-1, 6);
+		REQUIRE(Substring == View);
+	}
+
+	SECTION("Start and end indices are swapped.")
+	{
+		FANSIStringView Substring = View.Substring(5, 0);
+		REQUIRE(Substring.IsEmpty());
+	}
+
+	SECTION("Start and end indices are within the bounds of the view.")
+	{
+		FANSIStringView Substring = View.Substring(1, 3);
+		REQUIRE(Substring.GetData() == View.GetData() + 1);
+		REQUIRE(Substring == "el");
+	}
+}
+
+TEST_CASE("FANSIStringView::Find")
+{
+	FANSIStringView View = "1/2/3";
+	REQUIRE(View.Find('/') == 1);
+	REQUIRE(View.Find('/', 2) == 3);
+	REQUIRE(View.Find('/', 4) == InvalidIndex);
+	REQUIRE(View.Find('x') == InvalidIndex);
+}
+
+TEST_CASE("FANSIStringView hashing.")
+{
+	// Views hash the same way as the equivalent string, regardless of null-termination.
+	const char* Text = "Hello, world!";
+	FANSIStringView View(Text, 5);
+	FANSIString String = "Hello";
+	REQUIRE(GetTypeHash(View) == GetTypeHash(String));
+}
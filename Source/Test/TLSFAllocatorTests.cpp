@@ -0,0 +1,179 @@
+#include "catch/catch.hpp"
+
+#include "Memory/TLSFAllocator.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr uint64 TestHeapSize = 1024 * 1024;
+
+	// Heap memory for a test allocator, freed with the test.
+	struct FTestHeap
+	{
+		FTestHeap()
+			: Memory(TestHeapSize)
+			, Allocator(Memory.data(), TestHeapSize)
+		{
+		}
+
+		std::vector<int8> Memory;
+		FTLSFAllocator Allocator;
+	};
+}
+
+TEST_CASE("FTLSFAllocator::Allocate")
+{
+	FTestHeap Heap;
+	FTLSFAllocator& TestAllocator = Heap.Allocator;
+	const uint64 InitialFreeBytes = TestAllocator.GetNumBytesFree();
+
+	SECTION("Cannot allocate 0 bytes")
+	{
+		REQUIRE(TestAllocator.Allocate(0) == nullptr);
+		REQUIRE(TestAllocator.AllocateAligned(0, 16) == nullptr);
+	}
+
+	SECTION("Allocations are 8-byte aligned and rounded up")
+	{
+		void* First = TestAllocator.Allocate(3);
+		void* Second = TestAllocator.Allocate(20);
+		REQUIRE(reinterpret_cast<uint64>(First) % 8 == 0);
+		REQUIRE(reinterpret_cast<uint64>(Second) % 8 == 0);
+		REQUIRE(FTLSFAllocator::GetAllocationSize(First) == 16);
+		REQUIRE(FTLSFAllocator::GetAllocationSize(Second) == 24);
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 40);
+	}
+
+	SECTION("Larger alignments")
+	{
+		for (uint64 Alignment = 16; Alignment <= 4096; Alignment *= 2)
+		{
+			void* Unaligned = TestAllocator.Allocate(8);
+			int8* Aligned = static_cast<int8*>(TestAllocator.AllocateAligned(100, Alignment));
+			REQUIRE(Aligned != nullptr);
+			REQUIRE(reinterpret_cast<uint64>(Aligned) % Alignment == 0);
+			std::memset(Aligned, 0x5A, 100);
+			REQUIRE(FTLSFAllocator::GetAllocationSize(Aligned) >= 100);
+			TestAllocator.Deallocate(Unaligned);
+			TestAllocator.Deallocate(Aligned);
+		}
+
+		// The bytes skipped for alignment went back to the heap.
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 0);
+		REQUIRE(TestAllocator.GetNumBytesFree() == InitialFreeBytes);
+	}
+
+	SECTION("Returns nullptr when no block is large enough")
+	{
+		REQUIRE(TestAllocator.AllocateAligned(2 * TestHeapSize, 8) == nullptr);
+
+		void* Large = TestAllocator.AllocateAligned(TestHeapSize / 2, 8);
+		REQUIRE(Large != nullptr);
+		REQUIRE(TestAllocator.AllocateAligned(TestHeapSize / 2, 8) == nullptr);
+		TestAllocator.Deallocate(Large);
+		REQUIRE(TestAllocator.AllocateAligned(TestHeapSize / 2, 8) != nullptr);
+	}
+}
+
+TEST_CASE("FTLSFAllocator::Deallocate")
+{
+	FTestHeap Heap;
+	FTLSFAllocator& TestAllocator = Heap.Allocator;
+	const uint64 InitialFreeBytes = TestAllocator.GetNumBytesFree();
+
+	SECTION("Freed blocks are reused")
+	{
+		void* First = TestAllocator.Allocate(64);
+		TestAllocator.Allocate(64);
+		TestAllocator.Deallocate(First);
+		REQUIRE(TestAllocator.Allocate(64) == First);
+	}
+
+	SECTION("Adjacent free blocks are merged")
+	{
+		void* Blocks[8];
+		for (void*& Block : Blocks)
+		{
+			Block = TestAllocator.Allocate(1000);
+		}
+		REQUIRE(TestAllocator.GetNumBytesFree() < InitialFreeBytes);
+
+		// Free every other block first, so that the rest merge with neighbors on both sides.
+		for (int32 Index = 0; Index < 8; Index += 2)
+		{
+			TestAllocator.Deallocate(Blocks[Index]);
+		}
+		REQUIRE(TestAllocator.GetFragmentation() > 0.0f);
+		for (int32 Index = 1; Index < 8; Index += 2)
+		{
+			TestAllocator.Deallocate(Blocks[Index]);
+		}
+
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 0);
+		REQUIRE(TestAllocator.GetNumBytesFree() == InitialFreeBytes);
+		REQUIRE(TestAllocator.GetLargestFreeBlockSize() == InitialFreeBytes);
+		REQUIRE(TestAllocator.GetFragmentation() == 0.0f);
+	}
+
+	SECTION("Deallocating nullptr does nothing")
+	{
+		TestAllocator.Deallocate(nullptr);
+		REQUIRE(TestAllocator.GetNumBytesFree() == InitialFreeBytes);
+	}
+}
+
+TEST_CASE("FTLSFAllocator random allocations")
+{
+	FTestHeap Heap;
+	FTLSFAllocator& TestAllocator = Heap.Allocator;
+	const uint64 InitialFreeBytes = TestAllocator.GetNumBytesFree();
+
+	struct FLiveBlock
+	{
+		uint8* Memory;
+		uint64 Size;
+		uint8 Pattern;
+	};
+
+	// Keep random blocks alive, filled with a pattern, so that overlapping blocks are detected.
+	std::mt19937 Random(1234);
+	std::vector<FLiveBlock> LiveBlocks;
+	int32 NumErrors = 0;
+	for (int32 Iteration = 0; Iteration < 20000; ++Iteration)
+	{
+		if (!LiveBlocks.empty() && (LiveBlocks.size() > 200 || Random() % 2 == 0))
+		{
+			size_t Index = Random() % LiveBlocks.size();
+			FLiveBlock Block = LiveBlocks[Index];
+			for (uint64 Offset = 0; Offset < Block.Size; ++Offset)
+			{
+				NumErrors += Block.Memory[Offset] != Block.Pattern;
+			}
+			TestAllocator.Deallocate(Block.Memory);
+			LiveBlocks[Index] = LiveBlocks.back();
+			LiveBlocks.pop_back();
+		}
+		else
+		{
+			uint64 Size = 1 + Random() % (Random() % 8 == 0 ? 8000 : 200);
+			uint64 Alignment = Random() % 4 == 0 ? 64 : 8;
+			uint8* Memory = static_cast<uint8*>(TestAllocator.AllocateAligned(Size, Alignment));
+			REQUIRE(Memory != nullptr);
+			NumErrors += reinterpret_cast<uint64>(Memory) % Alignment != 0;
+			uint8 Pattern = static_cast<uint8>(Iteration);
+			std::memset(Memory, Pattern, Size);
+			LiveBlocks.push_back({ Memory, Size, Pattern });
+		}
+	}
+	REQUIRE(NumErrors == 0);
+
+	for (const FLiveBlock& Block : LiveBlocks)
+	{
+		TestAllocator.Deallocate(Block.Memory);
+	}
+	REQUIRE(TestAllocator.GetNumBytesUsed() == 0);
+	REQUIRE(TestAllocator.GetLargestFreeBlockSize() == InitialFreeBytes);
+}
@@ -526,3 +526,17 @@ TEST_CASE("FTransform4D::operator!=(const FTransform4D&)")
 	);
 	REQUIRE(Transform1 != Transform2);
 }
+
+// Compile-time evaluation
+TEST_CASE("FTransform4D compile-time evaluation.")
+{
+	constexpr FTransform4D Transform = FTransform4D::MakeTranslation(FVector3D(1.0f, 2.0f, 3.0f)) * FTransform4D::MakeScale(2.0f);
+	constexpr FVector4D Point = Transform * FVector4D(1.0f, 1.0f, 1.0f, 1.0f);
+	static_assert(Point.X == 3.0f && Point.Y == 4.0f && Point.Z == 5.0f && Point.W == 1.0f, "FTransform4D math should be usable in constant expressions.");
+	static_assert(FTransform4D::Identity.GetData()[0] == 1.0f && FTransform4D::Identity.GetData()[9] == 0.0f, "FTransform4D::Identity should be a constant expression.");
+
+	constexpr FMatrix4D Matrix = (FMatrix4D::Identity * FMatrix4D::Identity).GetTransposed();
+	static_assert(Matrix.GetData()[0] == 1.0f && Matrix.GetData()[1] == 0.0f, "FMatrix4D math should be usable in constant expressions.");
+
+	REQUIRE(Transform == FTransform4D(2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 2.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 3.0f));
+}
@@ -0,0 +1,200 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/TransformBatch.h"
+#include "Math/Vector4D.h"
+#include "Math/MathUtilities.h"
+#include "Containers/Array.h"
+
+#include <random>
+
+// Not a multiple of the lane count, so that the remainder loops are covered as well.
+static constexpr int32 NumBatchElements = 37;
+
+static bool IsNearlyEqual(float InA, float InB)
+{
+	float Tolerance = 1.e-4f * FMath::Max(1.0f, FMath::Max(FMath::Abs(InA), FMath::Abs(InB)));
+	return FMath::Abs(InA - InB) <= Tolerance;
+}
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return IsNearlyEqual(InA.X, InB.X) && IsNearlyEqual(InA.Y, InB.Y) && IsNearlyEqual(InA.Z, InB.Z);
+}
+
+static bool IsNearlyEqual(const FTransform4D& InA, const FTransform4D& InB)
+{
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		if (!IsNearlyEqual(InA.GetData()[Index], InB.GetData()[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Random inputs, stored both as an array of vectors and as component streams.
+struct FBatchInputs
+{
+	FBatchInputs()
+	{
+		std::mt19937 Engine(1234);
+		std::uniform_real_distribution<float> Distribution(-2.0f, 2.0f);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			FVector3D Vector(Distribution(Engine), Distribution(Engine), Distribution(Engine));
+			Vectors.Add(Vector);
+			X.Add(Vector.X);
+			Y.Add(Vector.Y);
+			Z.Add(Vector.Z);
+		}
+		Transform = FTransform4D::MakeTranslation(FVector3D(1.0f, -2.0f, 3.0f)) * FTransform4D::MakeRotation(0.7f, FVector3D(0.0f, 0.6f, 0.8f)) * FTransform4D::MakeScale(FVector3D(2.0f, 0.5f, 1.5f));
+	}
+
+	FVector3DStreams GetStreams()
+	{
+		return FVector3DStreams(X.GetData(), Y.GetData(), Z.GetData());
+	}
+
+	FVector3D GetStreamElement(int32 InIndex) const
+	{
+		return FVector3D(X[InIndex], Y[InIndex], Z[InIndex]);
+	}
+
+	FTransform4D Transform;
+	TArray<FVector3D> Vectors;
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+};
+
+TEST_CASE("FTransformBatch transforms points.")
+{
+	FBatchInputs Inputs;
+	const FTransform4D& Transform = Inputs.Transform;
+
+	SECTION("Array of vectors.")
+	{
+		FVector3D Results[NumBatchElements];
+		FTransformBatch::TransformPoints(Transform, Inputs.Vectors.GetData(), Results, NumBatchElements);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			FVector4D Expected = Transform * FVector4D(Inputs.Vectors[Index], 1.0f);
+			REQUIRE(IsNearlyEqual(Results[Index], FVector3D(Expected)));
+		}
+	}
+
+	SECTION("Component streams.")
+	{
+		float X[NumBatchElements], Y[NumBatchElements], Z[NumBatchElements];
+		FTransformBatch::TransformPoints(Transform, Inputs.GetStreams(), FVector3DStreams(X, Y, Z), NumBatchElements);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			FVector4D Expected = Transform * FVector4D(Inputs.GetStreamElement(Index), 1.0f);
+			REQUIRE(IsNearlyEqual(FVector3D(X[Index], Y[Index], Z[Index]), FVector3D(Expected)));
+		}
+	}
+
+	SECTION("In place.")
+	{
+		TArray<FVector3D> Points = Inputs.Vectors;
+		FTransformBatch::TransformPoints(Transform, Points.GetData(), Points.GetData(), NumBatchElements);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			FVector4D Expected = Transform * FVector4D(Inputs.Vectors[Index], 1.0f);
+			REQUIRE(IsNearlyEqual(Points[Index], FVector3D(Expected)));
+		}
+	}
+
+	SECTION("Split into ranges.")
+	{
+		float X[NumBatchElements], Y[NumBatchElements], Z[NumBatchElements];
+		FVector3DStreams Outputs(X, Y, Z);
+		FConstVector3DStreams Streams = Inputs.GetStreams();
+		FTransformBatch::TransformPoints(Transform, Streams, Outputs, 10);
+		FTransformBatch::TransformPoints(Transform, Streams + 10, Outputs + 10, NumBatchElements - 10);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			FVector4D Expected = Transform * FVector4D(Inputs.GetStreamElement(Index), 1.0f);
+			REQUIRE(IsNearlyEqual(FVector3D(X[Index], Y[Index], Z[Index]), FVector3D(Expected)));
+		}
+	}
+}
+
+TEST_CASE("FTransformBatch transforms vectors.")
+{
+	FBatchInputs Inputs;
+	const FTransform4D& Transform = Inputs.Transform;
+
+	SECTION("Array of vectors.")
+	{
+		FVector3D Results[NumBatchElements];
+		FTransformBatch::TransformVectors(Transform, Inputs.Vectors.GetData(), Results, NumBatchElements);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			REQUIRE(IsNearlyEqual(Results[Index], Transform * Inputs.Vectors[Index]));
+		}
+	}
+
+	SECTION("Component streams.")
+	{
+		float X[NumBatchElements], Y[NumBatchElements], Z[NumBatchElements];
+		FTransformBatch::TransformVectors(Transform, Inputs.GetStreams(), FVector3DStreams(X, Y, Z), NumBatchElements);
+		for (int32 Index = 0; Index < NumBatchElements; ++Index)
+		{
+			REQUIRE(IsNearlyEqual(FVector3D(X[Index], Y[Index], Z[Index]), Transform * Inputs.GetStreamElement(Index)));
+		}
+	}
+}
+
+TEST_CASE("FTransformBatch multiplies transforms.")
+{
+	FBatchInputs Inputs;
+	TArray<FTransform4D> Transforms;
+	for (int32 Index = 0; Index < NumBatchElements; ++Index)
+	{
+		Transforms.Add(FTransform4D::MakeTranslation(Inputs.Vectors[Index]) * FTransform4D::MakeRotationY(static_cast<float>(Index)));
+	}
+
+	FTransform4D Results[NumBatchElements];
+	FTransformBatch::MultiplyTransforms(Inputs.Transform, Transforms.GetData(), Results, NumBatchElements);
+	for (int32 Index = 0; Index < NumBatchElements; ++Index)
+	{
+		REQUIRE(IsNearlyEqual(Results[Index], Inputs.Transform * Transforms[Index]));
+	}
+}
+
+TEST_CASE("FTransformBatch composes transforms from components.")
+{
+	FBatchInputs Inputs;
+	TArray<float> Rotations[3];
+	TArray<float> Scales[3];
+	for (int32 Index = 0; Index < NumBatchElements; ++Index)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Rotations[Axis].Add(static_cast<float>(Index * 3 + Axis) * 0.37f);
+			Scales[Axis].Add(1.0f + static_cast<float>(Axis) * 0.5f + static_cast<float>(Index) * 0.01f);
+		}
+	}
+
+	FTransform4D Results[NumBatchElements];
+	FTransformBatch::ComposeTransforms(
+		Inputs.GetStreams(),
+		FConstVector3DStreams(Rotations[0].GetData(), Rotations[1].GetData(), Rotations[2].GetData()),
+		FConstVector3DStreams(Scales[0].GetData(), Scales[1].GetData(), Scales[2].GetData()),
+		Results,
+		NumBatchElements
+	);
+
+	// Same composition as FModel::GetWorldTransform.
+	for (int32 Index = 0; Index < NumBatchElements; ++Index)
+	{
+		FTransform4D T = FTransform4D::MakeTranslation(Inputs.GetStreamElement(Index));
+		FTransform4D RX = FTransform4D::MakeRotationX(Rotations[0][Index]);
+		FTransform4D RY = FTransform4D::MakeRotationY(Rotations[1][Index]);
+		FTransform4D RZ = FTransform4D::MakeRotationZ(Rotations[2][Index]);
+		FTransform4D S = FTransform4D::MakeScale(FVector3D(Scales[0][Index], Scales[1][Index], Scales[2][Index]));
+		REQUIRE(IsNearlyEqual(Results[Index], T * RZ * RY * RX * S));
+	}
+}
@@ -0,0 +1,109 @@
+#include "catch/catch.hpp"
+
+#include "Math/TransformTRS.h"
+#include "Math/Transform4D.h"
+#include "Math/Vector4D.h"
+#include "Math/MathUtilities.h"
+
+static constexpr float TRSTolerance = 1.e-4f;
+
+static bool IsNearlyEqual(const FVector3D& InA, const FVector3D& InB)
+{
+	return FMath::IsApproximatelyEqual(InA.X, InB.X, TRSTolerance)
+		&& FMath::IsApproximatelyEqual(InA.Y, InB.Y, TRSTolerance)
+		&& FMath::IsApproximatelyEqual(InA.Z, InB.Z, TRSTolerance);
+}
+
+static bool IsNearlyEqual(const FTransform4D& InA, const FTransform4D& InB)
+{
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		if (!FMath::IsApproximatelyEqual(InA.GetData()[Index], InB.GetData()[Index], TRSTolerance))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static FVector3D TransformPoint(const FTransform4D& InTransform, const FVector3D& InPoint)
+{
+	return FVector3D(InTransform * FVector4D(InPoint, 1.0f));
+}
+
+TEST_CASE("FTransformTRS default constructor is the identity.")
+{
+	FTransformTRS Transform;
+	REQUIRE(Transform == FTransformTRS::Identity);
+	REQUIRE(Transform.ToTransform() == FTransform4D::Identity);
+}
+
+TEST_CASE("FTransformTRS matches the equivalent FTransform4D.")
+{
+	FVector3D Translation(1.0f, -2.0f, 3.0f);
+	FVector3D Rotation(0.4f, 0.7f, -1.1f);
+	FVector3D Scale(2.0f, 0.5f, 1.5f);
+	FTransformTRS Transform(Translation, FQuat::MakeFromEuler(Rotation), Scale);
+
+	// Same composition as the Euler-angle transform models used to build.
+	FTransform4D Expected = FTransform4D::MakeTranslation(Translation)
+		* FTransform4D::MakeRotationZ(Rotation.Z)
+		* FTransform4D::MakeRotationY(Rotation.Y)
+		* FTransform4D::MakeRotationX(Rotation.X)
+		* FTransform4D::MakeScale(Scale);
+
+	REQUIRE(IsNearlyEqual(Transform.ToTransform(), Expected));
+
+	FVector3D Point(0.5f, 1.5f, -2.5f);
+	REQUIRE(IsNearlyEqual(Transform.TransformPoint(Point), TransformPoint(Expected, Point)));
+	REQUIRE(IsNearlyEqual(Transform.TransformVector(Point), Expected * Point));
+	REQUIRE(IsNearlyEqual(Transform.InverseTransformPoint(Transform.TransformPoint(Point)), Point));
+}
+
+TEST_CASE("FTransformTRS composition.")
+{
+	FTransformTRS Parent(FVector3D(1.0f, 2.0f, 3.0f), FQuat::MakeFromEuler(FVector3D(0.3f, -0.2f, 1.0f)), FVector3D(2.0f, 2.0f, 2.0f));
+	FTransformTRS Child(FVector3D(-1.0f, 0.5f, 4.0f), FQuat::MakeFromEuler(FVector3D(1.2f, 0.4f, -0.7f)), FVector3D(1.0f, 3.0f, 0.5f));
+
+	// Exact because the parent's scale is uniform.
+	FTransformTRS Composed = Parent * Child;
+	REQUIRE(IsNearlyEqual(Composed.ToTransform(), Parent.ToTransform() * Child.ToTransform()));
+
+	FTransformTRS Accumulated = Parent;
+	Accumulated *= Child;
+	REQUIRE(Accumulated == Composed);
+}
+
+TEST_CASE("FTransformTRS inverse.")
+{
+	FTransformTRS Transform(FVector3D(1.0f, 2.0f, 3.0f), FQuat::MakeFromEuler(FVector3D(0.3f, -0.2f, 1.0f)), FVector3D(4.0f, 4.0f, 4.0f));
+	FTransformTRS Inverse = Transform.GetInverted();
+
+	REQUIRE(IsNearlyEqual(Inverse.ToTransform(), Transform.ToTransform().GetInverted()));
+	REQUIRE(IsNearlyEqual((Transform * Inverse).ToTransform(), FTransform4D::Identity));
+
+	FTransformTRS Inverted = Transform;
+	Inverted.Invert();
+	REQUIRE(Inverted == Inverse);
+
+	SECTION("Non-uniform scale without rotation is exact.")
+	{
+		FTransformTRS Scaled(FVector3D(1.0f, 2.0f, 3.0f), FQuat::Identity, FVector3D(2.0f, 0.5f, 4.0f));
+		REQUIRE(IsNearlyEqual(Scaled.GetInverted().ToTransform(), Scaled.ToTransform().GetInverted()));
+	}
+}
+
+TEST_CASE("FTransformTRS interpolation.")
+{
+	FVector3D Axis = FVector3D::ZAxis;
+	FTransformTRS Start(FVector3D(0.0f, 0.0f, 0.0f), FQuat::MakeFromAxisAngle(Axis, 0.0f), FVector3D(1.0f, 1.0f, 1.0f));
+	FTransformTRS End(FVector3D(4.0f, -2.0f, 8.0f), FQuat::MakeFromAxisAngle(Axis, 2.0f), FVector3D(3.0f, 1.0f, 5.0f));
+
+	REQUIRE(FTransformTRS::Interpolate(Start, End, 0.0f) == Start);
+	REQUIRE(FTransformTRS::Interpolate(Start, End, 1.0f).ToTransform() == End.ToTransform());
+
+	FTransformTRS Middle = FTransformTRS::Interpolate(Start, End, 0.5f);
+	REQUIRE(IsNearlyEqual(Middle.Translation, FVector3D(2.0f, -1.0f, 4.0f)));
+	REQUIRE(IsNearlyEqual(Middle.Scale, FVector3D(2.0f, 1.0f, 3.0f)));
+	REQUIRE(IsNearlyEqual(Middle.TransformVector(FVector3D::XAxis), FVector3D(FMath::Cos(1.0f), FMath::Sin(1.0f), 0.0f) * 2.0f));
+}
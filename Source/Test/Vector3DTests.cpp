@@ -287,3 +287,16 @@ TEST_CASE("FVector3D::operator!=")
 	FVector3D Vector2 = { 2.0f, 3.0f, 4.0f };
 	REQUIRE(Vector1 != Vector2);
 }
+
+// Compile-time evaluation
+TEST_CASE("FVector3D compile-time evaluation.")
+{
+	constexpr FVector3D Vector = FVector3D::CrossProduct(FVector3D::XAxis, FVector3D::YAxis) * 2.0f + FVector3D::One;
+	static_assert(Vector.X == 1.0f && Vector.Y == 1.0f && Vector.Z == 3.0f, "FVector3D math should be usable in constant expressions.");
+	static_assert(FVector3D::DotProduct(Vector, -FVector3D::ZAxis) == -3.0f, "FVector3D::DotProduct should be usable in constant expressions.");
+
+	// Tables of vectors can be computed without any startup cost.
+	constexpr FVector3D Corners[] = { -FVector3D::One, FVector3D::One / 2.0f };
+	static_assert(Corners[0].X == -1.0f && Corners[1].Z == 0.5f, "Arrays of FVector3D should be usable in constant expressions.");
+	REQUIRE(Corners[1] == FVector3D(0.5f, 0.5f, 0.5f));
+}
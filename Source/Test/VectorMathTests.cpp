@@ -0,0 +1,292 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/VectorMath.h"
+#include "Math/MathUtilities.h"
+
+#include <cmath>
+#include <cstring>
+
+static constexpr int32 NumAccuracySamples = 100000;
+
+// Maps a float to an integer so that adjacent floats map to adjacent integers (with +0 and -0 both at zero).
+static int64 ToOrderedInt(float InValue)
+{
+	int32 Bits;
+	std::memcpy(&Bits, &InValue, sizeof(Bits));
+	return Bits < 0 ? -static_cast<int64>(Bits & 0x7FFFFFFF) : static_cast<int64>(Bits);
+}
+
+// Number of representable floats between the two values.
+static int64 UlpDistance(float InA, float InB)
+{
+	int64 Distance = ToOrderedInt(InA) - ToOrderedInt(InB);
+	return Distance < 0 ? -Distance : Distance;
+}
+
+// Evenly spaced samples in [InMin, InMax], or logarithmically spaced if bLogarithmic is set (InMin must then be positive).
+static float GetSample(float InMin, float InMax, int32 InIndex, int32 InCount, bool bLogarithmic = false)
+{
+	double Alpha = static_cast<double>(InIndex) / (InCount - 1);
+	if (bLogarithmic)
+	{
+		return static_cast<float>(std::exp(std::log(InMin) + (std::log(InMax) - std::log(InMin)) * Alpha));
+	}
+	return static_cast<float>(InMin + (InMax - InMin) * Alpha);
+}
+
+/**
+ * Error of an approximation over a set of samples, in ULP. Results whose correct value is smaller than
+ * InSmallMagnitude are measured by absolute error instead, for functions like sin whose relative error is
+ * meaningless near their zeros.
+ */
+struct FErrorMeasurement
+{
+	explicit FErrorMeasurement(double InSmallMagnitude = 0.0)
+		: SmallMagnitude(InSmallMagnitude)
+	{
+	}
+
+	void Add(float InApproximation, double InReference)
+	{
+		if (std::fabs(InReference) < SmallMagnitude)
+		{
+			MaxAbsoluteError = FMath::Max(MaxAbsoluteError, std::fabs(InApproximation - InReference));
+		}
+		else
+		{
+			MaxUlp = FMath::Max(MaxUlp, UlpDistance(InApproximation, static_cast<float>(InReference)));
+		}
+	}
+
+	double SmallMagnitude;
+	int64 MaxUlp = 0;
+	double MaxAbsoluteError = 0.0;
+};
+
+/**
+ * Runs a unary vector function over the samples with 4-wide and 8-wide registers, and returns the larger error
+ * of the two.
+ */
+template<typename VectorFunctionType>
+static FErrorMeasurement MeasureUnary(const float* InSamples, const double* InReference, VectorFunctionType InVectorFunction, double InSmallMagnitude = 0.0)
+{
+	FErrorMeasurement Error(InSmallMagnitude);
+	for (int32 Index = 0; Index + VectorRegister8Lanes <= NumAccuracySamples; Index += VectorRegister8Lanes)
+	{
+		float Results[VectorRegister8Lanes];
+		VectorStore(InVectorFunction(VectorLoad(InSamples + Index)), Results);
+		VectorStore(InVectorFunction(VectorLoad(InSamples + Index + 4)), Results + 4);
+		for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+		{
+			Error.Add(Results[Lane], InReference[Index + Lane]);
+		}
+
+		Vector8Store(InVectorFunction(Vector8Load(InSamples + Index)), Results);
+		for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+		{
+			Error.Add(Results[Lane], InReference[Index + Lane]);
+		}
+	}
+	return Error;
+}
+
+// Holds the inputs of an accuracy test along with the correctly rounded results.
+struct FAccuracySamples
+{
+	FAccuracySamples()
+		: X(new float[NumAccuracySamples])
+		, Reference(new double[NumAccuracySamples])
+	{
+	}
+
+	~FAccuracySamples()
+	{
+		delete[] X;
+		delete[] Reference;
+	}
+
+	float* X;
+	double* Reference;
+};
+
+TEST_CASE("Vectorized sin and cos accuracy.")
+{
+	FAccuracySamples Samples;
+	for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+	{
+		Samples.X[Index] = GetSample(-8192.0f, 8192.0f, Index, NumAccuracySamples);
+	}
+
+	SECTION("Sin")
+	{
+		for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+		{
+			Samples.Reference[Index] = std::sin(static_cast<double>(Samples.X[Index]));
+		}
+		auto VectorFunction = [](auto InX) { return VectorSin(InX); };
+		FErrorMeasurement Error = MeasureUnary(Samples.X, Samples.Reference, VectorFunction, 1.e-3);
+		REQUIRE(Error.MaxUlp <= 2);
+		REQUIRE(Error.MaxAbsoluteError <= 1.e-10);
+	}
+
+	SECTION("Cos")
+	{
+		for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+		{
+			Samples.Reference[Index] = std::cos(static_cast<double>(Samples.X[Index]));
+		}
+		auto VectorFunction = [](auto InX) { return VectorCos(InX); };
+		FErrorMeasurement Error = MeasureUnary(Samples.X, Samples.Reference, VectorFunction, 1.e-3);
+		REQUIRE(Error.MaxUlp <= 2);
+		REQUIRE(Error.MaxAbsoluteError <= 1.e-10);
+	}
+
+	SECTION("SinCos matches Sin and Cos")
+	{
+		for (int32 Index = 0; Index < NumAccuracySamples; Index += 997)
+		{
+			FVectorRegister4 Angle = VectorSplat(Samples.X[Index]);
+			FVectorRegister4 Sin, Cos;
+			VectorSinCos(Angle, Sin, Cos);
+			REQUIRE(VectorGetComponent(Sin, 0) == VectorGetComponent(VectorSin(Angle), 0));
+			REQUIRE(VectorGetComponent(Cos, 0) == VectorGetComponent(VectorCos(Angle), 0));
+		}
+	}
+
+	SECTION("Exact values")
+	{
+		REQUIRE(VectorGetComponent(VectorSin(VectorSplat(0.0f)), 0) == 0.0f);
+		REQUIRE(VectorGetComponent(VectorCos(VectorSplat(0.0f)), 0) == 1.0f);
+		REQUIRE(VectorGetComponent(VectorSin(VectorSplat(FMath::PiOverTwo)), 0) == 1.0f);
+		REQUIRE(FMath::IsApproximatelyEqual(VectorGetComponent(VectorSin(VectorSplat(-FMath::PiOverFour)), 0), -0.70710678f));
+	}
+}
+
+TEST_CASE("Vectorized atan2 accuracy.")
+{
+	// A grid of points in all four quadrants, including the axes.
+	static constexpr int32 GridSize = 321;
+	FErrorMeasurement Error;
+	for (int32 Row = 0; Row < GridSize; ++Row)
+	{
+		float Y[GridSize];
+		float X[GridSize];
+		for (int32 Column = 0; Column < GridSize; ++Column)
+		{
+			Y[Column] = GetSample(-100.0f, 100.0f, Row, GridSize);
+			X[Column] = GetSample(-100.0f, 100.0f, Column, GridSize);
+		}
+
+		for (int32 Column = 0; Column + VectorRegister8Lanes <= GridSize; Column += VectorRegister8Lanes)
+		{
+			float Results[VectorRegister8Lanes];
+			VectorStore(VectorAtan2(VectorLoad(Y + Column), VectorLoad(X + Column)), Results);
+			VectorStore(VectorAtan2(VectorLoad(Y + Column + 4), VectorLoad(X + Column + 4)), Results + 4);
+			for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+			{
+				Error.Add(Results[Lane], std::atan2(static_cast<double>(Y[Column + Lane]), static_cast<double>(X[Column + Lane])));
+			}
+
+			Vector8Store(VectorAtan2(Vector8Load(Y + Column), Vector8Load(X + Column)), Results);
+			for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+			{
+				Error.Add(Results[Lane], std::atan2(static_cast<double>(Y[Column + Lane]), static_cast<double>(X[Column + Lane])));
+			}
+		}
+
+		for (int32 Column = 0; Column < GridSize; ++Column)
+		{
+			Error.Add(FMath::FastAtan2(Y[Column], X[Column]), std::atan2(static_cast<double>(Y[Column]), static_cast<double>(X[Column])));
+		}
+	}
+	REQUIRE(Error.MaxUlp <= 3);
+
+	const float Pi = FMath::Pi;
+	const float PiOverTwo = FMath::PiOverTwo;
+	REQUIRE(FMath::FastAtan2(0.0f, 0.0f) == 0.0f);
+	REQUIRE(FMath::FastAtan2(1.0f, 0.0f) == PiOverTwo);
+	REQUIRE(FMath::FastAtan2(-1.0f, 0.0f) == -PiOverTwo);
+	REQUIRE(FMath::FastAtan2(0.0f, -1.0f) == Pi);
+}
+
+TEST_CASE("Vectorized exp and log accuracy.")
+{
+	FAccuracySamples Samples;
+
+	SECTION("Exp")
+	{
+		for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+		{
+			Samples.X[Index] = GetSample(-87.0f, 88.0f, Index, NumAccuracySamples);
+			Samples.Reference[Index] = std::exp(static_cast<double>(Samples.X[Index]));
+		}
+		auto VectorFunction = [](auto InX) { return VectorExp(InX); };
+		REQUIRE(MeasureUnary(Samples.X, Samples.Reference, VectorFunction).MaxUlp <= 2);
+		REQUIRE(VectorGetComponent(VectorExp(VectorSplat(0.0f)), 0) == 1.0f);
+	}
+
+	SECTION("Log")
+	{
+		for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+		{
+			Samples.X[Index] = GetSample(1.e-30f, 1.e30f, Index, NumAccuracySamples, true);
+			Samples.Reference[Index] = std::log(static_cast<double>(Samples.X[Index]));
+		}
+		auto VectorFunction = [](auto InX) { return VectorLog(InX); };
+		REQUIRE(MeasureUnary(Samples.X, Samples.Reference, VectorFunction).MaxUlp <= 2);
+
+		REQUIRE(VectorGetComponent(VectorLog(VectorSplat(1.0f)), 0) == 0.0f);
+		REQUIRE(std::isinf(VectorGetComponent(VectorLog(VectorSplat(0.0f)), 0)));
+		REQUIRE(VectorGetComponent(VectorLog(VectorSplat(0.0f)), 0) < 0.0f);
+		REQUIRE(std::isnan(VectorGetComponent(VectorLog(VectorSplat(-1.0f)), 0)));
+	}
+}
+
+TEST_CASE("Vectorized pow accuracy.")
+{
+	FErrorMeasurement Error;
+	static constexpr int32 NumBases = 400;
+	static constexpr int32 NumExponents = 248;
+	for (int32 BaseIndex = 0; BaseIndex < NumBases; ++BaseIndex)
+	{
+		float Base = GetSample(0.1f, 10.0f, BaseIndex, NumBases, true);
+		float Exponents[NumExponents];
+		for (int32 Index = 0; Index < NumExponents; ++Index)
+		{
+			Exponents[Index] = GetSample(-4.0f, 4.0f, Index, NumExponents);
+		}
+
+		for (int32 Index = 0; Index + VectorRegister8Lanes <= NumExponents; Index += VectorRegister8Lanes)
+		{
+			float Results[VectorRegister8Lanes];
+			VectorStore(VectorPow(VectorSplat(Base), VectorLoad(Exponents + Index)), Results);
+			VectorStore(VectorPow(VectorSplat(Base), VectorLoad(Exponents + Index + 4)), Results + 4);
+			for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+			{
+				Error.Add(Results[Lane], std::pow(static_cast<double>(Base), static_cast<double>(Exponents[Index + Lane])));
+			}
+
+			Vector8Store(VectorPow(Vector8Splat(Base), Vector8Load(Exponents + Index)), Results);
+			for (int32 Lane = 0; Lane < VectorRegister8Lanes; ++Lane)
+			{
+				Error.Add(Results[Lane], std::pow(static_cast<double>(Base), static_cast<double>(Exponents[Index + Lane])));
+			}
+		}
+	}
+	REQUIRE(Error.MaxUlp <= 16);
+
+	REQUIRE(VectorGetComponent(VectorPow(VectorSplat(0.0f), VectorSplat(2.0f)), 0) == 0.0f);
+	REQUIRE(VectorGetComponent(VectorPow(VectorSplat(2.0f), VectorSplat(0.0f)), 0) == 1.0f);
+}
+
+TEST_CASE("Vectorized reciprocal square root accuracy.")
+{
+	FAccuracySamples Samples;
+	for (int32 Index = 0; Index < NumAccuracySamples; ++Index)
+	{
+		Samples.X[Index] = GetSample(1.e-30f, 1.e30f, Index, NumAccuracySamples, true);
+		Samples.Reference[Index] = 1.0 / std::sqrt(static_cast<double>(Samples.X[Index]));
+	}
+	auto VectorFunction = [](auto InX) { return VectorReciprocalSqrtFast(InX); };
+	REQUIRE(MeasureUnary(Samples.X, Samples.Reference, VectorFunction).MaxUlp <= 4);
+}
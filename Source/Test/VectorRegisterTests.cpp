@@ -0,0 +1,151 @@
+#include "catch/catch.hpp"
+
+#include "Math/Simd/VectorRegister.h"
+#include "Math/Simd/VectorRegister8.h"
+#include "Math/MathUtilities.h"
+
+// Stores a register into an array so that its lanes can be inspected.
+struct FLanes
+{
+	explicit FLanes(FVectorRegister4 InVector)
+	{
+		VectorStore(InVector, Values);
+	}
+
+	float Values[4];
+};
+
+static bool LanesEqual(FVectorRegister4 InVector, float InX, float InY, float InZ, float InW)
+{
+	FLanes Lanes(InVector);
+	return Lanes.Values[0] == InX && Lanes.Values[1] == InY && Lanes.Values[2] == InZ && Lanes.Values[3] == InW;
+}
+
+TEST_CASE("FVectorRegister4 creation.")
+{
+	REQUIRE(LanesEqual(VectorZero(), 0, 0, 0, 0));
+	REQUIRE(LanesEqual(VectorSet(1, 2, 3, 4), 1, 2, 3, 4));
+	REQUIRE(LanesEqual(VectorSplat(5), 5, 5, 5, 5));
+
+	float Values[4] = { 1, 2, 3, 4 };
+	REQUIRE(LanesEqual(VectorLoad(Values), 1, 2, 3, 4));
+	REQUIRE(LanesEqual(VectorLoad3(Values), 1, 2, 3, 0));
+
+	// VectorStore3 leaves the fourth float untouched.
+	float Output[4] = { 0, 0, 0, 9 };
+	VectorStore3(VectorSet(1, 2, 3, 4), Output);
+	REQUIRE(Output[0] == 1);
+	REQUIRE(Output[1] == 2);
+	REQUIRE(Output[2] == 3);
+	REQUIRE(Output[3] == 9);
+}
+
+TEST_CASE("FVectorRegister4 swizzles.")
+{
+	FVectorRegister4 A = VectorSet(1, 2, 3, 4);
+	FVectorRegister4 B = VectorSet(5, 6, 7, 8);
+	REQUIRE(LanesEqual(VectorReplicate<2>(A), 3, 3, 3, 3));
+	REQUIRE(LanesEqual(VectorSwizzle<3, 2, 1, 0>(A), 4, 3, 2, 1));
+	REQUIRE(LanesEqual(VectorShuffle<0, 1, 2, 3>(A, B), 1, 2, 7, 8));
+	REQUIRE(VectorGetComponent(A, 1) == 2);
+}
+
+TEST_CASE("FVectorRegister4 arithmetic.")
+{
+	FVectorRegister4 A = VectorSet(1, -2, 3, -4);
+	FVectorRegister4 B = VectorSet(2, 2, 2, 2);
+	REQUIRE(LanesEqual(VectorAdd(A, B), 3, 0, 5, -2));
+	REQUIRE(LanesEqual(VectorSubtract(A, B), -1, -4, 1, -6));
+	REQUIRE(LanesEqual(VectorMultiply(A, B), 2, -4, 6, -8));
+	REQUIRE(LanesEqual(VectorDivide(A, B), 0.5f, -1, 1.5f, -2));
+	REQUIRE(LanesEqual(VectorMultiplyAdd(A, B, B), 4, -2, 8, -6));
+	REQUIRE(LanesEqual(VectorNegate(A), -1, 2, -3, 4));
+	REQUIRE(LanesEqual(VectorAbs(A), 1, 2, 3, 4));
+	REQUIRE(LanesEqual(VectorMin(A, B), 1, -2, 2, -4));
+	REQUIRE(LanesEqual(VectorMax(A, B), 2, 2, 3, 2));
+	REQUIRE(LanesEqual(VectorSqrt(VectorSet(4, 9, 16, 25)), 2, 3, 4, 5));
+	REQUIRE(LanesEqual(VectorReciprocal(VectorSet(1, 2, 4, 8)), 1, 0.5f, 0.25f, 0.125f));
+	REQUIRE(LanesEqual(VectorReciprocalSqrt(VectorSet(1, 4, 16, 64)), 1, 0.5f, 0.25f, 0.125f));
+}
+
+TEST_CASE("FVectorRegister4 comparisons.")
+{
+	FVectorRegister4 A = VectorSet(1, 2, 3, 4);
+	FVectorRegister4 B = VectorSet(4, 2, 2, 4);
+	REQUIRE(VectorMaskBits(VectorCompareEQ(A, B)) == 0xA);
+	REQUIRE(VectorMaskBits(VectorCompareNE(A, B)) == 0x5);
+	REQUIRE(VectorMaskBits(VectorCompareGT(A, B)) == 0x4);
+	REQUIRE(VectorMaskBits(VectorCompareGE(A, B)) == 0xE);
+	REQUIRE(VectorMaskBits(VectorCompareLT(A, B)) == 0x1);
+	REQUIRE(VectorMaskBits(VectorCompareLE(A, B)) == 0xB);
+	REQUIRE(LanesEqual(VectorSelect(VectorCompareGT(A, B), A, B), 4, 2, 3, 4));
+	REQUIRE(VectorAnyTrue(VectorCompareGT(A, B)));
+	REQUIRE(!VectorAllTrue(VectorCompareGT(A, B)));
+}
+
+TEST_CASE("FVectorRegister4 geometric functions.")
+{
+	FVectorRegister4 X = VectorSet(1, 0, 0, 0);
+	FVectorRegister4 Y = VectorSet(0, 1, 0, 0);
+	REQUIRE(LanesEqual(VectorCross(X, Y), 0, 0, 1, 0));
+	REQUIRE(LanesEqual(VectorDot3(VectorSet(1, 2, 3, 100), VectorSet(4, 5, 6, 100)), 32, 32, 32, 32));
+	REQUIRE(LanesEqual(VectorDot4(VectorSet(1, 2, 3, 4), VectorSet(5, 6, 7, 8)), 70, 70, 70, 70));
+
+	FVectorRegister4 Row0 = VectorSet(0, 1, 2, 3);
+	FVectorRegister4 Row1 = VectorSet(4, 5, 6, 7);
+	FVectorRegister4 Row2 = VectorSet(8, 9, 10, 11);
+	FVectorRegister4 Row3 = VectorSet(12, 13, 14, 15);
+	VectorTranspose4x4(Row0, Row1, Row2, Row3);
+	REQUIRE(LanesEqual(Row0, 0, 4, 8, 12));
+	REQUIRE(LanesEqual(Row1, 1, 5, 9, 13));
+	REQUIRE(LanesEqual(Row2, 2, 6, 10, 14));
+	REQUIRE(LanesEqual(Row3, 3, 7, 11, 15));
+}
+
+TEST_CASE("FVectorRegister4 rounding and integer lanes.")
+{
+	// Halfway cases round to even.
+	REQUIRE(LanesEqual(VectorRound(VectorSet(1.4f, -1.6f, 2.5f, -0.5f)), 1, -2, 2, -0.0f));
+
+	int32 Lanes[4];
+	VectorStore(VectorFloatToInt(VectorSet(1, -2, 3, 100)), reinterpret_cast<float*>(Lanes));
+	REQUIRE(Lanes[0] == 1);
+	REQUIRE(Lanes[1] == -2);
+	REQUIRE(Lanes[3] == 100);
+
+	FVectorRegister4 Integers = VectorIntAdd(VectorFloatToInt(VectorSet(1, 2, 3, 4)), VectorSplatInt(10));
+	REQUIRE(LanesEqual(VectorIntToFloat(Integers), 11, 12, 13, 14));
+	REQUIRE(LanesEqual(VectorIntToFloat(VectorIntSubtract(Integers, VectorSplatInt(1))), 10, 11, 12, 13));
+	REQUIRE(LanesEqual(VectorIntToFloat(VectorIntShiftLeft<2>(Integers)), 44, 48, 52, 56));
+	REQUIRE(VectorMaskBits(VectorIntCompareEQ(Integers, VectorFloatToInt(VectorSet(11, 0, 13, 0)))) == 0x5);
+
+	// The shift is logical, so the sign bit isn't replicated.
+	VectorStore(VectorIntShiftRight<28>(VectorSplatInt(-1)), reinterpret_cast<float*>(Lanes));
+	REQUIRE(Lanes[0] == 0xF);
+
+	// 1 / sqrt(4) to within the estimate's precision.
+	REQUIRE(FMath::IsApproximatelyEqual(VectorGetComponent(VectorReciprocalSqrtEstimate(VectorSplat(4)), 0), 0.5f, 1.e-3f));
+}
+
+TEST_CASE("FVectorRegister8 element-wise operations.")
+{
+	float A[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	float B[8] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+	FVectorRegister8 VectorA = Vector8Load(A);
+	FVectorRegister8 VectorB = Vector8Load(B);
+
+	float Result[8];
+	Vector8Store(VectorMultiplyAdd(VectorA, VectorB, Vector8Splat(1)), Result);
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		REQUIRE(Result[Index] == A[Index] * B[Index] + 1);
+	}
+
+	REQUIRE(VectorMaskBits(VectorCompareGT(VectorA, VectorB)) == 0xF0);
+
+	Vector8Store(VectorSelect(VectorCompareGT(VectorA, VectorB), VectorA, VectorB), Result);
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		REQUIRE(Result[Index] == (A[Index] > B[Index] ? A[Index] : B[Index]));
+	}
+}
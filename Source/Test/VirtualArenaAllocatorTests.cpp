@@ -0,0 +1,104 @@
+#include "catch/catch.hpp"
+
+#include "Memory/VirtualArenaAllocator.h"
+#include "HAL/PlatformMemory.h"
+
+#include <cstring>
+
+TEST_CASE("FVirtualArenaAllocator")
+{
+	// Reserving costs no memory, so tests can reserve far more than they use.
+	const uint64 ReserveSize = 64ull * 1024 * 1024 * 1024;
+	FVirtualArenaAllocator TestAllocator(ReserveSize);
+
+	REQUIRE(TestAllocator.IsValid());
+	REQUIRE(TestAllocator.GetCapacity() >= ReserveSize);
+	REQUIRE(TestAllocator.GetNumBytesCommitted() == 0);
+
+	SECTION("Cannot allocate 0 bytes")
+	{
+		REQUIRE(TestAllocator.Allocate(0) == nullptr);
+		REQUIRE(TestAllocator.Allocate64(0) == nullptr);
+	}
+
+	SECTION("Memory is committed as allocations reach it")
+	{
+		int8* First = static_cast<int8*>(TestAllocator.Allocate(100));
+		REQUIRE(First != nullptr);
+		uint64 NumBytesCommitted = TestAllocator.GetNumBytesCommitted();
+		REQUIRE(NumBytesCommitted >= 100);
+
+		// Fill the committed range, then allocate past it.
+		std::memset(First, 1, NumBytesCommitted);
+		int8* Second = static_cast<int8*>(TestAllocator.Allocate64(NumBytesCommitted));
+		REQUIRE(Second == First + 104);
+		REQUIRE(TestAllocator.GetNumBytesCommitted() > NumBytesCommitted);
+		std::memset(Second, 2, NumBytesCommitted);
+		REQUIRE(First[0] == 1);
+		REQUIRE(Second[NumBytesCommitted - 1] == 2);
+	}
+
+	SECTION("Allocations are aligned")
+	{
+		void* MemoryStart = TestAllocator.Allocate(1);
+		REQUIRE(reinterpret_cast<uint64>(MemoryStart) % 8 == 0);
+		REQUIRE(TestAllocator.Allocate(1) == (int8*)MemoryStart + 8);
+		REQUIRE(TestAllocator.Allocate(1, EMemoryAlignment::Two) == (int8*)MemoryStart + 10);
+	}
+
+	SECTION("Allocations larger than 2 GB of address space can be made")
+	{
+		const uint64 LargeSize = 3ull * 1024 * 1024 * 1024;
+		int8* Large = static_cast<int8*>(TestAllocator.Allocate64(LargeSize));
+		REQUIRE(Large != nullptr);
+		REQUIRE(TestAllocator.GetNumBytesUsed() == LargeSize);
+
+		// Touch only the ends, so that the pages between them stay untouched.
+		Large[0] = 1;
+		Large[LargeSize - 1] = 1;
+	}
+
+	SECTION("Cannot allocate beyond the reservation")
+	{
+		REQUIRE(TestAllocator.Allocate64(TestAllocator.GetCapacity() + 1) == nullptr);
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 0);
+	}
+
+	SECTION("Rewinding keeps memory committed")
+	{
+		TestAllocator.Allocate(8);
+		{
+			FScopedVirtualArenaMark Mark(TestAllocator);
+			TestAllocator.Allocate(1024 * 1024);
+		}
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 8);
+		REQUIRE(TestAllocator.GetNumBytesCommitted() >= 1024 * 1024);
+		REQUIRE(TestAllocator.GetHighWaterMark() == 8 + 1024 * 1024);
+	}
+
+	SECTION("Reset decommits memory")
+	{
+		int8* First = static_cast<int8*>(TestAllocator.Allocate(1024 * 1024));
+		First[0] = 1;
+		TestAllocator.Reset();
+		REQUIRE(TestAllocator.GetNumBytesUsed() == 0);
+		REQUIRE(TestAllocator.GetNumBytesCommitted() == 0);
+
+		// Memory committed again is zero-filled.
+		int8* Again = static_cast<int8*>(TestAllocator.Allocate(1024 * 1024));
+		REQUIRE(Again == First);
+		REQUIRE(Again[0] == 0);
+	}
+}
+
+TEST_CASE("FVirtualArenaAllocator with huge pages")
+{
+	FVirtualArenaAllocator TestAllocator(1024 * 1024 * 1024, true);
+	REQUIRE(TestAllocator.IsValid());
+
+	// Memory is committed in whole huge pages, starting at a huge page boundary.
+	int8* First = static_cast<int8*>(TestAllocator.Allocate(16));
+	REQUIRE(reinterpret_cast<uint64>(First) % FPlatformMemory::GetHugePageSize() == 0);
+	REQUIRE(TestAllocator.GetNumBytesCommitted() == FPlatformMemory::GetHugePageSize());
+	First[0] = 1;
+}